@@ -59,6 +59,16 @@ class _ae_config_t(Structure):
         ("preload_hrtf", c_bool),
         ("preload_all_presets", c_bool),
         ("max_reverb_time_sec", c_size_t),
+        ("reverb_rate", c_int),
+        ("early_reflection_taps", c_uint32),
+        ("diffuser", c_int),
+        ("delay_storage", c_int),
+        ("hrtf_cache_dir", c_char_p),
+        ("hrir_max_taps", c_uint32),
+        ("hrtf_db", c_void_p),
+        ("listener_count", c_uint32),
+        ("noise_seed", c_uint32),
+        ("binaural", c_int),
     ]
 
 class _ae_main_params_t(Structure):
@@ -47,6 +47,25 @@ public struct AeConfig
     [MarshalAs(UnmanagedType.I1)] public bool preloadHrtf;
     [MarshalAs(UnmanagedType.I1)] public bool preloadAllPresets;
     public UIntPtr maxReverbTimeSec;
+    public int reverbRate;
+    public uint earlyReflectionTaps;
+    public int diffuser;
+    public int delayStorage;
+    public IntPtr hrtfCacheDir;
+    public uint hrirMaxTaps;
+    public IntPtr hrtfDb;
+    public uint listenerCount;
+    public uint noiseSeed;
+    public int binaural; // AeBinauralModel
+}
+
+// Mirrors ae_binaural_model_t
+public enum AeBinauralModel
+{
+    Auto = 0,        // hrtfPath if set, otherwise Parametric
+    Parametric = 1,  // ITD/ILD and head shadow, no HRIR set
+    BuiltinHrtf = 2, // Built-in HRIR set, hrtfPath ignored
+    HrtfFile = 3     // hrtfPath, built-in set if it fails
 }
 
 [StructLayout(LayoutKind.Sequential)]
@@ -146,6 +146,43 @@ typedef struct {
   float alpha_high;        /* High frequency absorption */
 } ae_cave_params_t;
 
+/*============================================================================
+ * Room geometry (image-source early reflections)
+ *============================================================================*/
+#define AE_ROOM_MAX_PLANES 16
+#define AE_IMAGE_SOURCE_MAX_ORDER 4
+
+/* Wall plane; points p inside the room satisfy dot(normal, p) >= distance */
+typedef struct {
+  float normal[3];  /* Unit normal pointing into the room */
+  float distance;   /* Plane offset along the normal (m) */
+  float absorption; /* Energy absorption 0-1 (< 0: rock wall at 1 kHz) */
+  float area_m2;    /* Wall area for the Eyring estimate (0 = unknown) */
+} ae_room_plane_t;
+
+/* Convex room (shoebox or simple polyhedron) */
+typedef struct {
+  ae_room_plane_t planes[AE_ROOM_MAX_PLANES];
+  uint32_t plane_count; /* 4 - AE_ROOM_MAX_PLANES */
+  float volume_m3;      /* For the Eyring estimate (0 = unknown) */
+} ae_room_geometry_t;
+
+typedef struct {
+  float source[3];        /* Source position (m) */
+  float listener[3];      /* Listener position (m) */
+  float listener_yaw_deg; /* 0 = facing +y, positive turns toward +x */
+  uint32_t max_order;     /* Reflection order 1 - AE_IMAGE_SOURCE_MAX_ORDER */
+  float temperature_c;    /* Air temperature (speed of sound) */
+  bool apply_rt60;        /* Also set decay_time from the Eyring RT60 */
+} ae_image_source_params_t;
+
+typedef struct {
+  float delay_ms; /* Arrival after the direct sound */
+  float gain;     /* Pressure gain relative to the direct sound */
+  float pan;      /* -1 (left) to 1 (right) */
+  uint32_t order; /* Number of wall bounces */
+} ae_reflection_t;
+
 /*============================================================================
  * Binaural parameters
  *============================================================================*/
@@ -162,6 +199,121 @@ typedef struct {
   float pan;      /* Pan (-1 to 1) */
 } ae_precedence_t;
 
+/* Binaural FIR convolver: mono in, one filter per ear, zero latency */
+typedef struct ae_convolver ae_convolver_t;
+
+typedef struct {
+  uint32_t max_taps;          /* Longest filter set_filters takes */
+  uint32_t partition_size;    /* Power of two, 16 - 1024 (0 = auto) */
+  uint32_t crossfade_samples; /* Fade between filter sets (0 = 256) */
+} ae_convolver_config_t;
+
+/* HRIR set loaded once and shared, read-only, by any number of engines */
+typedef struct ae_hrtf_db ae_hrtf_db_t;
+
+typedef struct {
+  const char *path;      /* SOFA file (NULL = built-in set) */
+  uint32_t sample_rate;  /* Rate of the engines using it (0 = 48000) */
+  uint32_t max_taps;     /* HRIR taps after preprocessing (0 = 256) */
+  const char *cache_dir; /* Preprocessed HRIR cache (NULL = off) */
+} ae_hrtf_db_config_t;
+
+/* Ambisonic bus (ACN channel order, SN3D): any number of encoded sources,
+ * one rotation and one binaural decode */
+typedef struct ae_ambisonic_bus ae_ambisonic_bus_t;
+
+#define AE_AMBISONIC_MAX_ORDER 3
+#define AE_AMBISONIC_CHANNELS(order) (((order) + 1) * ((order) + 1))
+
+typedef struct {
+  uint32_t order;          /* 1 - AE_AMBISONIC_MAX_ORDER */
+  uint32_t max_frames;     /* Largest block for encode and decode */
+  uint32_t max_taps;       /* Longest decoder HRIR */
+  uint32_t partition_size; /* Decoder convolution (0 = auto) */
+} ae_ambisonic_config_t;
+
+/* Feed-forward block compressor; levels are sample peaks in dBFS */
+typedef struct ae_compressor ae_compressor_t;
+
+typedef struct {
+  float threshold_db; /* Compression starts here */
+  float ratio;        /* Input dB per output dB over threshold (>= 1) */
+  float knee_db;      /* Soft knee centred on the threshold (0 = hard) */
+  float attack_ms;    /* Time constant as gain reduction grows, > 0 */
+  float release_ms;   /* Time constant as gain reduction falls, > 0 */
+  float makeup_db;    /* Gain after compression */
+  bool stereo_link;   /* One gain from the louder channel (false: each own) */
+} ae_compressor_params_t;
+
+/* Lookahead peak limiter; output is delayed by ae_limiter_latency() frames */
+typedef struct ae_limiter ae_limiter_t;
+
+#define AE_LIMITER_MAX_LOOKAHEAD_MS 20.0f
+
+typedef struct {
+  float ceiling_db;   /* Output peak ceiling in dBFS */
+  float lookahead_ms; /* Gain ramp ahead of a peak, 0 - max lookahead */
+  float release_ms;   /* Time constant as gain reduction falls, > 0 */
+  bool true_peak;     /* Also detect 4x-oversampled inter-sample peaks */
+} ae_limiter_params_t;
+
+/* De-esser: compresses the band above a Linkwitz-Riley crossover */
+typedef struct ae_deesser ae_deesser_t;
+
+typedef struct {
+  float frequency_hz; /* Crossover, below Nyquist */
+  float threshold_db; /* Band peak level where reduction starts */
+  float ratio;        /* Input dB per output dB over threshold (>= 1) */
+  float attack_ms;    /* Time constant as gain reduction grows, > 0 */
+  float release_ms;   /* Time constant as gain reduction falls, > 0 */
+  bool wideband;      /* Reduce the whole signal (false: the band only) */
+} ae_deesser_params_t;
+
+/* Parametric EQ: up to AE_MAX_EQ_BANDS biquad bands in cascade */
+typedef struct ae_eq ae_eq_t;
+
+typedef enum {
+  AE_EQ_PEAK,
+  AE_EQ_LOW_SHELF,
+  AE_EQ_HIGH_SHELF,
+  AE_EQ_NOTCH,
+  AE_EQ_LOWPASS,
+  AE_EQ_HIGHPASS
+} ae_eq_band_type_t;
+
+typedef struct {
+  ae_eq_band_type_t type;
+  float frequency_hz; /* Centre or corner, below Nyquist */
+  float gain_db;      /* Peak and shelf bands, -24 to 24 */
+  float q;            /* 0.1 - 30 */
+  bool enabled;
+} ae_eq_band_t;
+
+/* Oversampler: runs a nonlinear stage at 2x, 4x or 8x the base rate */
+typedef struct ae_oversampler ae_oversampler_t;
+
+typedef enum {
+  AE_OVERSAMPLE_LINEAR_PHASE, /* FIR halfbands, constant delay */
+  AE_OVERSAMPLE_LOW_LATENCY   /* IIR allpass halfbands, minimum phase */
+} ae_oversample_phase_t;
+
+typedef enum {
+  AE_OVERSAMPLE_DRAFT,  /* Image rejection about 45 dB */
+  AE_OVERSAMPLE_NORMAL, /* About 60 dB (FIR), 75 dB (IIR) */
+  AE_OVERSAMPLE_HIGH    /* About 90 dB */
+} ae_oversample_quality_t;
+
+typedef struct {
+  uint32_t factor;     /* 2, 4 or 8 */
+  uint32_t max_frames; /* Largest base-rate block per callback */
+  ae_oversample_phase_t phase;
+  ae_oversample_quality_t quality;
+} ae_oversampler_config_t;
+
+/* Stage run at the oversampled rate, in place; right may be NULL */
+typedef void (*ae_oversample_fn)(float *left, float *right, size_t frames,
+                                 void *user_data);
+
 /*============================================================================
  * Dynamic parameters
  *============================================================================*/
@@ -226,16 +378,52 @@ typedef struct {
 /*============================================================================
  * Engine configuration
  *============================================================================*/
+typedef enum {
+  AE_REVERB_RATE_AUTO = 0, /* Half rate when damping removes the highs */
+  AE_REVERB_RATE_FULL,     /* Late reverb at the engine rate */
+  AE_REVERB_RATE_HALF      /* Late reverb at half the engine rate */
+} ae_reverb_rate_t;
+
+typedef enum {
+  AE_DIFFUSER_ALLPASS = 0, /* Two serial allpass stages */
+  AE_DIFFUSER_VELVET       /* Sparse velvet-noise FIR (+/-1 taps) */
+} ae_diffuser_t;
+
+typedef enum {
+  AE_DELAY_STORAGE_FLOAT32 = 0, /* 32-bit float delay lines */
+  AE_DELAY_STORAGE_FP16,        /* IEEE half floats, math stays float */
+  AE_DELAY_STORAGE_INT16        /* 16-bit fixed point, +/-8.0 full scale */
+} ae_delay_storage_t;
+
+typedef enum {
+  AE_BINAURAL_AUTO = 0,     /* hrtf_path if set, otherwise PARAMETRIC */
+  AE_BINAURAL_PARAMETRIC,   /* ITD/ILD and head shadow, no HRIR set */
+  AE_BINAURAL_BUILTIN_HRTF, /* Built-in HRIR set, hrtf_path ignored */
+  AE_BINAURAL_HRTF_FILE     /* hrtf_path, built-in set if it fails */
+} ae_binaural_model_t;
+
 typedef struct {
-  uint32_t sample_rate;       /* 48000 (fixed) */
-  uint32_t max_buffer_size;   /* Max buffer size (default: 4096) */
-  const char *data_path;      /* Data directory (NULL = exe path) */
-  const char *hrtf_path;      /* HRTF file path (NULL = builtin) */
-  bool preload_hrtf;          /* true = load at startup */
-  bool preload_all_presets;   /* true = load all presets */
-  size_t max_reverb_time_sec; /* Max reverb time (default: 10s) */
+  uint32_t sample_rate;             /* 48000 (fixed) */
+  uint32_t max_buffer_size;         /* Max buffer size (default: 4096) */
+  const char *data_path;            /* Data directory (NULL = exe path) */
+  const char *hrtf_path;            /* HRTF file (see binaural) */
+  bool preload_hrtf;                /* true = load at startup */
+  bool preload_all_presets;         /* true = load all presets */
+  size_t max_reverb_time_sec;       /* Max reverb time (default: 10s) */
+  ae_reverb_rate_t reverb_rate;     /* Late reverb rate (default: AUTO) */
+  uint32_t early_reflection_taps;   /* ER taps, 1-128; 0 = default (12) */
+  ae_diffuser_t diffuser;           /* Input diffuser (default: ALLPASS) */
+  ae_delay_storage_t delay_storage; /* Delay line format (default: FLOAT32) */
+  const char *hrtf_cache_dir;       /* Preprocessed HRIR cache (NULL = off) */
+  uint32_t hrir_max_taps;           /* HRIR taps after preprocessing (256) */
+  ae_hrtf_db_t *hrtf_db;            /* Shared HRIR set (NULL = own load) */
+  uint32_t listener_count;          /* Binaural outputs, 1-8 (default: 1) */
+  uint32_t noise_seed;              /* Lofi noise seed (0 = per engine) */
+  ae_binaural_model_t binaural;     /* Binaural renderer (default: AUTO) */
 } ae_config_t;
 
+#define AE_MAX_LISTENERS 8
+
 /*============================================================================
  * Perceptual metrics
  *============================================================================*/
@@ -437,6 +625,22 @@ AE_API const char *ae_get_last_error_detail(ae_engine_t *engine);
 AE_API ae_result_t ae_process(ae_engine_t *engine,
                               const ae_audio_buffer_t *input,
                               ae_audio_buffer_t *output);
+/* ae_process for count distinct engines (inputs may be NULL), all with the
+ * same output frame count. Their HRIR convolutions run batched, one engine
+ * per SIMD lane; otherwise each engine behaves as with ae_process. Nothing
+ * is processed if any engine's buffers are invalid. */
+AE_API ae_result_t ae_process_group(ae_engine_t *const *engines,
+                                    const ae_audio_buffer_t *inputs,
+                                    ae_audio_buffer_t *outputs,
+                                    size_t count);
+/* One input, one output per listener (count <= listener_count, all the
+ * same frame count). Everything up to the reverb runs once; each listener
+ * adds only its binaural stage, mix, precedence and width. ae_process
+ * renders listener 0 alone. */
+AE_API ae_result_t ae_process_listeners(ae_engine_t *engine,
+                                        const ae_audio_buffer_t *input,
+                                        ae_audio_buffer_t *outputs,
+                                        uint32_t count);
 
 /*============================================================================
  * Parameter API
@@ -478,6 +682,23 @@ AE_API ae_result_t ae_blend_scenarios(ae_engine_t *engine,
 AE_API ae_result_t ae_apply_cave_model(ae_engine_t *engine,
                                        const ae_cave_params_t *params);
 
+/* Room geometry: image-source early reflections.
+ * ae_set_room_geometry returns immediately; the tap table is computed on a
+ * background thread and swapped in at the start of a later ae_process. */
+AE_API ae_result_t ae_room_make_shoebox(float width_m, float depth_m,
+                                        float height_m,
+                                        const float absorption[6],
+                                        ae_room_geometry_t *out);
+AE_API float ae_room_eyring_rt60(const ae_room_geometry_t *room);
+AE_API ae_result_t ae_compute_image_sources(
+    const ae_room_geometry_t *room, const ae_image_source_params_t *params,
+    ae_reflection_t *out, size_t max_count, size_t *count_out);
+AE_API ae_result_t ae_set_room_geometry(ae_engine_t *engine,
+                                        const ae_room_geometry_t *room,
+                                        const ae_image_source_params_t *params);
+AE_API ae_result_t ae_clear_room_geometry(ae_engine_t *engine);
+AE_API ae_result_t ae_wait_room_geometry(ae_engine_t *engine);
+
 /* Binaural and precedence */
 AE_API ae_result_t ae_azimuth_to_binaural(float azimuth_deg,
                                           float elevation_deg,
@@ -488,9 +709,188 @@ AE_API ae_result_t ae_set_binaural_params(ae_engine_t *engine,
 AE_API ae_result_t ae_set_source_position(ae_engine_t *engine,
                                           float azimuth_deg,
                                           float elevation_deg);
+/* The source as heard by one listener; listener 0 is the one the calls
+ * above set */
+AE_API ae_result_t ae_set_listener_binaural_params(
+    ae_engine_t *engine, uint32_t listener,
+    const ae_binaural_params_t *params);
+AE_API ae_result_t ae_set_listener_source_position(ae_engine_t *engine,
+                                                   uint32_t listener,
+                                                   float azimuth_deg,
+                                                   float elevation_deg);
 AE_API ae_result_t ae_apply_precedence(ae_engine_t *engine,
                                        const ae_precedence_t *params);
 
+/* HRTF loading off the control and audio threads. ae_hrtf_load_async
+ * returns immediately; a SOFA file (path NULL = built-in set) is parsed on
+ * a background thread while rendering continues with the current set, or
+ * the parametric ITD/ILD model if none is loaded yet, and the new set is
+ * crossfaded in once ready. The callback (may be NULL) runs on the loader
+ * thread with AE_OK or AE_ERROR_HRTF_LOAD_FAILED; a failed load keeps the
+ * current set. A load still queued when another is posted is dropped
+ * without its callback. With preload_hrtf false, the first binaural update
+ * starts the same background load of the set config.binaural selects
+ * (none for PARAMETRIC). */
+typedef void (*ae_hrtf_loaded_fn)(ae_engine_t *engine, ae_result_t result,
+                                  void *user_data);
+AE_API ae_result_t ae_hrtf_load_async(ae_engine_t *engine, const char *path,
+                                      ae_hrtf_loaded_fn callback,
+                                      void *user_data);
+AE_API ae_result_t ae_hrtf_wait(ae_engine_t *engine);
+
+/* Shared HRIR sets. ae_hrtf_db_create loads (or reads from the cache) once
+ * and returns NULL on failure; engines given the set through
+ * ae_config_t::hrtf_db or ae_hrtf_set_db keep a reference and only own
+ * their filters and history. Create and release are thread-safe; a set
+ * with a different sample rate, or longer than the engine's filters,
+ * is refused with AE_ERROR_INVALID_PARAM. The built-in set (path NULL) at
+ * 48 kHz is expanded once per process; creating it again, or an engine
+ * loading it, returns a new reference to that one copy. */
+AE_API ae_hrtf_db_t *ae_hrtf_db_create(const ae_hrtf_db_config_t *config);
+AE_API ae_hrtf_db_t *ae_hrtf_db_retain(ae_hrtf_db_t *db);
+AE_API void ae_hrtf_db_release(ae_hrtf_db_t *db);
+AE_API ae_result_t ae_hrtf_set_db(ae_engine_t *engine, ae_hrtf_db_t *db);
+
+/* Binaural convolution. Taps up to the partition size run direct-form; the
+ * rest run as uniformly partitioned overlap-save FFT convolution.
+ * set_filters may run on a control thread concurrently with process; the
+ * audio thread crossfades to the new filters at its next partition. */
+AE_API ae_convolver_t *
+ae_convolver_create(const ae_convolver_config_t *config);
+AE_API void ae_convolver_destroy(ae_convolver_t *conv);
+AE_API void ae_convolver_reset(ae_convolver_t *conv);
+AE_API ae_result_t ae_convolver_set_filters(ae_convolver_t *conv,
+                                            const float *ir_l,
+                                            const float *ir_r, size_t taps);
+AE_API ae_result_t ae_convolver_process(ae_convolver_t *conv,
+                                        const float *input, float *out_l,
+                                        float *out_r, size_t frames);
+/* Several distinct convolvers over the same frame count, one per SIMD lane
+ * where their partition sizes and block positions line up */
+AE_API ae_result_t ae_convolver_process_group(ae_convolver_t *const *convs,
+                                              const float *const *inputs,
+                                              float *const *out_l,
+                                              float *const *out_r,
+                                              size_t count, size_t frames);
+
+/* Compressor. set_params validates and caches the attack/release
+ * coefficients and knee terms; process then runs per block: peak detector,
+ * log-domain gain curve, gain smoothing, one gain vector per channel. It
+ * works in place; right may be NULL (mono). A sidechain, when given, is
+ * detected instead of the signal (sc_right NULL = sc_left keys both). Call
+ * set_params between process calls, not concurrently. */
+AE_API ae_compressor_t *ae_compressor_create(uint32_t sample_rate);
+AE_API void ae_compressor_destroy(ae_compressor_t *comp);
+AE_API void ae_compressor_reset(ae_compressor_t *comp);
+AE_API ae_result_t
+ae_compressor_set_params(ae_compressor_t *comp,
+                         const ae_compressor_params_t *params);
+AE_API void ae_compressor_get_params(const ae_compressor_t *comp,
+                                     ae_compressor_params_t *params);
+AE_API ae_result_t ae_compressor_process(ae_compressor_t *comp, float *left,
+                                         float *right, const float *sc_left,
+                                         const float *sc_right, size_t frames);
+/* Current gain reduction in dB (>= 0), the larger of the two channels */
+AE_API float ae_compressor_gain_reduction(const ae_compressor_t *comp);
+
+/* Limiter. The signal is delayed by the lookahead; a sliding-window peak
+ * over that window sets the gain, which ramps down over the lookahead so
+ * it reaches its target as the peak comes out, then recovers with the
+ * release. One gain drives both channels; right may be NULL (mono). A
+ * set_params that changes the latency also resets the limiter. */
+AE_API ae_limiter_t *ae_limiter_create(uint32_t sample_rate);
+AE_API void ae_limiter_destroy(ae_limiter_t *lim);
+AE_API void ae_limiter_reset(ae_limiter_t *lim);
+AE_API ae_result_t ae_limiter_set_params(ae_limiter_t *lim,
+                                         const ae_limiter_params_t *params);
+AE_API void ae_limiter_get_params(const ae_limiter_t *lim,
+                                  ae_limiter_params_t *params);
+AE_API ae_result_t ae_limiter_process(ae_limiter_t *lim, float *left,
+                                      float *right, size_t frames);
+/* Delay of the output in frames, for compensating parallel paths */
+AE_API uint32_t ae_limiter_latency(const ae_limiter_t *lim);
+/* Gain reduction of the last output frame in dB (>= 0) */
+AE_API float ae_limiter_gain_reduction(const ae_limiter_t *lim);
+
+/* De-esser. A fourth-order Linkwitz-Riley crossover, both bands of both
+ * channels in one SIMD chain, feeds the high band to a peak detector;
+ * one gain from the louder channel is smoothed per block and applied to
+ * the high band (or the whole signal when wideband). The bands sum to an
+ * allpass, so split-band output keeps the input's magnitude, not its
+ * phase. Processes in place; right may be NULL (mono). */
+AE_API ae_deesser_t *ae_deesser_create(uint32_t sample_rate);
+AE_API void ae_deesser_destroy(ae_deesser_t *ds);
+AE_API void ae_deesser_reset(ae_deesser_t *ds);
+AE_API ae_result_t ae_deesser_set_params(ae_deesser_t *ds,
+                                         const ae_deesser_params_t *params);
+AE_API void ae_deesser_get_params(const ae_deesser_t *ds,
+                                  ae_deesser_params_t *params);
+AE_API ae_result_t ae_deesser_process(ae_deesser_t *ds, float *left,
+                                      float *right, size_t frames);
+/* Gain reduction of the last frame in dB (>= 0) */
+AE_API float ae_deesser_gain_reduction(const ae_deesser_t *ds);
+
+/* Parametric EQ. Enabled bands run as transposed direct form II sections,
+ * compacted ahead of time so disabled bands cost nothing. Two bands of
+ * both channels share a register, and the cascade is skewed one frame per
+ * band so every band advances in the same step. A band change glides the
+ * coefficients over a few milliseconds, switching a band on or off
+ * included. Processes in place; right may be NULL (mono). */
+AE_API ae_eq_t *ae_eq_create(uint32_t sample_rate);
+AE_API void ae_eq_destroy(ae_eq_t *eq);
+AE_API void ae_eq_reset(ae_eq_t *eq);
+AE_API ae_result_t ae_eq_set_band(ae_eq_t *eq, uint32_t index,
+                                  const ae_eq_band_t *band);
+AE_API ae_result_t ae_eq_get_band(const ae_eq_t *eq, uint32_t index,
+                                  ae_eq_band_t *band);
+AE_API ae_result_t ae_eq_process(ae_eq_t *eq, float *left, float *right,
+                                 size_t frames);
+
+/* Oversampler. process raises a block through cascaded 2x halfband stages,
+ * calls fn on it at factor times the rate, and brings it back down in
+ * place, so harmonics fn creates above the base band are filtered out
+ * instead of folding back. Blocks longer than max_frames are split into
+ * several calls; right may be NULL (mono). The passband reaches about
+ * 0.42 of the base rate. */
+AE_API ae_oversampler_t *
+ae_oversampler_create(const ae_oversampler_config_t *config);
+AE_API void ae_oversampler_destroy(ae_oversampler_t *os);
+AE_API void ae_oversampler_reset(ae_oversampler_t *os);
+AE_API ae_result_t ae_oversampler_process(ae_oversampler_t *os, float *left,
+                                          float *right, size_t frames,
+                                          ae_oversample_fn fn,
+                                          void *user_data);
+/* Delay in base-rate frames: fractional for linear phase above 2x, the
+ * low-frequency group delay for low latency */
+AE_API float ae_oversampler_latency(const ae_oversampler_t *os);
+
+/* Ambisonics. Angles follow ae_set_source_position (positive azimuth to the
+ * right). Sources are mixed into the bus with ae_ambisonic_encode; each
+ * ae_ambisonic_decode renders and clears it, so binaural cost does not
+ * depend on the number of sources. */
+AE_API ae_result_t ae_ambisonic_gains(uint32_t order, float azimuth_deg,
+                                      float elevation_deg, float *gains);
+AE_API ae_ambisonic_bus_t *
+ae_ambisonic_bus_create(const ae_ambisonic_config_t *config);
+AE_API void ae_ambisonic_bus_destroy(ae_ambisonic_bus_t *bus);
+AE_API void ae_ambisonic_bus_reset(ae_ambisonic_bus_t *bus);
+AE_API ae_result_t ae_ambisonic_set_decoder(
+    ae_ambisonic_bus_t *bus, const float *azimuth_deg,
+    const float *elevation_deg, const float *hrirs_l, const float *hrirs_r,
+    size_t speakers, size_t taps);
+AE_API ae_result_t ae_ambisonic_load_sofa(ae_ambisonic_bus_t *bus,
+                                          const char *path,
+                                          float sample_rate);
+AE_API ae_result_t ae_ambisonic_set_rotation(ae_ambisonic_bus_t *bus,
+                                             float yaw_deg, float pitch_deg,
+                                             float roll_deg);
+AE_API ae_result_t ae_ambisonic_encode(ae_ambisonic_bus_t *bus,
+                                       const float *input, size_t frames,
+                                       const float *gains,
+                                       const float *prev_gains);
+AE_API ae_result_t ae_ambisonic_decode(ae_ambisonic_bus_t *bus, float *out_l,
+                                       float *out_r, size_t frames);
+
 /* Dynamic parameters */
 AE_API ae_result_t ae_set_doppler(ae_engine_t *engine,
                                   const ae_doppler_params_t *params);
@@ -12,6 +12,18 @@ void ae_clear_error(ae_engine_t *engine) {
     engine->last_error[0] = '\0';
 }
 
+static bool ae_precedence_line_alloc(ae_precedence_line_t *line, size_t size,
+                                     ae_delay_storage_t storage) {
+  line->index = 0;
+  return ae_delay_buffer_alloc(&line->l, size, storage) &&
+         ae_delay_buffer_alloc(&line->r, size, storage);
+}
+
+static void ae_precedence_line_free(ae_precedence_line_t *line) {
+  ae_delay_buffer_free(&line->l);
+  ae_delay_buffer_free(&line->r);
+}
+
 AE_API ae_config_t ae_get_default_config(void) {
   ae_config_t config;
   config.sample_rate = AE_SAMPLE_RATE;
@@ -21,6 +33,16 @@ AE_API ae_config_t ae_get_default_config(void) {
   config.preload_hrtf = true;
   config.preload_all_presets = false;
   config.max_reverb_time_sec = 10;
+  config.reverb_rate = AE_REVERB_RATE_AUTO;
+  config.early_reflection_taps = AE_ER_TAPS;
+  config.diffuser = AE_DIFFUSER_ALLPASS;
+  config.delay_storage = AE_DELAY_STORAGE_FLOAT32;
+  config.hrtf_cache_dir = NULL;
+  config.hrir_max_taps = AE_HRIR_MAX_TAPS;
+  config.hrtf_db = NULL;
+  config.listener_count = 1;
+  config.noise_seed = 0;
+  config.binaural = AE_BINAURAL_AUTO;
   return config;
 }
 
@@ -29,6 +51,10 @@ AE_API ae_engine_t *ae_create_engine(const ae_config_t *config) {
   if (cfg.sample_rate != AE_SAMPLE_RATE) {
     return NULL;
   }
+  if (cfg.listener_count == 0)
+    cfg.listener_count = 1;
+  if (cfg.listener_count > AE_MAX_LISTENERS)
+    return NULL;
 
   ae_engine_t *engine = (ae_engine_t *)calloc(1, sizeof(ae_engine_t));
   if (!engine)
@@ -49,9 +75,14 @@ AE_API ae_engine_t *ae_create_engine(const ae_config_t *config) {
   AE_ATOMIC_STORE(&engine->diffusion, 0.5f);
   AE_ATOMIC_STORE(&engine->lofi_amount, 0.0f);
   AE_ATOMIC_STORE(&engine->modulation, 0.0f);
+  if (cfg.noise_seed != 0)
+    ae_rng_seed(&engine->noise_rng, cfg.noise_seed);
+  else
+    ae_rng_seed_unique(&engine->noise_rng);
+  AE_ATOMIC_STORE(&engine->tape_amount, 0.0f);
 
   engine->doppler.enabled = false;
-  engine->doppler_phase = 0.0f;
+  engine->doppler_line.primed = false;
   engine->envelope.attack_ms = 0.0f;
   engine->envelope.decay_ms = 0.0f;
   engine->envelope.sustain_level = 1.0f;
@@ -71,9 +102,12 @@ AE_API ae_engine_t *ae_create_engine(const ae_config_t *config) {
       (float *)calloc(engine->scratch_size, sizeof(float));
   engine->scratch_wet_r =
       (float *)calloc(engine->scratch_size, sizeof(float));
+  engine->scratch_env =
+      (float *)calloc(2 * engine->scratch_size, sizeof(float));
 
   if (!engine->scratch_l || !engine->scratch_r || !engine->scratch_mono ||
-      !engine->scratch_wet_l || !engine->scratch_wet_r) {
+      !engine->scratch_wet_l || !engine->scratch_wet_r ||
+      !engine->scratch_env) {
     ae_destroy_engine(engine);
     return NULL;
   }
@@ -82,15 +116,44 @@ AE_API ae_engine_t *ae_create_engine(const ae_config_t *config) {
   engine->prev_mag = NULL;
 
   engine->precedence_size = (size_t)(cfg.sample_rate * 0.1f) + 1;
-  engine->precedence_l =
-      (float *)calloc(engine->precedence_size, sizeof(float));
-  engine->precedence_r =
-      (float *)calloc(engine->precedence_size, sizeof(float));
-  if (!engine->precedence_l || !engine->precedence_r) {
+  if (!ae_precedence_line_alloc(&engine->precedence_line,
+                                engine->precedence_size, cfg.delay_storage)) {
     ae_destroy_engine(engine);
     return NULL;
   }
 
+  if (!ae_doppler_line_alloc(&engine->doppler_line,
+                             (float)cfg.sample_rate, engine->scratch_size)) {
+    ae_destroy_engine(engine);
+    return NULL;
+  }
+
+  /* Listeners past the first: the binaural stage onward, nothing shared */
+  if (cfg.listener_count > 1) {
+    size_t extra = cfg.listener_count - 1;
+    engine->listeners = (ae_listener_t *)calloc(extra, sizeof(ae_listener_t));
+    if (!engine->listeners) {
+      ae_destroy_engine(engine);
+      return NULL;
+    }
+    bool ok = true;
+    for (size_t l = 0; l < extra; ++l) {
+      ae_listener_t *listener = &engine->listeners[l];
+      listener->scratch_l =
+          (float *)calloc(engine->scratch_size, sizeof(float));
+      listener->scratch_r =
+          (float *)calloc(engine->scratch_size, sizeof(float));
+      ok = ok && listener->scratch_l && listener->scratch_r &&
+           ae_precedence_line_alloc(&listener->precedence_line,
+                                    engine->precedence_size,
+                                    cfg.delay_storage);
+    }
+    if (!ok) {
+      ae_destroy_engine(engine);
+      return NULL;
+    }
+  }
+
   ae_reverb_init(engine);
   ae_spatial_init(engine);
 
@@ -100,16 +163,29 @@ AE_API ae_engine_t *ae_create_engine(const ae_config_t *config) {
 AE_API void ae_destroy_engine(ae_engine_t *engine) {
   if (!engine)
     return;
+  /* Join the worker first: a running job may still publish into the reverb */
+  ae_worker_destroy(engine->worker);
   free(engine->scratch_l);
   free(engine->scratch_r);
   free(engine->scratch_mono);
   free(engine->scratch_wet_l);
   free(engine->scratch_wet_r);
+  free(engine->scratch_env);
   free(engine->prev_mag);
-  free(engine->precedence_l);
-  free(engine->precedence_r);
+  ae_precedence_line_free(&engine->precedence_line);
+  ae_doppler_line_free(&engine->doppler_line);
   ae_reverb_cleanup(engine);
+  /* Without the listener array only listener 0 was ever set up */
+  if (!engine->listeners)
+    engine->config.listener_count = 1;
   ae_spatial_cleanup(engine);
+  for (uint32_t l = 0; l + 1 < engine->config.listener_count; ++l) {
+    ae_listener_t *listener = &engine->listeners[l];
+    free(listener->scratch_l);
+    free(listener->scratch_r);
+    ae_precedence_line_free(&listener->precedence_line);
+  }
+  free(engine->listeners);
   free(engine);
 }
 
@@ -144,9 +220,19 @@ AE_API const char *ae_get_last_error_detail(ae_engine_t *engine) {
   return engine->last_error;
 }
 
-AE_API ae_result_t ae_process(ae_engine_t *engine,
-                              const ae_audio_buffer_t *input,
-                              ae_audio_buffer_t *output) {
+/* Mix settings read once per block, before the binaural stage */
+typedef struct {
+  float dry_wet;
+  float intensity;
+  float width;
+} ae_process_mix_t;
+
+/* Engines per ae_process_group pass; bounds its stack arrays */
+#define AE_PROCESS_GROUP 32
+
+static ae_result_t ae_process_check(ae_engine_t *engine,
+                                    const ae_audio_buffer_t *input,
+                                    const ae_audio_buffer_t *output) {
   if (!engine || !output)
     return AE_ERROR_INVALID_PARAM;
   ae_clear_error(engine);
@@ -166,7 +252,14 @@ AE_API ae_result_t ae_process(ae_engine_t *engine,
     return AE_ERROR_INVALID_PARAM;
   if (!output->samples)
     return AE_ERROR_INVALID_PARAM;
+  return AE_OK;
+}
 
+/* Input through reverb: leaves the dry path in scratch_l/r, ready for the
+ * binaural stage, and the wet path in scratch_wet_l/r */
+static void ae_process_front(ae_engine_t *engine,
+                             const ae_audio_buffer_t *input, size_t frames,
+                             ae_process_mix_t *mix) {
   float *dry_l = engine->scratch_l;
   float *dry_r = engine->scratch_r;
   float *mono = engine->scratch_mono;
@@ -202,14 +295,17 @@ AE_API ae_result_t ae_process(ae_engine_t *engine,
     }
   }
 
-  if (engine->doppler.enabled) {
-    ae_dsp_apply_doppler(&engine->doppler, dry_l, dry_r, wet_l, wet_r, frames,
-                         &engine->doppler_phase);
-    memcpy(dry_l, wet_l, frames * sizeof(float));
-    memcpy(dry_r, wet_r, frames * sizeof(float));
-  }
-
   float distance = AE_ATOMIC_LOAD(&engine->distance);
+  if (engine->doppler.enabled)
+    ae_dsp_apply_doppler(&engine->doppler_line, &engine->doppler, distance,
+                         (float)engine->config.sample_rate, dry_l, dry_r,
+                         frames);
+  /* Tape wobble: 0.8 Hz wow, under 1% pitch swing at full amount */
+  float tape = ae_clamp(AE_ATOMIC_LOAD(&engine->tape_amount), 0.0f, 1.0f);
+  ae_dsp_apply_wow_flutter(&engine->wow_flutter, dry_l, dry_r, frames,
+                           0.1f * tape, 0.8f,
+                           (float)engine->config.sample_rate);
+
   float room_size = AE_ATOMIC_LOAD(&engine->room_size);
   float brightness = AE_ATOMIC_LOAD(&engine->brightness);
   float width = AE_ATOMIC_LOAD(&engine->width);
@@ -236,12 +332,9 @@ AE_API ae_result_t ae_process(ae_engine_t *engine,
     dry_r[i] *= gain;
   }
 
-  ae_dsp_apply_brightness(dry_l, frames, brightness,
-                          (float)engine->config.sample_rate,
-                          &engine->lp_state_l, &engine->hp_state_l);
-  ae_dsp_apply_brightness(dry_r, frames, brightness,
-                          (float)engine->config.sample_rate,
-                          &engine->lp_state_r, &engine->hp_state_r);
+  ae_dsp_apply_brightness(&engine->brightness_lp, &engine->brightness_hp,
+                          dry_l, dry_r, frames, brightness,
+                          (float)engine->config.sample_rate);
 
   for (size_t i = 0; i < frames; ++i) {
     mono[i] = 0.5f * (dry_l[i] + dry_r[i]);
@@ -257,9 +350,38 @@ AE_API ae_result_t ae_process(ae_engine_t *engine,
 
   ae_reverb_update_params(engine, room_size, rt60, diffusion, damping);
   ae_reverb_process_block(engine, mono, wet_l, wet_r, frames);
-  ae_dsp_apply_lofi(wet_l, wet_r, frames, lofi_amount);
+  ae_dsp_apply_lofi(&engine->noise_rng, wet_l, wet_r, frames, lofi_amount);
 
-  ae_spatial_process(engine, dry_l, dry_r, frames);
+  mix->dry_wet = dry_wet;
+  mix->intensity = intensity;
+  mix->width = width;
+}
+
+/* Envelope gains for the block into scratch_env, left then right, once
+ * for all listeners */
+static void ae_process_envelope(ae_engine_t *engine, size_t frames) {
+  float *env_l = engine->scratch_env;
+  float *env_r = engine->scratch_env + frames;
+  for (size_t i = 0; i < frames; ++i) {
+    env_l[i] = ae_dsp_apply_envelope(engine, 1.0f);
+    env_r[i] = ae_dsp_apply_envelope(engine, 1.0f);
+  }
+}
+
+/* One listener: mix, envelope, precedence and width from its binaural
+ * output in dry_l/r, then its output buffer */
+static void ae_process_back(ae_engine_t *engine, float *dry_l, float *dry_r,
+                            ae_precedence_line_t *line,
+                            ae_audio_buffer_t *output,
+                            const ae_process_mix_t *mix) {
+  size_t frames = output->frame_count;
+  const float *env_l = engine->scratch_env;
+  const float *env_r = engine->scratch_env + frames;
+  float *wet_l = engine->scratch_wet_l;
+  float *wet_r = engine->scratch_wet_r;
+  float dry_wet = mix->dry_wet;
+  float intensity = mix->intensity;
+  float width = mix->width;
 
   float wet_gain = dry_wet * intensity;
   float dry_gain = 1.0f - dry_wet;
@@ -267,13 +389,11 @@ AE_API ae_result_t ae_process(ae_engine_t *engine,
   for (size_t i = 0; i < frames; ++i) {
     float out_l = dry_gain * dry_l[i] + wet_gain * wet_l[i];
     float out_r = dry_gain * dry_r[i] + wet_gain * wet_r[i];
-    out_l = ae_dsp_apply_envelope(engine, out_l);
-    out_r = ae_dsp_apply_envelope(engine, out_r);
-    dry_l[i] = out_l * engine->output_gain;
-    dry_r[i] = out_r * engine->output_gain;
+    dry_l[i] = out_l * env_l[i] * engine->output_gain;
+    dry_r[i] = out_r * env_r[i] * engine->output_gain;
   }
 
-  ae_dsp_apply_precedence(engine, dry_l, dry_r, frames);
+  ae_dsp_apply_precedence(engine, line, dry_l, dry_r, frames);
   ae_dsp_apply_width(dry_l, dry_r, frames, width);
 
   if (output->channels == 1) {
@@ -291,7 +411,115 @@ AE_API ae_result_t ae_process(ae_engine_t *engine,
       output->samples[i + frames] = dry_r[i];
     }
   }
+}
+
+AE_API ae_result_t ae_process(ae_engine_t *engine,
+                              const ae_audio_buffer_t *input,
+                              ae_audio_buffer_t *output) {
+  ae_result_t result = ae_process_check(engine, input, output);
+  if (result != AE_OK)
+    return result;
+  size_t frames = output->frame_count;
+  ae_process_mix_t mix;
+  ae_process_front(engine, input, frames, &mix);
+  ae_spatial_process(engine, 0, engine->scratch_l, engine->scratch_r, frames);
+  ae_process_envelope(engine, frames);
+  ae_process_back(engine, engine->scratch_l, engine->scratch_r,
+                  &engine->precedence_line, output, &mix);
+  return AE_OK;
+}
+
+AE_API ae_result_t ae_process_listeners(ae_engine_t *engine,
+                                        const ae_audio_buffer_t *input,
+                                        ae_audio_buffer_t *outputs,
+                                        uint32_t count) {
+  if (!engine || !outputs || count == 0)
+    return AE_ERROR_INVALID_PARAM;
+  if (count > engine->config.listener_count) {
+    ae_set_error(engine, "More outputs than listeners");
+    return AE_ERROR_INVALID_PARAM;
+  }
+  size_t frames = outputs[0].frame_count;
+  for (uint32_t l = 0; l < count; ++l) {
+    ae_result_t result = ae_process_check(engine, input, &outputs[l]);
+    if (result != AE_OK)
+      return result;
+    if (outputs[l].frame_count != frames) {
+      ae_set_error(engine, "Listener frame counts mismatch");
+      return AE_ERROR_INVALID_PARAM;
+    }
+  }
+
+  ae_process_mix_t mix;
+  ae_process_front(engine, input, frames, &mix);
+  /* Each listener's binaural stage runs in place, so the others take a
+   * copy of the shared dry path first */
+  for (uint32_t l = 1; l < count; ++l) {
+    ae_listener_t *listener = &engine->listeners[l - 1];
+    memcpy(listener->scratch_l, engine->scratch_l, frames * sizeof(float));
+    memcpy(listener->scratch_r, engine->scratch_r, frames * sizeof(float));
+  }
+  ae_process_envelope(engine, frames);
+  for (uint32_t l = 0; l < count; ++l) {
+    float *dry_l = engine->scratch_l;
+    float *dry_r = engine->scratch_r;
+    ae_precedence_line_t *line = &engine->precedence_line;
+    if (l > 0) {
+      ae_listener_t *listener = &engine->listeners[l - 1];
+      dry_l = listener->scratch_l;
+      dry_r = listener->scratch_r;
+      line = &listener->precedence_line;
+    }
+    ae_spatial_process(engine, l, dry_l, dry_r, frames);
+    ae_process_back(engine, dry_l, dry_r, line, &outputs[l], &mix);
+  }
+  return AE_OK;
+}
+
+/**
+ * ae_process for several engines in one call. Every stage runs per engine
+ * except the binaural one, which renders all the engines' HRIRs together.
+ */
+AE_API ae_result_t ae_process_group(ae_engine_t *const *engines,
+                                    const ae_audio_buffer_t *inputs,
+                                    ae_audio_buffer_t *outputs,
+                                    size_t count) {
+  if (!engines || !outputs || count == 0)
+    return AE_ERROR_INVALID_PARAM;
+  size_t frames = outputs[0].frame_count;
+  for (size_t e = 0; e < count; ++e) {
+    ae_result_t result =
+        ae_process_check(engines[e], inputs ? &inputs[e] : NULL, &outputs[e]);
+    if (result != AE_OK)
+      return result;
+    if (outputs[e].frame_count != frames) {
+      ae_set_error(engines[e], "Group frame counts mismatch");
+      return AE_ERROR_INVALID_PARAM;
+    }
+  }
 
+  for (size_t first = 0; first < count; first += AE_PROCESS_GROUP) {
+    size_t n = count - first < AE_PROCESS_GROUP ? count - first
+                                                : AE_PROCESS_GROUP;
+    ae_process_mix_t mix[AE_PROCESS_GROUP];
+    float *left[AE_PROCESS_GROUP];
+    float *right[AE_PROCESS_GROUP];
+    for (size_t e = 0; e < n; ++e) {
+      ae_engine_t *engine = engines[first + e];
+      ae_process_front(engine, inputs ? &inputs[first + e] : NULL, frames,
+                       &mix[e]);
+      left[e] = engine->scratch_l;
+      right[e] = engine->scratch_r;
+    }
+    ae_spatial_process_group(engines + first, left, right, n, frames);
+    for (size_t e = 0; e < n; ++e) {
+      ae_engine_t *engine = engines[first + e];
+      ae_process_envelope(engine, frames);
+      ae_process_back(engine, engine->scratch_l, engine->scratch_r,
+                      &engine->precedence_line, &outputs[first + e],
+                      &mix[e]);
+    }
+  }
   return AE_OK;
 }
 
@@ -536,7 +764,7 @@ AE_API ae_result_t ae_set_binaural_params(ae_engine_t *engine,
                                           const ae_binaural_params_t *params) {
   if (!engine || !params)
     return AE_ERROR_INVALID_PARAM;
-  ae_spatial_set_params(engine, params);
+  ae_spatial_set_params(engine, 0, params);
   return AE_OK;
 }
 
@@ -550,7 +778,31 @@ AE_API ae_result_t ae_set_source_position(ae_engine_t *engine,
       ae_azimuth_to_binaural(azimuth_deg, elevation_deg, 1000.0f, &params);
   if (res != AE_OK)
     return res;
-  ae_spatial_set_params(engine, &params);
+  ae_spatial_set_params(engine, 0, &params);
+  return AE_OK;
+}
+
+AE_API ae_result_t ae_set_listener_binaural_params(
+    ae_engine_t *engine, uint32_t listener,
+    const ae_binaural_params_t *params) {
+  if (!engine || !params || listener >= engine->config.listener_count)
+    return AE_ERROR_INVALID_PARAM;
+  ae_spatial_set_params(engine, listener, params);
+  return AE_OK;
+}
+
+AE_API ae_result_t ae_set_listener_source_position(ae_engine_t *engine,
+                                                   uint32_t listener,
+                                                   float azimuth_deg,
+                                                   float elevation_deg) {
+  if (!engine || listener >= engine->config.listener_count)
+    return AE_ERROR_INVALID_PARAM;
+  ae_binaural_params_t params;
+  ae_result_t res =
+      ae_azimuth_to_binaural(azimuth_deg, elevation_deg, 1000.0f, &params);
+  if (res != AE_OK)
+    return res;
+  ae_spatial_set_params(engine, listener, &params);
   return AE_OK;
 }
 
@@ -566,10 +818,10 @@ AE_API ae_result_t ae_set_doppler(ae_engine_t *engine,
                                   const ae_doppler_params_t *params) {
   if (!engine || !params)
     return AE_ERROR_INVALID_PARAM;
-  bool was_enabled = engine->doppler.enabled;
+  /* Turning on: clear the line here, before the audio thread can see it */
+  if (!engine->doppler.enabled && params->enabled)
+    ae_doppler_line_reset(&engine->doppler_line);
   engine->doppler = *params;
-  if (!was_enabled && engine->doppler.enabled)
-    engine->doppler_phase = 0.0f;
   return AE_OK;
 }
 
@@ -634,6 +886,8 @@ AE_API ae_result_t ae_apply_expression(ae_engine_t *engine,
     } else if (strcmp(key, "chaos") == 0) {
       AE_ATOMIC_STORE(&engine->lofi_amount, value);
       AE_ATOMIC_STORE(&engine->modulation, value);
+    } else if (strcmp(key, "tape") == 0) {
+      AE_ATOMIC_STORE(&engine->tape_amount, value);
     } else if (strcmp(key, "underwater") == 0) {
       ae_apply_scenario(engine, "deep_sea", 1.0f);
     }
@@ -0,0 +1,608 @@
+/**
+ * @file ae_ambisonic.c
+ * @brief Ambisonic mixing bus with a single binaural decode
+ *
+ * Sources are encoded into real spherical harmonics (ACN order, SN3D) with a
+ * gain per channel and summed on the bus. Listener rotation is one
+ * block-diagonal matrix per order applied to the bus, and the binaural
+ * decode is one convolver per channel whose filters fold a virtual
+ * loudspeaker decoder into the speakers' HRIRs. Past encoding, the cost is
+ * fixed by the order, not by the number of sources.
+ */
+
+#include "ae_internal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
+
+#define AE_AMBISONIC_MAX_CHANNELS                                              \
+  AE_AMBISONIC_CHANNELS(AE_AMBISONIC_MAX_ORDER)
+#define AE_AMBISONIC_ROT_EL 4 /* Rotation quadrature, exact to degree 7 */
+#define AE_AMBISONIC_ROT_AZ 8
+#define AE_AMBISONIC_SOFA_EL 6 /* Virtual speakers for ae_ambisonic_load_sofa */
+#define AE_AMBISONIC_SOFA_AZ 12
+#define AE_AMBISONIC_REGULARIZATION 1e-4
+
+struct ae_ambisonic_bus {
+  uint32_t order;
+  size_t channels;
+  size_t max_frames;
+  size_t max_taps;
+  float *bus;     /* [channels][max_frames], cleared by each decode */
+  float *rotated; /* [channels][max_frames] */
+  float *scratch_l;
+  float *scratch_r;
+  ae_convolver_t *decoder[AE_AMBISONIC_MAX_CHANNELS];
+
+  /* Rotation: targets from the control thread, applied by decode */
+  ae_atomic_float yaw_deg;
+  ae_atomic_float pitch_deg;
+  ae_atomic_float roll_deg;
+  float applied[3];
+  float matrix[AE_AMBISONIC_MAX_CHANNELS * AE_AMBISONIC_MAX_CHANNELS];
+  float next[AE_AMBISONIC_MAX_CHANNELS * AE_AMBISONIC_MAX_CHANNELS];
+  bool identity;
+
+  float *filter_l; /* Control thread: one channel's decoder filters */
+  float *filter_r;
+};
+
+/*============================================================================
+ * Spherical harmonics
+ *============================================================================*/
+
+/* Real SN3D harmonics in ACN order for a unit vector (x front, y left) */
+static void ae_ambisonic_sh(uint32_t order, float x, float y, float z,
+                            float *out) {
+  const float s3 = 1.7320508f;   /* sqrt(3) */
+  const float s15 = 3.8729833f;  /* sqrt(15) */
+  const float s38 = 0.61237244f; /* sqrt(3/8) */
+  const float s58 = 0.79056942f; /* sqrt(5/8) */
+  out[0] = 1.0f;
+  out[1] = y;
+  out[2] = z;
+  out[3] = x;
+  if (order < 2)
+    return;
+  out[4] = s3 * x * y;
+  out[5] = s3 * y * z;
+  out[6] = 0.5f * (3.0f * z * z - 1.0f);
+  out[7] = s3 * x * z;
+  out[8] = 0.5f * s3 * (x * x - y * y);
+  if (order < 3)
+    return;
+  out[9] = s58 * y * (3.0f * x * x - y * y);
+  out[10] = s15 * x * y * z;
+  out[11] = s38 * y * (5.0f * z * z - 1.0f);
+  out[12] = 0.5f * z * (5.0f * z * z - 3.0f);
+  out[13] = s38 * x * (5.0f * z * z - 1.0f);
+  out[14] = 0.5f * s15 * z * (x * x - y * y);
+  out[15] = s58 * x * (x * x - 3.0f * y * y);
+}
+
+/* Engine angles (positive azimuth to the right) to an ambisonic vector */
+static void ae_ambisonic_direction(float az_deg, float el_deg, float *v) {
+  float az = -az_deg * (float)M_PI / 180.0f;
+  float el = el_deg * (float)M_PI / 180.0f;
+  v[0] = cosf(el) * cosf(az);
+  v[1] = cosf(el) * sinf(az);
+  v[2] = sinf(el);
+}
+
+/* Gauss-Legendre nodes and weights on [-1, 1] */
+static void ae_ambisonic_gauss_legendre(size_t n, double *nodes,
+                                        double *weights) {
+  for (size_t i = 0; i < n; ++i) {
+    double x = cos(M_PI * ((double)i + 0.75) / ((double)n + 0.5));
+    double dp = 1.0;
+    for (int iter = 0; iter < 100; ++iter) {
+      double p0 = 1.0;
+      double p1 = x;
+      for (size_t k = 2; k <= n; ++k) {
+        double p2 = ((2.0 * k - 1.0) * x * p1 - (k - 1.0) * p0) / (double)k;
+        p0 = p1;
+        p1 = p2;
+      }
+      dp = (double)n * (x * p1 - p0) / (x * x - 1.0);
+      double dx = p1 / dp;
+      x -= dx;
+      if (fabs(dx) < 1e-15)
+        break;
+    }
+    nodes[i] = x;
+    weights[i] = 2.0 / ((1.0 - x * x) * dp * dp);
+  }
+}
+
+/*============================================================================
+ * Rotation
+ *============================================================================*/
+
+static void ae_ambisonic_rotate_vector(const float r[9], const float *v,
+                                       float *out) {
+  for (int i = 0; i < 3; ++i)
+    out[i] = r[3 * i] * v[0] + r[3 * i + 1] * v[1] + r[3 * i + 2] * v[2];
+}
+
+/**
+ * Bus rotation for a head orientation: yaw turns right, pitch looks up,
+ * roll lowers the right ear. Each order's block comes from projecting the
+ * rotated harmonics back onto the originals over an exact quadrature.
+ */
+static void ae_ambisonic_rotation(uint32_t order, size_t channels, float yaw,
+                                  float pitch, float roll, float *matrix) {
+  float cy = cosf(yaw * (float)M_PI / 180.0f);
+  float sy = sinf(yaw * (float)M_PI / 180.0f);
+  float cp = cosf(pitch * (float)M_PI / 180.0f);
+  float sp = sinf(pitch * (float)M_PI / 180.0f);
+  float cr = cosf(roll * (float)M_PI / 180.0f);
+  float sr = sinf(roll * (float)M_PI / 180.0f);
+  /* World to head: Rx(-roll) Ry(pitch) Rz(yaw) */
+  float rz[9] = {cy, -sy, 0.0f, sy, cy, 0.0f, 0.0f, 0.0f, 1.0f};
+  float ry[9] = {cp, 0.0f, sp, 0.0f, 1.0f, 0.0f, -sp, 0.0f, cp};
+  float rx[9] = {1.0f, 0.0f, 0.0f, 0.0f, cr, sr, 0.0f, -sr, cr};
+  float ryz[9];
+  float r[9];
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      ryz[3 * i + j] = ry[3 * i] * rz[j] + ry[3 * i + 1] * rz[3 + j] +
+                       ry[3 * i + 2] * rz[6 + j];
+    }
+  }
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      r[3 * i + j] = rx[3 * i] * ryz[j] + rx[3 * i + 1] * ryz[3 + j] +
+                     rx[3 * i + 2] * ryz[6 + j];
+    }
+  }
+
+  double nodes[AE_AMBISONIC_ROT_EL];
+  double weights[AE_AMBISONIC_ROT_EL];
+  ae_ambisonic_gauss_legendre(AE_AMBISONIC_ROT_EL, nodes, weights);
+  double acc[AE_AMBISONIC_MAX_CHANNELS * AE_AMBISONIC_MAX_CHANNELS] = {0};
+  for (size_t e = 0; e < AE_AMBISONIC_ROT_EL; ++e) {
+    float z = (float)nodes[e];
+    float rho = sqrtf(1.0f - z * z);
+    double w = weights[e] * 2.0 * M_PI / AE_AMBISONIC_ROT_AZ;
+    for (size_t a = 0; a < AE_AMBISONIC_ROT_AZ; ++a) {
+      float phi = 2.0f * (float)M_PI * (float)a / AE_AMBISONIC_ROT_AZ;
+      float v[3] = {rho * cosf(phi), rho * sinf(phi), z};
+      float rv[3];
+      ae_ambisonic_rotate_vector(r, v, rv);
+      float sh[AE_AMBISONIC_MAX_CHANNELS];
+      float rotated_sh[AE_AMBISONIC_MAX_CHANNELS];
+      ae_ambisonic_sh(order, v[0], v[1], v[2], sh);
+      ae_ambisonic_sh(order, rv[0], rv[1], rv[2], rotated_sh);
+      for (uint32_t l = 0; l <= order; ++l) {
+        for (size_t i = l * l; i < (l + 1) * (l + 1); ++i) {
+          for (size_t j = l * l; j < (l + 1) * (l + 1); ++j)
+            acc[i * channels + j] += w * rotated_sh[i] * sh[j];
+        }
+      }
+    }
+  }
+  memset(matrix, 0, channels * channels * sizeof(float));
+  for (uint32_t l = 0; l <= order; ++l) {
+    double norm = (2.0 * l + 1.0) / (4.0 * M_PI);
+    for (size_t i = l * l; i < (l + 1) * (l + 1); ++i) {
+      for (size_t j = l * l; j < (l + 1) * (l + 1); ++j)
+        matrix[i * channels + j] = (float)(acc[i * channels + j] * norm);
+    }
+  }
+}
+
+/*============================================================================
+ * Lifecycle
+ *============================================================================*/
+
+AE_API ae_ambisonic_bus_t *
+ae_ambisonic_bus_create(const ae_ambisonic_config_t *config) {
+  if (!config || config->order < 1 ||
+      config->order > AE_AMBISONIC_MAX_ORDER || config->max_frames == 0 ||
+      config->max_taps == 0)
+    return NULL;
+  ae_ambisonic_bus_t *bus =
+      (ae_ambisonic_bus_t *)calloc(1, sizeof(ae_ambisonic_bus_t));
+  if (!bus)
+    return NULL;
+  bus->order = config->order;
+  bus->channels = AE_AMBISONIC_CHANNELS(config->order);
+  bus->max_frames = config->max_frames;
+  bus->max_taps = config->max_taps;
+
+  size_t samples = bus->channels * bus->max_frames;
+  bus->bus = (float *)calloc(samples, sizeof(float));
+  bus->rotated = (float *)calloc(samples, sizeof(float));
+  bus->scratch_l = (float *)calloc(bus->max_frames, sizeof(float));
+  bus->scratch_r = (float *)calloc(bus->max_frames, sizeof(float));
+  bus->filter_l = (float *)calloc(bus->max_taps, sizeof(float));
+  bus->filter_r = (float *)calloc(bus->max_taps, sizeof(float));
+  bool ok = bus->bus && bus->rotated && bus->scratch_l && bus->scratch_r &&
+            bus->filter_l && bus->filter_r;
+  ae_convolver_config_t conv_config = {.max_taps = config->max_taps,
+                                       .partition_size =
+                                           config->partition_size,
+                                       .crossfade_samples = 0};
+  for (size_t c = 0; c < bus->channels && ok; ++c) {
+    bus->decoder[c] = ae_convolver_create(&conv_config);
+    ok = bus->decoder[c] != NULL;
+  }
+  if (!ok) {
+    ae_ambisonic_bus_destroy(bus);
+    return NULL;
+  }
+
+  AE_ATOMIC_STORE(&bus->yaw_deg, 0.0f);
+  AE_ATOMIC_STORE(&bus->pitch_deg, 0.0f);
+  AE_ATOMIC_STORE(&bus->roll_deg, 0.0f);
+  for (size_t c = 0; c < bus->channels; ++c)
+    bus->matrix[c * bus->channels + c] = 1.0f;
+  bus->identity = true;
+  return bus;
+}
+
+AE_API void ae_ambisonic_bus_destroy(ae_ambisonic_bus_t *bus) {
+  if (!bus)
+    return;
+  for (size_t c = 0; c < AE_AMBISONIC_MAX_CHANNELS; ++c)
+    ae_convolver_destroy(bus->decoder[c]);
+  free(bus->bus);
+  free(bus->rotated);
+  free(bus->scratch_l);
+  free(bus->scratch_r);
+  free(bus->filter_l);
+  free(bus->filter_r);
+  free(bus);
+}
+
+/* Clears the bus and decoder history; decoder filters and rotation stay */
+AE_API void ae_ambisonic_bus_reset(ae_ambisonic_bus_t *bus) {
+  if (!bus)
+    return;
+  ae_clear_buffer(bus->bus, bus->channels * bus->max_frames);
+  for (size_t c = 0; c < bus->channels; ++c)
+    ae_convolver_reset(bus->decoder[c]);
+}
+
+/*============================================================================
+ * Decoder
+ *============================================================================*/
+
+/* In-place Gauss-Jordan inverse of an n x n matrix; false if singular */
+static bool ae_ambisonic_invert(double *a, double *inv, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j)
+      inv[i * n + j] = i == j ? 1.0 : 0.0;
+  }
+  for (size_t col = 0; col < n; ++col) {
+    size_t pivot = col;
+    for (size_t r = col + 1; r < n; ++r) {
+      if (fabs(a[r * n + col]) > fabs(a[pivot * n + col]))
+        pivot = r;
+    }
+    if (fabs(a[pivot * n + col]) < 1e-12)
+      return false;
+    for (size_t j = 0; j < n; ++j) {
+      double t = a[col * n + j];
+      a[col * n + j] = a[pivot * n + j];
+      a[pivot * n + j] = t;
+      t = inv[col * n + j];
+      inv[col * n + j] = inv[pivot * n + j];
+      inv[pivot * n + j] = t;
+    }
+    double scale = 1.0 / a[col * n + col];
+    for (size_t j = 0; j < n; ++j) {
+      a[col * n + j] *= scale;
+      inv[col * n + j] *= scale;
+    }
+    for (size_t r = 0; r < n; ++r) {
+      double f = a[r * n + col];
+      if (r == col || f == 0.0)
+        continue;
+      for (size_t j = 0; j < n; ++j) {
+        a[r * n + j] -= f * a[col * n + j];
+        inv[r * n + j] -= f * inv[col * n + j];
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Build the binaural decoder from virtual loudspeaker HRIRs: hrirs_l/r are
+ * [speakers][taps]. Speaker gains come from a regularized mode-matching
+ * (pseudo-inverse) decoder, which reduces to plain projection on uniform
+ * layouts, and are folded into one filter pair per bus channel. Needs at
+ * least AE_AMBISONIC_CHANNELS(order) speakers. Safe to call while another
+ * thread decodes; the new filters crossfade in.
+ */
+AE_API ae_result_t ae_ambisonic_set_decoder(
+    ae_ambisonic_bus_t *bus, const float *azimuth_deg,
+    const float *elevation_deg, const float *hrirs_l, const float *hrirs_r,
+    size_t speakers, size_t taps) {
+  if (!bus || !azimuth_deg || !elevation_deg || !hrirs_l || !hrirs_r ||
+      taps == 0 || taps > bus->max_taps || speakers < bus->channels)
+    return AE_ERROR_INVALID_PARAM;
+
+  size_t channels = bus->channels;
+  double *y = (double *)malloc(channels * speakers * sizeof(double));
+  double *decode = (double *)malloc(channels * speakers * sizeof(double));
+  double gram[AE_AMBISONIC_MAX_CHANNELS * AE_AMBISONIC_MAX_CHANNELS];
+  double inv[AE_AMBISONIC_MAX_CHANNELS * AE_AMBISONIC_MAX_CHANNELS];
+  if (!y || !decode) {
+    free(y);
+    free(decode);
+    return AE_ERROR_OUT_OF_MEMORY;
+  }
+
+  for (size_t s = 0; s < speakers; ++s) {
+    float v[3];
+    float sh[AE_AMBISONIC_MAX_CHANNELS];
+    ae_ambisonic_direction(azimuth_deg[s], elevation_deg[s], v);
+    ae_ambisonic_sh(bus->order, v[0], v[1], v[2], sh);
+    for (size_t c = 0; c < channels; ++c)
+      y[c * speakers + s] = sh[c];
+  }
+  /* D = Y^T (Y Y^T + eps I)^-1 */
+  double trace = 0.0;
+  for (size_t i = 0; i < channels; ++i) {
+    for (size_t j = 0; j < channels; ++j) {
+      double sum = 0.0;
+      for (size_t s = 0; s < speakers; ++s)
+        sum += y[i * speakers + s] * y[j * speakers + s];
+      gram[i * channels + j] = sum;
+    }
+    trace += gram[i * channels + i];
+  }
+  for (size_t i = 0; i < channels; ++i)
+    gram[i * channels + i] +=
+        AE_AMBISONIC_REGULARIZATION * trace / (double)channels;
+  if (!ae_ambisonic_invert(gram, inv, channels)) {
+    free(y);
+    free(decode);
+    return AE_ERROR_INVALID_PARAM;
+  }
+  for (size_t c = 0; c < channels; ++c) {
+    for (size_t s = 0; s < speakers; ++s) {
+      double sum = 0.0;
+      for (size_t k = 0; k < channels; ++k)
+        sum += inv[c * channels + k] * y[k * speakers + s];
+      decode[c * speakers + s] = sum;
+    }
+  }
+
+  ae_result_t result = AE_OK;
+  for (size_t c = 0; c < channels && result == AE_OK; ++c) {
+    ae_clear_buffer(bus->filter_l, taps);
+    ae_clear_buffer(bus->filter_r, taps);
+    for (size_t s = 0; s < speakers; ++s) {
+      float g = (float)decode[c * speakers + s];
+      const float *h_l = hrirs_l + s * taps;
+      const float *h_r = hrirs_r + s * taps;
+      for (size_t k = 0; k < taps; ++k) {
+        bus->filter_l[k] += g * h_l[k];
+        bus->filter_r[k] += g * h_r[k];
+      }
+    }
+    result = ae_convolver_set_filters(bus->decoder[c], bus->filter_l,
+                                      bus->filter_r, taps);
+  }
+  free(y);
+  free(decode);
+  return result;
+}
+
+/**
+ * Decoder from a SOFA file: virtual speakers on a Gauss-Legendre grid,
+ * onset delays folded into the HRIRs. The file is closed before returning.
+ */
+AE_API ae_result_t ae_ambisonic_load_sofa(ae_ambisonic_bus_t *bus,
+                                          const char *path,
+                                          float sample_rate) {
+  if (!bus || !path || path[0] == '\0' || !(sample_rate > 0.0f))
+    return AE_ERROR_INVALID_PARAM;
+#ifdef AE_USE_LIBMYSOFA
+  int err = 0;
+  struct MYSOFA_EASY *sofa = mysofa_open(path, sample_rate, &err);
+  if (!sofa || err != MYSOFA_OK) {
+    if (sofa)
+      mysofa_close(sofa);
+    return AE_ERROR_HRTF_LOAD_FAILED;
+  }
+  size_t hrir_len = (size_t)sofa->hrtf->N;
+  if (hrir_len == 0 || hrir_len > bus->max_taps) {
+    mysofa_close(sofa);
+    return AE_ERROR_HRTF_LOAD_FAILED;
+  }
+  size_t taps = hrir_len + (size_t)(AE_HRIR_MAX_ONSET_S * sample_rate);
+  if (taps > bus->max_taps)
+    taps = bus->max_taps;
+
+  size_t speakers = AE_AMBISONIC_SOFA_EL * AE_AMBISONIC_SOFA_AZ;
+  float *az = (float *)malloc(speakers * sizeof(float));
+  float *el = (float *)malloc(speakers * sizeof(float));
+  float *hrirs_l = (float *)calloc(speakers * taps, sizeof(float));
+  float *hrirs_r = (float *)calloc(speakers * taps, sizeof(float));
+  ae_result_t result = AE_ERROR_OUT_OF_MEMORY;
+  if (az && el && hrirs_l && hrirs_r) {
+    double nodes[AE_AMBISONIC_SOFA_EL];
+    double weights[AE_AMBISONIC_SOFA_EL];
+    ae_ambisonic_gauss_legendre(AE_AMBISONIC_SOFA_EL, nodes, weights);
+    ae_sofa_source_t source = {sofa, sample_rate};
+    result = AE_OK;
+    for (size_t s = 0; s < speakers && result == AE_OK; ++s) {
+      size_t e = s / AE_AMBISONIC_SOFA_AZ;
+      size_t a = s % AE_AMBISONIC_SOFA_AZ;
+      el[s] = (float)(asin(nodes[e]) * 180.0 / M_PI);
+      az[s] = 360.0f * (float)a / AE_AMBISONIC_SOFA_AZ - 180.0f;
+      float *h_l = hrirs_l + s * taps;
+      float *h_r = hrirs_r + s * taps;
+      float delay_l = 0.0f;
+      float delay_r = 0.0f;
+      if (!ae_spatial_sample_sofa(&source, az[s], el[s], h_l, h_r, &delay_l,
+                                  &delay_r)) {
+        result = AE_ERROR_HRTF_LOAD_FAILED;
+        break;
+      }
+      ae_hrir_apply_onset(h_l, hrir_len, taps, delay_l);
+      ae_hrir_apply_onset(h_r, hrir_len, taps, delay_r);
+    }
+  }
+  mysofa_close(sofa);
+  if (result == AE_OK)
+    result = ae_ambisonic_set_decoder(bus, az, el, hrirs_l, hrirs_r,
+                                      speakers, taps);
+  free(az);
+  free(el);
+  free(hrirs_l);
+  free(hrirs_r);
+  return result;
+#else
+  return AE_ERROR_HRTF_LOAD_FAILED;
+#endif
+}
+
+AE_API ae_result_t ae_ambisonic_set_rotation(ae_ambisonic_bus_t *bus,
+                                             float yaw_deg, float pitch_deg,
+                                             float roll_deg) {
+  if (!bus || !isfinite(yaw_deg) || !isfinite(pitch_deg) ||
+      !isfinite(roll_deg))
+    return AE_ERROR_INVALID_PARAM;
+  AE_ATOMIC_STORE(&bus->yaw_deg, yaw_deg);
+  AE_ATOMIC_STORE(&bus->pitch_deg, pitch_deg);
+  AE_ATOMIC_STORE(&bus->roll_deg, roll_deg);
+  return AE_OK;
+}
+
+/*============================================================================
+ * Processing
+ *============================================================================*/
+
+AE_API ae_result_t ae_ambisonic_gains(uint32_t order, float azimuth_deg,
+                                      float elevation_deg, float *gains) {
+  if (!gains || order < 1 || order > AE_AMBISONIC_MAX_ORDER)
+    return AE_ERROR_INVALID_PARAM;
+  float v[3];
+  ae_ambisonic_direction(azimuth_deg, elevation_deg, v);
+  ae_ambisonic_sh(order, v[0], v[1], v[2], gains);
+  return AE_OK;
+}
+
+/* dst[i] += (gain + step * (i + 1)) * src[i] */
+static void ae_ambisonic_mac(float *dst, const float *src, float gain,
+                             float step, size_t n) {
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  __m128 g = _mm_setr_ps(gain + step, gain + 2.0f * step, gain + 3.0f * step,
+                         gain + 4.0f * step);
+  __m128 dg = _mm_set1_ps(4.0f * step);
+  for (; i + 4 <= n; i += 4) {
+    __m128 acc = _mm_loadu_ps(dst + i);
+    acc = _mm_add_ps(acc, _mm_mul_ps(g, _mm_loadu_ps(src + i)));
+    _mm_storeu_ps(dst + i, acc);
+    g = _mm_add_ps(g, dg);
+  }
+#endif
+  for (; i < n; ++i)
+    dst[i] += (gain + step * (float)(i + 1)) * src[i];
+}
+
+/**
+ * Mix frames of a mono source into the bus with gains from
+ * ae_ambisonic_gains (scaled as needed). With prev_gains, the gains ramp
+ * from prev_gains to gains over the block, so a moving source does not
+ * zipper.
+ */
+AE_API ae_result_t ae_ambisonic_encode(ae_ambisonic_bus_t *bus,
+                                       const float *input, size_t frames,
+                                       const float *gains,
+                                       const float *prev_gains) {
+  if (!bus || !input || !gains)
+    return AE_ERROR_INVALID_PARAM;
+  if (frames > bus->max_frames)
+    return AE_ERROR_BUFFER_TOO_SMALL;
+  if (frames == 0)
+    return AE_OK;
+  for (size_t c = 0; c < bus->channels; ++c) {
+    float from = prev_gains ? prev_gains[c] : gains[c];
+    float step = (gains[c] - from) / (float)frames;
+    if (from == 0.0f && step == 0.0f)
+      continue;
+    ae_ambisonic_mac(bus->bus + c * bus->max_frames, input, from, step,
+                     frames);
+  }
+  return AE_OK;
+}
+
+/* Rotate the bus into bus->rotated, ramping if the orientation changed */
+static const float *ae_ambisonic_apply_rotation(ae_ambisonic_bus_t *bus,
+                                                size_t frames) {
+  float target[3] = {AE_ATOMIC_LOAD(&bus->yaw_deg),
+                     AE_ATOMIC_LOAD(&bus->pitch_deg),
+                     AE_ATOMIC_LOAD(&bus->roll_deg)};
+  bool changed = target[0] != bus->applied[0] ||
+                 target[1] != bus->applied[1] ||
+                 target[2] != bus->applied[2];
+  if (!changed && bus->identity)
+    return bus->bus;
+
+  size_t channels = bus->channels;
+  const float *to = bus->matrix;
+  if (changed) {
+    ae_ambisonic_rotation(bus->order, channels, target[0], target[1],
+                          target[2], bus->next);
+    to = bus->next;
+  }
+  size_t stride = bus->max_frames;
+  float inv_frames = 1.0f / (float)frames;
+  for (uint32_t l = 0; l <= bus->order; ++l) {
+    for (size_t i = l * l; i < (l + 1) * (l + 1); ++i) {
+      float *dst = bus->rotated + i * stride;
+      ae_clear_buffer(dst, frames);
+      for (size_t j = l * l; j < (l + 1) * (l + 1); ++j) {
+        float from = bus->matrix[i * channels + j];
+        float step = (to[i * channels + j] - from) * inv_frames;
+        if (from != 0.0f || step != 0.0f)
+          ae_ambisonic_mac(dst, bus->bus + j * stride, from, step, frames);
+      }
+    }
+  }
+  if (changed) {
+    memcpy(bus->matrix, bus->next, channels * channels * sizeof(float));
+    memcpy(bus->applied, target, sizeof(target));
+    bus->identity =
+        target[0] == 0.0f && target[1] == 0.0f && target[2] == 0.0f;
+  }
+  return bus->rotated;
+}
+
+/**
+ * Rotate and decode the bus to binaural, then clear it for the next block.
+ * frames must match the frames encoded since the last decode.
+ */
+AE_API ae_result_t ae_ambisonic_decode(ae_ambisonic_bus_t *bus, float *out_l,
+                                       float *out_r, size_t frames) {
+  if (!bus || !out_l || !out_r)
+    return AE_ERROR_INVALID_PARAM;
+  if (frames > bus->max_frames)
+    return AE_ERROR_BUFFER_TOO_SMALL;
+  if (frames == 0)
+    return AE_OK;
+
+  const float *signal = ae_ambisonic_apply_rotation(bus, frames);
+  size_t stride = bus->max_frames;
+  ae_convolver_process(bus->decoder[0], signal, out_l, out_r, frames);
+  for (size_t c = 1; c < bus->channels; ++c) {
+    ae_convolver_process(bus->decoder[c], signal + c * stride,
+                         bus->scratch_l, bus->scratch_r, frames);
+    for (size_t i = 0; i < frames; ++i) {
+      out_l[i] += bus->scratch_l[i];
+      out_r[i] += bus->scratch_r[i];
+    }
+  }
+  for (size_t c = 0; c < bus->channels; ++c)
+    ae_clear_buffer(bus->bus + c * stride, frames);
+  return AE_OK;
+}
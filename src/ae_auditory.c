@@ -218,17 +218,24 @@ AE_API ae_result_t ae_ihc_envelope(const float *basilar_membrane_output,
   float alpha = dt / (rc + dt);
 
   float state = 0.0f;
+  float compressed[64];
+
+  for (size_t start = 0; start < n_samples; start += 64) {
+    size_t count = n_samples - start < 64 ? n_samples - start : 64;
 
-  for (size_t i = 0; i < n_samples; ++i) {
     /* Half-wave rectification */
-    float rectified = fmaxf(0.0f, basilar_membrane_output[i]);
+    for (size_t i = 0; i < count; ++i)
+      compressed[i] =
+          fmaxf(0.0f, basilar_membrane_output[start + i]) + AE_LOG_EPSILON;
 
-    /* Compression */
-    float compressed = powf(rectified + AE_LOG_EPSILON, theta);
+    /* Compression, a tile at a time */
+    ae_fast_pow(compressed, compressed, theta, count, AE_MATH_1E4);
 
     /* Lowpass filter */
-    state = state + alpha * (compressed - state);
-    ihc_output[i] = state;
+    for (size_t i = 0; i < count; ++i) {
+      state = state + alpha * (compressed[i] - state);
+      ihc_output[start + i] = state;
+    }
   }
 
   return AE_OK;
@@ -0,0 +1,795 @@
+/**
+ * @file ae_convolver.c
+ * @brief Zero-latency partitioned convolution (mono in, stereo out)
+ *
+ * Filter taps [0, B) run direct-form against the input history, so output
+ * sample n needs nothing newer than input n. Taps [B, L) are split into
+ * B-tap partitions and run as uniformly partitioned overlap-save in the
+ * frequency domain: each completed input block is transformed once (2B-point
+ * real FFT) and pushed into a frequency-domain delay line that both ears
+ * read, and the result lands exactly one block later, which is where those
+ * taps start anyway.
+ *
+ * Filters live in three sets. The control thread fills a free set and
+ * publishes it; the audio thread picks it up at a block boundary and, while
+ * the previous set is still held, runs both and crossfades. No locks, no
+ * allocation after create.
+ *
+ * ae_convolver_process_group runs the direct-form part of up to
+ * AE_CONVOLVER_LANES convolvers at once, one convolver per SIMD lane, over
+ * interleaved copies of their input windows and head taps. The FFT
+ * partitions stay per convolver; the arithmetic is unchanged.
+ */
+
+#include "ae_internal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define AE_HAS_AVX2 1
+#endif
+
+#define AE_CONVOLVER_MIN_PARTITION 16
+#define AE_CONVOLVER_MAX_PARTITION 1024
+#define AE_CONVOLVER_AUTO_SHORT 32 /* Up to 256 taps */
+#define AE_CONVOLVER_AUTO_LONG 64
+#define AE_CONVOLVER_DEFAULT_FADE 256
+#define AE_CONVOLVER_SETS 3 /* Active, fading out, being written */
+#define AE_CONVOLVER_NONE (-1)
+#define AE_CONVOLVER_LANES 8 /* Convolvers per batch: 2 x SSE2 or 1 x AVX */
+
+typedef enum {
+  AE_FILTER_SET_FREE = 0, /* Control thread may write */
+  AE_FILTER_SET_WRITING,  /* Control thread is filling it */
+  AE_FILTER_SET_READY,    /* Published, not yet picked up */
+  AE_FILTER_SET_READING   /* Active or fading out on the audio thread */
+} ae_filter_set_state_t;
+
+typedef struct {
+  float *head[2];      /* Taps [0, B) per ear, time reversed */
+  float *filter_re[2]; /* [max_partitions][stride] per ear, scaled 1/2B */
+  float *filter_im[2];
+  size_t partitions; /* FFT partitions in use */
+  ae_atomic_int state;
+} ae_filter_set_t;
+
+struct ae_convolver {
+  size_t block;          /* Partition length B */
+  size_t max_taps;
+  size_t max_partitions; /* FFT partitions the buffers hold */
+  size_t stride;         /* Spectrum length B + 1, padded to 4 */
+  size_t fade_blocks;    /* Crossfade length in blocks */
+
+  ae_filter_set_t sets[AE_CONVOLVER_SETS];
+  ae_fft_t filter_fft; /* Control thread's plan and scratch */
+  float *filter_time;
+
+  /* Audio thread only below */
+  int active;        /* Set in use, or AE_CONVOLVER_NONE */
+  int fading;        /* Set being faded out, or AE_CONVOLVER_NONE */
+  size_t fade_block; /* Blocks of the crossfade completed */
+  long id;           /* Unique per convolver, for batch head caches */
+  size_t generation; /* Bumped whenever active or fading changes */
+  ae_fft_t fft;
+  float *fdl_re; /* Input spectra, newest just before fdl_index */
+  float *fdl_im;
+  size_t fdl_index;
+
+  float *input;   /* Previous and current input block (2B) */
+  size_t fill;    /* Samples of the current block received */
+  float *tail[2]; /* FFT partitions' output for the current block */
+  float *fade_tail[2];
+  float *acc_re; /* Scratch: 2 x stride */
+  float *acc_im;
+  float *time; /* Scratch: 2B */
+
+  /* Batch scratch, used while this convolver leads a group */
+  float *lane_x; /* Input windows: [2B][lanes] */
+  float *lane_h; /* Head taps: [active, fading][ear][B][lanes] */
+  float *lane_y; /* Head output: [ear][B][lanes] */
+  size_t lane_count; /* Batch lane_h was built for: ids and generations */
+  long lane_id[AE_CONVOLVER_LANES];
+  size_t lane_gen[AE_CONVOLVER_LANES];
+};
+
+static ae_atomic_int ae_convolver_next_id;
+
+static float *ae_convolver_alloc(size_t n) {
+  return (float *)calloc(n, sizeof(float));
+}
+
+AE_API ae_convolver_t *
+ae_convolver_create(const ae_convolver_config_t *config) {
+  if (!config || config->max_taps == 0)
+    return NULL;
+  size_t block = config->partition_size;
+  if (block == 0) {
+    /* Measured optimum for typical HRIR lengths (bench_engine) */
+    size_t cap = config->max_taps <= 256 ? AE_CONVOLVER_AUTO_SHORT
+                                         : AE_CONVOLVER_AUTO_LONG;
+    block = ae_next_pow2(config->max_taps);
+    if (block > cap)
+      block = cap;
+  }
+  if ((block & (block - 1)) != 0 || block > AE_CONVOLVER_MAX_PARTITION)
+    return NULL;
+  if (block < AE_CONVOLVER_MIN_PARTITION)
+    block = AE_CONVOLVER_MIN_PARTITION;
+
+  ae_convolver_t *conv = (ae_convolver_t *)calloc(1, sizeof(ae_convolver_t));
+  if (!conv)
+    return NULL;
+  conv->block = block;
+  conv->max_taps = config->max_taps;
+  conv->max_partitions =
+      conv->max_taps > block ? (conv->max_taps - 1) / block : 0;
+  conv->stride = (block + 1 + 3) & ~(size_t)3;
+  size_t fade = config->crossfade_samples > 0 ? config->crossfade_samples
+                                              : AE_CONVOLVER_DEFAULT_FADE;
+  conv->fade_blocks = (fade + block - 1) / block;
+  conv->active = AE_CONVOLVER_NONE;
+  conv->fading = AE_CONVOLVER_NONE;
+  long id = AE_ATOMIC_LOAD_INT(&ae_convolver_next_id);
+  while (!AE_ATOMIC_CAS_INT(&ae_convolver_next_id, id, id + 1))
+    id = AE_ATOMIC_LOAD_INT(&ae_convolver_next_id);
+  conv->id = id;
+
+  size_t spectra = conv->max_partitions * conv->stride;
+  bool ok = true;
+  if (spectra > 0) {
+    ok = ae_fft_init(&conv->fft, 2 * block) &&
+         ae_fft_init(&conv->filter_fft, 2 * block);
+    conv->fdl_re = ae_convolver_alloc(spectra);
+    conv->fdl_im = ae_convolver_alloc(spectra);
+    conv->acc_re = ae_convolver_alloc(2 * conv->stride);
+    conv->acc_im = ae_convolver_alloc(2 * conv->stride);
+    conv->time = ae_convolver_alloc(2 * block);
+    conv->filter_time = ae_convolver_alloc(2 * block);
+    ok = ok && conv->fdl_re && conv->fdl_im && conv->acc_re &&
+         conv->acc_im && conv->time && conv->filter_time;
+  }
+  conv->input = ae_convolver_alloc(2 * block);
+  conv->lane_x = ae_convolver_alloc(2 * block * AE_CONVOLVER_LANES);
+  conv->lane_h = ae_convolver_alloc(4 * block * AE_CONVOLVER_LANES);
+  conv->lane_y = ae_convolver_alloc(2 * block * AE_CONVOLVER_LANES);
+  ok = ok && conv->input && conv->lane_x && conv->lane_h && conv->lane_y;
+  for (int ear = 0; ear < 2; ++ear) {
+    conv->tail[ear] = ae_convolver_alloc(block);
+    conv->fade_tail[ear] = ae_convolver_alloc(block);
+    ok = ok && conv->tail[ear] && conv->fade_tail[ear];
+  }
+  for (int s = 0; s < AE_CONVOLVER_SETS; ++s) {
+    ae_filter_set_t *set = &conv->sets[s];
+    AE_ATOMIC_STORE_INT(&set->state, AE_FILTER_SET_FREE);
+    for (int ear = 0; ear < 2; ++ear) {
+      set->head[ear] = ae_convolver_alloc(block);
+      ok = ok && set->head[ear];
+      if (spectra > 0) {
+        set->filter_re[ear] = ae_convolver_alloc(spectra);
+        set->filter_im[ear] = ae_convolver_alloc(spectra);
+        ok = ok && set->filter_re[ear] && set->filter_im[ear];
+      }
+    }
+  }
+  if (!ok) {
+    ae_convolver_destroy(conv);
+    return NULL;
+  }
+  return conv;
+}
+
+AE_API void ae_convolver_destroy(ae_convolver_t *conv) {
+  if (!conv)
+    return;
+  ae_fft_free(&conv->fft);
+  ae_fft_free(&conv->filter_fft);
+  for (int s = 0; s < AE_CONVOLVER_SETS; ++s) {
+    for (int ear = 0; ear < 2; ++ear) {
+      free(conv->sets[s].head[ear]);
+      free(conv->sets[s].filter_re[ear]);
+      free(conv->sets[s].filter_im[ear]);
+    }
+  }
+  for (int ear = 0; ear < 2; ++ear) {
+    free(conv->tail[ear]);
+    free(conv->fade_tail[ear]);
+  }
+  free(conv->fdl_re);
+  free(conv->fdl_im);
+  free(conv->input);
+  free(conv->acc_re);
+  free(conv->acc_im);
+  free(conv->time);
+  free(conv->filter_time);
+  free(conv->lane_x);
+  free(conv->lane_h);
+  free(conv->lane_y);
+  free(conv);
+}
+
+/* Clears the signal history; the current filters stay (audio thread) */
+AE_API void ae_convolver_reset(ae_convolver_t *conv) {
+  if (!conv)
+    return;
+  size_t spectra = conv->max_partitions * conv->stride;
+  ae_clear_buffer(conv->input, 2 * conv->block);
+  ae_clear_buffer(conv->fdl_re, spectra);
+  ae_clear_buffer(conv->fdl_im, spectra);
+  conv->fdl_index = 0;
+  conv->fill = 0;
+}
+
+/**
+ * Publish new filters for both ears. Safe to call from one control thread
+ * while another thread runs ae_convolver_process: the filters are prepared
+ * here, and the audio thread crossfades to them from its next block
+ * boundary. A set published but not yet picked up is replaced.
+ */
+AE_API ae_result_t ae_convolver_set_filters(ae_convolver_t *conv,
+                                            const float *ir_l,
+                                            const float *ir_r, size_t taps) {
+  if (!conv || !ir_l || !ir_r || taps == 0 || taps > conv->max_taps)
+    return AE_ERROR_INVALID_PARAM;
+
+  /* Take back an unconsumed set first, so at most one is ever pending */
+  ae_filter_set_t *set = NULL;
+  while (!set) {
+    for (int s = 0; s < AE_CONVOLVER_SETS && !set; ++s) {
+      if (AE_ATOMIC_CAS_INT(&conv->sets[s].state, AE_FILTER_SET_READY,
+                            AE_FILTER_SET_WRITING))
+        set = &conv->sets[s];
+    }
+    for (int s = 0; s < AE_CONVOLVER_SETS && !set; ++s) {
+      if (AE_ATOMIC_CAS_INT(&conv->sets[s].state, AE_FILTER_SET_FREE,
+                            AE_FILTER_SET_WRITING))
+        set = &conv->sets[s];
+    }
+    if (!set)
+      ae_thread_yield(); /* Only with concurrent writers */
+  }
+
+  size_t block = conv->block;
+  const float *irs[2] = {ir_l, ir_r};
+  size_t head_taps = taps < block ? taps : block;
+  set->partitions = taps > block ? (taps - block + block - 1) / block : 0;
+  float scale = 1.0f / (float)(2 * block);
+
+  for (int ear = 0; ear < 2; ++ear) {
+    float *head = set->head[ear];
+    ae_clear_buffer(head, block);
+    for (size_t k = 0; k < head_taps; ++k)
+      head[block - 1 - k] = irs[ear][k];
+
+    for (size_t p = 0; p < set->partitions; ++p) {
+      size_t start = block + p * block;
+      size_t n = taps - start < block ? taps - start : block;
+      ae_clear_buffer(conv->filter_time, 2 * block);
+      for (size_t k = 0; k < n; ++k)
+        conv->filter_time[k] = irs[ear][start + k] * scale;
+      ae_fft_forward(&conv->filter_fft, conv->filter_time,
+                     set->filter_re[ear] + p * conv->stride,
+                     set->filter_im[ear] + p * conv->stride);
+    }
+  }
+  AE_ATOMIC_STORE_INT(&set->state, AE_FILTER_SET_READY);
+  return AE_OK;
+}
+
+/* Both ears' head partitions against the same input window */
+static void ae_convolver_head(const float *head_l, const float *head_r,
+                              const float *x, size_t n, float *out_l,
+                              float *out_r) {
+#ifdef AE_HAS_SSE2
+  __m128 acc_l = _mm_setzero_ps();
+  __m128 acc_r = _mm_setzero_ps();
+  for (size_t k = 0; k < n; k += 4) {
+    __m128 v = _mm_loadu_ps(x + k);
+    acc_l = _mm_add_ps(acc_l, _mm_mul_ps(_mm_loadu_ps(head_l + k), v));
+    acc_r = _mm_add_ps(acc_r, _mm_mul_ps(_mm_loadu_ps(head_r + k), v));
+  }
+  /* Horizontal sums of both accumulators at once */
+  __m128 lo = _mm_unpacklo_ps(acc_l, acc_r);
+  __m128 hi = _mm_unpackhi_ps(acc_l, acc_r);
+  __m128 sum = _mm_add_ps(lo, hi);
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  float pair[4];
+  _mm_storeu_ps(pair, sum);
+  *out_l = pair[0];
+  *out_r = pair[1];
+#else
+  float sum_l = 0.0f;
+  float sum_r = 0.0f;
+  for (size_t k = 0; k < n; ++k) {
+    sum_l += head_l[k] * x[k];
+    sum_r += head_r[k] * x[k];
+  }
+  *out_l = sum_l;
+  *out_r = sum_r;
+#endif
+}
+
+/* acc += x * h over one spectrum, both ears sharing x */
+static void ae_convolver_mac(const float *x_re, const float *x_im,
+                             const float *hl_re, const float *hl_im,
+                             const float *hr_re, const float *hr_im,
+                             float *acc_re, float *acc_im, size_t stride) {
+  float *accl_re = acc_re, *accl_im = acc_im;
+  float *accr_re = acc_re + stride, *accr_im = acc_im + stride;
+#ifdef AE_HAS_SSE2
+  for (size_t k = 0; k < stride; k += 4) {
+    __m128 xr = _mm_loadu_ps(x_re + k);
+    __m128 xi = _mm_loadu_ps(x_im + k);
+    __m128 lr = _mm_loadu_ps(hl_re + k);
+    __m128 li = _mm_loadu_ps(hl_im + k);
+    __m128 rr = _mm_loadu_ps(hr_re + k);
+    __m128 ri = _mm_loadu_ps(hr_im + k);
+    _mm_storeu_ps(accl_re + k,
+                  _mm_add_ps(_mm_loadu_ps(accl_re + k),
+                             _mm_sub_ps(_mm_mul_ps(xr, lr),
+                                        _mm_mul_ps(xi, li))));
+    _mm_storeu_ps(accl_im + k,
+                  _mm_add_ps(_mm_loadu_ps(accl_im + k),
+                             _mm_add_ps(_mm_mul_ps(xr, li),
+                                        _mm_mul_ps(xi, lr))));
+    _mm_storeu_ps(accr_re + k,
+                  _mm_add_ps(_mm_loadu_ps(accr_re + k),
+                             _mm_sub_ps(_mm_mul_ps(xr, rr),
+                                        _mm_mul_ps(xi, ri))));
+    _mm_storeu_ps(accr_im + k,
+                  _mm_add_ps(_mm_loadu_ps(accr_im + k),
+                             _mm_add_ps(_mm_mul_ps(xr, ri),
+                                        _mm_mul_ps(xi, rr))));
+  }
+#else
+  for (size_t k = 0; k < stride; ++k) {
+    accl_re[k] += x_re[k] * hl_re[k] - x_im[k] * hl_im[k];
+    accl_im[k] += x_re[k] * hl_im[k] + x_im[k] * hl_re[k];
+    accr_re[k] += x_re[k] * hr_re[k] - x_im[k] * hr_im[k];
+    accr_im[k] += x_re[k] * hr_im[k] + x_im[k] * hr_re[k];
+  }
+#endif
+}
+
+/* FFT partitions of one set over the delay line, into tail[0..1] */
+static void ae_convolver_tail(ae_convolver_t *conv, const ae_filter_set_t *set,
+                              float *const tail[2]) {
+  size_t block = conv->block;
+  size_t stride = conv->stride;
+  if (set->partitions == 0) {
+    ae_clear_buffer(tail[0], block);
+    ae_clear_buffer(tail[1], block);
+    return;
+  }
+  size_t newest = conv->fdl_index == 0 ? conv->max_partitions - 1
+                                       : conv->fdl_index - 1;
+  ae_clear_buffer(conv->acc_re, 2 * stride);
+  ae_clear_buffer(conv->acc_im, 2 * stride);
+  for (size_t p = 0; p < set->partitions; ++p) {
+    size_t s = newest >= p ? newest - p : newest + conv->max_partitions - p;
+    ae_convolver_mac(conv->fdl_re + s * stride, conv->fdl_im + s * stride,
+                     set->filter_re[0] + p * stride,
+                     set->filter_im[0] + p * stride,
+                     set->filter_re[1] + p * stride,
+                     set->filter_im[1] + p * stride, conv->acc_re,
+                     conv->acc_im, stride);
+  }
+  for (int ear = 0; ear < 2; ++ear) {
+    ae_fft_inverse(&conv->fft, conv->acc_re + ear * stride,
+                   conv->acc_im + ear * stride, conv->time);
+    /* Overlap-save: the second half is the linear part */
+    memcpy(tail[ear], conv->time + block, block * sizeof(float));
+  }
+}
+
+/* Block boundary: finish or start a crossfade, then the tails */
+static void ae_convolver_begin_block(ae_convolver_t *conv) {
+  if (conv->fading != AE_CONVOLVER_NONE &&
+      ++conv->fade_block >= conv->fade_blocks) {
+    AE_ATOMIC_STORE_INT(&conv->sets[conv->fading].state, AE_FILTER_SET_FREE);
+    conv->fading = AE_CONVOLVER_NONE;
+    ++conv->generation;
+  }
+  if (conv->fading == AE_CONVOLVER_NONE) {
+    for (int s = 0; s < AE_CONVOLVER_SETS; ++s) {
+      if (!AE_ATOMIC_CAS_INT(&conv->sets[s].state, AE_FILTER_SET_READY,
+                             AE_FILTER_SET_READING))
+        continue;
+      /* The very first filters start at full level */
+      conv->fading = conv->active;
+      conv->fade_block = 0;
+      conv->active = s;
+      ++conv->generation;
+      break;
+    }
+  }
+  if (conv->active == AE_CONVOLVER_NONE)
+    return;
+  ae_convolver_tail(conv, &conv->sets[conv->active], conv->tail);
+  if (conv->fading != AE_CONVOLVER_NONE)
+    ae_convolver_tail(conv, &conv->sets[conv->fading], conv->fade_tail);
+}
+
+/* Block complete: push its spectrum and slide the input window */
+static void ae_convolver_end_block(ae_convolver_t *conv) {
+  size_t block = conv->block;
+  if (conv->max_partitions > 0) {
+    size_t slot = conv->fdl_index;
+    ae_fft_forward(&conv->fft, conv->input, conv->fdl_re + slot * conv->stride,
+                   conv->fdl_im + slot * conv->stride);
+    conv->fdl_index = slot + 1 == conv->max_partitions ? 0 : slot + 1;
+  }
+  memcpy(conv->input, conv->input + block, block * sizeof(float));
+  conv->fill = 0;
+}
+
+/**
+ * Convolve frames of input with both filters. input may alias out_l or
+ * out_r. Outputs silence until the first ae_convolver_set_filters.
+ */
+AE_API ae_result_t ae_convolver_process(ae_convolver_t *conv,
+                                        const float *input, float *out_l,
+                                        float *out_r, size_t frames) {
+  if (!conv || !input || !out_l || !out_r)
+    return AE_ERROR_INVALID_PARAM;
+
+  size_t block = conv->block;
+  size_t i = 0;
+  while (i < frames) {
+    if (conv->fill == 0)
+      ae_convolver_begin_block(conv);
+    size_t n = block - conv->fill;
+    if (n > frames - i)
+      n = frames - i;
+    float *current = conv->input + block + conv->fill;
+    memcpy(current, input + i, n * sizeof(float));
+
+    if (conv->active == AE_CONVOLVER_NONE) {
+      ae_clear_buffer(out_l + i, n);
+      ae_clear_buffer(out_r + i, n);
+    } else {
+      const ae_filter_set_t *set = &conv->sets[conv->active];
+      for (size_t k = 0; k < n; ++k) {
+        float head_l, head_r;
+        /* Window ends at the current sample: x[n - B + 1] .. x[n] */
+        ae_convolver_head(set->head[0], set->head[1],
+                          current + k + 1 - block, block, &head_l, &head_r);
+        out_l[i + k] = head_l + conv->tail[0][conv->fill + k];
+        out_r[i + k] = head_r + conv->tail[1][conv->fill + k];
+      }
+    }
+
+    if (conv->fading != AE_CONVOLVER_NONE) {
+      /* Linear crossfade from the old set, reaching 1 on the last sample */
+      const ae_filter_set_t *old = &conv->sets[conv->fading];
+      float step = 1.0f / (float)(conv->fade_blocks * block);
+      size_t done = conv->fade_block * block + conv->fill;
+      for (size_t k = 0; k < n; ++k) {
+        float head_l, head_r;
+        ae_convolver_head(old->head[0], old->head[1],
+                          current + k + 1 - block, block, &head_l, &head_r);
+        float old_l = head_l + conv->fade_tail[0][conv->fill + k];
+        float old_r = head_r + conv->fade_tail[1][conv->fill + k];
+        float g = (float)(done + k + 1) * step;
+        out_l[i + k] = old_l + g * (out_l[i + k] - old_l);
+        out_r[i + k] = old_r + g * (out_r[i + k] - old_r);
+      }
+    }
+
+    conv->fill += n;
+    i += n;
+    if (conv->fill == block)
+      ae_convolver_end_block(conv);
+  }
+  return AE_OK;
+}
+
+/*============================================================================
+ * Batched direct-form heads
+ *============================================================================*/
+
+/**
+ * y[k][lane] = sum_t h[t][lane] * x[k + t][lane] for k < n, both ears.
+ * Every lane is its own convolver, so there are no horizontal sums; lanes
+ * is a multiple of 4. Four outputs share each tap load, which also gives
+ * eight independent accumulators to hide the add latency.
+ */
+static void ae_convolver_head_lanes(const float *h_l, const float *h_r,
+                                    const float *x, size_t block,
+                                    size_t lanes, size_t n, float *y_l,
+                                    float *y_r) {
+  size_t k = 0;
+#ifdef AE_HAS_SSE2
+  for (; k + 4 <= n; k += 4) {
+    size_t c = 0;
+#ifdef AE_HAS_AVX2
+    for (; c + 8 <= lanes; c += 8) {
+      __m256 l0 = _mm256_setzero_ps(), l1 = l0, l2 = l0, l3 = l0;
+      __m256 r0 = l0, r1 = l0, r2 = l0, r3 = l0;
+      const float *xk = x + k * lanes + c;
+      for (size_t t = 0; t < block; ++t) {
+        __m256 hl = _mm256_loadu_ps(h_l + t * lanes + c);
+        __m256 hr = _mm256_loadu_ps(h_r + t * lanes + c);
+        const float *xt = xk + t * lanes;
+        __m256 v0 = _mm256_loadu_ps(xt);
+        __m256 v1 = _mm256_loadu_ps(xt + lanes);
+        __m256 v2 = _mm256_loadu_ps(xt + 2 * lanes);
+        __m256 v3 = _mm256_loadu_ps(xt + 3 * lanes);
+        l0 = _mm256_add_ps(l0, _mm256_mul_ps(hl, v0));
+        l1 = _mm256_add_ps(l1, _mm256_mul_ps(hl, v1));
+        l2 = _mm256_add_ps(l2, _mm256_mul_ps(hl, v2));
+        l3 = _mm256_add_ps(l3, _mm256_mul_ps(hl, v3));
+        r0 = _mm256_add_ps(r0, _mm256_mul_ps(hr, v0));
+        r1 = _mm256_add_ps(r1, _mm256_mul_ps(hr, v1));
+        r2 = _mm256_add_ps(r2, _mm256_mul_ps(hr, v2));
+        r3 = _mm256_add_ps(r3, _mm256_mul_ps(hr, v3));
+      }
+      float *yl = y_l + k * lanes + c;
+      float *yr = y_r + k * lanes + c;
+      _mm256_storeu_ps(yl, l0);
+      _mm256_storeu_ps(yl + lanes, l1);
+      _mm256_storeu_ps(yl + 2 * lanes, l2);
+      _mm256_storeu_ps(yl + 3 * lanes, l3);
+      _mm256_storeu_ps(yr, r0);
+      _mm256_storeu_ps(yr + lanes, r1);
+      _mm256_storeu_ps(yr + 2 * lanes, r2);
+      _mm256_storeu_ps(yr + 3 * lanes, r3);
+    }
+#endif
+    for (; c < lanes; c += 4) {
+      __m128 l0 = _mm_setzero_ps(), l1 = l0, l2 = l0, l3 = l0;
+      __m128 r0 = l0, r1 = l0, r2 = l0, r3 = l0;
+      const float *xk = x + k * lanes + c;
+      for (size_t t = 0; t < block; ++t) {
+        __m128 hl = _mm_loadu_ps(h_l + t * lanes + c);
+        __m128 hr = _mm_loadu_ps(h_r + t * lanes + c);
+        const float *xt = xk + t * lanes;
+        __m128 v0 = _mm_loadu_ps(xt);
+        __m128 v1 = _mm_loadu_ps(xt + lanes);
+        __m128 v2 = _mm_loadu_ps(xt + 2 * lanes);
+        __m128 v3 = _mm_loadu_ps(xt + 3 * lanes);
+        l0 = _mm_add_ps(l0, _mm_mul_ps(hl, v0));
+        l1 = _mm_add_ps(l1, _mm_mul_ps(hl, v1));
+        l2 = _mm_add_ps(l2, _mm_mul_ps(hl, v2));
+        l3 = _mm_add_ps(l3, _mm_mul_ps(hl, v3));
+        r0 = _mm_add_ps(r0, _mm_mul_ps(hr, v0));
+        r1 = _mm_add_ps(r1, _mm_mul_ps(hr, v1));
+        r2 = _mm_add_ps(r2, _mm_mul_ps(hr, v2));
+        r3 = _mm_add_ps(r3, _mm_mul_ps(hr, v3));
+      }
+      float *yl = y_l + k * lanes + c;
+      float *yr = y_r + k * lanes + c;
+      _mm_storeu_ps(yl, l0);
+      _mm_storeu_ps(yl + lanes, l1);
+      _mm_storeu_ps(yl + 2 * lanes, l2);
+      _mm_storeu_ps(yl + 3 * lanes, l3);
+      _mm_storeu_ps(yr, r0);
+      _mm_storeu_ps(yr + lanes, r1);
+      _mm_storeu_ps(yr + 2 * lanes, r2);
+      _mm_storeu_ps(yr + 3 * lanes, r3);
+    }
+  }
+#endif
+  for (; k < n; ++k) {
+    const float *xk = x + k * lanes;
+    for (size_t c = 0; c < lanes; ++c) {
+      float sum_l = 0.0f;
+      float sum_r = 0.0f;
+      for (size_t t = 0; t < block; ++t) {
+        sum_l += h_l[t * lanes + c] * xk[t * lanes + c];
+        sum_r += h_r[t * lanes + c] * xk[t * lanes + c];
+      }
+      y_l[k * lanes + c] = sum_l;
+      y_r[k * lanes + c] = sum_r;
+    }
+  }
+}
+
+/* Interleave lanes sources of span samples: x[j][lane] = src[lane][j] */
+static void ae_convolver_interleave(const float *const *src, size_t lanes,
+                                    size_t span, float *x) {
+  for (size_t c = 0; c < lanes; c += 4) {
+    size_t j = 0;
+#ifdef AE_HAS_SSE2
+    for (; j + 4 <= span; j += 4) {
+      __m128 r0 = _mm_loadu_ps(src[c] + j);
+      __m128 r1 = _mm_loadu_ps(src[c + 1] + j);
+      __m128 r2 = _mm_loadu_ps(src[c + 2] + j);
+      __m128 r3 = _mm_loadu_ps(src[c + 3] + j);
+      _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+      _mm_storeu_ps(x + j * lanes + c, r0);
+      _mm_storeu_ps(x + (j + 1) * lanes + c, r1);
+      _mm_storeu_ps(x + (j + 2) * lanes + c, r2);
+      _mm_storeu_ps(x + (j + 3) * lanes + c, r3);
+    }
+#endif
+    for (; j < span; ++j) {
+      for (size_t r = 0; r < 4; ++r)
+        x[j * lanes + c + r] = src[c + r][j];
+    }
+  }
+}
+
+/* The inverse, for the first count lanes: dst[lane][k] = y[k][lane] */
+static void ae_convolver_deinterleave(const float *y, size_t lanes,
+                                      size_t count, size_t n,
+                                      float *const *dst) {
+  for (size_t c = 0; c < count; c += 4) {
+    size_t valid = count - c < 4 ? count - c : 4;
+    size_t k = 0;
+#ifdef AE_HAS_SSE2
+    for (; k + 4 <= n; k += 4) {
+      __m128 r[4];
+      r[0] = _mm_loadu_ps(y + k * lanes + c);
+      r[1] = _mm_loadu_ps(y + (k + 1) * lanes + c);
+      r[2] = _mm_loadu_ps(y + (k + 2) * lanes + c);
+      r[3] = _mm_loadu_ps(y + (k + 3) * lanes + c);
+      _MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+      for (size_t l = 0; l < valid; ++l)
+        _mm_storeu_ps(dst[c + l] + k, r[l]);
+    }
+#endif
+    for (; k < n; ++k) {
+      for (size_t l = 0; l < valid; ++l)
+        dst[c + l][k] = y[k * lanes + c + l];
+    }
+  }
+}
+
+/**
+ * Interleaved head taps of each lane's active and fading sets into the
+ * lead's lane_h; silent and padding lanes get 0. Sets only change at a
+ * swap, so the taps are rebuilt only when the batch or a generation does.
+ */
+static void ae_convolver_lane_heads(ae_convolver_t *const *convs,
+                                    size_t count, size_t lanes) {
+  ae_convolver_t *lead = convs[0];
+  bool fresh = lead->lane_count == count;
+  for (size_t c = 0; c < count && fresh; ++c)
+    fresh = lead->lane_id[c] == convs[c]->id &&
+            lead->lane_gen[c] == convs[c]->generation;
+  if (fresh)
+    return;
+
+  size_t block = lead->block;
+  ae_clear_buffer(lead->lane_h, 4 * block * lanes);
+  for (size_t c = 0; c < count; ++c) {
+    int sets[2] = {convs[c]->active, convs[c]->fading};
+    for (int which = 0; which < 2; ++which) {
+      if (sets[which] == AE_CONVOLVER_NONE)
+        continue;
+      const ae_filter_set_t *set = &convs[c]->sets[sets[which]];
+      for (int ear = 0; ear < 2; ++ear) {
+        float *dst = lead->lane_h + (size_t)(2 * which + ear) * block * lanes;
+        for (size_t t = 0; t < block; ++t)
+          dst[t * lanes + c] = set->head[ear][t];
+      }
+    }
+    lead->lane_id[c] = convs[c]->id;
+    lead->lane_gen[c] = convs[c]->generation;
+  }
+  lead->lane_count = count;
+}
+
+/* One batch: same partition size and block position in every convolver */
+static void ae_convolver_process_lanes(ae_convolver_t *const *convs,
+                                       const float *const *inputs,
+                                       float *const *out_l,
+                                       float *const *out_r, size_t count,
+                                       size_t frames) {
+  ae_convolver_t *lead = convs[0];
+  size_t block = lead->block;
+  size_t lanes = (count + 3) & ~(size_t)3;
+  size_t plane = block * lanes;
+  float *x = lead->lane_x;
+  float *y_l = lead->lane_y;
+  float *y_r = lead->lane_y + plane;
+
+  size_t i = 0;
+  while (i < frames) {
+    size_t fill = lead->fill;
+    size_t n = block - fill;
+    if (n > frames - i)
+      n = frames - i;
+    bool any_fading = false;
+    const float *windows[AE_CONVOLVER_LANES];
+    float *dst_l[AE_CONVOLVER_LANES];
+    float *dst_r[AE_CONVOLVER_LANES];
+    for (size_t c = 0; c < lanes; ++c) {
+      /* Padding lanes repeat lane 0; their taps are 0 */
+      ae_convolver_t *conv = convs[c < count ? c : 0];
+      if (c < count) {
+        if (fill == 0)
+          ae_convolver_begin_block(conv);
+        memcpy(conv->input + block + fill, inputs[c] + i, n * sizeof(float));
+        any_fading = any_fading || conv->fading != AE_CONVOLVER_NONE;
+        dst_l[c] = out_l[c] + i;
+        dst_r[c] = out_r[c] + i;
+      }
+      /* Window for output k is x[fill + 1 + k .. fill + k + B] */
+      windows[c] = conv->input + fill + 1;
+    }
+    ae_convolver_interleave(windows, lanes, n + block - 1, x);
+    ae_convolver_lane_heads(convs, count, lanes);
+    const float *h = lead->lane_h;
+
+    ae_convolver_head_lanes(h, h + plane, x, block, lanes, n, y_l, y_r);
+    ae_convolver_deinterleave(y_l, lanes, count, n, dst_l);
+    ae_convolver_deinterleave(y_r, lanes, count, n, dst_r);
+    for (size_t c = 0; c < count; ++c) {
+      ae_convolver_t *conv = convs[c];
+      if (conv->active == AE_CONVOLVER_NONE) {
+        ae_clear_buffer(dst_l[c], n);
+        ae_clear_buffer(dst_r[c], n);
+        continue;
+      }
+      ae_simd_add(dst_l[c], dst_l[c], conv->tail[0] + fill, n);
+      ae_simd_add(dst_r[c], dst_r[c], conv->tail[1] + fill, n);
+    }
+
+    if (any_fading) {
+      ae_convolver_head_lanes(h + 2 * plane, h + 3 * plane, x, block, lanes,
+                              n, y_l, y_r);
+      for (size_t c = 0; c < count; ++c) {
+        ae_convolver_t *conv = convs[c];
+        if (conv->fading == AE_CONVOLVER_NONE)
+          continue;
+        /* Same linear crossfade as ae_convolver_process */
+        float step = 1.0f / (float)(conv->fade_blocks * block);
+        size_t done = conv->fade_block * block + fill;
+        for (size_t k = 0; k < n; ++k) {
+          float old_l = y_l[k * lanes + c] + conv->fade_tail[0][fill + k];
+          float old_r = y_r[k * lanes + c] + conv->fade_tail[1][fill + k];
+          float g = (float)(done + k + 1) * step;
+          dst_l[c][k] = old_l + g * (dst_l[c][k] - old_l);
+          dst_r[c][k] = old_r + g * (dst_r[c][k] - old_r);
+        }
+      }
+    }
+
+    for (size_t c = 0; c < count; ++c) {
+      convs[c]->fill += n;
+      if (convs[c]->fill == block)
+        ae_convolver_end_block(convs[c]);
+    }
+    i += n;
+  }
+}
+
+/**
+ * ae_convolver_process for count convolvers, each with its own input and
+ * outputs. Runs of neighbours with the same partition size and block
+ * position are batched; the rest run one at a time. The results match
+ * separate ae_convolver_process calls up to float rounding.
+ */
+AE_API ae_result_t ae_convolver_process_group(ae_convolver_t *const *convs,
+                                              const float *const *inputs,
+                                              float *const *out_l,
+                                              float *const *out_r,
+                                              size_t count, size_t frames) {
+  if (!convs || !inputs || !out_l || !out_r)
+    return AE_ERROR_INVALID_PARAM;
+  for (size_t c = 0; c < count; ++c) {
+    if (!convs[c] || !inputs[c] || !out_l[c] || !out_r[c])
+      return AE_ERROR_INVALID_PARAM;
+  }
+
+  size_t c = 0;
+  while (c < count) {
+    size_t run = 1;
+    while (run < AE_CONVOLVER_LANES && c + run < count &&
+           convs[c + run]->block == convs[c]->block &&
+           convs[c + run]->fill == convs[c]->fill)
+      ++run;
+    if (run == 1)
+      ae_convolver_process(convs[c], inputs[c], out_l[c], out_r[c], frames);
+    else
+      ae_convolver_process_lanes(convs + c, inputs + c, out_l + c,
+                                 out_r + c, run, frames);
+    c += run;
+  }
+  return AE_OK;
+}
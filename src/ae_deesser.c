@@ -1,139 +1,260 @@
 /**
  * @file ae_deesser.c
  * @brief De-esser implementation (sibilance reduction)
+ *
+ * A fourth-order Linkwitz-Riley crossover splits the signal: two
+ * Butterworth sections per band, with lanes {left low, left high, right
+ * low, right high} so one register carries the whole split and both
+ * sections advance in the same loop. The louder channel's high band drives
+ * one gain for both channels; split-band mode applies it to the high band
+ * and adds the low band back, wideband mode applies it to the unsplit
+ * signal. The two bands sum to an allpass,
+ * so with no reduction split-band output keeps the magnitude of the input
+ * but not its phase.
+ *
+ * Detection and gain run a tile at a time: peak to dB through the fast
+ * log, a hard-knee curve four levels at a time, attack/release smoothing,
+ * then back to linear through the fast exp.
  */
 
 #include "ae_internal.h"
 
-/**
- * De-esser state structure
- */
-typedef struct {
-  float hp_state;       /* High-pass filter state */
-  float envelope;       /* Envelope follower state */
-  float gain_reduction; /* Current gain reduction */
-  float threshold_db;   /* Detection threshold */
-  float ratio;          /* Reduction ratio */
-  float attack_ms;      /* Attack time */
-  float release_ms;     /* Release time */
-  float freq_low_hz;    /* Lower frequency bound */
-  float freq_high_hz;   /* Upper frequency bound */
-  bool wideband;        /* Wideband mode vs split-band */
-} ae_deesser_state_t;
-
-/* Default de-esser parameters */
-static ae_deesser_state_t g_deesser_defaults = {.hp_state = 0.0f,
-                                                .envelope = 0.0f,
-                                                .gain_reduction = 0.0f,
-                                                .threshold_db = -20.0f,
-                                                .ratio = 4.0f,
-                                                .attack_ms = 0.5f,
-                                                .release_ms = 20.0f,
-                                                .freq_low_hz = 4000.0f,
-                                                .freq_high_hz = 10000.0f,
-                                                .wideband = false};
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
 
-/**
- * Initialize de-esser state
- */
-void ae_deesser_init(ae_deesser_state_t *state) {
-  if (!state)
-    return;
-  *state = g_deesser_defaults;
-}
+#define AE_DEESSER_TILE 256
 
-/**
- * High-pass filter for sibilance detection
- */
-static float deesser_highpass(float sample, float cutoff_hz, float sample_rate,
-                              float *state) {
-  float rc = 1.0f / (2.0f * (float)M_PI * cutoff_hz);
-  float dt = 1.0f / sample_rate;
-  float alpha = rc / (rc + dt);
-
-  float output = alpha * (*state + sample);
-  *state = output - sample;
-  return output;
-}
+/* Crossover lanes */
+enum { AE_DS_LOW_L, AE_DS_HIGH_L, AE_DS_LOW_R, AE_DS_HIGH_R };
 
-/**
- * Process a single sample through the de-esser
- */
-float ae_deesser_process_sample(ae_deesser_state_t *state, float sample,
-                                float sample_rate) {
-  if (!state)
-    return sample;
-
-  /* Detect sibilance using high-passed signal */
-  float detection = deesser_highpass(sample, state->freq_low_hz, sample_rate,
-                                     &state->hp_state);
-
-  /* Rectify detection signal */
-  float detection_abs = fabsf(detection);
-
-  /* Convert to dB */
-  float detection_db = 20.0f * log10f(detection_abs + AE_LOG_EPSILON);
-
-  /* Envelope follower */
-  float attack_coeff = expf(-1.0f / (state->attack_ms * 0.001f * sample_rate));
-  float release_coeff =
-      expf(-1.0f / (state->release_ms * 0.001f * sample_rate));
-
-  if (detection_db > state->envelope) {
-    state->envelope =
-        attack_coeff * state->envelope + (1.0f - attack_coeff) * detection_db;
-  } else {
-    state->envelope =
-        release_coeff * state->envelope + (1.0f - release_coeff) * detection_db;
-  }
+struct ae_deesser {
+  ae_deesser_params_t params;
+  float sample_rate;
 
-  /* Calculate gain reduction */
-  float gain_db = 0.0f;
-  if (state->envelope > state->threshold_db) {
-    float overshoot = state->envelope - state->threshold_db;
-    gain_db = -overshoot * (1.0f - 1.0f / state->ratio);
-  }
-  state->gain_reduction = -gain_db;
+  /* Cached by set_params */
+  float attack_coeff;
+  float release_coeff;
+  float slope; /* 1 / ratio - 1: gain dB per dB over threshold */
 
-  float gain_linear = powf(10.0f, gain_db / 20.0f);
+  /* Crossover per lane; both sections share them, and b2 = b0 */
+  float b0[4], b1[4], a1[4], a2[4];
+  /* Section inputs x, section 1 outputs y (the inputs of section 2),
+   * section 2 outputs z, one and two frames back */
+  float x1[4], x2[4], y1[4], y2[4], z1[4], z2[4];
+  float gain_db; /* Smoothed gain change (<= 0) */
+};
 
-  if (state->wideband) {
-    /* Wideband: reduce entire signal */
-    return sample * gain_linear;
-  } else {
-    /* Split-band: only reduce high frequencies */
-    float low_content = sample - detection;
-    return low_content + detection * gain_linear;
+/* Butterworth (Q = 1/sqrt 2) lowpass and highpass at the crossover */
+static void ae_deesser_design(ae_deesser_t *ds) {
+  double w0 = 2.0 * M_PI * ds->params.frequency_hz / ds->sample_rate;
+  double cw = cos(w0);
+  double alpha = sin(w0) * M_SQRT1_2;
+  double a0 = 1.0 + alpha;
+  float lo = (float)(0.5 * (1.0 - cw) / a0);
+  float hi = (float)(0.5 * (1.0 + cw) / a0);
+  for (int lane = 0; lane < 4; ++lane) {
+    bool high = lane & 1;
+    ds->b0[lane] = high ? hi : lo;
+    ds->b1[lane] = high ? -2.0f * hi : 2.0f * lo;
+    ds->a1[lane] = (float)(-2.0 * cw / a0);
+    ds->a2[lane] = (float)((1.0 - alpha) / a0);
   }
 }
 
-/**
- * Process a buffer through the de-esser
- */
-void ae_deesser_process(ae_deesser_state_t *state, float *samples,
-                        size_t frames, float sample_rate) {
-  if (!state || !samples || frames == 0)
-    return;
+#ifdef AE_HAS_SSE2
+/* One frame through both sections. The a1 term goes last so the feedback
+ * path from the previous output is one multiply and one subtract. */
+#define AE_DS_SECTION(x, in1, in2, out1, out2, y)                              \
+  do {                                                                         \
+    y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b0, x), _mm_mul_ps(b1, in1)),         \
+                   _mm_mul_ps(b0, in2));                                       \
+    y = _mm_sub_ps(_mm_sub_ps(y, _mm_mul_ps(a2, out2)),                        \
+                   _mm_mul_ps(a1, out1));                                      \
+    in2 = in1;                                                                 \
+    in1 = x;                                                                   \
+  } while (0)
+
+#define AE_DS_FRAME(v)                                                         \
+  do {                                                                         \
+    __m128 y_, z_;                                                             \
+    AE_DS_SECTION(v, x1, x2, y1, y2, y_);                                      \
+    AE_DS_SECTION(y_, y1, y2, z1, z2, z_);                                     \
+    z2 = z1;                                                                   \
+    z1 = z_;                                                                   \
+    v = z_;                                                                    \
+  } while (0)
+#endif
 
-  for (size_t i = 0; i < frames; ++i) {
-    samples[i] = ae_deesser_process_sample(state, samples[i], sample_rate);
+/* Splits n frames into band[lane]; r may equal l, and then only the left
+ * lanes are stored */
+static void ae_deesser_split(ae_deesser_t *ds, const float *l,
+                             const float *r, float *const band[4],
+                             size_t n) {
+  size_t lanes = r != l ? 4 : 2;
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  const __m128 b0 = _mm_loadu_ps(ds->b0), b1 = _mm_loadu_ps(ds->b1);
+  const __m128 a1 = _mm_loadu_ps(ds->a1), a2 = _mm_loadu_ps(ds->a2);
+  __m128 x1 = _mm_loadu_ps(ds->x1), x2 = _mm_loadu_ps(ds->x2);
+  __m128 y1 = _mm_loadu_ps(ds->y1), y2 = _mm_loadu_ps(ds->y2);
+  __m128 z1 = _mm_loadu_ps(ds->z1), z2 = _mm_loadu_ps(ds->z2);
+  for (; i + 4 <= n; i += 4) {
+    __m128 lv = _mm_loadu_ps(l + i), rv = _mm_loadu_ps(r + i);
+    __m128 f0 = _mm_shuffle_ps(lv, rv, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 f1 = _mm_shuffle_ps(lv, rv, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 f2 = _mm_shuffle_ps(lv, rv, _MM_SHUFFLE(2, 2, 2, 2));
+    __m128 f3 = _mm_shuffle_ps(lv, rv, _MM_SHUFFLE(3, 3, 3, 3));
+    AE_DS_FRAME(f0);
+    AE_DS_FRAME(f1);
+    AE_DS_FRAME(f2);
+    AE_DS_FRAME(f3);
+    _MM_TRANSPOSE4_PS(f0, f1, f2, f3);
+    _mm_storeu_ps(band[0] + i, f0);
+    _mm_storeu_ps(band[1] + i, f1);
+    if (lanes == 4) {
+      _mm_storeu_ps(band[2] + i, f2);
+      _mm_storeu_ps(band[3] + i, f3);
+    }
   }
+  for (; i < n; ++i) {
+    __m128 v = _mm_unpacklo_ps(_mm_load_ss(l + i), _mm_load_ss(r + i));
+    v = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 0, 0));
+    AE_DS_FRAME(v);
+    float out[4];
+    _mm_storeu_ps(out, v);
+    for (size_t k = 0; k < lanes; ++k)
+      band[k][i] = out[k];
+  }
+  _mm_storeu_ps(ds->x1, x1);
+  _mm_storeu_ps(ds->x2, x2);
+  _mm_storeu_ps(ds->y1, y1);
+  _mm_storeu_ps(ds->y2, y2);
+  _mm_storeu_ps(ds->z1, z1);
+  _mm_storeu_ps(ds->z2, z2);
+#else
+  for (; i < n; ++i) {
+    float in[4] = {l[i], l[i], r[i], r[i]};
+    for (size_t k = 0; k < 4; ++k) {
+      float x = in[k];
+      float b0 = ds->b0[k], b1 = ds->b1[k], a1 = ds->a1[k], a2 = ds->a2[k];
+      float y = b0 * x + b1 * ds->x1[k] + b0 * ds->x2[k];
+      y = y - a2 * ds->y2[k] - a1 * ds->y1[k];
+      float z = b0 * y + b1 * ds->y1[k] + b0 * ds->y2[k];
+      z = z - a2 * ds->z2[k] - a1 * ds->z1[k];
+      ds->x2[k] = ds->x1[k];
+      ds->x1[k] = x;
+      ds->y2[k] = ds->y1[k];
+      ds->y1[k] = y;
+      ds->z2[k] = ds->z1[k];
+      ds->z1[k] = z;
+      if (k < lanes)
+        band[k][i] = z;
+    }
+  }
+#endif
 }
 
-/**
- * Stereo-linked de-esser
- */
-void ae_deesser_process_stereo(ae_deesser_state_t *state, float *left,
-                               float *right, size_t frames, float sample_rate) {
-  if (!state || !left || !right || frames == 0)
+AE_API ae_deesser_t *ae_deesser_create(uint32_t sample_rate) {
+  if (sample_rate == 0)
+    return NULL;
+  ae_deesser_t *ds = (ae_deesser_t *)calloc(1, sizeof(*ds));
+  if (!ds)
+    return NULL;
+  ds->sample_rate = (float)sample_rate;
+  float nyquist_quarter = 0.25f * ds->sample_rate;
+  ae_deesser_params_t params = {
+      .frequency_hz = nyquist_quarter < 5000.0f ? nyquist_quarter : 5000.0f,
+      .threshold_db = -20.0f,
+      .ratio = 4.0f,
+      .attack_ms = 0.5f,
+      .release_ms = 20.0f,
+      .wideband = false};
+  ae_deesser_set_params(ds, &params);
+  return ds;
+}
+
+AE_API void ae_deesser_destroy(ae_deesser_t *ds) { free(ds); }
+
+AE_API void ae_deesser_reset(ae_deesser_t *ds) {
+  if (!ds)
     return;
+  memset(ds->x1, 0, sizeof(ds->x1));
+  memset(ds->x2, 0, sizeof(ds->x2));
+  memset(ds->y1, 0, sizeof(ds->y1));
+  memset(ds->y2, 0, sizeof(ds->y2));
+  memset(ds->z1, 0, sizeof(ds->z1));
+  memset(ds->z2, 0, sizeof(ds->z2));
+  ds->gain_db = 0.0f;
+}
 
-  for (size_t i = 0; i < frames; ++i) {
-    /* Use max of L/R for detection */
-    float mono = fmaxf(fabsf(left[i]), fabsf(right[i]));
-    float gain = ae_deesser_process_sample(state, mono, sample_rate) /
-                 (mono + AE_LOG_EPSILON);
-    left[i] *= gain;
-    right[i] *= gain;
+AE_API ae_result_t ae_deesser_set_params(ae_deesser_t *ds,
+                                         const ae_deesser_params_t *params) {
+  if (!ds || !params || !(params->frequency_hz > 0.0f) ||
+      !(params->frequency_hz < 0.5f * ds->sample_rate) ||
+      !(params->ratio >= 1.0f) || !(params->attack_ms > 0.0f) ||
+      !(params->release_ms > 0.0f) || !isfinite(params->threshold_db))
+    return AE_ERROR_INVALID_PARAM;
+  ds->params = *params;
+  ds->attack_coeff =
+      expf(-1.0f / (params->attack_ms * 0.001f * ds->sample_rate));
+  ds->release_coeff =
+      expf(-1.0f / (params->release_ms * 0.001f * ds->sample_rate));
+  ds->slope = 1.0f / params->ratio - 1.0f;
+  ae_deesser_design(ds);
+  return AE_OK;
+}
+
+AE_API void ae_deesser_get_params(const ae_deesser_t *ds,
+                                  ae_deesser_params_t *params) {
+  if (ds && params)
+    *params = ds->params;
+}
+
+AE_API ae_result_t ae_deesser_process(ae_deesser_t *ds, float *left,
+                                      float *right, size_t frames) {
+  if (!ds || !left)
+    return AE_ERROR_INVALID_PARAM;
+  size_t channels = right ? 2 : 1;
+  float band[4][AE_DEESSER_TILE];
+  float gain[AE_DEESSER_TILE];
+  float level[AE_DEESSER_TILE];
+  float *const lanes[4] = {band[0], band[1], band[2], band[3]};
+
+  for (size_t start = 0; start < frames; start += AE_DEESSER_TILE) {
+    size_t count = frames - start < AE_DEESSER_TILE ? frames - start
+                                                     : AE_DEESSER_TILE;
+    float *io[2] = {left + start, right ? right + start : NULL};
+    ae_deesser_split(ds, io[0], right ? io[1] : io[0], lanes, count);
+
+    /* One detector on the louder high band drives both channels */
+    ae_simd_abs(gain, band[AE_DS_HIGH_L], count);
+    if (right) {
+      ae_simd_abs(level, band[AE_DS_HIGH_R], count);
+      ae_simd_max(gain, gain, level, count);
+    }
+    /* Hard knee: the shared curve with a zero knee width */
+    ae_gain_curve_db(gain, count, ds->params.threshold_db, ds->slope, 0.0f,
+                     0.0f);
+    ds->gain_db = ae_gain_smooth(gain, count, ds->gain_db, ds->attack_coeff,
+                                 ds->release_coeff);
+    ae_simd_scale(gain, gain, AE_DB_TO_NEPER, count);
+    ae_fast_exp(gain, gain, count, AE_MATH_1E4);
+
+    for (size_t ch = 0; ch < channels; ++ch) {
+      if (ds->params.wideband) {
+        ae_simd_mul(io[ch], io[ch], gain, count);
+      } else {
+        float *high = band[AE_DS_HIGH_L + 2 * ch];
+        ae_simd_mul(high, high, gain, count);
+        ae_simd_add(io[ch], band[AE_DS_LOW_L + 2 * ch], high, count);
+      }
+    }
   }
+  return AE_OK;
+}
+
+AE_API float ae_deesser_gain_reduction(const ae_deesser_t *ds) {
+  return ds ? -ds->gain_db : 0.0f;
 }
@@ -0,0 +1,202 @@
+/**
+ * @file ae_delay.c
+ * @brief Delay line storage (float32, fp16 or int16 samples)
+ *
+ * The compact formats halve the memory the reverb and precedence lines
+ * occupy per voice; all processing still runs in float32 and converts on
+ * every read and write.
+ */
+
+#include "ae_internal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
+
+/* F16C half conversion: built in when the compiler targets it
+ * (AE_ENABLE_F16C), otherwise compiled for it on the side and selected at
+ * run time on GCC/Clang x86 */
+#if defined(__F16C__)
+#define AE_F16C_TARGET
+#define ae_delay_has_f16c() 1
+#elif defined(AE_HAS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define AE_F16C_TARGET __attribute__((target("f16c")))
+#define ae_delay_has_f16c() __builtin_cpu_supports("f16c")
+#endif
+
+#ifdef AE_F16C_TARGET
+/* Stores whole groups of four and returns how many it wrote; subnormals
+ * truncate like ae_float_to_half */
+AE_F16C_TARGET static size_t ae_delay_store_f16c(uint16_t *dst,
+                                                 const float *src, size_t n) {
+  __m128 lo = _mm_set1_ps(-65504.0f);
+  __m128 hi = _mm_set1_ps(65504.0f);
+  __m128 sign = _mm_set1_ps(-0.0f);
+  __m128 tiny = _mm_set1_ps(AE_DELAY_HALF_TRUNCATE);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), lo), hi);
+    __m128i sub =
+        _mm_castps_si128(_mm_cmplt_ps(_mm_andnot_ps(sign, v), tiny));
+    sub = _mm_packs_epi32(sub, sub);
+    __m128i near = _mm_cvtps_ph(v, 0);
+    __m128i zero = _mm_cvtps_ph(v, _MM_FROUND_TO_ZERO);
+    __m128i h =
+        _mm_or_si128(_mm_and_si128(sub, zero), _mm_andnot_si128(sub, near));
+    _mm_storel_epi64((__m128i *)(dst + i), h);
+  }
+  return i;
+}
+
+AE_F16C_TARGET static size_t ae_delay_load_f16c(float *dst,
+                                                const uint16_t *src,
+                                                size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    _mm_storeu_ps(dst + i,
+                  _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)(src + i))));
+  return i;
+}
+#endif
+
+static size_t ae_delay_sample_bytes(ae_delay_storage_t format) {
+  return format == AE_DELAY_STORAGE_FLOAT32 ? sizeof(float) : sizeof(int16_t);
+}
+
+bool ae_delay_buffer_alloc(ae_delay_buffer_t *buf, size_t size,
+                           ae_delay_storage_t format) {
+  if (!buf)
+    return false;
+  if (format != AE_DELAY_STORAGE_FP16 && format != AE_DELAY_STORAGE_INT16)
+    format = AE_DELAY_STORAGE_FLOAT32;
+  buf->format = format;
+  buf->data = size > 0 ? calloc(size, ae_delay_sample_bytes(format)) : NULL;
+  return buf->data != NULL;
+}
+
+void ae_delay_buffer_free(ae_delay_buffer_t *buf) {
+  if (!buf)
+    return;
+  free(buf->data);
+  buf->data = NULL;
+}
+
+void ae_delay_buffer_clear(ae_delay_buffer_t *buf, size_t size) {
+  /* All-zero bits are 0.0 in every format */
+  if (buf && buf->data && size > 0)
+    memset(buf->data, 0, size * ae_delay_sample_bytes(buf->format));
+}
+
+static void ae_delay_store(ae_delay_buffer_t *buf, size_t start,
+                           const float *src, size_t n) {
+  size_t i = 0;
+  switch (buf->format) {
+  case AE_DELAY_STORAGE_FP16: {
+    uint16_t *dst = (uint16_t *)buf->data + start;
+#ifdef AE_F16C_TARGET
+    if (ae_delay_has_f16c())
+      i = ae_delay_store_f16c(dst, src, n);
+#endif
+    for (; i < n; ++i)
+      dst[i] = ae_float_to_half(src[i]);
+    break;
+  }
+  case AE_DELAY_STORAGE_INT16: {
+    int16_t *dst = (int16_t *)buf->data + start;
+#ifdef AE_HAS_SSE2
+    /* Clamp before converting: out-of-range floats convert to INT_MIN.
+     * Small values truncate and the rest round, as in ae_float_to_int16 */
+    __m128 scale = _mm_set1_ps(AE_DELAY_INT16_SCALE);
+    __m128 lo = _mm_set1_ps(-32768.0f);
+    __m128 hi = _mm_set1_ps(32767.0f);
+    __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 small = _mm_set1_ps(AE_DELAY_INT16_TRUNCATE);
+    for (; i + 8 <= n; i += 8) {
+      __m128i q[2];
+      for (int h = 0; h < 2; ++h) {
+        __m128 f = _mm_mul_ps(_mm_loadu_ps(src + i + 4 * h), scale);
+        f = _mm_min_ps(_mm_max_ps(f, lo), hi);
+        __m128i trunc = _mm_castps_si128(
+            _mm_cmplt_ps(_mm_andnot_ps(sign, f), small));
+        q[h] = _mm_or_si128(_mm_and_si128(trunc, _mm_cvttps_epi32(f)),
+                            _mm_andnot_si128(trunc, _mm_cvtps_epi32(f)));
+      }
+      _mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(q[0], q[1]));
+    }
+#endif
+    for (; i < n; ++i)
+      dst[i] = ae_float_to_int16(src[i]);
+    break;
+  }
+  default:
+    memcpy((float *)buf->data + start, src, n * sizeof(float));
+    break;
+  }
+}
+
+/* Write n samples at start, wrapping at size */
+void ae_delay_write_span(ae_delay_buffer_t *buf, size_t size, size_t start,
+                         const float *src, size_t n) {
+  size_t first = size - start < n ? size - start : n;
+  ae_delay_span_store(buf, start, src, first);
+  if (first < n)
+    ae_delay_span_store(buf, 0, src + first, n - first);
+}
+
+/**
+ * Store n contiguous samples (no wrap). A span returned by
+ * ae_delay_span_load for float32 storage already is the buffer, so writing
+ * it back costs nothing.
+ */
+void ae_delay_span_store(ae_delay_buffer_t *buf, size_t start,
+                         const float *src, size_t n) {
+  if (buf->format == AE_DELAY_STORAGE_FLOAT32 &&
+      src == (const float *)buf->data + start)
+    return;
+  ae_delay_store(buf, start, src, n);
+}
+
+/**
+ * Float view of n contiguous samples (no wrap). Float storage is returned in
+ * place, so edits through the view land in the buffer directly; compact
+ * formats are converted into scratch, which must hold n floats, and need
+ * ae_delay_span_store to write edits back.
+ */
+float *ae_delay_span_load(const ae_delay_buffer_t *buf, size_t start,
+                          size_t n, float *scratch) {
+  size_t i = 0;
+  switch (buf->format) {
+  case AE_DELAY_STORAGE_FP16: {
+    const uint16_t *src = (const uint16_t *)buf->data + start;
+#ifdef AE_F16C_TARGET
+    if (ae_delay_has_f16c())
+      i = ae_delay_load_f16c(scratch, src, n);
+#endif
+    for (; i < n; ++i)
+      scratch[i] = ae_half_to_float(src[i]);
+    return scratch;
+  }
+  case AE_DELAY_STORAGE_INT16: {
+    const int16_t *src = (const int16_t *)buf->data + start;
+    const float inv = 1.0f / AE_DELAY_INT16_SCALE;
+#ifdef AE_HAS_SSE2
+    __m128 vinv = _mm_set1_ps(inv);
+    for (; i + 8 <= n; i += 8) {
+      __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+      /* Sign-extend: interleave with itself, then arithmetic shift */
+      __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+      __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+      _mm_storeu_ps(scratch + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), vinv));
+      _mm_storeu_ps(scratch + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), vinv));
+    }
+#endif
+    for (; i < n; ++i)
+      scratch[i] = (float)src[i] * inv;
+    return scratch;
+  }
+  default:
+    return (float *)buf->data + start;
+  }
+}
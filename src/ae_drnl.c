@@ -34,6 +34,7 @@ typedef struct {
   /* Gammatone coefficients */
   float a;      /* Amplitude */
   float b;      /* Bandwidth factor */
+  float decay;  /* exp(-b): per-sample pole radius */
   float cos_cf; /* cos(2*pi*cf/sr) */
   float sin_cf; /* sin(2*pi*cf/sr) */
 } ae_drnl_channel_t;
@@ -84,6 +85,7 @@ static void drnl_calculate_center_freqs(ae_drnl_t *drnl) {
 
     float erb_cf = drnl_erb(ch->cf);
     ch->b = 2.0f * (float)M_PI * 1.019f * erb_cf / drnl->config.sample_rate;
+    ch->decay = expf(-ch->b);
     ch->a = 1.0f;
 
     float w = 2.0f * (float)M_PI * ch->cf / drnl->config.sample_rate;
@@ -104,7 +106,7 @@ static float broken_stick_compress(float x, float a, float b, float c) {
     return 0.0f;
 
   float lin = a * abs_x;
-  float nlin = b * powf(abs_x, c);
+  float nlin = b * ae_fast_powf(abs_x, c, AE_MATH_1E4);
   float result = fminf(lin, nlin);
 
   return (x >= 0.0f) ? result : -result;
@@ -122,9 +124,8 @@ static float lowpass_process(float input, float *state, float alpha) {
  * 4th-order Gammatone IIR Stage
  *============================================================================*/
 static float gammatone_stage(float input, float *state_re, float *state_im,
-                             float a, float b, float cos_w, float sin_w) {
-  float decay = expf(-b);
-
+                             float a, float decay, float cos_w,
+                             float sin_w) {
   for (int stage = 0; stage < 4; ++stage) {
     float in_re = (stage == 0) ? input : state_re[stage - 1];
     float in_im = (stage == 0) ? 0.0f : state_im[stage - 1];
@@ -235,7 +236,7 @@ AE_API ae_result_t ae_drnl_process(ae_drnl_t *drnl, const float *input,
       /* Gammatone filter */
       float lin_gt = gammatone_stage(
           sample, channel->lin_state_re, channel->lin_state_im, channel->a,
-          channel->b, channel->cos_cf, channel->sin_cf);
+          channel->decay, channel->cos_cf, channel->sin_cf);
       /* Lowpass filter */
       float lin_lp = lowpass_process(lin_gt, &channel->lin_lp_state, lp_alpha);
       /* Apply gain */
@@ -245,7 +246,7 @@ AE_API ae_result_t ae_drnl_process(ae_drnl_t *drnl, const float *input,
       /* First Gammatone */
       float nlin_gt1 = gammatone_stage(
           sample, channel->nlin1_state_re, channel->nlin1_state_im, channel->a,
-          channel->b, channel->cos_cf, channel->sin_cf);
+          channel->decay, channel->cos_cf, channel->sin_cf);
       /* First Lowpass */
       float nlin_lp1 =
           lowpass_process(nlin_gt1, &channel->nlin_lp1_state, lp_alpha);
@@ -257,7 +258,7 @@ AE_API ae_result_t ae_drnl_process(ae_drnl_t *drnl, const float *input,
       /* Second Gammatone */
       float nlin_gt2 = gammatone_stage(
           compressed, channel->nlin2_state_re, channel->nlin2_state_im,
-          channel->a, channel->b, channel->cos_cf, channel->sin_cf);
+          channel->a, channel->decay, channel->cos_cf, channel->sin_cf);
       /* Second Lowpass */
       float nlin_out =
           lowpass_process(nlin_gt2, &channel->nlin_lp2_state, lp_alpha);
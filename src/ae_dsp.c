@@ -1,63 +1,145 @@
 #include "ae_internal.h"
 
-static void ae_dsp_lowpass(float *samples, size_t n, float cutoff,
-                           float sample_rate, float *state) {
-  if (!samples || n == 0)
-    return;
-  float x = *state;
-  float rc = 1.0f / (2.0f * (float)M_PI * cutoff);
-  float dt = 1.0f / sample_rate;
-  float alpha = dt / (rc + dt);
-  for (size_t i = 0; i < n; ++i) {
-    x = x + alpha * (samples[i] - x);
-    samples[i] = x;
-  }
-  *state = x;
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
+
+#ifdef AE_HAS_SSE2
+/* floorf() for four lanes; magnitudes of 2^23 and up are already whole */
+static inline __m128 ae_dsp_floor4(__m128 v) {
+  __m128 whole = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+  whole = _mm_sub_ps(whole, _mm_and_ps(_mm_cmpgt_ps(whole, v),
+                                       _mm_set1_ps(1.0f)));
+  __m128 big = _mm_cmpge_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), v),
+                            _mm_set1_ps(8388608.0f));
+  return _mm_or_ps(_mm_and_ps(big, v), _mm_andnot_ps(big, whole));
+}
+#endif
+
+/* Append a block to a ring that keeps a copy of its first three samples
+ * past the end, so four-tap reads never wrap */
+static void ae_dsp_ring_write(float *ring, size_t size, size_t write,
+                              const float *src, size_t frames) {
+  size_t first = size - write < frames ? size - write : frames;
+  memcpy(ring + write, src, first * sizeof(float));
+  memcpy(ring, src + first, (frames - first) * sizeof(float));
+  memcpy(ring + size, ring, 3 * sizeof(float));
 }
 
-static void ae_dsp_highpass(float *samples, size_t n, float cutoff,
-                            float sample_rate, float *state) {
-  if (!samples || n == 0)
-    return;
-  float lp = *state;
-  float rc = 1.0f / (2.0f * (float)M_PI * cutoff);
-  float dt = 1.0f / sample_rate;
-  float alpha = dt / (rc + dt);
-  for (size_t i = 0; i < n; ++i) {
-    lp = lp + alpha * (samples[i] - lp);
-    samples[i] = samples[i] - lp;
-  }
-  *state = lp;
+/* Third-order Lagrange weights for taps at -1, 0, 1, 2 */
+static inline void ae_dsp_lagrange_weights(float d, float w[4]) {
+  float a = d * (d - 1.0f);
+  float b = (d + 1.0f) * (d - 2.0f);
+  w[0] = -a * (d - 2.0f) * (1.0f / 6.0f);
+  w[1] = b * (d - 1.0f) * 0.5f;
+  w[2] = -b * d * 0.5f;
+  w[3] = a * (d + 1.0f) * (1.0f / 6.0f);
 }
 
-void ae_dsp_apply_brightness(float *samples, size_t n, float brightness,
-                             float sample_rate, float *lp_state,
-                             float *hp_state) {
+#ifdef AE_HAS_SSE2
+static inline void ae_dsp_lagrange_weights4(__m128 d, __m128 w[4]) {
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 sixth = _mm_set1_ps(1.0f / 6.0f);
+  const __m128 half = _mm_set1_ps(0.5f);
+  __m128 dm1 = _mm_sub_ps(d, one);
+  __m128 dm2 = _mm_sub_ps(dm1, one);
+  __m128 dp1 = _mm_add_ps(d, one);
+  __m128 a = _mm_mul_ps(d, dm1);
+  __m128 b = _mm_mul_ps(dp1, dm2);
+  w[0] = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(_mm_mul_ps(a, dm2), sixth));
+  w[1] = _mm_mul_ps(_mm_mul_ps(b, dm1), half);
+  w[2] = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(_mm_mul_ps(b, d), half));
+  w[3] = _mm_mul_ps(_mm_mul_ps(a, dp1), sixth);
+}
+
+/* Four interpolated reads: one contiguous 4-tap row per output starting at
+ * base[k], transposed so each weight multiplies a whole tap column */
+static inline __m128 ae_dsp_lagrange_read4(const float *ring,
+                                           const int32_t base[4],
+                                           const __m128 w[4]) {
+  __m128 t0 = _mm_loadu_ps(ring + base[0]);
+  __m128 t1 = _mm_loadu_ps(ring + base[1]);
+  __m128 t2 = _mm_loadu_ps(ring + base[2]);
+  __m128 t3 = _mm_loadu_ps(ring + base[3]);
+  _MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+  return _mm_add_ps(_mm_add_ps(_mm_mul_ps(w[0], t0), _mm_mul_ps(w[1], t1)),
+                    _mm_add_ps(_mm_mul_ps(w[2], t2), _mm_mul_ps(w[3], t3)));
+}
+#endif
+
+/**
+ * Darken with a lowpass or brighten with a highpass, left and right in one
+ * pass. Each filter keeps its own state, so switching direction resumes
+ * where that filter last stopped.
+ */
+void ae_dsp_apply_brightness(ae_onepole4_t *lp, ae_onepole4_t *hp,
+                             float *left, float *right, size_t n,
+                             float brightness, float sample_rate) {
+  if (!lp || !hp || !left || !right || n == 0)
+    return;
+  float *const ch[2] = {left, right};
   float bright_norm = ae_clamp(brightness, -1.0f, 1.0f);
   if (bright_norm < 0.0f) {
     float cutoff = 2000.0f + (bright_norm + 1.0f) * 6000.0f;
-    ae_dsp_lowpass(samples, n, cutoff, sample_rate, lp_state);
+    float alpha = ae_onepole_alpha(cutoff, sample_rate);
+    ae_onepole4_set(lp, 0, alpha, AE_ONEPOLE_LOWPASS);
+    ae_onepole4_set(lp, 1, alpha, AE_ONEPOLE_LOWPASS);
+    ae_onepole4_process(lp, ch, 2, n);
   } else if (bright_norm > 0.0f) {
     float cutoff = 1000.0f + bright_norm * 6000.0f;
-    ae_dsp_highpass(samples, n, cutoff, sample_rate, hp_state);
+    float alpha = ae_onepole_alpha(cutoff, sample_rate);
+    ae_onepole4_set(hp, 0, alpha, AE_ONEPOLE_HIGHPASS);
+    ae_onepole4_set(hp, 1, alpha, AE_ONEPOLE_HIGHPASS);
+    ae_onepole4_process(hp, ch, 2, n);
   }
 }
 
-void ae_dsp_apply_lofi(float *left, float *right, size_t n, float amount) {
-  if (!left || !right || n == 0 || amount <= 0.0f)
+/**
+ * Hiss plus bitcrusher. The noise comes from the engine's own generator a
+ * tile at a time, and the add and round-half-up quantization run four
+ * samples per step. step is a power of two, so scaling by its inverse is
+ * exact.
+ */
+void ae_dsp_apply_lofi(ae_rng_t *rng, float *left, float *right, size_t n,
+                       float amount) {
+  if (!rng || !left || !right || n == 0 || amount <= 0.0f)
     return;
   float clamped = ae_clamp(amount, 0.0f, 1.0f);
   int bits = (int)(16.0f - clamped * 12.0f);
   if (bits < 4)
     bits = 4;
-  float step = 1.0f / (float)(1 << bits);
+  float levels = (float)(1 << bits);
+  float step = 1.0f / levels;
   float noise_amp = clamped * 0.002f;
-  for (size_t i = 0; i < n; ++i) {
-    float noise = noise_amp * (2.0f * ((float)rand() / RAND_MAX) - 1.0f);
-    float l = left[i] + noise;
-    float r = right[i] + noise;
-    left[i] = floorf(l / step + 0.5f) * step;
-    right[i] = floorf(r / step + 0.5f) * step;
+
+  float noise[AE_ER_TILE];
+  for (size_t base = 0; base < n; base += AE_ER_TILE) {
+    size_t count = n - base < AE_ER_TILE ? n - base : AE_ER_TILE;
+    float *l = left + base;
+    float *r = right + base;
+    ae_rng_uniform(rng, noise, count);
+    size_t i = 0;
+#ifdef AE_HAS_SSE2
+    const __m128 amp = _mm_set1_ps(noise_amp);
+    const __m128 scale = _mm_set1_ps(levels);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 vstep = _mm_set1_ps(step);
+    for (; i + 4 <= count; i += 4) {
+      __m128 hiss = _mm_mul_ps(_mm_loadu_ps(noise + i), amp);
+      __m128 yl = _mm_add_ps(
+          _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(l + i), hiss), scale), half);
+      __m128 yr = _mm_add_ps(
+          _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(r + i), hiss), scale), half);
+      _mm_storeu_ps(l + i, _mm_mul_ps(ae_dsp_floor4(yl), vstep));
+      _mm_storeu_ps(r + i, _mm_mul_ps(ae_dsp_floor4(yr), vstep));
+    }
+#endif
+    for (; i < count; ++i) {
+      float hiss = noise_amp * noise[i];
+      l[i] = floorf((l[i] + hiss) * levels + 0.5f) * step;
+      r[i] = floorf((r[i] + hiss) * levels + 0.5f) * step;
+    }
   }
 }
 
@@ -74,9 +156,9 @@ void ae_dsp_apply_width(float *left, float *right, size_t n, float width) {
   }
 }
 
-void ae_dsp_apply_precedence(ae_engine_t *engine, float *left, float *right,
-                             size_t frames) {
-  if (!engine || !left || !right || frames == 0)
+void ae_dsp_apply_precedence(ae_engine_t *engine, ae_precedence_line_t *line,
+                             float *left, float *right, size_t frames) {
+  if (!engine || !line || !left || !right || frames == 0)
     return;
   if (engine->precedence.delay_ms <= 0.0f)
     return;
@@ -90,60 +172,173 @@ void ae_dsp_apply_precedence(ae_engine_t *engine, float *left, float *right,
                                   engine->config.sample_rate);
   if (delay_samples >= engine->precedence_size)
     delay_samples = engine->precedence_size - 1;
+  if (delay_samples < 1)
+    delay_samples = 1;
+
+  /* Spans stop at either ring end and never exceed the delay, so the
+   * samples read were all written before this span */
+  float scratch_l[AE_ER_TILE];
+  float scratch_r[AE_ER_TILE];
+  size_t size = engine->precedence_size;
+  size_t i = 0;
+  while (i < frames) {
+    size_t write = line->index;
+    size_t read = write >= delay_samples ? write - delay_samples
+                                         : write + size - delay_samples;
+    size_t n = frames - i;
+    if (n > AE_ER_TILE)
+      n = AE_ER_TILE;
+    if (n > delay_samples)
+      n = delay_samples;
+    if (n > size - read)
+      n = size - read;
+    if (n > size - write)
+      n = size - write;
+
+    const float *delayed_l = ae_delay_span_load(&line->l, read, n, scratch_l);
+    const float *delayed_r = ae_delay_span_load(&line->r, read, n, scratch_r);
+    ae_delay_span_store(&line->l, write, left + i, n);
+    ae_delay_span_store(&line->r, write, right + i, n);
+    line->index = write + n == size ? 0 : write + n;
+
+    for (size_t k = 0; k < n; ++k) {
+      left[i + k] += gain * (delayed_l[k] * pan_l);
+      right[i + k] += gain * (delayed_r[k] * pan_r);
+    }
+    i += n;
+  }
+}
 
-  for (size_t i = 0; i < frames; ++i) {
-    size_t read_pos =
-        (engine->precedence_index + engine->precedence_size - delay_samples) %
-        engine->precedence_size;
-    float delayed_l = engine->precedence_l[read_pos];
-    float delayed_r = engine->precedence_r[read_pos];
-
-    engine->precedence_l[engine->precedence_index] = left[i];
-    engine->precedence_r[engine->precedence_index] = right[i];
-    engine->precedence_index =
-        (engine->precedence_index + 1) % engine->precedence_size;
-
-    left[i] += gain * (delayed_l * pan_l);
-    right[i] += gain * (delayed_r * pan_r);
+bool ae_doppler_line_alloc(ae_doppler_line_t *line, float sample_rate,
+                           size_t max_frames) {
+  if (!line)
+    return false;
+  memset(line, 0, sizeof(*line));
+  line->max_delay = (size_t)(AE_DOPPLER_MAX_DELAY_S * sample_rate);
+  size_t size = 1;
+  while (size < line->max_delay + max_frames + 4)
+    size <<= 1;
+  line->l = (float *)calloc(size + 3, sizeof(float));
+  line->r = (float *)calloc(size + 3, sizeof(float));
+  if (!line->l || !line->r) {
+    ae_doppler_line_free(line);
+    return false;
   }
+  line->size = size;
+  return true;
 }
 
-void ae_dsp_apply_doppler(const ae_doppler_params_t *doppler, const float *in_l,
-                          const float *in_r, float *out_l, float *out_r,
-                          size_t frames, float *phase) {
-  if (!doppler || !in_l || !in_r || !out_l || !out_r || frames == 0)
+void ae_doppler_line_free(ae_doppler_line_t *line) {
+  if (!line)
     return;
-  if (!doppler->enabled) {
-    memcpy(out_l, in_l, frames * sizeof(float));
-    memcpy(out_r, in_r, frames * sizeof(float));
+  free(line->l);
+  free(line->r);
+  line->l = NULL;
+  line->r = NULL;
+}
+
+/* Silence the rings for a fresh start; control thread, while the audio
+ * thread is not running the line (Doppler off) */
+void ae_doppler_line_reset(ae_doppler_line_t *line) {
+  if (!line || !line->l || !line->r)
     return;
-  }
+  memset(line->l, 0, (line->size + 3) * sizeof(float));
+  memset(line->r, 0, (line->size + 3) * sizeof(float));
+  line->write = 0;
+  line->primed = false;
+}
 
-  float c = 343.0f;
+/**
+ * Propagation delay with the pitch shift of a moving source. The delay
+ * tracks distance / c: a new engine distance sets it directly, otherwise
+ * the velocities carry the distance on by the exact Doppler ratio. The
+ * delay eases toward that target once per block and moves in a straight
+ * line inside it, at a rate that keeps the pitch within an octave.
+ * Processes left/right in place.
+ */
+void ae_dsp_apply_doppler(ae_doppler_line_t *line,
+                          const ae_doppler_params_t *doppler, float distance,
+                          float sample_rate, float *left, float *right,
+                          size_t frames) {
+  if (!line || !line->l || !line->r || !doppler || !left || !right ||
+      frames == 0 || frames > line->size - line->max_delay - 4)
+    return;
+
+  const float c = 343.0f;
+  const float min_delay = 2.0f;
+  const float max_delay = (float)line->max_delay;
   float ratio =
       (c + doppler->listener_velocity) / (c - doppler->source_velocity);
   ratio = ae_clamp(ratio, 0.5f, 2.0f);
-
-  float local_phase = phase ? *phase : 0.0f;
-  while (local_phase >= (float)frames)
-    local_phase -= (float)frames;
-  if (local_phase < 0.0f)
-    local_phase = 0.0f;
-  for (size_t i = 0; i < frames; ++i) {
-    size_t idx = (size_t)local_phase;
-    float frac = local_phase - (float)idx;
-    float l0 = (idx < frames) ? in_l[idx] : 0.0f;
-    float l1 = (idx + 1 < frames) ? in_l[idx + 1] : l0;
-    float r0 = (idx < frames) ? in_r[idx] : 0.0f;
-    float r1 = (idx + 1 < frames) ? in_r[idx + 1] : r0;
-    out_l[i] = l0 + (l1 - l0) * frac;
-    out_r[i] = r0 + (r1 - r0) * frac;
-    local_phase += ratio;
-    while (local_phase >= (float)frames)
-      local_phase -= (float)frames;
+  float block_s = (float)frames / sample_rate;
+
+  if (!line->primed) {
+    /* The rings were cleared when the line was made or Doppler enabled */
+    line->distance = distance;
+    line->delay = ae_clamp(distance / c * sample_rate, min_delay, max_delay);
+    line->primed = true;
+  } else if (distance != line->distance_set) {
+    line->distance = distance;
+  } else {
+    line->distance += (1.0f - ratio) * c * block_s;
+  }
+  line->distance_set = distance;
+  line->distance = ae_clamp(line->distance, 0.0f, max_delay * c / sample_rate);
+
+  float target = ae_clamp(line->distance / c * sample_rate, min_delay,
+                          max_delay);
+  float ease = 1.0f - expf(-block_s / AE_DOPPLER_SMOOTH_S);
+  float slope = (target - line->delay) * ease / (float)frames;
+  slope = ae_clamp(slope, 1.0f - 2.0f, 1.0f - 0.5f);
+
+  size_t size = line->size;
+  size_t mask = size - 1;
+  size_t write = line->write;
+  ae_dsp_ring_write(line->l, size, write, left, frames);
+  ae_dsp_ring_write(line->r, size, write, right, frames);
+
+  /* Read i sits (i - delay - slope * i) from this block's first sample.
+   * The whole delay is split off so the ramp keeps full float precision */
+  float whole = floorf(line->delay);
+  float part = line->delay - whole;
+  size_t origin = (write + size - (size_t)whole - 1) & mask;
+
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  const __m128 vpart = _mm_set1_ps(part);
+  const __m128 vslope = _mm_set1_ps(slope);
+  const __m128i vorigin = _mm_set1_epi32((int)origin);
+  const __m128i vmask = _mm_set1_epi32((int)mask);
+  __m128 vi = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+  for (; i + 4 <= frames; i += 4) {
+    __m128 q = _mm_sub_ps(_mm_sub_ps(vi, vpart), _mm_mul_ps(vslope, vi));
+    __m128 fl = ae_dsp_floor4(q);
+    int32_t base[4];
+    _mm_storeu_si128(
+        (__m128i *)base,
+        _mm_and_si128(_mm_add_epi32(vorigin, _mm_cvttps_epi32(fl)), vmask));
+    __m128 w[4];
+    ae_dsp_lagrange_weights4(_mm_sub_ps(q, fl), w);
+    _mm_storeu_ps(left + i, ae_dsp_lagrange_read4(line->l, base, w));
+    _mm_storeu_ps(right + i, ae_dsp_lagrange_read4(line->r, base, w));
+    vi = _mm_add_ps(vi, _mm_set1_ps(4.0f));
   }
-  if (phase)
-    *phase = local_phase;
+#endif
+  for (; i < frames; ++i) {
+    float fi = (float)i;
+    float q = fi - part - slope * fi;
+    float fl = floorf(q);
+    float w[4];
+    ae_dsp_lagrange_weights(q - fl, w);
+    size_t base = (origin + (size_t)(ptrdiff_t)fl) & mask;
+    const float *tl = line->l + base;
+    const float *tr = line->r + base;
+    left[i] = w[0] * tl[0] + w[1] * tl[1] + w[2] * tl[2] + w[3] * tl[3];
+    right[i] = w[0] * tr[0] + w[1] * tr[1] + w[2] * tr[2] + w[3] * tr[3];
+  }
+
+  line->write = (write + frames) & mask;
+  line->delay += slope * (float)frames;
 }
 
 float ae_dsp_apply_envelope(ae_engine_t *engine, float sample) {
@@ -202,61 +397,160 @@ float ae_dsp_apply_envelope(ae_engine_t *engine, float sample) {
   return sample * engine->env_level;
 }
 
+/* Four consecutive sin values of an oscillator at phase (cycles) stepping
+ * omega radians per sample, rotated on by four samples per call */
+typedef struct {
+  float re[4];
+  float im[4];
+  float step_re; /* cos(4 omega) */
+  float step_im; /* sin(4 omega) */
+} ae_dsp_phasor4_t;
+
+static void ae_dsp_phasor4_init(ae_dsp_phasor4_t *p, float phase,
+                                float omega) {
+  float start = 2.0f * (float)M_PI * phase;
+  for (int k = 0; k < 4; ++k) {
+    p->re[k] = cosf(start + omega * (float)k);
+    p->im[k] = sinf(start + omega * (float)k);
+  }
+  p->step_re = cosf(4.0f * omega);
+  p->step_im = sinf(4.0f * omega);
+}
+
 /**
  * Wow and flutter effect (tape-style pitch wobble)
  *
- * @param samples Input/output samples
+ * A slow wow sine plus a flutter sine at 5.7 times its rate sweep a short
+ * fractional delay. Both oscillators are rotating phasors, reseeded from
+ * the stored phases every tile so they never drift in level. All state
+ * lives in wf; right may be NULL for mono.
+ *
+ * @param wf Per-instance delay lines and LFO phases
+ * @param left Input/output samples
+ * @param right Input/output samples (shares the left modulation)
  * @param n Number of samples
- * @param depth Modulation depth (0.0-1.0, typical 0.001-0.005 for subtle)
+ * @param depth Modulation depth (0.0-1.0, 1.0 = 10 ms sweep)
  * @param rate_hz Modulation rate in Hz (typical 0.5-4.0)
  * @param sample_rate Sample rate in Hz
- * @param phase LFO phase state (caller-owned)
  */
-void ae_dsp_apply_wow_flutter(float *samples, size_t n, float depth,
-                              float rate_hz, float sample_rate, float *phase) {
-  if (!samples || n == 0 || depth <= 0.0f || !phase)
+void ae_dsp_apply_wow_flutter(ae_wow_flutter_t *wf, float *left, float *right,
+                              size_t n, float depth, float rate_hz,
+                              float sample_rate) {
+  if (!wf || !left || n == 0)
     return;
-
-  float lfo_phase = *phase;
-  float phase_inc = 2.0f * (float)M_PI * rate_hz / sample_rate;
-  float max_delay_samples =
-      depth * sample_rate * 0.01f; /* Max 10ms delay variation */
-
-  /* Simple delay buffer for interpolation */
-  static float delay_buffer[4800]; /* 100ms at 48kHz */
-  static size_t delay_index = 0;
-  size_t delay_size = 4800;
-
-  for (size_t i = 0; i < n; ++i) {
-    /* LFO (combination of slow wow and faster flutter) */
-    float wow = sinf(lfo_phase);
-    float flutter =
-        0.3f * sinf(lfo_phase * 5.7f);  /* Higher frequency flutter */
-    float mod = (wow + flutter) * 0.5f; /* Combined modulation */
-
-    /* Calculate delay time */
-    float delay_samples = (1.0f + mod) * max_delay_samples + 1.0f;
-    delay_samples = ae_clamp(delay_samples, 1.0f, (float)(delay_size - 2));
-
-    /* Write to delay buffer */
-    delay_buffer[delay_index] = samples[i];
-
-    /* Read with interpolation */
-    float read_pos = (float)delay_index - delay_samples;
-    while (read_pos < 0.0f)
-      read_pos += (float)delay_size;
-    size_t idx0 = (size_t)read_pos % delay_size;
-    size_t idx1 = (idx0 + 1) % delay_size;
-    float frac = read_pos - floorf(read_pos);
-    samples[i] = delay_buffer[idx0] * (1.0f - frac) + delay_buffer[idx1] * frac;
-
-    delay_index = (delay_index + 1) % delay_size;
-    lfo_phase += phase_inc;
-    if (lfo_phase >= 2.0f * (float)M_PI)
-      lfo_phase -= 2.0f * (float)M_PI;
+  if (depth <= 0.0f) {
+    wf->primed = false;
+    return;
+  }
+  if (!wf->primed) {
+    memset(wf, 0, sizeof(*wf));
+    wf->primed = true;
   }
 
-  *phase = lfo_phase;
+  const size_t size = AE_WOW_FLUTTER_SIZE;
+  const size_t mask = size - 1;
+  /* Sweep depth in samples, held short enough for a tile plus the swing */
+  float max_delay = ae_clamp(depth, 0.0f, 1.0f) * sample_rate * 0.01f;
+  max_delay = fminf(max_delay, (float)(size - AE_ER_TILE) * 0.5f - 4.0f);
+  float wow_cycles = rate_hz / sample_rate;
+  float flutter_cycles = 5.7f * wow_cycles;
+
+  float mod[AE_ER_TILE];
+  for (size_t base = 0; base < n; base += AE_ER_TILE) {
+    size_t count = n - base < AE_ER_TILE ? n - base : AE_ER_TILE;
+    float *l = left + base;
+    float *r = right ? right + base : NULL;
+
+    /* Delay per sample, at least 2 so the last tap is already written */
+    ae_dsp_phasor4_t wow;
+    ae_dsp_phasor4_t flutter;
+    ae_dsp_phasor4_init(&wow, wf->wow_phase, 2.0f * (float)M_PI * wow_cycles);
+    ae_dsp_phasor4_init(&flutter, wf->flutter_phase,
+                        2.0f * (float)M_PI * flutter_cycles);
+#ifdef AE_HAS_SSE2
+    {
+      __m128 wre = _mm_loadu_ps(wow.re);
+      __m128 wim = _mm_loadu_ps(wow.im);
+      __m128 fre = _mm_loadu_ps(flutter.re);
+      __m128 fim = _mm_loadu_ps(flutter.im);
+      const __m128 wc = _mm_set1_ps(wow.step_re);
+      const __m128 ws = _mm_set1_ps(wow.step_im);
+      const __m128 fc = _mm_set1_ps(flutter.step_re);
+      const __m128 fs = _mm_set1_ps(flutter.step_im);
+      const __m128 swing = _mm_set1_ps(0.5f * max_delay);
+      const __m128 center = _mm_set1_ps(max_delay + 2.0f);
+      for (size_t i = 0; i < count; i += 4) {
+        __m128 lfo = _mm_add_ps(wim, _mm_mul_ps(_mm_set1_ps(0.3f), fim));
+        _mm_storeu_ps(mod + i, _mm_add_ps(center, _mm_mul_ps(lfo, swing)));
+        __m128 t = _mm_sub_ps(_mm_mul_ps(wre, wc), _mm_mul_ps(wim, ws));
+        wim = _mm_add_ps(_mm_mul_ps(wre, ws), _mm_mul_ps(wim, wc));
+        wre = t;
+        t = _mm_sub_ps(_mm_mul_ps(fre, fc), _mm_mul_ps(fim, fs));
+        fim = _mm_add_ps(_mm_mul_ps(fre, fs), _mm_mul_ps(fim, fc));
+        fre = t;
+      }
+    }
+#else
+    for (size_t i = 0; i < count; i += 4) {
+      for (int k = 0; k < 4; ++k) {
+        float lfo = 0.5f * (wow.im[k] + 0.3f * flutter.im[k]);
+        mod[i + k] = (1.0f + lfo) * max_delay + 2.0f;
+        float t = wow.re[k] * wow.step_re - wow.im[k] * wow.step_im;
+        wow.im[k] = wow.re[k] * wow.step_im + wow.im[k] * wow.step_re;
+        wow.re[k] = t;
+        t = flutter.re[k] * flutter.step_re - flutter.im[k] * flutter.step_im;
+        flutter.im[k] =
+            flutter.re[k] * flutter.step_im + flutter.im[k] * flutter.step_re;
+        flutter.re[k] = t;
+      }
+    }
+#endif
+    wf->wow_phase += wow_cycles * (float)count;
+    wf->wow_phase -= floorf(wf->wow_phase);
+    wf->flutter_phase += flutter_cycles * (float)count;
+    wf->flutter_phase -= floorf(wf->flutter_phase);
+
+    size_t write = wf->write;
+    ae_dsp_ring_write(wf->l, size, write, l, count);
+    if (r)
+      ae_dsp_ring_write(wf->r, size, write, r, count);
+    size_t origin = (write + size - 1) & mask;
+
+    size_t i = 0;
+#ifdef AE_HAS_SSE2
+    const __m128i vorigin = _mm_set1_epi32((int)origin);
+    const __m128i vmask = _mm_set1_epi32((int)mask);
+    __m128 vi = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    for (; i + 4 <= count; i += 4) {
+      __m128 q = _mm_sub_ps(vi, _mm_loadu_ps(mod + i));
+      __m128 fl = ae_dsp_floor4(q);
+      int32_t taps[4];
+      _mm_storeu_si128(
+          (__m128i *)taps,
+          _mm_and_si128(_mm_add_epi32(vorigin, _mm_cvttps_epi32(fl)), vmask));
+      __m128 w[4];
+      ae_dsp_lagrange_weights4(_mm_sub_ps(q, fl), w);
+      _mm_storeu_ps(l + i, ae_dsp_lagrange_read4(wf->l, taps, w));
+      if (r)
+        _mm_storeu_ps(r + i, ae_dsp_lagrange_read4(wf->r, taps, w));
+      vi = _mm_add_ps(vi, _mm_set1_ps(4.0f));
+    }
+#endif
+    for (; i < count; ++i) {
+      float q = (float)i - mod[i];
+      float fl = floorf(q);
+      float w[4];
+      ae_dsp_lagrange_weights(q - fl, w);
+      size_t tap = (origin + (size_t)(ptrdiff_t)fl) & mask;
+      const float *tl = wf->l + tap;
+      l[i] = w[0] * tl[0] + w[1] * tl[1] + w[2] * tl[2] + w[3] * tl[3];
+      if (r) {
+        const float *tr = wf->r + tap;
+        r[i] = w[0] * tr[0] + w[1] * tr[1] + w[2] * tr[2] + w[3] * tr[3];
+      }
+    }
+    wf->write = (write + count) & mask;
+  }
 }
 
 /**
@@ -275,16 +569,18 @@ void ae_dsp_apply_tape_saturation(float *samples, size_t n, float drive) {
   /* Pre-gain based on drive */
   float pre_gain = 1.0f + d * 3.0f;
 
-  for (size_t i = 0; i < n; ++i) {
-    float x = samples[i] * pre_gain;
+  float saturated[AE_ER_TILE];
+  for (size_t start = 0; start < n; start += AE_ER_TILE) {
+    size_t count = n - start < AE_ER_TILE ? n - start : AE_ER_TILE;
+    float *block = samples + start;
 
     /* Soft clipping using tanh (tape-like saturation curve) */
-    float saturated = tanhf(x);
+    ae_simd_scale(saturated, block, pre_gain, count);
+    ae_fast_tanh(saturated, saturated, count, AE_MATH_1E4);
 
     /* Blend between clean and saturated */
-    float output = samples[i] * (1.0f - d) + saturated * d;
-
-    /* Apply subtle high-frequency rolloff (tape head loss simulation) */
-    samples[i] = output;
+    ae_simd_scale(block, block, 1.0f - d, count);
+    ae_simd_scale(saturated, saturated, d, count);
+    ae_simd_add(block, block, saturated, count);
   }
 }
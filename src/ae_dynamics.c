@@ -5,6 +5,11 @@
 
 #include "ae_internal.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
+
 /**
  * Initialize dynamics processor
  */
@@ -21,186 +26,509 @@ void ae_dynamics_init(ae_dynamics_t *dyn) {
   dyn->gain_reduction_db = 0.0f;
 }
 
-/**
- * Compute compressor gain for a given input level
- *
- * @param input_db Input level in dB
- * @param threshold_db Threshold in dB
- * @param ratio Compression ratio (e.g., 4.0 = 4:1)
- * @param knee_db Knee width in dB
- * @return Output level in dB
- */
-static float compute_compressor_curve(float input_db, float threshold_db,
-                                      float ratio, float knee_db) {
-  float half_knee = knee_db * 0.5f;
-  float knee_start = threshold_db - half_knee;
-  float knee_end = threshold_db + half_knee;
-
-  if (input_db <= knee_start) {
-    /* Below knee: no compression */
-    return input_db;
-  } else if (input_db >= knee_end) {
-    /* Above knee: full compression */
-    return threshold_db + (input_db - threshold_db) / ratio;
-  } else {
-    /* In knee: smooth transition */
-    float knee_factor = (input_db - knee_start) / knee_db;
-    float slope = 1.0f + (1.0f / ratio - 1.0f) * knee_factor;
-    return knee_start + (input_db - knee_start) * slope;
+/*============================================================================
+ * Block compressor
+ *============================================================================*/
+
+/* Frames per detector/gain pass; the scratch lives on the stack */
+#define AE_COMPRESSOR_TILE 256
+
+struct ae_compressor {
+  ae_compressor_params_t params;
+  float sample_rate;
+
+  /* Cached by set_params */
+  float attack_coeff;
+  float release_coeff;
+  float slope;      /* 1 / ratio - 1: gain dB per dB over threshold */
+  float half_knee;
+  float knee_scale; /* slope / (2 * knee) */
+
+  float gain_db[2]; /* Smoothed gain change per channel (<= 0) */
+};
+
+/* Makeup, then dB to linear: 10^(dB/20) as e^(dB * ln10/20) */
+static void ae_compressor_to_linear(const ae_compressor_t *comp, float *gain,
+                                    size_t n) {
+  ae_simd_offset(gain, gain, comp->params.makeup_db, n);
+  ae_simd_scale(gain, gain, AE_DB_TO_NEPER, n);
+  ae_fast_exp(gain, gain, n, AE_MATH_1E4);
+}
+
+/* Detector levels to smoothed linear gain for channel ch, in place */
+static void ae_compressor_gain(ae_compressor_t *comp, float *gain, size_t n,
+                               size_t ch) {
+  ae_gain_curve_db(gain, n, comp->params.threshold_db, comp->slope,
+                   comp->half_knee, comp->knee_scale);
+  comp->gain_db[ch] = ae_gain_smooth(gain, n, comp->gain_db[ch],
+                                     comp->attack_coeff, comp->release_coeff);
+  ae_compressor_to_linear(comp, gain, n);
+}
+
+AE_API ae_compressor_t *ae_compressor_create(uint32_t sample_rate) {
+  if (sample_rate == 0)
+    return NULL;
+  ae_compressor_t *comp = (ae_compressor_t *)calloc(1, sizeof(*comp));
+  if (!comp)
+    return NULL;
+  comp->sample_rate = (float)sample_rate;
+  ae_compressor_params_t params = {.threshold_db = -20.0f,
+                                   .ratio = 4.0f,
+                                   .knee_db = 6.0f,
+                                   .attack_ms = 10.0f,
+                                   .release_ms = 100.0f,
+                                   .makeup_db = 0.0f,
+                                   .stereo_link = true};
+  ae_compressor_set_params(comp, &params);
+  return comp;
+}
+
+AE_API void ae_compressor_destroy(ae_compressor_t *comp) { free(comp); }
+
+AE_API void ae_compressor_reset(ae_compressor_t *comp) {
+  if (!comp)
+    return;
+  comp->gain_db[0] = 0.0f;
+  comp->gain_db[1] = 0.0f;
+}
+
+AE_API ae_result_t
+ae_compressor_set_params(ae_compressor_t *comp,
+                         const ae_compressor_params_t *params) {
+  if (!comp || !params || !(params->ratio >= 1.0f) ||
+      !(params->knee_db >= 0.0f) || !(params->attack_ms > 0.0f) ||
+      !(params->release_ms > 0.0f) || !isfinite(params->threshold_db) ||
+      !isfinite(params->makeup_db) || !isfinite(params->knee_db))
+    return AE_ERROR_INVALID_PARAM;
+  comp->params = *params;
+  comp->attack_coeff =
+      expf(-1.0f / (params->attack_ms * 0.001f * comp->sample_rate));
+  comp->release_coeff =
+      expf(-1.0f / (params->release_ms * 0.001f * comp->sample_rate));
+  comp->slope = 1.0f / params->ratio - 1.0f;
+  comp->half_knee = 0.5f * params->knee_db;
+  comp->knee_scale =
+      params->knee_db > 0.0f ? comp->slope / (2.0f * params->knee_db) : 0.0f;
+  return AE_OK;
+}
+
+AE_API void ae_compressor_get_params(const ae_compressor_t *comp,
+                                     ae_compressor_params_t *params) {
+  if (comp && params)
+    *params = comp->params;
+}
+
+AE_API ae_result_t ae_compressor_process(ae_compressor_t *comp, float *left,
+                                         float *right, const float *sc_left,
+                                         const float *sc_right,
+                                         size_t frames) {
+  if (!comp || !left)
+    return AE_ERROR_INVALID_PARAM;
+  const float *key_l = sc_left ? sc_left : left;
+  const float *key_r = sc_left ? (sc_right ? sc_right : sc_left)
+                               : (right ? right : left);
+  bool linked = comp->params.stereo_link || !right;
+
+  float gain_l[AE_COMPRESSOR_TILE];
+  float gain_r[AE_COMPRESSOR_TILE];
+  for (size_t start = 0; start < frames; start += AE_COMPRESSOR_TILE) {
+    size_t count = frames - start < AE_COMPRESSOR_TILE
+                       ? frames - start
+                       : AE_COMPRESSOR_TILE;
+    ae_simd_abs(gain_l, key_l + start, count);
+    ae_simd_abs(gain_r, key_r + start, count);
+    if (linked) {
+      /* One detector on the louder channel drives both */
+      ae_simd_max(gain_l, gain_l, gain_r, count);
+      ae_compressor_gain(comp, gain_l, count, 0);
+      comp->gain_db[1] = comp->gain_db[0];
+      ae_simd_mul(left + start, left + start, gain_l, count);
+      if (right)
+        ae_simd_mul(right + start, right + start, gain_l, count);
+    } else {
+      ae_compressor_gain(comp, gain_l, count, 0);
+      ae_compressor_gain(comp, gain_r, count, 1);
+      ae_simd_mul(left + start, left + start, gain_l, count);
+      ae_simd_mul(right + start, right + start, gain_r, count);
+    }
   }
+  return AE_OK;
 }
 
-/**
- * Process a single sample through the compressor
- *
- * @param dyn Dynamics processor state
- * @param sample Input sample
- * @param sample_rate Sample rate in Hz
- * @return Output sample
- */
-float ae_compressor_process_sample(ae_dynamics_t *dyn, float sample,
-                                   float sample_rate) {
-  if (!dyn)
-    return sample;
+AE_API float ae_compressor_gain_reduction(const ae_compressor_t *comp) {
+  if (!comp)
+    return 0.0f;
+  return -fminf(comp->gain_db[0], comp->gain_db[1]);
+}
+
+/*============================================================================
+ * Lookahead limiter
+ *============================================================================*/
+
+#define AE_LIMITER_TILE 256
+
+/* True-peak interpolator: 4 phases of 12 taps. Phase 0 passes x[n - 6]
+ * through, phases 1-3 estimate x at n - 6 + k/4. */
+#define AE_LIMITER_TP_TAPS 12
+#define AE_LIMITER_TP_DELAY 6
+#define AE_LIMITER_TP_PHASES 4
+
+struct ae_limiter {
+  ae_limiter_params_t params;
+  float sample_rate;
+
+  /* Cached by set_params */
+  float ceiling; /* Linear */
+  float release_coeff;
+  size_t window;  /* Lookahead in frames; the peak hold spans window + 1 */
+  size_t latency; /* window, plus the interpolator delay for true peak */
+
+  /* Audio delay: power-of-two rings, written and read a tile at a time */
+  float *delay[2];
+  size_t delay_mask;
+  size_t delay_pos;
+
+  /* Sliding max: peaks falling from head to tail, with their frames */
+  float *queue_peak;
+  uint64_t *queue_frame;
+  size_t queue_mask;
+  size_t queue_head;
+  size_t queue_tail;
+  uint64_t frame;
+
+  /* Release stage, then a moving average over the last window gains */
+  float *ramp;
+  size_t ramp_len;
+  size_t ramp_pos;
+  double ramp_sum;
+  float release_gain;
+  float gain;
 
-  /* Convert to dB */
-  float input_abs = fabsf(sample);
-  float input_db = (input_abs > 1e-10f) ? 20.0f * log10f(input_abs) : -100.0f;
-
-  /* Envelope follower */
-  float target_db = input_db;
-  float attack_coeff = expf(-1.0f / (dyn->attack_ms * 0.001f * sample_rate));
-  float release_coeff = expf(-1.0f / (dyn->release_ms * 0.001f * sample_rate));
-
-  if (target_db > dyn->envelope) {
-    dyn->envelope =
-        attack_coeff * dyn->envelope + (1.0f - attack_coeff) * target_db;
-  } else {
-    dyn->envelope =
-        release_coeff * dyn->envelope + (1.0f - release_coeff) * target_db;
+  /* Interpolator taps per phase, and the last inputs */
+  float tp_coeff[AE_LIMITER_TP_PHASES][AE_LIMITER_TP_TAPS];
+  float tp_history[2][AE_LIMITER_TP_TAPS - 1];
+};
+
+static size_t ae_limiter_pow2(size_t n) {
+  size_t size = 1;
+  while (size < n)
+    size <<= 1;
+  return size;
+}
+
+/* Blackman-windowed sinc at 4x, each phase normalized to unity DC gain */
+static void ae_limiter_design_interpolator(ae_limiter_t *lim) {
+  const int len = AE_LIMITER_TP_TAPS * AE_LIMITER_TP_PHASES;
+  const double center = 0.5 * len;
+  for (int k = 0; k < AE_LIMITER_TP_PHASES; ++k) {
+    double sum = 0.0;
+    for (int j = 0; j < AE_LIMITER_TP_TAPS; ++j) {
+      double m = j * AE_LIMITER_TP_PHASES + k - center;
+      double t = m / AE_LIMITER_TP_PHASES;
+      double x = m / center;
+      double sinc = t == 0.0 ? 1.0 : sin(M_PI * t) / (M_PI * t);
+      double w = 0.42 + 0.5 * cos(M_PI * x) + 0.08 * cos(2.0 * M_PI * x);
+      lim->tp_coeff[k][j] = (float)(sinc * w);
+      sum += lim->tp_coeff[k][j];
+    }
+    for (int j = 0; j < AE_LIMITER_TP_TAPS; ++j)
+      lim->tp_coeff[k][j] = (float)(lim->tp_coeff[k][j] / sum);
   }
+}
 
-  /* Compute gain reduction */
-  float output_db = compute_compressor_curve(dyn->envelope, dyn->threshold_db,
-                                             dyn->ratio, dyn->knee_db);
-  float gain_db = output_db - dyn->envelope + dyn->makeup_db;
-  dyn->gain_reduction_db = dyn->envelope - output_db;
+/* Copy n samples into or out of a ring starting at pos, in two pieces at
+ * most, so the per-sample path never wraps an index */
+static void ae_limiter_ring_write(float *ring, size_t mask, size_t pos,
+                                  const float *src, size_t n) {
+  size_t at = pos & mask;
+  size_t first = mask + 1 - at < n ? mask + 1 - at : n;
+  memcpy(ring + at, src, first * sizeof(float));
+  memcpy(ring, src + first, (n - first) * sizeof(float));
+}
 
-  /* Apply gain */
-  float gain_linear = powf(10.0f, gain_db / 20.0f);
-  return sample * gain_linear;
+static void ae_limiter_ring_read(const float *ring, size_t mask, size_t pos,
+                                 float *dst, size_t n) {
+  size_t at = pos & mask;
+  size_t first = mask + 1 - at < n ? mask + 1 - at : n;
+  memcpy(dst, ring + at, first * sizeof(float));
+  memcpy(dst + first, ring, (n - first) * sizeof(float));
 }
 
 /**
- * Process a buffer through the compressor
- *
- * @param dyn Dynamics processor state
- * @param samples Input/output samples
- * @param frames Number of frames
- * @param sample_rate Sample rate in Hz
+ * Largest inter-sample value per frame across the channels. Each phase
+ * is a 12-tap FIR run over four frames per vector, from unaligned loads
+ * of the input; the phases then fold into the peak with a max, so no
+ * horizontal step is needed.
  */
-void ae_compressor_process(ae_dynamics_t *dyn, float *samples, size_t frames,
-                           float sample_rate) {
-  if (!dyn || !samples || frames == 0)
-    return;
-
-  for (size_t i = 0; i < frames; ++i) {
-    samples[i] = ae_compressor_process_sample(dyn, samples[i], sample_rate);
+static void ae_limiter_true_peak(ae_limiter_t *lim, float *const *ch,
+                                 size_t channels, float *peak, size_t n) {
+  const size_t hist = AE_LIMITER_TP_TAPS - 1;
+  float buf[2][AE_LIMITER_TP_TAPS - 1 + AE_LIMITER_TILE];
+  for (size_t c = 0; c < channels; ++c) {
+    memcpy(buf[c], lim->tp_history[c], hist * sizeof(float));
+    memcpy(buf[c] + hist, ch[c], n * sizeof(float));
+  }
+#ifdef AE_HAS_SSE2
+  __m128 coeff[AE_LIMITER_TP_PHASES][AE_LIMITER_TP_TAPS];
+  for (size_t k = 0; k < AE_LIMITER_TP_PHASES; ++k)
+    for (size_t j = 0; j < AE_LIMITER_TP_TAPS; ++j)
+      coeff[k][j] = _mm_set1_ps(lim->tp_coeff[k][j]);
+  const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 p = _mm_setzero_ps();
+    for (size_t c = 0; c < channels; ++c) {
+      const float *x = buf[c] + hist + i;
+      for (size_t k = 0; k < AE_LIMITER_TP_PHASES; ++k) {
+        __m128 acc = _mm_mul_ps(coeff[k][0], _mm_loadu_ps(x));
+        for (size_t j = 1; j < AE_LIMITER_TP_TAPS; ++j)
+          acc = _mm_add_ps(acc,
+                           _mm_mul_ps(coeff[k][j], _mm_loadu_ps(x - j)));
+        p = _mm_max_ps(p, _mm_and_ps(acc, abs_mask));
+      }
+    }
+    _mm_storeu_ps(peak + i, p);
   }
+#else
+  size_t i = 0;
+#endif
+  for (; i < n; ++i) {
+    float p = 0.0f;
+    for (size_t c = 0; c < channels; ++c) {
+      const float *x = buf[c] + hist + i;
+      for (size_t k = 0; k < AE_LIMITER_TP_PHASES; ++k) {
+        float acc = lim->tp_coeff[k][0] * x[0];
+        for (size_t j = 1; j < AE_LIMITER_TP_TAPS; ++j)
+          acc += lim->tp_coeff[k][j] * x[-(int)j];
+        p = fmaxf(p, fabsf(acc));
+      }
+    }
+    peak[i] = p;
+  }
+  for (size_t c = 0; c < channels; ++c)
+    memcpy(lim->tp_history[c], buf[c] + n, hist * sizeof(float));
 }
 
 /**
- * Stereo-linked compressor processing
- *
- * @param dyn Dynamics processor state
- * @param left Left channel samples
- * @param right Right channel samples
- * @param frames Number of frames
- * @param sample_rate Sample rate in Hz
+ * Peak over the last window + 1 frames, in place. The queue keeps only
+ * peaks not dominated by a later, larger one, so its head is the window
+ * maximum and each frame is pushed and popped at most once.
  */
-void ae_compressor_process_stereo(ae_dynamics_t *dyn, float *left, float *right,
-                                  size_t frames, float sample_rate) {
-  if (!dyn || !left || !right || frames == 0)
-    return;
-
-  for (size_t i = 0; i < frames; ++i) {
-    /* Use max of L/R for detection */
-    float input_abs = fmaxf(fabsf(left[i]), fabsf(right[i]));
-    float input_db = (input_abs > 1e-10f) ? 20.0f * log10f(input_abs) : -100.0f;
+static void ae_limiter_sliding_max(ae_limiter_t *lim, float *peak,
+                                   size_t n) {
+  float *qp = lim->queue_peak;
+  uint64_t *qf = lim->queue_frame;
+  size_t mask = lim->queue_mask;
+  size_t head = lim->queue_head;
+  size_t tail = lim->queue_tail;
+  uint64_t frame = lim->frame;
+  for (size_t i = 0; i < n; ++i, ++frame) {
+    float p = peak[i];
+    while (tail != head && qp[(tail - 1) & mask] <= p)
+      --tail;
+    qp[tail & mask] = p;
+    qf[tail & mask] = frame;
+    ++tail;
+    while (qf[head & mask] + lim->window < frame)
+      ++head;
+    peak[i] = qp[head & mask];
+  }
+  lim->queue_head = head;
+  lim->queue_tail = tail;
+  lim->frame = frame;
+}
 
-    /* Envelope follower */
-    float attack_coeff = expf(-1.0f / (dyn->attack_ms * 0.001f * sample_rate));
-    float release_coeff =
-        expf(-1.0f / (dyn->release_ms * 0.001f * sample_rate));
+/* Held peak to target gain, ceiling / max(peak, ceiling), in place */
+static void ae_limiter_target(const ae_limiter_t *lim, float *peak,
+                              size_t n) {
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  const __m128 ceiling = _mm_set1_ps(lim->ceiling);
+  for (; i + 4 <= n; i += 4)
+    _mm_storeu_ps(peak + i,
+                  _mm_div_ps(ceiling,
+                             _mm_max_ps(_mm_loadu_ps(peak + i), ceiling)));
+#endif
+  for (; i < n; ++i)
+    peak[i] = lim->ceiling / fmaxf(peak[i], lim->ceiling);
+}
 
-    if (input_db > dyn->envelope) {
-      dyn->envelope =
-          attack_coeff * dyn->envelope + (1.0f - attack_coeff) * input_db;
-    } else {
-      dyn->envelope =
-          release_coeff * dyn->envelope + (1.0f - release_coeff) * input_db;
-    }
+/**
+ * Instant attack and exponential release, then a moving average over the
+ * lookahead. Release never rises above the held target, and the held
+ * target covers every frame the average spans, so the averaged gain is at
+ * or below the target when the delayed peak comes out: a linear ramp that
+ * lands on it rather than a step.
+ */
+static void ae_limiter_ramp(ae_limiter_t *lim, float *gain, size_t n) {
+  float c = lim->release_coeff;
+  float r = lim->release_gain;
+  float *ramp = lim->ramp;
+  size_t len = lim->ramp_len;
+  size_t pos = lim->ramp_pos;
+  double sum = lim->ramp_sum;
+  double inv_len = 1.0 / (double)len;
+  for (size_t i = 0; i < n; ++i) {
+    float target = gain[i];
+    float released = target + c * (r - target);
+    r = released < target ? released : target;
+    sum += (double)r - ramp[pos];
+    ramp[pos] = r;
+    if (++pos == len)
+      pos = 0;
+    float g = (float)(sum * inv_len);
+    gain[i] = g < 1.0f ? g : 1.0f;
+  }
+  lim->release_gain = r;
+  lim->ramp_pos = pos;
+  lim->ramp_sum = sum;
+  if (n > 0)
+    lim->gain = gain[n - 1];
+}
 
-    /* Compute gain */
-    float output_db = compute_compressor_curve(dyn->envelope, dyn->threshold_db,
-                                               dyn->ratio, dyn->knee_db);
-    float gain_db = output_db - dyn->envelope + dyn->makeup_db;
-    float gain_linear = powf(10.0f, gain_db / 20.0f);
+AE_API ae_limiter_t *ae_limiter_create(uint32_t sample_rate) {
+  if (sample_rate == 0)
+    return NULL;
+  ae_limiter_t *lim = (ae_limiter_t *)calloc(1, sizeof(*lim));
+  if (!lim)
+    return NULL;
+  lim->sample_rate = (float)sample_rate;
 
-    left[i] *= gain_linear;
-    right[i] *= gain_linear;
+  /* Buffers cover the longest lookahead, so set_params never allocates */
+  size_t max_window = (size_t)ceilf(AE_LIMITER_MAX_LOOKAHEAD_MS * 0.001f *
+                                    lim->sample_rate);
+  size_t delay_size =
+      ae_limiter_pow2(max_window + AE_LIMITER_TP_DELAY + AE_LIMITER_TILE);
+  size_t queue_size = ae_limiter_pow2(max_window + 2);
+  lim->delay_mask = delay_size - 1;
+  lim->queue_mask = queue_size - 1;
+  lim->delay[0] = (float *)calloc(delay_size, sizeof(float));
+  lim->delay[1] = (float *)calloc(delay_size, sizeof(float));
+  lim->queue_peak = (float *)calloc(queue_size, sizeof(float));
+  lim->queue_frame = (uint64_t *)calloc(queue_size, sizeof(uint64_t));
+  lim->ramp = (float *)calloc(max_window + 1, sizeof(float));
+  if (!lim->delay[0] || !lim->delay[1] || !lim->queue_peak ||
+      !lim->queue_frame || !lim->ramp) {
+    ae_limiter_destroy(lim);
+    return NULL;
   }
+  ae_limiter_design_interpolator(lim);
+
+  ae_limiter_params_t params = {.ceiling_db = -1.0f,
+                                .lookahead_ms = 5.0f,
+                                .release_ms = 50.0f,
+                                .true_peak = false};
+  ae_limiter_set_params(lim, &params);
+  return lim;
 }
 
-/**
- * Lookahead limiter processing
- *
- * @param samples Input/output samples
- * @param frames Number of frames
- * @param ceiling_db Ceiling level in dB (e.g., -0.3)
- * @param lookahead_samples Lookahead in samples
- * @param release_ms Release time in ms
- * @param sample_rate Sample rate in Hz
- * @param delay_buffer Delay buffer (caller-owned, size = lookahead_samples)
- * @param delay_index Delay buffer write index (caller-owned)
- * @param envelope Envelope state (caller-owned)
- */
-void ae_limiter_process(float *samples, size_t frames, float ceiling_db,
-                        size_t lookahead_samples, float release_ms,
-                        float sample_rate, float *delay_buffer,
-                        size_t *delay_index, float *envelope) {
-  if (!samples || !delay_buffer || !delay_index || !envelope || frames == 0)
+AE_API void ae_limiter_destroy(ae_limiter_t *lim) {
+  if (!lim)
     return;
+  free(lim->delay[0]);
+  free(lim->delay[1]);
+  free(lim->queue_peak);
+  free(lim->queue_frame);
+  free(lim->ramp);
+  free(lim);
+}
 
-  float ceiling_linear = powf(10.0f, ceiling_db / 20.0f);
-  float release_coeff = expf(-1.0f / (release_ms * 0.001f * sample_rate));
+AE_API void ae_limiter_reset(ae_limiter_t *lim) {
+  if (!lim)
+    return;
+  memset(lim->delay[0], 0, (lim->delay_mask + 1) * sizeof(float));
+  memset(lim->delay[1], 0, (lim->delay_mask + 1) * sizeof(float));
+  lim->delay_pos = 0;
+  lim->queue_head = 0;
+  lim->queue_tail = 0;
+  lim->frame = 0;
+  lim->ramp_len = lim->window > 0 ? lim->window : 1;
+  for (size_t i = 0; i < lim->ramp_len; ++i)
+    lim->ramp[i] = 1.0f;
+  lim->ramp_pos = 0;
+  lim->ramp_sum = (double)lim->ramp_len;
+  lim->release_gain = 1.0f;
+  lim->gain = 1.0f;
+  memset(lim->tp_history, 0, sizeof(lim->tp_history));
+}
 
-  for (size_t i = 0; i < frames; ++i) {
-    /* Read from delay buffer */
-    size_t read_idx =
-        (*delay_index + lookahead_samples) % (lookahead_samples * 2);
-    float delayed_sample = delay_buffer[read_idx];
+AE_API ae_result_t ae_limiter_set_params(ae_limiter_t *lim,
+                                         const ae_limiter_params_t *params) {
+  if (!lim || !params || !isfinite(params->ceiling_db) ||
+      !(params->lookahead_ms >= 0.0f) ||
+      !(params->lookahead_ms <= AE_LIMITER_MAX_LOOKAHEAD_MS) ||
+      !(params->release_ms > 0.0f))
+    return AE_ERROR_INVALID_PARAM;
+  size_t old_latency = lim->latency;
+  lim->params = *params;
+  lim->ceiling = powf(10.0f, params->ceiling_db / 20.0f);
+  lim->release_coeff =
+      expf(-1.0f / (params->release_ms * 0.001f * lim->sample_rate));
+  lim->window =
+      (size_t)lroundf(params->lookahead_ms * 0.001f * lim->sample_rate);
+  lim->latency = lim->window + (params->true_peak ? AE_LIMITER_TP_DELAY : 0);
+  /* The ramp length and delay taps move with the latency */
+  if (lim->latency != old_latency ||
+      lim->ramp_len != (lim->window > 0 ? lim->window : 1))
+    ae_limiter_reset(lim);
+  return AE_OK;
+}
+
+AE_API void ae_limiter_get_params(const ae_limiter_t *lim,
+                                  ae_limiter_params_t *params) {
+  if (lim && params)
+    *params = lim->params;
+}
 
-    /* Write to delay buffer */
-    delay_buffer[*delay_index] = samples[i];
-    *delay_index = (*delay_index + 1) % (lookahead_samples * 2);
+AE_API ae_result_t ae_limiter_process(ae_limiter_t *lim, float *left,
+                                      float *right, size_t frames) {
+  if (!lim || !left)
+    return AE_ERROR_INVALID_PARAM;
+  size_t channels = right ? 2 : 1;
 
-    /* Peak detection with lookahead */
-    float peak = fabsf(samples[i]);
-    if (peak > *envelope) {
-      *envelope = peak;
+  float gain[AE_LIMITER_TILE];
+  float scratch[AE_LIMITER_TILE];
+  for (size_t start = 0; start < frames; start += AE_LIMITER_TILE) {
+    size_t count = frames - start < AE_LIMITER_TILE ? frames - start
+                                                    : AE_LIMITER_TILE;
+    float *tile[2] = {left + start, right ? right + start : NULL};
+
+    /* Detector, louder channel: sample peaks or inter-sample peaks */
+    if (lim->params.true_peak) {
+      ae_limiter_true_peak(lim, tile, channels, gain, count);
     } else {
-      *envelope *= release_coeff;
+      ae_simd_abs(gain, tile[0], count);
+      if (right) {
+        ae_simd_abs(scratch, tile[1], count);
+        ae_simd_max(gain, gain, scratch, count);
+      }
     }
+    ae_limiter_sliding_max(lim, gain, count);
+    ae_limiter_target(lim, gain, count);
+    ae_limiter_ramp(lim, gain, count);
 
-    /* Compute gain reduction */
-    float gain = 1.0f;
-    if (*envelope > ceiling_linear) {
-      gain = ceiling_linear / *envelope;
+    /* The ring holds latency frames before this tile, so the input goes
+     * in first and the delayed tile comes straight back out */
+    for (size_t c = 0; c < channels; ++c) {
+      ae_limiter_ring_write(lim->delay[c], lim->delay_mask, lim->delay_pos,
+                            tile[c], count);
+      ae_limiter_ring_read(lim->delay[c], lim->delay_mask,
+                           lim->delay_pos - lim->latency, tile[c], count);
+      ae_simd_mul(tile[c], tile[c], gain, count);
     }
-
-    samples[i] = delayed_sample * gain;
+    lim->delay_pos += count;
   }
+  return AE_OK;
+}
+
+AE_API uint32_t ae_limiter_latency(const ae_limiter_t *lim) {
+  return lim ? (uint32_t)lim->latency : 0;
+}
+
+AE_API float ae_limiter_gain_reduction(const ae_limiter_t *lim) {
+  if (!lim)
+    return 0.0f;
+  return -20.0f * log10f(lim->gain);
 }
 
 /**
@@ -222,6 +550,7 @@ float ae_soft_clip(float sample, float threshold) {
   /* Soft knee using tanh */
   float sign = sample >= 0.0f ? 1.0f : -1.0f;
   float overshoot = abs_sample - threshold;
-  float compressed = threshold + (1.0f - threshold) * tanhf(overshoot);
+  float compressed =
+      threshold + (1.0f - threshold) * ae_fast_tanhf(overshoot, AE_MATH_1E4);
   return sign * compressed;
 }
@@ -1,58 +1,73 @@
 /**
  * @file ae_eq.c
  * @brief Parametric EQ implementation (8-band)
+ *
+ * Each band is an RBJ biquad run as a transposed direct form II section.
+ * A cascade cannot be vectorized along time, and stereo alone fills only
+ * half a register, so the cascade is skewed instead: a register holds two
+ * consecutive bands of both channels, and at step S band j filters frame
+ * S - j, taking band j - 1's output from step S - 1. Every band then
+ * advances in the same step, and an eight-band stereo EQ is four
+ * independent recursions rather than eight chained ones. The first and
+ * last few steps of each call mask out the bands that have no frame yet
+ * (or none left), so nothing is held back between calls.
  */
 
 #include "ae_internal.h"
 
-/*============================================================================
- * EQ Band Types
- *============================================================================*/
-typedef enum {
-  AE_EQ_PEAK,
-  AE_EQ_LOW_SHELF,
-  AE_EQ_HIGH_SHELF,
-  AE_EQ_NOTCH,
-  AE_EQ_LOWPASS,
-  AE_EQ_HIGHPASS
-} ae_eq_band_type_t;
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
+
+/* Coefficient glide after a band change */
+#define AE_EQ_SMOOTH_MS 5.0f
+
+/* b0, b1, b2, a1, a2 */
+#define AE_EQ_COEFFS 5
+
+/* Registers in the skewed cascade, two bands each */
+#define AE_EQ_PAIRS ((AE_MAX_EQ_BANDS + 1) / 2)
 
 /*============================================================================
  * Single EQ Band
  *============================================================================*/
 typedef struct {
-  ae_eq_band_type_t type;
-  float frequency_hz; /* Center/corner frequency */
-  float gain_db;      /* Gain in dB (for peak/shelf) */
-  float q;            /* Q factor (0.1 - 30) */
-  bool enabled;
-
-  /* Biquad coefficients */
-  float b0, b1, b2;
-  float a1, a2;
-
-  /* Filter state (stereo) */
-  float x1_l, x2_l;
-  float y1_l, y2_l;
-  float x1_r, x2_r;
-  float y1_r, y2_r;
-} ae_eq_band_t;
+  ae_eq_band_t params;
+
+  float target[AE_EQ_COEFFS]; /* From params; identity when disabled */
+  float coeff[AE_EQ_COEFFS];  /* In use, gliding towards target */
+  float step[AE_EQ_COEFFS];   /* Per-frame increment of the glide */
+  float remaining;            /* Frames left in the glide */
+
+  /* Transposed direct form II state, left and right */
+  float s1[2];
+  float s2[2];
+
+  bool active; /* In the cascade: enabled, or gliding out */
+} ae_eq_slot_t;
 
 /*============================================================================
  * 8-Band Parametric EQ
  *============================================================================*/
-typedef struct {
-  ae_eq_band_t bands[AE_MAX_EQ_BANDS];
-  uint8_t band_count;
+struct ae_eq {
+  ae_eq_slot_t bands[AE_MAX_EQ_BANDS];
   float sample_rate;
-} ae_parametric_eq_t;
+  float smooth_frames;
+};
 
 /*============================================================================
  * Coefficient Calculation
  *============================================================================*/
-static void eq_calculate_coeffs(ae_eq_band_t *band, float sample_rate) {
-  if (!band || sample_rate <= 0.0f)
+static const float eq_identity[AE_EQ_COEFFS] = {1.0f, 0.0f, 0.0f, 0.0f,
+                                                0.0f};
+
+static void eq_calculate_coeffs(const ae_eq_band_t *band, float sample_rate,
+                                float c[AE_EQ_COEFFS]) {
+  if (!band->enabled) {
+    memcpy(c, eq_identity, sizeof(eq_identity));
     return;
+  }
 
   float w0 = 2.0f * (float)M_PI * band->frequency_hz / sample_rate;
   float cos_w0 = cosf(w0);
@@ -60,183 +75,464 @@ static void eq_calculate_coeffs(ae_eq_band_t *band, float sample_rate) {
   float alpha = sin_w0 / (2.0f * band->q);
   float A = powf(10.0f, band->gain_db / 40.0f);
 
-  float a0;
+  float b0, b1, b2, a0, a1, a2;
 
   switch (band->type) {
   case AE_EQ_PEAK:
-    band->b0 = 1.0f + alpha * A;
-    band->b1 = -2.0f * cos_w0;
-    band->b2 = 1.0f - alpha * A;
+    b0 = 1.0f + alpha * A;
+    b1 = -2.0f * cos_w0;
+    b2 = 1.0f - alpha * A;
     a0 = 1.0f + alpha / A;
-    band->a1 = -2.0f * cos_w0;
-    band->a2 = 1.0f - alpha / A;
+    a1 = -2.0f * cos_w0;
+    a2 = 1.0f - alpha / A;
     break;
 
   case AE_EQ_LOW_SHELF: {
     float sqrt_A = sqrtf(A);
     float sqrt_A_alpha = 2.0f * sqrt_A * alpha;
-    band->b0 = A * ((A + 1.0f) - (A - 1.0f) * cos_w0 + sqrt_A_alpha);
-    band->b1 = 2.0f * A * ((A - 1.0f) - (A + 1.0f) * cos_w0);
-    band->b2 = A * ((A + 1.0f) - (A - 1.0f) * cos_w0 - sqrt_A_alpha);
+    b0 = A * ((A + 1.0f) - (A - 1.0f) * cos_w0 + sqrt_A_alpha);
+    b1 = 2.0f * A * ((A - 1.0f) - (A + 1.0f) * cos_w0);
+    b2 = A * ((A + 1.0f) - (A - 1.0f) * cos_w0 - sqrt_A_alpha);
     a0 = (A + 1.0f) + (A - 1.0f) * cos_w0 + sqrt_A_alpha;
-    band->a1 = -2.0f * ((A - 1.0f) + (A + 1.0f) * cos_w0);
-    band->a2 = (A + 1.0f) + (A - 1.0f) * cos_w0 - sqrt_A_alpha;
+    a1 = -2.0f * ((A - 1.0f) + (A + 1.0f) * cos_w0);
+    a2 = (A + 1.0f) + (A - 1.0f) * cos_w0 - sqrt_A_alpha;
     break;
   }
 
   case AE_EQ_HIGH_SHELF: {
     float sqrt_A = sqrtf(A);
     float sqrt_A_alpha = 2.0f * sqrt_A * alpha;
-    band->b0 = A * ((A + 1.0f) + (A - 1.0f) * cos_w0 + sqrt_A_alpha);
-    band->b1 = -2.0f * A * ((A - 1.0f) + (A + 1.0f) * cos_w0);
-    band->b2 = A * ((A + 1.0f) + (A - 1.0f) * cos_w0 - sqrt_A_alpha);
+    b0 = A * ((A + 1.0f) + (A - 1.0f) * cos_w0 + sqrt_A_alpha);
+    b1 = -2.0f * A * ((A - 1.0f) + (A + 1.0f) * cos_w0);
+    b2 = A * ((A + 1.0f) + (A - 1.0f) * cos_w0 - sqrt_A_alpha);
     a0 = (A + 1.0f) - (A - 1.0f) * cos_w0 + sqrt_A_alpha;
-    band->a1 = 2.0f * ((A - 1.0f) - (A + 1.0f) * cos_w0);
-    band->a2 = (A + 1.0f) - (A - 1.0f) * cos_w0 - sqrt_A_alpha;
+    a1 = 2.0f * ((A - 1.0f) - (A + 1.0f) * cos_w0);
+    a2 = (A + 1.0f) - (A - 1.0f) * cos_w0 - sqrt_A_alpha;
     break;
   }
 
   case AE_EQ_NOTCH:
-    band->b0 = 1.0f;
-    band->b1 = -2.0f * cos_w0;
-    band->b2 = 1.0f;
+    b0 = 1.0f;
+    b1 = -2.0f * cos_w0;
+    b2 = 1.0f;
     a0 = 1.0f + alpha;
-    band->a1 = -2.0f * cos_w0;
-    band->a2 = 1.0f - alpha;
+    a1 = -2.0f * cos_w0;
+    a2 = 1.0f - alpha;
     break;
 
   case AE_EQ_LOWPASS:
-    band->b0 = (1.0f - cos_w0) / 2.0f;
-    band->b1 = 1.0f - cos_w0;
-    band->b2 = (1.0f - cos_w0) / 2.0f;
+    b0 = (1.0f - cos_w0) / 2.0f;
+    b1 = 1.0f - cos_w0;
+    b2 = (1.0f - cos_w0) / 2.0f;
     a0 = 1.0f + alpha;
-    band->a1 = -2.0f * cos_w0;
-    band->a2 = 1.0f - alpha;
+    a1 = -2.0f * cos_w0;
+    a2 = 1.0f - alpha;
     break;
 
   case AE_EQ_HIGHPASS:
-    band->b0 = (1.0f + cos_w0) / 2.0f;
-    band->b1 = -(1.0f + cos_w0);
-    band->b2 = (1.0f + cos_w0) / 2.0f;
+    b0 = (1.0f + cos_w0) / 2.0f;
+    b1 = -(1.0f + cos_w0);
+    b2 = (1.0f + cos_w0) / 2.0f;
     a0 = 1.0f + alpha;
-    band->a1 = -2.0f * cos_w0;
-    band->a2 = 1.0f - alpha;
+    a1 = -2.0f * cos_w0;
+    a2 = 1.0f - alpha;
     break;
 
   default:
-    band->b0 = 1.0f;
-    band->b1 = band->b2 = 0.0f;
-    band->a1 = band->a2 = 0.0f;
+    memcpy(c, eq_identity, sizeof(eq_identity));
     return;
   }
 
   /* Normalize by a0 */
-  if (a0 != 0.0f) {
-    band->b0 /= a0;
-    band->b1 /= a0;
-    band->b2 /= a0;
-    band->a1 /= a0;
-    band->a2 /= a0;
+  c[0] = b0 / a0;
+  c[1] = b1 / a0;
+  c[2] = b2 / a0;
+  c[3] = a1 / a0;
+  c[4] = a2 / a0;
+}
+
+/**
+ * Start a glide from the coefficients in use to the target. Stable
+ * (a1, a2) pairs form a triangle, which is convex, so every point on a
+ * straight line between two stable sections is stable as well.
+ */
+static void eq_start_glide(ae_eq_t *eq, ae_eq_slot_t *band) {
+  bool moving = false;
+  for (int k = 0; k < AE_EQ_COEFFS; ++k) {
+    band->step[k] = (band->target[k] - band->coeff[k]) / eq->smooth_frames;
+    moving |= band->target[k] != band->coeff[k];
   }
+  band->remaining = moving ? eq->smooth_frames : 0.0f;
 }
 
 /*============================================================================
- * Band Processing
+ * Skewed cascade
  *============================================================================*/
-static float eq_process_band_sample(ae_eq_band_t *band, float sample, float *x1,
-                                    float *x2, float *y1, float *y2) {
-  float output = band->b0 * sample + band->b1 * (*x1) + band->b2 * (*x2) -
-                 band->a1 * (*y1) - band->a2 * (*y2);
+#ifdef AE_HAS_SSE2
+/* Register v: lanes 0-1 are band 2v (L, R), lanes 2-3 band 2v + 1 */
+typedef struct {
+  __m128 c[AE_EQ_PAIRS][AE_EQ_COEFFS];
+  __m128 target[AE_EQ_PAIRS][AE_EQ_COEFFS];
+  __m128 step[AE_EQ_PAIRS][AE_EQ_COEFFS];
+  __m128 remaining[AE_EQ_PAIRS];
+  __m128 s1[AE_EQ_PAIRS];
+  __m128 s2[AE_EQ_PAIRS];
+  __m128 out[AE_EQ_PAIRS]; /* Last step's outputs, next step's inputs */
+} ae_eq_pipe_t;
+
+/* One register of the cascade, all lanes live */
+static inline __m128 eq_pair_step(const __m128 c[AE_EQ_COEFFS], __m128 *s1,
+                                  __m128 *s2, __m128 in) {
+  __m128 y = _mm_add_ps(_mm_mul_ps(c[0], in), *s1);
+  *s1 = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(c[1], in), *s2),
+                   _mm_mul_ps(c[3], y));
+  *s2 = _mm_sub_ps(_mm_mul_ps(c[2], in), _mm_mul_ps(c[4], y));
+  return y;
+}
 
-  *x2 = *x1;
-  *x1 = sample;
-  *y2 = *y1;
-  *y1 = output;
+/**
+ * One step of every register; x holds the new frame in lanes 0-1 and the
+ * return value the last band's output in lanes 2-3. Registers go from the
+ * end of the cascade back, so each reads its neighbour's previous output
+ * before that is overwritten. active masks bands without a frame this
+ * step; glide advances the coefficients of the active bands.
+ */
+static __m128 eq_pipe_step(ae_eq_pipe_t *p, size_t pairs, __m128 x,
+                           const __m128 *active, bool glide) {
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (size_t v = pairs; v-- > 0;) {
+    __m128 in = v > 0 ? _mm_shuffle_ps(p->out[v - 1], p->out[v],
+                                       _MM_SHUFFLE(1, 0, 3, 2))
+                      : _mm_shuffle_ps(x, p->out[0], _MM_SHUFFLE(1, 0, 1, 0));
+    if (glide) {
+      __m128 live =
+          _mm_and_ps(active[v], _mm_cmpgt_ps(p->remaining[v], zero));
+      p->remaining[v] = _mm_sub_ps(p->remaining[v], _mm_and_ps(live, one));
+      __m128 done = _mm_and_ps(live, _mm_cmple_ps(p->remaining[v], zero));
+      for (int k = 0; k < AE_EQ_COEFFS; ++k) {
+        __m128 c = _mm_add_ps(p->c[v][k], _mm_and_ps(live, p->step[v][k]));
+        p->c[v][k] = _mm_or_ps(_mm_and_ps(done, p->target[v][k]),
+                               _mm_andnot_ps(done, c));
+      }
+    }
+    __m128 s1 = p->s1[v];
+    __m128 s2 = p->s2[v];
+    p->out[v] = eq_pair_step(p->c[v], &s1, &s2, in);
+    p->s1[v] = _mm_or_ps(_mm_and_ps(active[v], s1),
+                         _mm_andnot_ps(active[v], p->s1[v]));
+    p->s2[v] = _mm_or_ps(_mm_and_ps(active[v], s2),
+                         _mm_andnot_ps(active[v], p->s2[v]));
+  }
+  return p->out[pairs - 1];
+}
 
-  return output;
+#define EQ_LINK(a, b) _mm_shuffle_ps((a), (b), _MM_SHUFFLE(1, 0, 3, 2))
+
+/**
+ * Steps first .. last - 1 with every band live and no glide. pairs is a
+ * constant at each call site and the registers are spelled out rather
+ * than looped over, so the whole state stays in registers for the run
+ * instead of going through memory every step.
+ */
+static inline void eq_pipe_run(ae_eq_pipe_t *p, const size_t pairs,
+                               float *left, float *right, size_t first,
+                               size_t last, size_t lag) {
+  __m128 c[AE_EQ_PAIRS][AE_EQ_COEFFS], s1[AE_EQ_PAIRS], s2[AE_EQ_PAIRS];
+  __m128 out[AE_EQ_PAIRS];
+  for (size_t v = 0; v < pairs; ++v) {
+    for (int k = 0; k < AE_EQ_COEFFS; ++k)
+      c[v][k] = p->c[v][k];
+    s1[v] = p->s1[v];
+    s2[v] = p->s2[v];
+    out[v] = p->out[v];
+  }
+  for (size_t s = first; s < last; ++s) {
+    __m128 x = _mm_unpacklo_ps(_mm_load_ss(left + s),
+                               right ? _mm_load_ss(right + s)
+                                     : _mm_setzero_ps());
+    if (pairs > 3)
+      out[3] = eq_pair_step(c[3], &s1[3], &s2[3], EQ_LINK(out[2], out[3]));
+    if (pairs > 2)
+      out[2] = eq_pair_step(c[2], &s1[2], &s2[2], EQ_LINK(out[1], out[2]));
+    if (pairs > 1)
+      out[1] = eq_pair_step(c[1], &s1[1], &s2[1], EQ_LINK(out[0], out[1]));
+    out[0] = eq_pair_step(c[0], &s1[0], &s2[0],
+                          _mm_shuffle_ps(x, out[0], _MM_SHUFFLE(1, 0, 1, 0)));
+    __m128 hi = _mm_movehl_ps(out[pairs - 1], out[pairs - 1]);
+    _mm_store_ss(left + s - lag, hi);
+    if (right)
+      _mm_store_ss(right + s - lag,
+                   _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(1, 1, 1, 1)));
+  }
+  for (size_t v = 0; v < pairs; ++v) {
+    p->s1[v] = s1[v];
+    p->s2[v] = s2[v];
+    p->out[v] = out[v];
+  }
+}
+
+/* Bands with a frame at step S: band j filters frame S - j */
+static inline void eq_pipe_mask(size_t pairs, size_t step, size_t frames,
+                                __m128 *active) {
+  for (size_t v = 0; v < pairs; ++v) {
+    size_t j = 2 * v;
+    int lo = step >= j && step - j < frames ? -1 : 0;
+    int hi = step >= j + 1 && step - j - 1 < frames ? -1 : 0;
+    active[v] = _mm_castsi128_ps(_mm_set_epi32(hi, hi, lo, lo));
+  }
+}
+#endif
+
+/* Pipeline slots of the cascade: active band indices in order */
+static size_t eq_compact(const ae_eq_t *eq, size_t *order) {
+  size_t count = 0;
+  for (size_t b = 0; b < AE_MAX_EQ_BANDS; ++b) {
+    if (eq->bands[b].active)
+      order[count++] = b;
+  }
+  return count;
+}
+
+/* A band glided out of the cascade leaves it, with its state cleared */
+static void eq_retire(ae_eq_slot_t *band) {
+  if (band->params.enabled || band->remaining > 0.0f)
+    return;
+  band->active = false;
+  memset(band->s1, 0, sizeof(band->s1));
+  memset(band->s2, 0, sizeof(band->s2));
 }
 
 /*============================================================================
  * Public API
  *============================================================================*/
-void ae_parametric_eq_init(ae_parametric_eq_t *eq, float sample_rate) {
+AE_API ae_eq_t *ae_eq_create(uint32_t sample_rate) {
+  if (sample_rate == 0)
+    return NULL;
+  ae_eq_t *eq = (ae_eq_t *)calloc(1, sizeof(*eq));
   if (!eq)
-    return;
-
-  memset(eq, 0, sizeof(ae_parametric_eq_t));
-  eq->sample_rate = sample_rate;
-  eq->band_count = 0;
+    return NULL;
+  eq->sample_rate = (float)sample_rate;
+  eq->smooth_frames = fmaxf(
+      roundf(AE_EQ_SMOOTH_MS * 0.001f * eq->sample_rate), 1.0f);
 
   /* Initialize all bands to bypass */
   for (int i = 0; i < AE_MAX_EQ_BANDS; ++i) {
-    eq->bands[i].enabled = false;
-    eq->bands[i].type = AE_EQ_PEAK;
-    eq->bands[i].frequency_hz = 1000.0f;
-    eq->bands[i].gain_db = 0.0f;
-    eq->bands[i].q = 1.0f;
-    eq->bands[i].b0 = 1.0f;
-    eq->bands[i].b1 = eq->bands[i].b2 = 0.0f;
-    eq->bands[i].a1 = eq->bands[i].a2 = 0.0f;
+    ae_eq_slot_t *band = &eq->bands[i];
+    band->params.type = AE_EQ_PEAK;
+    band->params.frequency_hz = 1000.0f;
+    band->params.gain_db = 0.0f;
+    band->params.q = 1.0f;
+    band->params.enabled = false;
+    memcpy(band->target, eq_identity, sizeof(eq_identity));
+    memcpy(band->coeff, eq_identity, sizeof(eq_identity));
   }
+  return eq;
 }
 
-void ae_parametric_eq_set_band(ae_parametric_eq_t *eq, uint8_t band_index,
-                               ae_eq_band_type_t type, float freq_hz,
-                               float gain_db, float q, bool enabled) {
-  if (!eq || band_index >= AE_MAX_EQ_BANDS)
-    return;
-
-  ae_eq_band_t *band = &eq->bands[band_index];
-  band->type = type;
-  band->frequency_hz = ae_clamp(freq_hz, 20.0f, 20000.0f);
-  band->gain_db = ae_clamp(gain_db, -24.0f, 24.0f);
-  band->q = ae_clamp(q, 0.1f, 30.0f);
-  band->enabled = enabled;
+AE_API void ae_eq_destroy(ae_eq_t *eq) { free(eq); }
 
-  eq_calculate_coeffs(band, eq->sample_rate);
-
-  if (band_index >= eq->band_count) {
-    eq->band_count = band_index + 1;
+AE_API void ae_eq_reset(ae_eq_t *eq) {
+  if (!eq)
+    return;
+  for (int i = 0; i < AE_MAX_EQ_BANDS; ++i) {
+    ae_eq_slot_t *band = &eq->bands[i];
+    memcpy(band->coeff, band->target, sizeof(band->coeff));
+    memset(band->step, 0, sizeof(band->step));
+    band->remaining = 0.0f;
+    memset(band->s1, 0, sizeof(band->s1));
+    memset(band->s2, 0, sizeof(band->s2));
+    band->active = band->params.enabled;
   }
 }
 
-void ae_parametric_eq_process(ae_parametric_eq_t *eq, float *left, float *right,
-                              size_t frames) {
-  if (!eq || !left || frames == 0)
-    return;
+AE_API ae_result_t ae_eq_set_band(ae_eq_t *eq, uint32_t index,
+                                  const ae_eq_band_t *band) {
+  if (!eq || !band || index >= AE_MAX_EQ_BANDS ||
+      (unsigned)band->type > AE_EQ_HIGHPASS ||
+      !(band->frequency_hz > 0.0f) ||
+      !(band->frequency_hz < 0.5f * eq->sample_rate) ||
+      !(band->gain_db >= -24.0f && band->gain_db <= 24.0f) ||
+      !(band->q >= 0.1f && band->q <= 30.0f))
+    return AE_ERROR_INVALID_PARAM;
+
+  ae_eq_slot_t *slot = &eq->bands[index];
+  slot->params = *band;
+  eq_calculate_coeffs(band, eq->sample_rate, slot->target);
+  if (!slot->active) {
+    if (!band->enabled)
+      return AE_OK;
+    /* Enter as a pass-through and glide in */
+    memcpy(slot->coeff, eq_identity, sizeof(eq_identity));
+    slot->active = true;
+  }
+  eq_start_glide(eq, slot);
+  eq_retire(slot);
+  return AE_OK;
+}
 
-  for (size_t i = 0; i < frames; ++i) {
-    float sample_l = left[i];
-    float sample_r = right ? right[i] : sample_l;
+AE_API ae_result_t ae_eq_get_band(const ae_eq_t *eq, uint32_t index,
+                                  ae_eq_band_t *band) {
+  if (!eq || !band || index >= AE_MAX_EQ_BANDS)
+    return AE_ERROR_INVALID_PARAM;
+  *band = eq->bands[index].params;
+  return AE_OK;
+}
 
-    for (uint8_t b = 0; b < eq->band_count; ++b) {
-      ae_eq_band_t *band = &eq->bands[b];
-      if (!band->enabled)
-        continue;
+#ifdef AE_HAS_SSE2
+static void eq_process_pipe(ae_eq_t *eq, const size_t *order, size_t count,
+                            float *left, float *right, size_t frames) {
+  ae_eq_pipe_t p;
+  size_t pairs = (count + 1) / 2;
+  size_t slots = 2 * pairs;
+  bool glide = false;
+
+  /* Gather: slot j of the cascade is lane pair (j & 1) of register j / 2;
+   * an odd count is padded with a pass-through */
+  float lanes[3 * AE_EQ_COEFFS + 3][4];
+  for (size_t v = 0; v < pairs; ++v) {
+    for (size_t half = 0; half < 2; ++half) {
+      size_t j = 2 * v + half;
+      const ae_eq_slot_t *band = j < count ? &eq->bands[order[j]] : NULL;
+      for (size_t ch = 0; ch < 2; ++ch) {
+        size_t lane = 2 * half + ch;
+        for (int k = 0; k < AE_EQ_COEFFS; ++k) {
+          lanes[k][lane] = band ? band->coeff[k] : eq_identity[k];
+          lanes[AE_EQ_COEFFS + k][lane] =
+              band ? band->target[k] : eq_identity[k];
+          lanes[2 * AE_EQ_COEFFS + k][lane] = band ? band->step[k] : 0.0f;
+        }
+        lanes[3 * AE_EQ_COEFFS][lane] = band ? band->remaining : 0.0f;
+        lanes[3 * AE_EQ_COEFFS + 1][lane] = band ? band->s1[ch] : 0.0f;
+        lanes[3 * AE_EQ_COEFFS + 2][lane] = band ? band->s2[ch] : 0.0f;
+        glide |= band && band->remaining > 0.0f;
+      }
+    }
+    for (int k = 0; k < AE_EQ_COEFFS; ++k) {
+      p.c[v][k] = _mm_loadu_ps(lanes[k]);
+      p.target[v][k] = _mm_loadu_ps(lanes[AE_EQ_COEFFS + k]);
+      p.step[v][k] = _mm_loadu_ps(lanes[2 * AE_EQ_COEFFS + k]);
+    }
+    p.remaining[v] = _mm_loadu_ps(lanes[3 * AE_EQ_COEFFS]);
+    p.s1[v] = _mm_loadu_ps(lanes[3 * AE_EQ_COEFFS + 1]);
+    p.s2[v] = _mm_loadu_ps(lanes[3 * AE_EQ_COEFFS + 2]);
+    p.out[v] = _mm_setzero_ps();
+  }
 
-      sample_l = eq_process_band_sample(band, sample_l, &band->x1_l,
-                                        &band->x2_l, &band->y1_l, &band->y2_l);
-      if (right) {
-        sample_r = eq_process_band_sample(
-            band, sample_r, &band->x1_r, &band->x2_r, &band->y1_r, &band->y2_r);
+  /* Steps 0 .. frames + slots - 2; frame S - (slots - 1) leaves at S.
+   * Only the first and last slots - 1 steps need masks. */
+  size_t lag = slots - 1;
+  size_t steps = frames + lag;
+  size_t full_end = glide || frames <= lag ? lag : frames;
+  __m128 active[AE_EQ_PAIRS];
+  for (size_t s = 0; s < steps; ++s) {
+    if (s == lag && full_end > lag) {
+      switch (pairs) {
+      case 1:
+        eq_pipe_run(&p, 1, left, right, lag, full_end, lag);
+        break;
+      case 2:
+        eq_pipe_run(&p, 2, left, right, lag, full_end, lag);
+        break;
+      case 3:
+        eq_pipe_run(&p, 3, left, right, lag, full_end, lag);
+        break;
+      default:
+        eq_pipe_run(&p, AE_EQ_PAIRS, left, right, lag, full_end, lag);
+        break;
       }
+      s = full_end - 1;
+      continue;
     }
+    __m128 x = _mm_setzero_ps();
+    if (s < frames)
+      x = _mm_unpacklo_ps(_mm_load_ss(left + s),
+                          right ? _mm_load_ss(right + s) : _mm_setzero_ps());
+    eq_pipe_mask(pairs, s, frames, active);
+    __m128 y = eq_pipe_step(&p, pairs, x, active, glide);
+    if (s >= lag) {
+      size_t f = s - lag;
+      __m128 hi = _mm_movehl_ps(y, y);
+      _mm_store_ss(left + f, hi);
+      if (right)
+        _mm_store_ss(right + f,
+                     _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(1, 1, 1, 1)));
+    }
+  }
 
-    left[i] = sample_l;
-    if (right)
-      right[i] = sample_r;
+  /* Scatter the state back to the bands */
+  for (size_t v = 0; v < pairs; ++v) {
+    for (int k = 0; k < AE_EQ_COEFFS; ++k)
+      _mm_storeu_ps(lanes[k], p.c[v][k]);
+    _mm_storeu_ps(lanes[3 * AE_EQ_COEFFS], p.remaining[v]);
+    _mm_storeu_ps(lanes[3 * AE_EQ_COEFFS + 1], p.s1[v]);
+    _mm_storeu_ps(lanes[3 * AE_EQ_COEFFS + 2], p.s2[v]);
+    for (size_t half = 0; half < 2; ++half) {
+      size_t j = 2 * v + half;
+      if (j >= count)
+        continue;
+      ae_eq_slot_t *band = &eq->bands[order[j]];
+      for (int k = 0; k < AE_EQ_COEFFS; ++k)
+        band->coeff[k] = lanes[k][2 * half];
+      band->remaining = lanes[3 * AE_EQ_COEFFS][2 * half];
+      for (size_t ch = 0; ch < 2; ++ch) {
+        band->s1[ch] = lanes[3 * AE_EQ_COEFFS + 1][2 * half + ch];
+        band->s2[ch] = lanes[3 * AE_EQ_COEFFS + 2][2 * half + ch];
+      }
+    }
   }
 }
-
-void ae_parametric_eq_reset(ae_parametric_eq_t *eq) {
-  if (!eq)
-    return;
-
-  for (int i = 0; i < AE_MAX_EQ_BANDS; ++i) {
-    ae_eq_band_t *band = &eq->bands[i];
-    band->x1_l = band->x2_l = 0.0f;
-    band->y1_l = band->y2_l = 0.0f;
-    band->x1_r = band->x2_r = 0.0f;
-    band->y1_r = band->y2_r = 0.0f;
+#else
+/* Band by band over the block, with the same per-frame arithmetic */
+static void eq_process_bands(ae_eq_t *eq, const size_t *order, size_t count,
+                             float *left, float *right, size_t frames) {
+  float *const ch[2] = {left, right};
+  size_t channels = right ? 2 : 1;
+  for (size_t j = 0; j < count; ++j) {
+    ae_eq_slot_t *band = &eq->bands[order[j]];
+    float coeff[AE_EQ_COEFFS];
+    float remaining = 0.0f;
+    for (size_t c = 0; c < channels; ++c) {
+      float *samples = ch[c];
+      float s1 = band->s1[c], s2 = band->s2[c];
+      memcpy(coeff, band->coeff, sizeof(coeff));
+      remaining = band->remaining;
+      for (size_t i = 0; i < frames; ++i) {
+        if (remaining > 0.0f) {
+          remaining -= 1.0f;
+          for (int k = 0; k < AE_EQ_COEFFS; ++k)
+            coeff[k] = remaining > 0.0f ? coeff[k] + band->step[k]
+                                        : band->target[k];
+        }
+        float x = samples[i];
+        float y = coeff[0] * x + s1;
+        s1 = (coeff[1] * x + s2) - coeff[3] * y;
+        s2 = coeff[2] * x - coeff[4] * y;
+        samples[i] = y;
+      }
+      band->s1[c] = s1;
+      band->s2[c] = s2;
+    }
+    memcpy(band->coeff, coeff, sizeof(coeff));
+    band->remaining = remaining;
   }
 }
+#endif
+
+AE_API ae_result_t ae_eq_process(ae_eq_t *eq, float *left, float *right,
+                                 size_t frames) {
+  if (!eq || !left)
+    return AE_ERROR_INVALID_PARAM;
+  size_t order[AE_MAX_EQ_BANDS];
+  size_t count = eq_compact(eq, order);
+  if (count == 0 || frames == 0)
+    return AE_OK;
+#ifdef AE_HAS_SSE2
+  eq_process_pipe(eq, order, count, left, right, frames);
+#else
+  eq_process_bands(eq, order, count, left, right, frames);
+#endif
+  for (size_t j = 0; j < count; ++j)
+    eq_retire(&eq->bands[order[j]]);
+  return AE_OK;
+}
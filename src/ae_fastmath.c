@@ -0,0 +1,215 @@
+/**
+ * @file ae_fastmath.c
+ * @brief Vectorized exp/log10/pow/sin/cos/tanh with accuracy tiers
+ *
+ * Each kernel takes an ae_math_tier_t. AE_MATH_EXACT calls libm; the other
+ * tiers evaluate the polynomials in ae_internal.h four lanes at a time,
+ * with the scalar ae_fast_*f() forms finishing the tail. exp2 splits off
+ * the integer part into the exponent bits, log2 reads the exponent bits
+ * and fits the mantissa, sin and cos reduce by multiples of pi.
+ */
+
+#include "ae_internal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
+
+#ifdef AE_HAS_SSE2
+static inline __m128 ae_fm_floor_ps(__m128 v) {
+  __m128 whole = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+  return _mm_sub_ps(whole, _mm_and_ps(_mm_cmpgt_ps(whole, v),
+                                      _mm_set1_ps(1.0f)));
+}
+
+static inline __m128 ae_fm_exp2_ps(__m128 x, ae_math_tier_t tier) {
+  x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-126.0f)), _mm_set1_ps(126.0f));
+  __m128 n = ae_fm_floor_ps(_mm_add_ps(x, _mm_set1_ps(0.5f)));
+  __m128 f = _mm_sub_ps(x, n);
+  __m128 p;
+  if (tier == AE_MATH_1E2) {
+    p = _mm_add_ps(_mm_set1_ps(AE_FM_EXP2_1E2_C1),
+                   _mm_mul_ps(f, _mm_set1_ps(AE_FM_EXP2_1E2_C2)));
+    p = _mm_add_ps(_mm_set1_ps(AE_FM_EXP2_1E2_C0), _mm_mul_ps(f, p));
+  } else {
+    p = _mm_add_ps(_mm_set1_ps(AE_FM_EXP2_1E4_C3),
+                   _mm_mul_ps(f, _mm_set1_ps(AE_FM_EXP2_1E4_C4)));
+    p = _mm_add_ps(_mm_set1_ps(AE_FM_EXP2_1E4_C2), _mm_mul_ps(f, p));
+    p = _mm_add_ps(_mm_set1_ps(AE_FM_EXP2_1E4_C1), _mm_mul_ps(f, p));
+    p = _mm_add_ps(_mm_set1_ps(AE_FM_EXP2_1E4_C0), _mm_mul_ps(f, p));
+  }
+  __m128i scale = _mm_slli_epi32(_mm_cvttps_epi32(n), 23);
+  return _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(p), scale));
+}
+
+static inline __m128 ae_fm_log2_ps(__m128 x, ae_math_tier_t tier) {
+  x = _mm_max_ps(x, _mm_set1_ps(FLT_MIN));
+  __m128i bits = _mm_castps_si128(x);
+  __m128 e = _mm_cvtepi32_ps(
+      _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+  __m128 m = _mm_castsi128_ps(
+      _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)),
+                   _mm_set1_epi32(0x3f800000)));
+  __m128 big = _mm_cmpgt_ps(m, _mm_set1_ps(1.41421356f));
+  m = _mm_sub_ps(m, _mm_and_ps(big, _mm_mul_ps(m, _mm_set1_ps(0.5f))));
+  e = _mm_add_ps(e, _mm_and_ps(big, _mm_set1_ps(1.0f)));
+  const __m128 one = _mm_set1_ps(1.0f);
+  __m128 s = _mm_div_ps(_mm_sub_ps(m, one), _mm_add_ps(m, one));
+  if (tier == AE_MATH_1E2)
+    return _mm_add_ps(e, _mm_mul_ps(s, _mm_set1_ps(AE_FM_LOG2_1E2_C1)));
+  __m128 s2 = _mm_mul_ps(s, s);
+  __m128 p = _mm_add_ps(_mm_set1_ps(AE_FM_LOG2_1E4_C3),
+                        _mm_mul_ps(s2, _mm_set1_ps(AE_FM_LOG2_1E4_C5)));
+  p = _mm_add_ps(_mm_set1_ps(AE_FM_LOG2_1E4_C1), _mm_mul_ps(s2, p));
+  return _mm_add_ps(e, _mm_mul_ps(s, p));
+}
+
+/* sin of r in [-pi/2, pi/2], sign flipped where the integer k is odd */
+static inline __m128 ae_fm_sin_reduced_ps(__m128 r, __m128 k,
+                                          ae_math_tier_t tier) {
+  __m128 r2 = _mm_mul_ps(r, r);
+  __m128 p;
+  if (tier == AE_MATH_1E2) {
+    p = _mm_add_ps(_mm_set1_ps(AE_FM_SIN_1E2_C1),
+                   _mm_mul_ps(r2, _mm_set1_ps(AE_FM_SIN_1E2_C3)));
+  } else {
+    p = _mm_add_ps(_mm_set1_ps(AE_FM_SIN_1E4_C5),
+                   _mm_mul_ps(r2, _mm_set1_ps(AE_FM_SIN_1E4_C7)));
+    p = _mm_add_ps(_mm_set1_ps(AE_FM_SIN_1E4_C3), _mm_mul_ps(r2, p));
+    p = _mm_add_ps(_mm_set1_ps(AE_FM_SIN_1E4_C1), _mm_mul_ps(r2, p));
+  }
+  p = _mm_mul_ps(r, p);
+  __m128i sign = _mm_slli_epi32(_mm_cvttps_epi32(k), 31);
+  return _mm_xor_ps(p, _mm_castsi128_ps(sign));
+}
+
+static inline __m128 ae_fm_reduce_pi_ps(__m128 x, __m128 k) {
+  x = _mm_sub_ps(x, _mm_mul_ps(k, _mm_set1_ps(AE_FM_PI_A)));
+  x = _mm_sub_ps(x, _mm_mul_ps(k, _mm_set1_ps(AE_FM_PI_B)));
+  return _mm_sub_ps(x, _mm_mul_ps(k, _mm_set1_ps(AE_FM_PI_C)));
+}
+#endif
+
+void ae_fast_exp(float *dst, const float *src, size_t n, ae_math_tier_t tier) {
+  if (!dst || !src)
+    return;
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  if (tier != AE_MATH_EXACT) {
+    const __m128 log2e = _mm_set1_ps(AE_FM_LOG2E);
+    for (; i + 4 <= n; i += 4)
+      _mm_storeu_ps(dst + i, ae_fm_exp2_ps(
+                                 _mm_mul_ps(_mm_loadu_ps(src + i), log2e),
+                                 tier));
+  }
+#endif
+  for (; i < n; ++i)
+    dst[i] = ae_fast_expf(src[i], tier);
+}
+
+void ae_fast_log10(float *dst, const float *src, size_t n,
+                   ae_math_tier_t tier) {
+  if (!dst || !src)
+    return;
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  if (tier != AE_MATH_EXACT) {
+    const __m128 log10_2 = _mm_set1_ps(AE_FM_LOG10_2);
+    for (; i + 4 <= n; i += 4)
+      _mm_storeu_ps(dst + i,
+                    _mm_mul_ps(ae_fm_log2_ps(_mm_loadu_ps(src + i), tier),
+                               log10_2));
+  }
+#endif
+  for (; i < n; ++i)
+    dst[i] = ae_fast_log10f(src[i], tier);
+}
+
+void ae_fast_pow(float *dst, const float *src, float y, size_t n,
+                 ae_math_tier_t tier) {
+  if (!dst || !src)
+    return;
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  if (tier != AE_MATH_EXACT) {
+    const __m128 vy = _mm_set1_ps(y);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4) {
+      __m128 x = _mm_loadu_ps(src + i);
+      __m128 r = ae_fm_exp2_ps(_mm_mul_ps(vy, ae_fm_log2_ps(x, tier)), tier);
+      _mm_storeu_ps(dst + i, _mm_and_ps(_mm_cmpgt_ps(x, zero), r));
+    }
+  }
+#endif
+  for (; i < n; ++i)
+    dst[i] = ae_fast_powf(src[i], y, tier);
+}
+
+void ae_fast_sin(float *dst, const float *src, size_t n, ae_math_tier_t tier) {
+  if (!dst || !src)
+    return;
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  if (tier != AE_MATH_EXACT) {
+    const __m128 inv_pi = _mm_set1_ps((float)(1.0 / M_PI));
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (; i + 4 <= n; i += 4) {
+      __m128 x = _mm_loadu_ps(src + i);
+      __m128 k = ae_fm_floor_ps(_mm_add_ps(_mm_mul_ps(x, inv_pi), half));
+      _mm_storeu_ps(dst + i, ae_fm_sin_reduced_ps(ae_fm_reduce_pi_ps(x, k), k,
+                                                  tier));
+    }
+  }
+#endif
+  for (; i < n; ++i)
+    dst[i] = ae_fast_sinf(src[i], tier);
+}
+
+void ae_fast_cos(float *dst, const float *src, size_t n, ae_math_tier_t tier) {
+  if (!dst || !src)
+    return;
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  if (tier != AE_MATH_EXACT) {
+    const __m128 inv_pi = _mm_set1_ps((float)(1.0 / M_PI));
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 neg = _mm_set1_ps(-0.0f);
+    for (; i + 4 <= n; i += 4) {
+      __m128 x = _mm_loadu_ps(src + i);
+      __m128 k = ae_fm_floor_ps(_mm_mul_ps(x, inv_pi));
+      __m128 r = ae_fm_reduce_pi_ps(x, _mm_add_ps(k, half));
+      _mm_storeu_ps(dst + i,
+                    _mm_xor_ps(ae_fm_sin_reduced_ps(r, k, tier), neg));
+    }
+  }
+#endif
+  for (; i < n; ++i)
+    dst[i] = ae_fast_cosf(src[i], tier);
+}
+
+void ae_fast_tanh(float *dst, const float *src, size_t n,
+                  ae_math_tier_t tier) {
+  if (!dst || !src)
+    return;
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  if (tier != AE_MATH_EXACT) {
+    const __m128 neg = _mm_set1_ps(-0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 limit = _mm_set1_ps(9.0f);
+    const __m128 scale = _mm_set1_ps(2.0f * AE_FM_LOG2E);
+    for (; i + 4 <= n; i += 4) {
+      __m128 x = _mm_loadu_ps(src + i);
+      __m128 sign = _mm_and_ps(x, neg);
+      __m128 a = _mm_min_ps(_mm_andnot_ps(neg, x), limit);
+      __m128 t = ae_fm_exp2_ps(_mm_mul_ps(a, scale), tier);
+      t = _mm_sub_ps(one, _mm_div_ps(two, _mm_add_ps(t, one)));
+      _mm_storeu_ps(dst + i, _mm_or_ps(t, sign));
+    }
+  }
+#endif
+  for (; i < n; ++i)
+    dst[i] = ae_fast_tanhf(src[i], tier);
+}
@@ -0,0 +1,186 @@
+/**
+ * @file ae_fft.c
+ * @brief Real-input FFT for block convolution
+ *
+ * A length-N real transform runs as an N/2-point complex radix-2 FFT on the
+ * even/odd samples packed as re/im, followed by a split pass. Spectra are
+ * N/2 + 1 bins in split (separate re and im) form so the multiply-accumulate
+ * loops of the convolvers vectorize directly.
+ */
+
+#include "ae_internal.h"
+
+bool ae_fft_init(ae_fft_t *fft, size_t size) {
+  if (!fft)
+    return false;
+  memset(fft, 0, sizeof(*fft));
+  if (size < 4 || (size & (size - 1)) != 0)
+    return false;
+
+  size_t half = size / 2;
+  fft->size = size;
+  fft->half = half;
+  fft->twiddle = (float *)calloc(half, sizeof(float));
+  fft->split = (float *)calloc(half, sizeof(float));
+  fft->bitrev = (uint32_t *)calloc(half, sizeof(uint32_t));
+  fft->work = (float *)calloc(size, sizeof(float));
+  if (!fft->twiddle || !fft->split || !fft->bitrev || !fft->work) {
+    ae_fft_free(fft);
+    return false;
+  }
+
+  /* e^{-2 pi i k / half} for the complex stages, k < half / 2 */
+  for (size_t k = 0; k < half / 2; ++k) {
+    double angle = -2.0 * M_PI * (double)k / (double)half;
+    fft->twiddle[2 * k] = (float)cos(angle);
+    fft->twiddle[2 * k + 1] = (float)sin(angle);
+  }
+  /* e^{-2 pi i k / size} for the split pass, k < half / 2 */
+  for (size_t k = 0; k < half / 2; ++k) {
+    double angle = -2.0 * M_PI * (double)k / (double)size;
+    fft->split[2 * k] = (float)cos(angle);
+    fft->split[2 * k + 1] = (float)sin(angle);
+  }
+
+  size_t bits = 0;
+  while (((size_t)1 << bits) < half)
+    ++bits;
+  for (size_t i = 0; i < half; ++i) {
+    size_t r = 0;
+    for (size_t b = 0; b < bits; ++b)
+      r |= ((i >> b) & 1u) << (bits - 1 - b);
+    fft->bitrev[i] = (uint32_t)r;
+  }
+  return true;
+}
+
+void ae_fft_free(ae_fft_t *fft) {
+  if (!fft)
+    return;
+  free(fft->twiddle);
+  free(fft->split);
+  free(fft->bitrev);
+  free(fft->work);
+  memset(fft, 0, sizeof(*fft));
+}
+
+/* In-place forward complex FFT of fft->work, already in bit-reversed order */
+static void ae_fft_complex(const ae_fft_t *fft, float *data) {
+  size_t n = fft->half;
+  for (size_t i = 0; i < n; i += 2) {
+    float ar = data[2 * i], ai = data[2 * i + 1];
+    float br = data[2 * i + 2], bi = data[2 * i + 3];
+    data[2 * i] = ar + br;
+    data[2 * i + 1] = ai + bi;
+    data[2 * i + 2] = ar - br;
+    data[2 * i + 3] = ai - bi;
+  }
+  for (size_t len = 4; len <= n; len <<= 1) {
+    size_t half_len = len / 2;
+    size_t step = n / len;
+    for (size_t i = 0; i < n; i += len) {
+      float *a = data + 2 * i;
+      float *b = a + 2 * half_len;
+      for (size_t j = 0; j < half_len; ++j) {
+        float wr = fft->twiddle[2 * j * step];
+        float wi = fft->twiddle[2 * j * step + 1];
+        float vr = b[2 * j] * wr - b[2 * j + 1] * wi;
+        float vi = b[2 * j] * wi + b[2 * j + 1] * wr;
+        float ur = a[2 * j];
+        float ui = a[2 * j + 1];
+        a[2 * j] = ur + vr;
+        a[2 * j + 1] = ui + vi;
+        b[2 * j] = ur - vr;
+        b[2 * j + 1] = ui - vi;
+      }
+    }
+  }
+}
+
+/**
+ * Forward transform of fft->size real samples into size / 2 + 1 bins.
+ */
+void ae_fft_forward(ae_fft_t *fft, const float *in, float *re, float *im) {
+  size_t half = fft->half;
+  float *z = fft->work;
+  for (size_t i = 0; i < half; ++i) {
+    size_t r = fft->bitrev[i];
+    z[2 * r] = in[2 * i];
+    z[2 * r + 1] = in[2 * i + 1];
+  }
+  ae_fft_complex(fft, z);
+
+  re[0] = z[0] + z[1];
+  im[0] = 0.0f;
+  re[half] = z[0] - z[1];
+  im[half] = 0.0f;
+  /* Bins k and half - k share the same pair of complex outputs */
+  for (size_t k = 1; k <= half / 2; ++k) {
+    size_t m = half - k;
+    float zr = z[2 * k], zi = z[2 * k + 1];
+    float cr = z[2 * m], ci = -z[2 * m + 1];
+    float er = 0.5f * (zr + cr), ei = 0.5f * (zi + ci);
+    /* O = (Z[k] - conj Z[half - k]) / 2i */
+    float or_ = 0.5f * (zi - ci), oi = -0.5f * (zr - cr);
+    float wr, wi;
+    if (k < half / 2) {
+      wr = fft->split[2 * k];
+      wi = fft->split[2 * k + 1];
+    } else {
+      wr = 0.0f;
+      wi = -1.0f;
+    }
+    re[k] = er + or_ * wr - oi * wi;
+    im[k] = ei + or_ * wi + oi * wr;
+    if (m != k) {
+      /* W^{half - k} = -conj W^k, so X[half - k] = conj(E - W^k O) */
+      re[m] = er - (or_ * wr - oi * wi);
+      im[m] = -ei + (or_ * wi + oi * wr);
+    }
+  }
+}
+
+/**
+ * Inverse of ae_fft_forward, unnormalized: the output is fft->size times the
+ * original signal. Callers fold 1 / size into their filter spectra.
+ */
+void ae_fft_inverse(ae_fft_t *fft, const float *re, const float *im,
+                    float *out) {
+  size_t half = fft->half;
+  float *z = fft->work;
+  /* Rebuild the packed spectrum (conjugated, to reuse the forward FFT) */
+  for (size_t k = 0; k <= half / 2; ++k) {
+    size_t m = half - k;
+    float xr = re[k], xi = im[k];
+    float cr = re[m], ci = -im[m];
+    float er = xr + cr, ei = xi + ci;
+    float dr = xr - cr, di = xi - ci;
+    float wr, wi;
+    if (k == 0) {
+      wr = 1.0f;
+      wi = 0.0f;
+    } else if (k < half / 2) {
+      wr = fft->split[2 * k];
+      wi = -fft->split[2 * k + 1];
+    } else {
+      wr = 0.0f;
+      wi = 1.0f;
+    }
+    /* O = D W^{-k}; Z[k] = E + iO */
+    float or_ = dr * wr - di * wi, oi = dr * wi + di * wr;
+    size_t rk = fft->bitrev[k];
+    z[2 * rk] = er - oi;
+    z[2 * rk + 1] = -(ei + or_);
+    if (m != k && m < half) {
+      /* Z[half - k] from the mirrored pair: E' = conj E, O' = conj O */
+      size_t rm = fft->bitrev[m];
+      z[2 * rm] = er + oi;
+      z[2 * rm + 1] = ei - or_;
+    }
+  }
+  ae_fft_complex(fft, z);
+  for (size_t i = 0; i < half; ++i) {
+    out[2 * i] = z[2 * i];
+    out[2 * i + 1] = -z[2 * i + 1];
+  }
+}
@@ -0,0 +1,211 @@
+/**
+ * @file ae_hrir_cache.c
+ * @brief Binary cache of preprocessed HRIR grids
+ *
+ * One file per (source file, sample rate, tap limit), named after a hash of
+ * all three. The file is a fixed header followed by the grid arrays exactly
+ * as ae_hrir_grid_t holds them: the delays, padded to 16 bytes, then the
+ * 16-byte aligned tap table. Loading is one fread per array straight into
+ * the grid's own heap buffers, with no parsing or conversion; the grid
+ * owns that memory like a freshly built one, so ae_hrir_grid_free applies.
+ *
+ * Files are native-endian and carry a byte-order mark; a cache written on a
+ * different architecture is rejected and rebuilt, never misread.
+ */
+
+#include "ae_internal.h"
+#include <inttypes.h>
+#include <stdio.h>
+
+#define AE_HRIR_CACHE_VERSION 1u
+#define AE_HRIR_CACHE_BYTE_ORDER 0x01020304u
+#define AE_HRIR_CACHE_ALIGN 16
+/* Sanity limits on a header read from disk */
+#define AE_HRIR_CACHE_MAX_TAPS 65536u
+#define AE_HRIR_CACHE_MAX_POINTS 1000000u
+
+static const char ae_hrir_cache_magic[8] = {'A', 'E', 'H', 'R',
+                                            'I', 'R', '\0', '\0'};
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order; /* AE_HRIR_CACHE_BYTE_ORDER as written */
+  uint64_t key;        /* ae_hrir_cache_key of the source */
+  uint32_t taps;
+  uint32_t stride;
+  uint32_t az_count;
+  uint32_t el_count;
+  float az_step;
+  float el_step;
+  uint32_t reserved[4]; /* Pads the header to 64 bytes */
+} ae_hrir_cache_header_t;
+
+/* Delay floats rounded up so the table starts 16-byte aligned */
+static size_t ae_hrir_cache_delay_floats(size_t points) {
+  return (points * 2 + 3) & ~(size_t)3;
+}
+
+/**
+ * FNV-1a over the source file's bytes, then over the parameters that
+ * shape the preprocessed grid. False if the file cannot be read.
+ */
+bool ae_hrir_cache_key(const char *source_path, uint32_t sample_rate,
+                       uint32_t max_taps, uint64_t *key) {
+  if (!source_path || !key)
+    return false;
+  FILE *file = fopen(source_path, "rb");
+  if (!file)
+    return false;
+
+  uint64_t hash = 0xcbf29ce484222325ull;
+  unsigned char chunk[4096];
+  size_t got;
+  while ((got = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    for (size_t i = 0; i < got; ++i) {
+      hash ^= chunk[i];
+      hash *= 0x100000001b3ull;
+    }
+  }
+  bool ok = !ferror(file);
+  fclose(file);
+
+  uint32_t params[3] = {sample_rate, max_taps, AE_HRIR_CACHE_VERSION};
+  const unsigned char *bytes = (const unsigned char *)params;
+  for (size_t i = 0; i < sizeof(params); ++i) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ull;
+  }
+  *key = hash;
+  return ok;
+}
+
+/* <dir>/<key>.aehrir; false if it does not fit */
+bool ae_hrir_cache_path(const char *dir, uint64_t key, char *path,
+                        size_t size) {
+  if (!dir || !path || size == 0)
+    return false;
+  size_t len = strlen(dir);
+  const char *sep = len > 0 && (dir[len - 1] == '/' || dir[len - 1] == '\\')
+                        ? ""
+                        : "/";
+  int written = snprintf(path, size, "%s%s%016" PRIx64 ".aehrir", dir, sep,
+                         key);
+  return written > 0 && (size_t)written < size;
+}
+
+/**
+ * Load a cached grid written under the same key. Any mismatch or short
+ * read leaves the grid empty and returns false, so the caller rebuilds.
+ */
+bool ae_hrir_cache_load(ae_hrir_grid_t *grid, const char *path,
+                        uint64_t key) {
+  if (!grid || !path)
+    return false;
+  memset(grid, 0, sizeof(*grid));
+  FILE *file = fopen(path, "rb");
+  if (!file)
+    return false;
+
+  ae_hrir_cache_header_t header;
+  if (fread(&header, sizeof(header), 1, file) != 1 ||
+      memcmp(header.magic, ae_hrir_cache_magic, sizeof(header.magic)) != 0 ||
+      header.version != AE_HRIR_CACHE_VERSION ||
+      header.byte_order != AE_HRIR_CACHE_BYTE_ORDER || header.key != key ||
+      header.taps == 0 || header.taps > AE_HRIR_CACHE_MAX_TAPS ||
+      header.stride != ((header.taps + 3) & ~3u) || header.az_count == 0 ||
+      header.el_count < 2 ||
+      (uint64_t)header.az_count * header.el_count >
+          AE_HRIR_CACHE_MAX_POINTS ||
+      !(header.az_step > 0.0f) || !(header.el_step > 0.0f)) {
+    fclose(file);
+    return false;
+  }
+
+  size_t points = (size_t)header.az_count * header.el_count;
+  size_t delay_floats = ae_hrir_cache_delay_floats(points);
+  size_t table_floats = points * 2 * header.stride;
+  grid->delays = (float *)malloc(delay_floats * sizeof(float));
+  grid->storage = malloc(table_floats * sizeof(float) + AE_HRIR_CACHE_ALIGN);
+  if (!grid->delays || !grid->storage) {
+    fclose(file);
+    ae_hrir_grid_free(grid);
+    return false;
+  }
+  uintptr_t base = (uintptr_t)grid->storage;
+  base =
+      (base + AE_HRIR_CACHE_ALIGN - 1) & ~(uintptr_t)(AE_HRIR_CACHE_ALIGN - 1);
+  grid->table = (float *)base;
+
+  /* Exact size: both arrays present and nothing after them */
+  bool ok =
+      fread(grid->delays, sizeof(float), delay_floats, file) ==
+          delay_floats &&
+      fread(grid->table, sizeof(float), table_floats, file) == table_floats &&
+      fgetc(file) == EOF;
+  fclose(file);
+  if (!ok) {
+    ae_hrir_grid_free(grid);
+    return false;
+  }
+
+  grid->taps = header.taps;
+  grid->stride = header.stride;
+  grid->az_count = header.az_count;
+  grid->el_count = header.el_count;
+  grid->az_step = header.az_step;
+  grid->el_step = header.el_step;
+  return true;
+}
+
+/**
+ * Write the grid under key. The file is written beside its final name and
+ * renamed into place, so concurrent loaders never see a partial cache.
+ */
+bool ae_hrir_cache_save(const ae_hrir_grid_t *grid, const char *path,
+                        uint64_t key) {
+  if (!grid || !grid->table || !path)
+    return false;
+  char tmp_path[1024];
+  int written = snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+  if (written <= 0 || (size_t)written >= sizeof(tmp_path))
+    return false;
+
+  ae_hrir_cache_header_t header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, ae_hrir_cache_magic, sizeof(header.magic));
+  header.version = AE_HRIR_CACHE_VERSION;
+  header.byte_order = AE_HRIR_CACHE_BYTE_ORDER;
+  header.key = key;
+  header.taps = (uint32_t)grid->taps;
+  header.stride = (uint32_t)grid->stride;
+  header.az_count = (uint32_t)grid->az_count;
+  header.el_count = (uint32_t)grid->el_count;
+  header.az_step = grid->az_step;
+  header.el_step = grid->el_step;
+
+  size_t points = grid->az_count * grid->el_count;
+  size_t delay_floats = ae_hrir_cache_delay_floats(points);
+  size_t table_floats = points * 2 * grid->stride;
+  float pad[3] = {0.0f, 0.0f, 0.0f};
+
+  FILE *file = fopen(tmp_path, "wb");
+  if (!file)
+    return false;
+  bool ok =
+      fwrite(&header, sizeof(header), 1, file) == 1 &&
+      fwrite(grid->delays, sizeof(float), points * 2, file) == points * 2 &&
+      fwrite(pad, sizeof(float), delay_floats - points * 2, file) ==
+          delay_floats - points * 2 &&
+      fwrite(grid->table, sizeof(float), table_floats, file) == table_floats;
+  ok = fclose(file) == 0 && ok;
+  if (ok) {
+#ifdef _WIN32
+    remove(path); /* rename() does not replace an existing file here */
+#endif
+    ok = rename(tmp_path, path) == 0;
+  }
+  if (!ok)
+    remove(tmp_path);
+  return ok;
+}
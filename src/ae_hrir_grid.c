@@ -0,0 +1,309 @@
+/**
+ * @file ae_hrir_grid.c
+ * @brief HRIR set resampled onto a regular azimuth/elevation grid
+ *
+ * The source set (SOFA or otherwise) is sampled once at load time through a
+ * callback. Lookups are then a bilinear blend of the four surrounding grid
+ * points: constant time, no allocation and no calls back into the source.
+ */
+
+#include "ae_internal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
+
+#define AE_HRIR_GRID_ALIGN 16
+
+void ae_hrir_grid_free(ae_hrir_grid_t *grid) {
+  if (!grid)
+    return;
+  free(grid->storage);
+  free(grid->delays);
+  memset(grid, 0, sizeof(*grid));
+}
+
+/**
+ * Sample every grid point. Azimuth columns cover [0, 360) and wrap;
+ * elevation rows cover [-90, 90] inclusive. Fails if any sample fails.
+ */
+bool ae_hrir_grid_build(ae_hrir_grid_t *grid, size_t taps, float step_deg,
+                        ae_hrir_sample_fn sample, void *user) {
+  if (!grid || taps == 0 || !sample || !(step_deg > 0.0f))
+    return false;
+  memset(grid, 0, sizeof(*grid));
+
+  grid->taps = taps;
+  grid->stride = (taps + 3) & ~(size_t)3;
+  grid->az_count = (size_t)ceilf(360.0f / step_deg);
+  grid->el_count = (size_t)ceilf(180.0f / step_deg) + 1;
+  grid->az_step = 360.0f / (float)grid->az_count;
+  grid->el_step = 180.0f / (float)(grid->el_count - 1);
+
+  size_t points = grid->az_count * grid->el_count;
+  size_t floats = points * 2 * grid->stride;
+  grid->storage = calloc(floats * sizeof(float) + AE_HRIR_GRID_ALIGN, 1);
+  grid->delays = (float *)calloc(points * 2, sizeof(float));
+  if (!grid->storage || !grid->delays) {
+    ae_hrir_grid_free(grid);
+    return false;
+  }
+  uintptr_t base = (uintptr_t)grid->storage;
+  base = (base + AE_HRIR_GRID_ALIGN - 1) & ~(uintptr_t)(AE_HRIR_GRID_ALIGN - 1);
+  grid->table = (float *)base;
+
+  for (size_t e = 0; e < grid->el_count; ++e) {
+    float el = -90.0f + (float)e * grid->el_step;
+    for (size_t a = 0; a < grid->az_count; ++a) {
+      size_t p = e * grid->az_count + a;
+      float *ir = grid->table + p * 2 * grid->stride;
+      if (!sample(user, (float)a * grid->az_step, el, ir, ir + grid->stride,
+                  &grid->delays[2 * p], &grid->delays[2 * p + 1])) {
+        ae_hrir_grid_free(grid);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/* dst = sum of four weighted rows */
+static void ae_hrir_grid_blend(float *dst, const float *const rows[4],
+                               const float w[4], size_t n) {
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  __m128 w0 = _mm_set1_ps(w[0]);
+  __m128 w1 = _mm_set1_ps(w[1]);
+  __m128 w2 = _mm_set1_ps(w[2]);
+  __m128 w3 = _mm_set1_ps(w[3]);
+  for (; i + 4 <= n; i += 4) {
+    __m128 acc = _mm_mul_ps(_mm_load_ps(rows[0] + i), w0);
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_load_ps(rows[1] + i), w1));
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_load_ps(rows[2] + i), w2));
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_load_ps(rows[3] + i), w3));
+    _mm_storeu_ps(dst + i, acc);
+  }
+#endif
+  for (; i < n; ++i)
+    dst[i] = rows[0][i] * w[0] + rows[1][i] * w[1] + rows[2][i] * w[2] +
+             rows[3][i] * w[3];
+}
+
+/**
+ * Bilinear lookup. Writes grid->taps taps per ear and the blended onset
+ * delays (samples). Azimuth is any angle in degrees; elevation is clamped.
+ */
+void ae_hrir_grid_lookup(const ae_hrir_grid_t *grid, float az_deg,
+                         float el_deg, float *ir_l, float *ir_r,
+                         float *delay_l, float *delay_r) {
+  float az = fmodf(az_deg, 360.0f);
+  if (az < 0.0f)
+    az += 360.0f;
+  float el = ae_clamp(el_deg, -90.0f, 90.0f) + 90.0f;
+
+  float az_pos = az / grid->az_step;
+  float el_pos = el / grid->el_step;
+  size_t a0 = (size_t)az_pos;
+  size_t e0 = (size_t)el_pos;
+  if (a0 >= grid->az_count)
+    a0 = grid->az_count - 1;
+  if (e0 >= grid->el_count - 1)
+    e0 = grid->el_count - 2;
+  float fa = ae_clamp(az_pos - (float)a0, 0.0f, 1.0f);
+  float fe = ae_clamp(el_pos - (float)e0, 0.0f, 1.0f);
+  size_t a1 = a0 + 1 == grid->az_count ? 0 : a0 + 1;
+
+  size_t points[4] = {e0 * grid->az_count + a0, e0 * grid->az_count + a1,
+                      (e0 + 1) * grid->az_count + a0,
+                      (e0 + 1) * grid->az_count + a1};
+  float w[4] = {(1.0f - fa) * (1.0f - fe), fa * (1.0f - fe),
+                (1.0f - fa) * fe, fa * fe};
+
+  const float *rows_l[4];
+  const float *rows_r[4];
+  float d_l = 0.0f;
+  float d_r = 0.0f;
+  for (int i = 0; i < 4; ++i) {
+    rows_l[i] = grid->table + points[i] * 2 * grid->stride;
+    rows_r[i] = rows_l[i] + grid->stride;
+    d_l += w[i] * grid->delays[2 * points[i]];
+    d_r += w[i] * grid->delays[2 * points[i] + 1];
+  }
+  ae_hrir_grid_blend(ir_l, rows_l, w, grid->taps);
+  ae_hrir_grid_blend(ir_r, rows_r, w, grid->taps);
+  if (delay_l)
+    *delay_l = d_l;
+  if (delay_r)
+    *delay_r = d_r;
+}
+
+/* Shift an HRIR right by its onset delay, zeroing the lead-in */
+void ae_hrir_apply_onset(float *ir, size_t hrir_len, size_t filter_len,
+                         float delay) {
+  size_t onset = (size_t)lrintf(
+      ae_clamp(delay, 0.0f, (float)(filter_len - hrir_len)));
+  memmove(ir + onset, ir, hrir_len * sizeof(float));
+  ae_clear_buffer(ir, onset);
+  ae_clear_buffer(ir + onset + hrir_len, filter_len - hrir_len - onset);
+}
+
+/*============================================================================
+ * Preprocessing (once per SOFA set, before caching)
+ *============================================================================*/
+
+/* Onset: first tap within 20 dB of the peak */
+#define AE_HRIR_ONSET_THRESHOLD 0.1f
+/* Truncation keeps all but this fraction of the energy (-40 dB) */
+#define AE_HRIR_TAIL_ENERGY 1e-4f
+/* Magnitude floor for the cepstrum, relative to the peak bin (-140 dB) */
+#define AE_HRIR_LOG_FLOOR 1e-7f
+
+static size_t ae_hrir_onset(const float *ir, size_t n) {
+  float peak = 0.0f;
+  for (size_t i = 0; i < n; ++i)
+    peak = fmaxf(peak, fabsf(ir[i]));
+  for (size_t i = 0; i < n; ++i) {
+    if (fabsf(ir[i]) >= AE_HRIR_ONSET_THRESHOLD * peak)
+      return i;
+  }
+  return 0;
+}
+
+/* Taps holding all but AE_HRIR_TAIL_ENERGY of the energy */
+static size_t ae_hrir_energy_length(const float *ir, size_t n) {
+  double total = 0.0;
+  for (size_t i = 0; i < n; ++i)
+    total += (double)ir[i] * ir[i];
+  double tail = 0.0;
+  size_t len = n;
+  while (len > 1) {
+    double e = (double)ir[len - 1] * ir[len - 1];
+    if (tail + e > total * AE_HRIR_TAIL_ENERGY)
+      break;
+    tail += e;
+    --len;
+  }
+  return len;
+}
+
+/**
+ * In-place minimum-phase version of ir (same magnitude response) through
+ * the folded real cepstrum. buf holds fft->size floats, re/im half + 1.
+ */
+static void ae_hrir_minimum_phase(ae_fft_t *fft, float *ir, size_t n,
+                                  float *buf, float *re, float *im) {
+  size_t size = fft->size;
+  size_t half = fft->half;
+  memcpy(buf, ir, n * sizeof(float));
+  ae_clear_buffer(buf + n, size - n);
+  ae_fft_forward(fft, buf, re, im);
+
+  float peak = 0.0f;
+  for (size_t k = 0; k <= half; ++k) {
+    re[k] = sqrtf(re[k] * re[k] + im[k] * im[k]);
+    peak = fmaxf(peak, re[k]);
+  }
+  if (!(peak > 0.0f))
+    return;
+  float floor_mag = peak * AE_HRIR_LOG_FLOOR;
+  for (size_t k = 0; k <= half; ++k) {
+    re[k] = logf(fmaxf(re[k], floor_mag));
+    im[k] = 0.0f;
+  }
+
+  /* Real cepstrum, folded onto positive quefrencies */
+  ae_fft_inverse(fft, re, im, buf);
+  float scale = 1.0f / (float)size;
+  buf[0] *= scale;
+  for (size_t i = 1; i < half; ++i)
+    buf[i] *= 2.0f * scale;
+  buf[half] *= scale;
+  ae_clear_buffer(buf + half + 1, size - half - 1);
+
+  ae_fft_forward(fft, buf, re, im);
+  for (size_t k = 0; k <= half; ++k) {
+    float mag = expf(re[k]);
+    float phase = im[k];
+    re[k] = mag * cosf(phase);
+    im[k] = mag * sinf(phase);
+  }
+  ae_fft_inverse(fft, re, im, buf);
+  for (size_t i = 0; i < n; ++i)
+    ir[i] = buf[i] * scale;
+}
+
+/**
+ * Make a freshly built grid cheap to render: move each HRIR's onset into
+ * its delay and drop the latency common to the whole set, convert to
+ * minimum phase, then truncate every HRIR to the longest energy length
+ * (at most max_taps). The table is reallocated at the new length.
+ */
+bool ae_hrir_grid_preprocess(ae_hrir_grid_t *grid, size_t max_taps) {
+  if (!grid || !grid->table || max_taps == 0)
+    return false;
+  size_t n = grid->taps;
+  size_t points = grid->az_count * grid->el_count;
+
+  /* Zero padding to 4x keeps cepstral aliasing down */
+  size_t size = 64;
+  while (size < 4 * n)
+    size *= 2;
+  ae_fft_t fft;
+  if (!ae_fft_init(&fft, size))
+    return false;
+  float *buf = (float *)malloc(size * sizeof(float));
+  float *re = (float *)malloc((fft.half + 1) * sizeof(float));
+  float *im = (float *)malloc((fft.half + 1) * sizeof(float));
+  if (!buf || !re || !im) {
+    free(buf);
+    free(re);
+    free(im);
+    ae_fft_free(&fft);
+    return false;
+  }
+
+  float common = INFINITY;
+  size_t len = 1;
+  for (size_t p = 0; p < points * 2; ++p) {
+    float *ir = grid->table + p * grid->stride;
+    grid->delays[p] += (float)ae_hrir_onset(ir, n);
+    common = fminf(common, grid->delays[p]);
+    ae_hrir_minimum_phase(&fft, ir, n, buf, re, im);
+    size_t ir_len = ae_hrir_energy_length(ir, n);
+    if (ir_len > len)
+      len = ir_len;
+  }
+  for (size_t p = 0; p < points * 2; ++p)
+    grid->delays[p] -= common;
+  free(buf);
+  free(re);
+  free(im);
+  ae_fft_free(&fft);
+
+  if (len > max_taps)
+    len = max_taps;
+  size_t stride = (len + 3) & ~(size_t)3;
+  if (stride == grid->stride) {
+    grid->taps = len;
+    return true;
+  }
+
+  void *storage = calloc(points * 2 * stride * sizeof(float) +
+                             AE_HRIR_GRID_ALIGN,
+                         1);
+  if (!storage)
+    return false;
+  uintptr_t base = (uintptr_t)storage;
+  base = (base + AE_HRIR_GRID_ALIGN - 1) & ~(uintptr_t)(AE_HRIR_GRID_ALIGN - 1);
+  float *table = (float *)base;
+  for (size_t p = 0; p < points * 2; ++p)
+    memcpy(table + p * stride, grid->table + p * grid->stride,
+           len * sizeof(float));
+  free(grid->storage);
+  grid->storage = storage;
+  grid->table = table;
+  grid->taps = len;
+  grid->stride = stride;
+  return true;
+}
@@ -0,0 +1,975 @@
+/**
+ * @file ae_hrtf_default.c
+ * @brief Built-in HRIR set (generated by tools/gen_default_hrtf.py)
+ *
+ * Brown-Duda structural model, minimum phase, 32 taps at 48000 Hz on a
+ * 15-degree grid. Left ear only; do not edit by hand.
+ */
+
+#include "ae_internal.h"
+
+const int16_t ae_hrtf_default_taps[AE_HRTF_DEFAULT_EL][AE_HRTF_DEFAULT_AZ]
+                                   [AE_HRTF_DEFAULT_TAPS] = {
+    /* Elevation -90 */
+    {
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0},
+        {4050, 163, 1495, -316, 33, -359, 389, -536, 497, -618, -2308, 510,
+         -408, 1420, -78, -110, 56, -144, -509, 461, 354, -31, 16, 18, -4, 19,
+         -7, 12, -4, 5, -1, 0}
+    },
+    /* Elevation -75 */
+    {
+        {4009, 100, 1278, -167, -42, -231, 444, -840, 754, -748, -1809, 276,
+         -291, 1352, -251, -85, 130, -122, -492, 472, 275, -12, 10, 25, -7, 23,
+         -8, 14, -5, 5, -1, 1},
+        {3668, 162, 1227, -85, 13, -173, 433, -741, 706, -675, -1644, 221, -281,
+         1217, -225, -73, 119, -111, -449, 425, 251, -5, 14, 27, -3, 24, -5, 14,
+         -4, 5, -1, 1},
+        {3376, 216, 1184, -14, 61, -127, 423, -660, 677, -632, -1488, 171, -267,
+         1102, -209, -60, 108, -104, -411, 389, 227, 2, 16, 29, 0, 24, -3, 14,
+         -3, 5, -1, 1},
+        {3148, 257, 1150, 41, 100, -94, 413, -601, 666, -618, -1352, 127, -249,
+         1011, -202, -45, 99, -101, -378, 364, 205, 7, 18, 30, 2, 25, -2, 14,
+         -2, 5, -1, 0},
+        {2996, 286, 1128, 79, 126, -75, 404, -565, 675, -636, -1241, 92, -227,
+         948, -205, -29, 91, -104, -353, 352, 185, 12, 19, 31, 4, 25, -1, 14,
+         -2, 5, -1, 0},
+        {2925, 301, 1118, 98, 137, -71, 393, -554, 703, -688, -1154, 64, -199,
+         916, -218, -13, 86, -112, -336, 355, 169, 15, 18, 32, 4, 25, -1, 14,
+         -1, 5, -1, 0},
+        {2938, 302, 1120, 100, 133, -82, 380, -566, 752, -780, -1089, 42, -163,
+         912, -242, 4, 83, -126, -325, 371, 154, 17, 17, 33, 3, 26, -1, 14, -2,
+         5, -1, 0},
+        {3037, 281, 1135, 71, 119, -92, 396, -588, 727, -725, -1198, 79, -199,
+         959, -230, -14, 89, -117, -348, 372, 174, 13, 17, 32, 3, 25, -2, 14,
+         -2, 5, -1, 0},
+        {3217, 246, 1162, 26, 91, -116, 410, -632, 718, -702, -1333, 124, -228,
+         1034, -227, -32, 98, -113, -379, 386, 197, 8, 16, 30, 1, 25, -3, 14,
+         -2, 5, -1, 1},
+        {3467, 199, 1199, -36, 49, -152, 423, -697, 724, -706, -1491, 175, -253,
+         1136, -233, -51, 108, -114, -416, 412, 224, 1, 14, 29, -1, 24, -4, 14,
+         -3, 5, -1, 1},
+        {3778, 142, 1244, -111, -3, -198, 435, -780, 746, -736, -1669, 232,
+         -273, 1260, -246, -69, 121, -119, -459, 447, 252, -6, 12, 27, -4, 24,
+         -6, 14, -4, 5, -1, 1},
+        {4129, 78, 1296, -196, -61, -254, 447, -878, 782, -790, -1855, 293,
+         -290, 1400, -266, -85, 133, -128, -505, 492, 280, -14, 9, 25, -8, 23,
+         -9, 14, -5, 5, -1, 1},
+        {4500, 11, 1351, -285, -121, -317, 459, -986, 834, -869, -2034, 353,
+         -300, 1546, -294, -98, 146, -140, -552, 543, 307, -22, 5, 23, -12, 23,
+         -12, 14, -6, 5, -2, 1},
+        {4862, -55, 1407, -373, -178, -383, 469, -1096, 903, -973, -2190, 406,
+         -303, 1689, -330, -104, 157, -156, -594, 598, 327, -29, 1, 22, -16, 23,
+         -14, 14, -8, 5, -2, 1},
+        {5190, -115, 1458, -453, -228, -448, 478, -1203, 987, -1102, -2303, 447,
+         -295, 1817, -374, -103, 165, -174, -629, 654, 339, -34, -3, 21, -20,
+         23, -17, 15, -9, 6, -2, 1},
+        {5458, -163, 1500, -517, -267, -508, 481, -1296, 1085, -1254, -2358,
+         471, -273, 1918, -424, -91, 169, -196, -652, 708, 340, -37, -7, 21,
+         -24, 23, -20, 15, -10, 6, -3, 1},
+        {5643, -195, 1530, -561, -294, -558, 478, -1368, 1190, -1423, -2342,
+         471, -236, 1981, -477, -69, 168, -220, -659, 756, 329, -37, -11, 21,
+         -27, 24, -21, 15, -11, 6, -3, 1},
+        {5729, -207, 1544, -578, -308, -592, 465, -1411, 1295, -1600, -2252,
+         443, -181, 1999, -529, -38, 162, -246, -648, 793, 305, -34, -14, 22,
+         -29, 25, -23, 16, -11, 6, -3, 1},
+        {5709, -196, 1539, -565, -310, -605, 440, -1415, 1387, -1772, -2089,
+         387, -109, 1965, -574, 0, 152, -272, -617, 818, 270, -28, -16, 24, -30,
+         26, -23, 16, -12, 6, -3, 1},
+        {5591, -182, 1523, -545, -286, -566, 462, -1368, 1266, -1555, -2198,
+         425, -182, 1946, -514, -37, 159, -240, -632, 772, 298, -32, -12, 23,
+         -28, 25, -22, 16, -11, 6, -3, 1},
+        {5378, -147, 1489, -497, -252, -510, 471, -1288, 1139, -1345, -2232,
+         433, -235, 1878, -450, -65, 160, -209, -628, 715, 314, -32, -8, 22,
+         -24, 24, -19, 15, -10, 6, -3, 1},
+        {5088, -96, 1444, -428, -208, -442, 470, -1185, 1018, -1153, -2196, 416,
+         -269, 1773, -389, -83, 158, -181, -608, 653, 319, -30, -3, 22, -20, 23,
+         -17, 15, -9, 6, -2, 1},
+        {4745, -34, 1390, -345, -157, -369, 464, -1069, 911, -987, -2103, 380,
+         -288, 1642, -334, -92, 151, -157, -575, 589, 312, -25, 2, 23, -15, 23,
+         -14, 14, -7, 5, -2, 1},
+        {4376, 33, 1333, -256, -100, -297, 455, -952, 822, -852, -1967, 331,
+         -294, 1497, -288, -92, 141, -137, -535, 527, 296, -19, 6, 24, -11, 23,
+         -11, 14, -6, 5, -2, 1}
+    },
+    /* Elevation -60 */
+    {
+        {3845, 292, 779, 216, -47, -315, 335, -854, 1077, -1146, -1222, 78,
+         -106, 1147, -357, 30, 142, -186, -398, 505, 174, 3, 9, 28, -5, 23, -6,
+         13, -4, 5, -1, 1},
+        {3193, 394, 763, 309, 63, -190, 328, -663, 922, -935, -1000, 8, -112,
+         919, -285, 31, 118, -153, -329, 408, 146, 14, 15, 31, 2, 24, -2, 13,
+         -2, 5, -1, 0},
+        {2661, 467, 759, 390, 144, -75, 294, -485, 801, -799, -781, -66, -92,
+         721, -235, 42, 96, -135, -262, 335, 116, 25, 21, 33, 8, 24, 2, 13, 0,
+         5, 0, 0},
+        {2251, 540, 743, 463, 202, -1, 268, -359, 726, -726, -596, -131, -61,
+         567, -198, 53, 78, -127, -207, 284, 90, 35, 23, 36, 12, 25, 5, 13, 2,
+         4, 0, 0},
+        {2010, 555, 758, 506, 223, 72, 195, -226, 652, -705, -445, -190, -5,
+         451, -177, 70, 64, -135, -154, 253, 69, 41, 25, 36, 15, 25, 7, 13, 2,
+         4, 0, 0},
+        {1897, 567, 764, 542, 216, 109, 119, -122, 600, -737, -324, -241, 71,
+         367, -163, 87, 51, -153, -107, 240, 52, 45, 26, 37, 16, 25, 8, 12, 3,
+         4, 0, 0},
+        {1914, 563, 772, 566, 174, 121, 17, -12, 543, -820, -217, -293, 181,
+         294, -154, 108, 35, -184, -53, 241, 36, 48, 24, 36, 16, 24, 9, 12, 3,
+         4, 1, 0},
+        {2076, 540, 769, 523, 175, 76, 102, -155, 650, -836, -340, -243, 100,
+         411, -189, 97, 53, -171, -113, 270, 51, 44, 23, 36, 14, 25, 7, 12, 2,
+         4, 0, 0},
+        {2376, 502, 766, 464, 147, 1, 176, -314, 760, -889, -504, -179, 35, 557,
+         -229, 85, 71, -167, -176, 314, 71, 37, 20, 35, 10, 25, 4, 13, 1, 4, 0,
+         0},
+        {2806, 467, 749, 396, 97, -118, 262, -518, 893, -980, -722, -97, -22,
+         746, -274, 68, 93, -168, -252, 376, 100, 28, 16, 34, 5, 25, 1, 13, 0,
+         4, 0, 0},
+        {3396, 363, 771, 295, 12, -227, 293, -702, 1009, -1101, -981, -7, -58,
+         969, -329, 54, 118, -184, -330, 453, 136, 15, 12, 30, 0, 24, -3, 13,
+         -2, 5, -1, 0},
+        {4070, 270, 775, 193, -89, -372, 336, -929, 1161, -1270, -1264, 90, -85,
+         1223, -393, 40, 147, -206, -415, 547, 176, 1, 5, 27, -8, 24, -8, 14,
+         -5, 5, -1, 1},
+        {4808, 153, 795, 86, -213, -513, 343, -1146, 1333, -1503, -1520, 171,
+         -80, 1482, -473, 37, 175, -243, -494, 655, 209, -12, -2, 24, -15, 23,
+         -13, 14, -7, 5, -2, 1},
+        {5525, 66, 796, 0, -343, -675, 349, -1372, 1557, -1825, -1701, 225, -39,
+         1726, -571, 54, 196, -293, -559, 776, 226, -23, -11, 22, -24, 23, -19,
+         14, -9, 5, -2, 1},
+        {6190, -31, 815, -66, -491, -803, 287, -1526, 1797, -2245, -1741, 220,
+         70, 1911, -689, 100, 205, -366, -587, 903, 214, -27, -22, 21, -32, 22,
+         -23, 14, -12, 6, -3, 1},
+        {6695, -46, 789, -70, -641, -936, 212, -1636, 2066, -2755, -1606, 143,
+         250, 2003, -805, 171, 198, -455, -571, 1023, 171, -21, -35, 23, -41,
+         24, -28, 14, -13, 5, -3, 1},
+        {7104, -170, 868, -77, -829, -926, -75, -1453, 2162, -3269, -1269, -36,
+         556, 1931, -902, 275, 165, -578, -461, 1104, 98, -10, -45, 24, -46, 23,
+         -31, 15, -14, 6, -3, 1},
+        {7276, -210, 912, -18, -1011, -886, -406, -1104, 2103, -3699, -794,
+         -284, 938, 1686, -927, 375, 105, -699, -281, 1126, 12, 8, -53, 25, -47,
+         22, -31, 13, -14, 5, -3, 1},
+        {7220, -202, 943, 82, -1178, -794, -785, -549, 1778, -3904, -272, -552,
+         1358, 1265, -844, 445, 20, -798, -33, 1065, -68, 26, -56, 23, -43, 18,
+         -26, 10, -12, 4, -3, 0},
+        {6990, -169, 904, 12, -946, -833, -378, -1052, 2023, -3542, -769, -281,
+         892, 1615, -886, 359, 102, -670, -272, 1079, 14, 10, -49, 25, -44, 22,
+         -29, 13, -13, 5, -3, 1},
+        {6558, -92, 857, -14, -717, -819, -46, -1322, 2000, -2994, -1181, -52,
+         496, 1772, -825, 253, 154, -531, -429, 1012, 95, -5, -37, 25, -39, 23,
+         -27, 14, -13, 6, -3, 1},
+        {5941, 53, 781, 21, -498, -777, 222, -1419, 1839, -2411, -1435, 96, 198,
+         1759, -702, 151, 177, -400, -509, 897, 157, -12, -25, 26, -32, 24, -22,
+         14, -10, 5, -3, 1},
+        {5285, 96, 801, 50, -328, -617, 289, -1260, 1542, -1875, -1494, 147, 28,
+         1606, -572, 85, 177, -307, -504, 757, 189, -13, -11, 24, -22, 23, -17,
+         14, -9, 5, -2, 1},
+        {4553, 203, 782, 129, -173, -472, 340, -1076, 1292, -1454, -1409, 135,
+         -70, 1390, -452, 44, 163, -235, -463, 623, 193, -7, 0, 26, -13, 23,
+         -12, 14, -6, 5, -2, 1}
+    },
+    /* Elevation -45 */
+    {
+        {3709, 273, 647, 461, -137, -241, -240, -210, 974, -1449, -634, -195,
+         236, 807, -401, 219, 94, -347, -180, 511, 62, 26, 4, 30, -3, 23, -4,
+         12, -2, 4, -1, 0},
+        {2813, 410, 671, 525, 44, -73, -129, -88, 751, -1052, -476, -218, 151,
+         565, -280, 170, 74, -259, -133, 371, 56, 36, 15, 33, 7, 24, 2, 12, 0,
+         4, 0, 0},
+        {2106, 514, 698, 584, 180, 55, -67, 40, 560, -764, -325, -247, 115, 357,
+         -182, 139, 52, -199, -81, 262, 47, 44, 24, 36, 15, 24, 7, 12, 2, 4, 0,
+         0},
+        {1619, 584, 718, 634, 270, 136, -40, 145, 407, -567, -220, -265, 107,
+         205, -107, 120, 33, -163, -37, 188, 42, 50, 30, 36, 20, 24, 11, 12, 4,
+         4, 1, 0},
+        {1338, 622, 733, 673, 316, 170, -42, 233, 282, -450, -160, -266, 122,
+         105, -52, 110, 16, -146, 2, 144, 42, 51, 34, 36, 24, 23, 13, 11, 5, 3,
+         1, 0},
+        {1220, 642, 743, 697, 322, 168, -64, 320, 148, -382, -131, -247, 161,
+         34, -6, 105, -6, -141, 46, 118, 43, 50, 37, 34, 26, 21, 15, 10, 6, 3,
+         1, 0},
+        {1242, 666, 737, 687, 292, 138, -89, 407, -37, -314, -132, -191, 212,
+         -26, 38, 91, -38, -129, 101, 95, 47, 45, 39, 30, 29, 19, 17, 9, 7, 3,
+         1, 0},
+        {1388, 615, 750, 692, 270, 129, -108, 359, 135, -458, -120, -261, 213,
+         32, -11, 118, -17, -163, 65, 133, 38, 49, 35, 33, 25, 21, 14, 10, 6, 3,
+         1, 0},
+        {1733, 556, 745, 658, 207, 86, -137, 279, 313, -654, -150, -296, 227,
+         138, -85, 146, 2, -199, 27, 194, 31, 50, 28, 35, 20, 22, 11, 11, 4, 3,
+         1, 0},
+        {2301, 471, 726, 599, 101, -1, -179, 156, 523, -923, -241, -297, 250,
+         313, -186, 178, 24, -249, -25, 288, 29, 47, 20, 35, 13, 23, 7, 11, 2,
+         4, 0, 0},
+        {3084, 356, 693, 526, -42, -135, -236, -12, 770, -1253, -411, -265, 274,
+         562, -309, 213, 55, -313, -95, 413, 37, 38, 10, 33, 4, 23, 1, 12, 0, 4,
+         0, 0},
+        {4038, 216, 653, 447, -219, -308, -317, -201, 1037, -1639, -632, -215,
+         314, 859, -444, 252, 89, -393, -172, 563, 52, 25, -1, 30, -7, 23, -6,
+         12, -3, 4, -1, 0},
+        {5091, 56, 621, 371, -429, -505, -443, -355, 1303, -2098, -829, -183,
+         405, 1150, -586, 307, 116, -495, -232, 728, 62, 13, -14, 26, -18, 22,
+         -13, 13, -7, 5, -2, 0},
+        {6153, -119, 620, 312, -673, -713, -641, -396, 1531, -2652, -902, -211,
+         595, 1365, -727, 394, 116, -625, -239, 895, 47, 6, -29, 24, -30, 21,
+         -21, 13, -10, 5, -2, 1},
+        {7120, -295, 670, 288, -955, -921, -937, -228, 1637, -3274, -769, -336,
+         928, 1412, -832, 518, 67, -785, -150, 1037, -4, 10, -46, 22, -41, 19,
+         -26, 12, -12, 5, -3, 1},
+        {7885, -448, 781, 317, -1279, -1125, -1322, 246, 1467, -3835, -423,
+         -556, 1416, 1201, -831, 654, -51, -958, 71, 1105, -83, 22, -62, 19,
+         -47, 16, -29, 9, -13, 4, -3, 0},
+        {8356, -535, 941, 405, -1637, -1330, -1723, 1047, 831, -4080, 17, -786,
+         1983, 692, -636, 739, -244, -1093, 429, 1038, -156, 31, -68, 11, -44,
+         6, -25, 4, -11, 2, -2, 0},
+        {8519, -502, 1050, 483, -1966, -1498, -1987, 1993, -366, -3696, 311,
+         -829, 2431, -21, -230, 681, -480, -1097, 861, 795, -176, 21, -54, -9,
+         -27, -11, -13, -7, -4, -2, -1, 0},
+        {8482, -316, 896, 407, -2082, -1550, -1976, 2663, -1899, -2512, 180,
+         -439, 2487, -673, 219, 446, -662, -871, 1201, 408, -114, -21, -17, -41,
+         2, -34, 6, -20, 4, -7, 1, -1},
+        {8104, -437, 1033, 495, -1836, -1403, -1877, 1898, -337, -3507, 286,
+         -796, 2302, -18, -217, 649, -453, -1042, 814, 757, -164, 23, -49, -7,
+         -24, -9, -11, -6, -4, -2, -1, 0},
+        {7555, -403, 917, 435, -1413, -1159, -1531, 954, 769, -3665, -3, -727,
+         1771, 625, -570, 667, -214, -985, 380, 936, -134, 33, -56, 14, -36, 8,
+         -21, 5, -9, 2, -2, 0},
+        {6766, -264, 770, 374, -1002, -900, -1092, 228, 1278, -3251, -386, -504,
+         1182, 1023, -702, 559, -36, -816, 51, 941, -61, 27, -46, 22, -35, 17,
+         -22, 10, -10, 4, -2, 0},
+        {5787, -81, 678, 367, -653, -661, -705, -157, 1351, -2607, -650, -312,
+         712, 1132, -659, 417, 63, -629, -132, 831, 9, 19, -28, 26, -26, 21,
+         -17, 12, -8, 4, -2, 0},
+        {4732, 106, 642, 403, -368, -441, -423, -265, 1199, -1971, -720, -214,
+         406, 1025, -537, 299, 98, -469, -194, 672, 50, 19, -10, 28, -14, 22,
+         -11, 12, -6, 5, -1, 0}
+    },
+    /* Elevation -30 */
+    {
+        {3486, 188, 844, 551, -100, -537, -572, 649, 418, -1420, -223, -387,
+         573, 312, -210, 383, -101, -456, 124, 428, -16, 46, 1, 31, 1, 20, 0,
+         10, 0, 3, 0, 0},
+        {2435, 379, 808, 613, 121, -248, -334, 507, 312, -920, -183, -327, 357,
+         182, -114, 268, -59, -312, 82, 285, 10, 49, 17, 33, 12, 21, 7, 10, 2,
+         3, 0, 0},
+        {1646, 516, 791, 674, 279, -51, -164, 430, 196, -545, -145, -276, 212,
+         66, -28, 186, -38, -208, 65, 176, 30, 51, 29, 34, 21, 22, 12, 10, 5, 3,
+         1, 0},
+        {1197, 618, 759, 688, 371, 73, -63, 378, 100, -323, -135, -220, 140, 7,
+         18, 130, -25, -142, 61, 113, 44, 50, 37, 34, 27, 22, 15, 10, 6, 3, 1,
+         0},
+        {1016, 669, 750, 693, 394, 97, -13, 371, -2, -217, -142, -158, 121, -23,
+         51, 103, -34, -107, 76, 85, 52, 48, 41, 33, 29, 21, 17, 10, 7, 3, 1,
+         0},
+        {1009, 718, 731, 654, 381, 71, 28, 357, -131, -133, -170, -66, 120, -31,
+         72, 77, -58, -67, 102, 68, 56, 44, 42, 31, 30, 19, 17, 9, 7, 3, 1, 0},
+        {1038, 744, 726, 602, 373, -1, 126, 256, -218, -45, -199, 63, 71, -9,
+         80, 53, -88, -1, 108, 59, 56, 44, 40, 32, 28, 21, 15, 10, 6, 3, 1, 0},
+        {1072, 710, 731, 649, 364, 48, 22, 376, -159, -137, -174, -60, 132, -38,
+         78, 78, -67, -69, 112, 67, 56, 43, 42, 30, 30, 19, 17, 9, 7, 3, 1, 0},
+        {1305, 623, 770, 678, 308, -5, -63, 470, -90, -293, -137, -163, 200,
+         -50, 69, 120, -70, -135, 123, 96, 46, 45, 38, 30, 28, 18, 16, 9, 7, 3,
+         1, 0},
+        {1861, 500, 809, 659, 190, -150, -208, 575, 6, -585, -113, -263, 328,
+         -11, 23, 191, -90, -226, 146, 167, 24, 47, 29, 30, 22, 18, 13, 9, 5, 3,
+         1, 0},
+        {2716, 314, 877, 636, 7, -402, -413, 690, 172, -1037, -130, -357, 490,
+         109, -65, 305, -123, -361, 167, 297, -3, 48, 14, 30, 11, 19, 6, 9, 2,
+         3, 0, 0},
+        {3862, 112, 888, 548, -207, -681, -669, 778, 375, -1599, -198, -423,
+         695, 300, -207, 430, -144, -515, 179, 466, -31, 45, -4, 29, -2, 18, -2,
+         9, -1, 3, 0, 0},
+        {5140, -120, 924, 471, -469, -1026, -959, 933, 525, -2212, -257, -491,
+         950, 474, -333, 571, -189, -691, 221, 645, -61, 41, -24, 25, -16, 17,
+         -10, 9, -5, 3, -1, 0},
+        {6407, -363, 1030, 434, -794, -1454, -1268, 1262, 488, -2810, -224,
+         -594, 1299, 513, -374, 719, -296, -879, 351, 791, -103, 38, -43, 20,
+         -28, 13, -17, 7, -7, 3, -2, 0},
+        {7502, -582, 1254, 468, -1216, -1977, -1532, 1851, 69, -3238, -67, -718,
+         1733, 303, -233, 840, -505, -1047, 619, 841, -152, 36, -56, 10, -34, 5,
+         -18, 2, -8, 1, -2, 0},
+        {8468, -646, 1295, 383, -1619, -2375, -1657, 2535, -922, -3192, 102,
+         -685, 2193, -175, 59, 805, -744, -1074, 994, 712, -175, 19, -54, -11,
+         -27, -12, -13, -7, -4, -2, -1, 0},
+        {9109, -558, 1271, 280, -2031, -2759, -1445, 3123, -2453, -2361, 2,
+         -272, 2327, -751, 535, 582, -1018, -877, 1379, 397, -130, -26, -27,
+         -44, -5, -37, 2, -20, 3, -7, 1, -1},
+        {9627, -324, 787, -55, -2036, -3016, -867, 2968, -3854, -739, -655, 759,
+         1828, -1010, 803, 220, -1172, -334, 1488, 9, -30, -82, 7, -75, 15, -55,
+         14, -30, 8, -11, 2, -1},
+        {9820, -268, 539, -553, -1723, -3553, 590, 1384, -4012, 780, -1417,
+         2108, 448, -576, 724, -71, -1291, 526, 1106, -175, -2, -67, -18, -42,
+         -16, -25, -10, -12, -4, -4, -1, 0},
+        {9102, -261, 784, -12, -1888, -2828, -813, 2809, -3627, -701, -625, 709,
+         1724, -951, 758, 211, -1104, -317, 1404, 12, -25, -74, 9, -68, 16, -50,
+         14, -28, 8, -10, 2, -1},
+        {8129, -411, 1208, 329, -1737, -2413, -1271, 2790, -2156, -2101, -15,
+         -259, 2060, -663, 477, 524, -899, -784, 1221, 359, -108, -17, -19, -35,
+         -1, -30, 4, -17, 3, -6, 1, -1},
+        {7110, -411, 1195, 439, -1247, -1918, -1359, 2133, -732, -2656, 58,
+         -598, 1810, -141, 52, 678, -610, -900, 820, 600, -134, 25, -37, -2,
+         -17, -6, -7, -4, -2, -1, 0, 0},
+        {5899, -282, 1128, 524, -806, -1450, -1157, 1462, 103, -2500, -88, -597,
+         1316, 238, -177, 661, -377, -818, 467, 659, -102, 40, -33, 16, -19, 10,
+         -10, 4, -4, 2, -1, 0},
+        {4690, -43, 935, 511, -398, -932, -864, 936, 412, -1993, -206, -478,
+         891, 369, -262, 524, -194, -634, 235, 572, -54, 43, -17, 26, -11, 17,
+         -7, 9, -3, 3, -1, 0}
+    },
+    /* Elevation -15 */
+    {
+        {3351, 363, 789, 385, 1, -864, -356, 1060, -434, -964, -81, -273, 741,
+         -162, 125, 294, -286, -357, 397, 219, -11, 35, 16, 16, 15, 8, 10, 3, 4,
+         1, 1, 0},
+        {2227, 529, 756, 501, 206, -421, -173, 727, -243, -575, -110, -209, 438,
+         -107, 99, 197, -166, -228, 247, 146, 21, 40, 29, 24, 23, 14, 14, 6, 6,
+         2, 1, 0},
+        {1436, 655, 732, 585, 339, -123, -36, 498, -143, -291, -136, -142, 228,
+         -71, 89, 125, -91, -132, 150, 93, 45, 43, 38, 29, 28, 17, 16, 8, 7, 2,
+         1, 0},
+        {1041, 725, 723, 625, 398, 5, 42, 378, -116, -150, -154, -80, 125, -44,
+         85, 90, -63, -77, 108, 70, 56, 44, 42, 31, 30, 19, 17, 9, 7, 3, 1, 0},
+        {1019, 755, 712, 615, 375, -21, 109, 320, -193, -76, -178, 14, 88, -31,
+         98, 66, -82, -31, 115, 59, 58, 43, 42, 31, 30, 19, 17, 9, 7, 3, 1, 0},
+        {1208, 766, 691, 552, 315, -152, 254, 165, -271, -4, -203, 165, 19, 5,
+         108, 31, -122, 55, 119, 52, 54, 43, 37, 32, 25, 21, 14, 10, 5, 3, 1,
+         0},
+        {1173, 785, 679, 542, 257, -132, 357, -101, -119, -44, -93, 189, -39,
+         60, 91, -17, -88, 116, 84, 59, 49, 46, 34, 34, 23, 22, 12, 11, 5, 3, 1,
+         0},
+        {1018, 780, 704, 579, 360, -65, 216, 169, -203, -25, -177, 114, 28, 9,
+         93, 39, -96, 35, 104, 58, 55, 45, 39, 33, 26, 21, 15, 10, 6, 3, 1, 0},
+        {1133, 746, 708, 602, 346, -71, 115, 344, -246, -72, -190, 34, 99, -42,
+         110, 65, -99, -28, 132, 56, 58, 41, 42, 29, 30, 18, 17, 9, 7, 3, 1, 0},
+        {1642, 665, 720, 562, 257, -253, 9, 562, -362, -218, -174, -41, 251,
+         -115, 146, 103, -146, -104, 209, 69, 49, 35, 40, 23, 29, 14, 17, 6, 7,
+         2, 2, 0},
+        {2558, 520, 744, 470, 101, -588, -165, 856, -491, -551, -129, -144, 516,
+         -182, 168, 185, -232, -224, 330, 123, 22, 32, 30, 17, 24, 9, 15, 3, 6,
+         1, 1, 0},
+        {3775, 322, 789, 342, -98, -1050, -396, 1211, -614, -1037, -79, -260,
+         857, -222, 170, 309, -348, -385, 478, 221, -18, 29, 14, 11, 15, 4, 10,
+         1, 4, 0, 1, 0},
+        {5171, 111, 834, 197, -347, -1598, -633, 1619, -824, -1545, -41, -347,
+         1237, -280, 193, 437, -493, -551, 660, 320, -59, 23, -3, 2, 5, -3, 5,
+         -3, 3, -1, 1, 0},
+        {6598, -53, 849, 51, -653, -2196, -804, 2092, -1288, -1881, -23, -351,
+         1620, -433, 300, 514, -678, -671, 899, 357, -88, 9, -14, -13, 0, -14,
+         3, -8, 2, -3, 1, 0},
+        {7906, -111, 796, -74, -1036, -2803, -786, 2566, -2146, -1798, -99,
+         -154, 1890, -710, 546, 474, -906, -665, 1189, 273, -86, -23, -11, -38,
+         4, -31, 7, -18, 5, -7, 1, -1},
+        {8951, -13, 659, -189, -1469, -3401, -406, 2796, -3346, -1068, -422,
+         428, 1782, -967, 884, 277, -1161, -427, 1435, 58, -38, -72, 9, -70, 17,
+         -52, 15, -29, 8, -10, 2, -1},
+        {9795, 125, 345, -347, -1852, -3877, 496, 2156, -4240, 186, -1069, 1532,
+         979, -854, 1053, -37, -1365, 165, 1397, -175, 18, -106, 14, -81, 15,
+         -57, 12, -29, 6, -10, 2, -1},
+        {10389, 169, 33, -750, -1856, -4382, 2062, -12, -3605, 1010, -1438,
+         2607, -371, -190, 813, -329, -1393, 1011, 888, -212, -13, -62, -41,
+         -29, -38, -13, -24, -4, -11, -1, -2, 0},
+        {10493, 191, -224, -830, -2365, -3945, 3209, -3017, -988, 257, -382,
+         2345, -1276, 535, 449, -763, -858, 1523, 205, -90, -80, -7, -84, 10,
+         -69, 14, -44, 10, -20, 5, -5, 1},
+        {9789, 208, 76, -665, -1714, -4105, 1944, -1, -3387, 944, -1357, 2448,
+         -346, -177, 766, -305, -1310, 949, 837, -195, -8, -55, -36, -25, -34,
+         -11, -22, -4, -10, -1, -2, 0},
+        {8679, 204, 392, -225, -1568, -3386, 448, 1922, -3725, 153, -956, 1339,
+         866, -749, 931, -24, -1202, 140, 1234, -145, 23, -87, 18, -67, 17, -47,
+         13, -24, 6, -9, 2, -1},
+        {7425, 128, 672, -32, -1109, -2744, -319, 2329, -2723, -891, -370, 330,
+         1462, -789, 730, 241, -949, -359, 1179, 60, -20, -50, 15, -50, 19, -38,
+         15, -21, 8, -8, 2, -1},
+        {6098, 102, 779, 110, -651, -2055, -576, 1988, -1587, -1377, -109, -151,
+         1426, -532, 419, 376, -678, -516, 899, 222, -49, -4, 3, -19, 11, -17,
+         10, -11, 5, -4, 1, 0},
+        {4689, 201, 809, 248, -278, -1421, -528, 1496, -832, -1310, -61, -289,
+         1104, -291, 212, 375, -454, -478, 614, 265, -40, 22, 5, 3, 10, -2, 8,
+         -2, 4, -1, 1, 0}
+    },
+    /* Elevation 0 */
+    {
+        {3301, 637, 498, 392, -218, -971, 174, 842, -1095, -211, -295, 265, 411,
+         -293, 398, 33, -384, -54, 473, 7, 51, -1, 41, -4, 31, -5, 19, -4, 9,
+         -2, 2, 0},
+        {2155, 708, 588, 502, 61, -495, 163, 564, -639, -126, -239, 153, 229,
+         -160, 256, 42, -231, -34, 291, 29, 56, 20, 43, 13, 31, 7, 19, 2, 8, 0,
+         2, 0},
+        {1366, 762, 653, 577, 244, -179, 173, 356, -339, -60, -201, 99, 95, -60,
+         159, 45, -133, -8, 167, 45, 60, 35, 43, 25, 30, 15, 17, 7, 7, 2, 2, 0},
+        {1020, 789, 683, 599, 320, -54, 197, 229, -208, -36, -172, 95, 33, -6,
+         113, 42, -94, 17, 112, 56, 58, 43, 41, 31, 29, 20, 16, 10, 6, 3, 1, 0},
+        {1115, 788, 675, 562, 272, -104, 294, 77, -196, -19, -150, 168, -19, 34,
+         108, 11, -102, 76, 101, 56, 53, 45, 36, 34, 25, 22, 14, 11, 5, 3, 1,
+         0},
+        {1673, 732, 625, 475, 13, -225, 481, -284, -117, -54, -40, 271, -129,
+         119, 108, -83, -98, 196, 79, 54, 41, 44, 27, 33, 18, 22, 9, 11, 3, 4,
+         1, 0},
+        {1463, 732, 661, 499, -64, 37, 289, -335, 50, -117, 148, 112, -76, 140,
+         62, -109, 10, 167, 54, 62, 42, 44, 30, 32, 21, 21, 12, 10, 4, 3, 1, 0},
+        {1072, 785, 682, 559, 218, -41, 316, -85, -85, -58, -48, 156, -41, 71,
+         91, -24, -64, 107, 79, 62, 50, 47, 35, 35, 24, 22, 13, 11, 5, 3, 1, 0},
+        {1115, 788, 675, 562, 272, -104, 294, 77, -196, -19, -150, 168, -19, 34,
+         108, 11, -102, 76, 101, 56, 53, 45, 36, 34, 25, 22, 14, 11, 5, 3, 1,
+         0},
+        {1591, 762, 629, 538, 155, -296, 293, 260, -444, 16, -241, 234, 21, -26,
+         174, 13, -174, 65, 173, 36, 57, 34, 38, 25, 27, 16, 15, 8, 6, 2, 1, 0},
+        {2497, 709, 552, 469, -73, -657, 273, 543, -838, -27, -308, 306, 172,
+         -155, 302, 6, -293, 31, 326, 8, 58, 13, 41, 9, 30, 5, 18, 1, 8, 0, 2,
+         0},
+        {3739, 624, 454, 352, -354, -1161, 233, 900, -1314, -167, -349, 374,
+         421, -326, 458, 10, -451, -25, 534, -13, 52, -10, 41, -10, 31, -9, 20,
+         -6, 9, -2, 2, 0},
+        {5174, 532, 344, 214, -697, -1759, 231, 1262, -1877, -297, -409, 498,
+         669, -499, 636, 4, -642, -61, 766, -36, 43, -36, 38, -31, 32, -24, 21,
+         -14, 10, -5, 2, -1},
+        {6651, 472, 205, 78, -1118, -2386, 361, 1518, -2554, -242, -551, 779,
+         775, -631, 831, -50, -855, -8, 982, -89, 42, -65, 37, -53, 31, -39, 22,
+         -22, 10, -8, 3, -1},
+        {8020, 464, 53, -55, -1620, -2992, 760, 1460, -3270, 132, -827, 1315,
+         553, -620, 999, -179, -1078, 220, 1102, -173, 50, -92, 31, -68, 26,
+         -48, 18, -26, 9, -9, 2, -1},
+        {9223, 455, -112, -279, -2069, -3533, 1550, 691, -3597, 703, -1162,
+         2079, -120, -309, 994, -362, -1253, 689, 990, -225, 33, -88, 0, -54,
+         -2, -35, -2, -17, 0, -6, 0, -1},
+        {10277, 279, -258, -646, -2376, -3851, 2653, -1192, -2689, 799, -1035,
+         2578, -1000, 276, 748, -619, -1185, 1273, 585, -177, -32, -42, -56,
+         -13, -51, -1, -33, 3, -15, 2, -4, 0},
+        {10956, -26, -279, -819, -3167, -3088, 3014, -3323, -632, 21, 84, 2046,
+         -1490, 853, 392, -1003, -624, 1568, 88, -70, -93, -6, -89, 9, -72, 13,
+         -46, 10, -21, 5, -5, 1},
+        {11010, -239, -117, -907, -4280, -1000, 1496, -3929, 1145, -806, 1626,
+         451, -1150, 1115, -58, -1266, 323, 1302, -222, 12, -115, -1, -81, -1,
+         -58, 2, -34, 2, -15, 1, -3, 0},
+        {10312, 26, -216, -729, -2947, -2890, 2839, -3113, -596, 16, 75, 1923,
+         -1396, 802, 372, -940, -588, 1473, 88, -61, -84, -2, -81, 11, -66, 14,
+         -42, 10, -19, 4, -4, 1},
+        {9085, 344, -136, -489, -2031, -3364, 2347, -1027, -2364, 692, -920,
+         2264, -872, 245, 665, -537, -1044, 1117, 522, -147, -21, -30, -44, -7,
+         -41, 2, -27, 4, -13, 2, -3, 0},
+        {7621, 518, 44, -107, -1602, -2853, 1287, 600, -2935, 559, -969, 1692,
+         -91, -249, 822, -283, -1027, 558, 818, -170, 38, -62, 8, -38, 4, -24,
+         2, -12, 2, -4, 0, 0},
+        {6148, 547, 222, 123, -1096, -2200, 595, 1149, -2446, 79, -651, 973,
+         424, -462, 762, -116, -812, 156, 839, -112, 53, -57, 35, -42, 27, -30,
+         18, -16, 9, -6, 2, -1},
+        {4680, 575, 373, 264, -601, -1557, 274, 1100, -1714, -191, -415, 505,
+         536, -424, 579, -10, -582, -19, 679, -37, 49, -28, 39, -24, 31, -19,
+         20, -11, 9, -4, 2, 0}
+    },
+    /* Elevation 15 */
+    {
+        {3449, 639, 400, 267, -527, -871, 842, -225, -819, 171, -331, 759, -314,
+         142, 280, -185, -349, 382, 213, -3, 33, 23, 13, 21, 6, 16, 2, 9, 0, 3,
+         0, 0},
+        {2288, 699, 561, 409, -181, -470, 602, -120, -484, 68, -210, 463, -194,
+         111, 196, -102, -219, 243, 147, 29, 42, 35, 23, 28, 16, 20, 7, 10, 3,
+         3, 0, 0},
+        {1497, 745, 642, 499, 75, -183, 418, -72, -227, -12, -116, 260, -104,
+         89, 130, -47, -121, 150, 100, 51, 47, 43, 31, 33, 21, 22, 11, 11, 4, 3,
+         1, 0},
+        {1112, 775, 678, 543, 183, -32, 319, -62, -103, -52, -51, 162, -53, 79,
+         98, -27, -67, 109, 81, 61, 50, 47, 35, 35, 24, 23, 13, 11, 5, 3, 1, 0},
+        {1089, 768, 691, 541, 138, 26, 295, -131, -47, -73, 24, 132, -51, 97,
+         84, -47, -35, 118, 71, 64, 49, 47, 35, 34, 24, 22, 13, 11, 5, 3, 1, 0},
+        {1268, 741, 687, 499, -5, 101, 237, -242, 21, -93, 141, 84, -53, 133,
+         59, -90, 18, 140, 59, 64, 46, 45, 33, 33, 23, 21, 13, 10, 5, 3, 1, 0},
+        {1212, 753, 684, 482, -30, 218, 67, -199, 46, -63, 208, 10, 0, 126, 28,
+         -87, 76, 118, 60, 61, 48, 43, 35, 30, 25, 19, 14, 9, 6, 3, 1, 0},
+        {1068, 766, 700, 534, 84, 111, 220, -172, 0, -80, 107, 84, -32, 110, 64,
+         -65, 8, 119, 65, 65, 49, 46, 35, 33, 25, 21, 14, 10, 5, 3, 1, 0},
+        {1211, 754, 682, 521, 89, 4, 321, -175, -45, -77, 34, 146, -69, 111, 85,
+         -62, -37, 135, 69, 63, 47, 46, 33, 34, 23, 22, 12, 11, 5, 3, 1, 0},
+        {1754, 712, 620, 447, -42, -206, 484, -251, -161, -39, -46, 285, -151,
+         136, 119, -93, -104, 202, 83, 52, 41, 43, 27, 33, 18, 22, 9, 11, 3, 4,
+         1, 0},
+        {2667, 653, 532, 336, -323, -557, 728, -326, -453, 57, -168, 533, -273,
+         170, 194, -156, -225, 317, 132, 28, 34, 35, 17, 29, 10, 20, 4, 10, 1,
+         4, 0, 0},
+        {3879, 595, 405, 203, -720, -1011, 1005, -370, -892, 193, -325, 860,
+         -403, 194, 306, -239, -387, 458, 216, -10, 27, 21, 6, 21, 3, 16, -2, 9,
+         -1, 3, -1, 0},
+        {5322, 525, 186, 33, -1135, -1515, 1285, -471, -1326, 326, -487, 1234,
+         -539, 220, 414, -336, -553, 625, 305, -50, 16, 5, -5, 12, -9, 12, -8,
+         7, -4, 3, -1, 0},
+        {6779, 406, 119, -174, -1704, -1997, 1740, -825, -1637, 422, -534, 1582,
+         -782, 345, 506, -490, -693, 850, 342, -80, 0, -5, -26, 7, -21, 10, -18,
+         7, -7, 3, -2, 0},
+        {8245, 227, 2, -439, -2227, -2341, 2203, -1533, -1532, 387, -417, 1830,
+         -1078, 553, 500, -675, -723, 1110, 283, -86, -30, -7, -47, 8, -40, 12,
+         -28, 9, -12, 4, -3, 0},
+        {9558, -7, -112, -707, -2793, -2326, 2482, -2528, -891, 120, 10, 1779,
+         -1337, 827, 378, -900, -557, 1334, 120, -61, -66, -1, -70, 12, -56, 14,
+         -37, 10, -17, 4, -4, 1},
+        {10466, -237, -35, -952, -3590, -1673, 2263, -3448, 91, -332, 838, 1195,
+         -1402, 1120, 152, -1151, -145, 1406, -86, -16, -99, 3, -83, 11, -63,
+         11, -40, 9, -17, 4, -4, 0},
+        {10903, -363, 40, -1180, -4320, -418, 1090, -3629, 1014, -706, 1767,
+         116, -1052, 1231, -173, -1284, 475, 1196, -233, 16, -110, -6, -76, -2,
+         -53, -2, -31, 2, -13, 0, -3, 0},
+        {10838, -322, -48, -1368, -4573, 939, -972, -2569, 1339, -598, 2237,
+         -1037, -331, 1016, -508, -1140, 1088, 711, -227, -6, -79, -34, -43,
+         -33, -25, -24, -12, -13, -4, -4, -1, 0},
+        {10274, -291, 83, -1071, -4038, -384, 1035, -3408, 950, -666, 1661, 113,
+         -986, 1160, -158, -1206, 446, 1127, -214, 19, -99, -2, -69, 0, -48, -1,
+         -28, 2, -12, 1, -3, 0},
+        {9273, -110, 58, -763, -3116, -1456, 2013, -3026, 74, -300, 734, 1060,
+         -1230, 990, 143, -1011, -131, 1242, -67, -6, -81, 9, -68, 14, -52, 13,
+         -33, 9, -15, 4, -3, 0},
+        {7929, 142, 41, -466, -2219, -1883, 2065, -2053, -738, 87, -2, 1467,
+         -1090, 683, 324, -731, -462, 1097, 113, -38, -44, 8, -49, 16, -41, 16,
+         -28, 10, -12, 4, -3, 0},
+        {6360, 371, 181, -177, -1584, -1738, 1705, -1125, -1167, 275, -333,
+         1391, -806, 423, 397, -500, -555, 842, 232, -47, -8, 7, -25, 15, -23,
+         14, -17, 9, -8, 4, -2, 0},
+        {4817, 533, 312, 81, -1039, -1330, 1243, -517, -1133, 267, -392, 1094,
+         -526, 243, 371, -320, -486, 585, 257, -33, 19, 12, -4, 16, -5, 14, -7,
+         8, -3, 3, -1, 0}
+    },
+    /* Elevation 30 */
+    {
+        {3724, 425, 489, 11, -970, -84, 508, -1040, 194, -220, 475, 164, -333,
+         418, 11, -378, 96, 416, -7, 50, 6, 34, 5, 25, 3, 17, 1, 9, 0, 3, 0, 0},
+        {2613, 565, 576, 217, -528, 14, 370, -666, 120, -163, 327, 118, -201,
+         290, 30, -245, 66, 287, 22, 57, 24, 39, 18, 28, 12, 18, 6, 9, 2, 3, 0,
+         0},
+        {1793, 670, 637, 366, -209, 101, 249, -391, 71, -119, 229, 74, -98, 195,
+         39, -149, 52, 190, 44, 61, 38, 42, 28, 30, 19, 20, 11, 10, 4, 3, 1, 0},
+        {1306, 735, 673, 453, -26, 157, 167, -231, 39, -84, 178, 50, -35, 140,
+         43, -94, 48, 135, 57, 63, 46, 44, 33, 32, 23, 20, 13, 10, 5, 3, 1, 0},
+        {1113, 763, 685, 481, 37, 196, 102, -165, 26, -58, 172, 32, -3, 120, 37,
+         -73, 57, 113, 63, 63, 49, 44, 36, 31, 25, 20, 14, 10, 6, 3, 1, 0},
+        {1079, 770, 684, 471, 36, 237, 21, -134, 24, -26, 191, 6, 21, 114, 22,
+         -66, 81, 103, 66, 61, 50, 43, 37, 30, 26, 19, 15, 9, 6, 3, 1, 0},
+        {1075, 773, 681, 447, 36, 270, -81, -86, 12, 27, 199, -18, 47, 107, 1,
+         -53, 106, 92, 68, 58, 52, 41, 38, 29, 27, 18, 15, 9, 6, 3, 1, 0},
+        {1146, 762, 679, 456, 7, 244, 9, -145, 31, -28, 204, -3, 21, 119, 17,
+         -73, 89, 106, 64, 60, 50, 42, 37, 30, 26, 19, 15, 9, 6, 3, 1, 0},
+        {1429, 721, 661, 415, -100, 215, 78, -245, 65, -76, 236, 2, -17, 151,
+         20, -108, 88, 134, 54, 61, 45, 42, 33, 30, 24, 19, 13, 9, 5, 3, 1, 0},
+        {2030, 641, 618, 309, -334, 161, 171, -449, 121, -130, 313, 18, -90,
+         219, 13, -178, 100, 199, 35, 59, 35, 40, 26, 28, 18, 18, 10, 9, 4, 3,
+         1, 0},
+        {2957, 521, 549, 142, -693, 59, 322, -769, 184, -189, 422, 68, -210,
+         328, 4, -288, 113, 309, 9, 55, 19, 36, 15, 26, 10, 17, 5, 8, 2, 3, 0,
+         0},
+        {4144, 371, 459, -73, -1154, -80, 516, -1178, 245, -248, 559, 146, -367,
+         467, -6, -430, 128, 456, -21, 48, 0, 31, 0, 23, 0, 15, -1, 8, -1, 3, 0,
+         0},
+        {5492, 202, 353, -321, -1687, -209, 694, -1634, 328, -316, 733, 213,
+         -532, 624, -26, -590, 159, 615, -56, 41, -22, 25, -15, 19, -12, 13, -8,
+         7, -4, 3, -1, 0},
+        {6875, 26, 250, -589, -2271, -249, 775, -2091, 467, -400, 972, 198,
+         -665, 784, -70, -758, 237, 757, -99, 34, -44, 18, -31, 14, -22, 10,
+         -14, 6, -6, 2, -1, 0},
+        {8169, -140, 149, -859, -2860, -131, 650, -2463, 683, -502, 1285, 43,
+         -715, 922, -152, -911, 387, 843, -147, 29, -63, 9, -42, 6, -30, 5, -17,
+         3, -8, 1, -2, 0},
+        {9240, -270, 58, -1117, -3405, 193, 217, -2623, 934, -579, 1641, -292,
+         -636, 1006, -280, -1019, 618, 836, -189, 22, -74, -3, -46, -5, -31, -4,
+         -17, -1, -7, 0, -2, 0},
+        {9975, -337, -26, -1349, -3820, 691, -581, -2414, 1111, -547, 1940,
+         -773, -399, 995, -443, -1040, 907, 709, -204, 7, -72, -20, -41, -21,
+         -25, -15, -13, -8, -5, -3, -1, 0},
+        {10293, -323, -102, -1549, -3990, 1226, -1686, -1720, 1068, -288, 2019,
+         -1275, -36, 866, -622, -927, 1184, 470, -173, -22, -53, -44, -25, -40,
+         -11, -29, -4, -16, 0, -6, 0, -1},
+        {10168, -252, -137, -1733, -3789, 1560, -2862, -572, 703, 285, 1702,
+         -1594, 345, 639, -792, -642, 1345, 175, -98, -62, -22, -67, -3, -57, 4,
+         -42, 6, -23, 4, -8, 1, -1},
+        {9732, -257, -54, -1425, -3745, 1166, -1582, -1623, 1005, -272, 1908,
+         -1197, -32, 820, -583, -874, 1117, 447, -158, -17, -47, -38, -21, -36,
+         -9, -26, -3, -14, 0, -5, 0, 0},
+        {8901, -205, 61, -1127, -3353, 631, -499, -2142, 980, -488, 1726, -676,
+         -351, 889, -385, -923, 804, 637, -172, 14, -58, -13, -31, -14, -19,
+         -11, -10, -6, -3, -2, -1, 0},
+        {7758, -84, 174, -824, -2774, 187, 208, -2177, 767, -487, 1368, -229,
+         -523, 844, -220, -847, 512, 705, -143, 30, -52, 6, -31, 2, -21, 1, -12,
+         1, -5, 0, -1, 0},
+        {6423, 81, 283, -523, -2134, -67, 540, -1895, 516, -397, 996, 51, -546,
+         723, -100, -703, 295, 664, -95, 38, -36, 18, -23, 13, -16, 9, -10, 5,
+         -4, 2, -1, 0},
+        {5032, 259, 391, -241, -1517, -135, 600, -1475, 317, -298, 693, 163,
+         -464, 570, -27, -537, 163, 554, -47, 44, -14, 27, -10, 20, -7, 13, -5,
+         7, -2, 2, -1, 0}
+    },
+    /* Elevation 45 */
+    {
+        {3865, 439, 410, -291, -1026, 641, -970, -154, 183, 158, 614, -503, 160,
+         260, -259, -203, 486, 101, 22, 20, 30, 7, 26, 2, 21, 0, 13, -1, 6, -1,
+         1, 0},
+        {2932, 549, 499, -55, -662, 518, -690, -112, 118, 128, 468, -343, 128,
+         206, -176, -146, 362, 94, 39, 32, 38, 18, 30, 11, 23, 6, 14, 2, 6, 0,
+         1, 0},
+        {2199, 635, 569, 125, -372, 422, -486, -65, 63, 117, 348, -219, 106,
+         162, -114, -97, 266, 87, 52, 41, 44, 27, 34, 18, 25, 10, 14, 5, 6, 1,
+         1, 0},
+        {1699, 694, 617, 244, -171, 355, -355, -29, 23, 117, 265, -134, 92, 131,
+         -75, -61, 202, 81, 62, 48, 48, 32, 36, 22, 26, 14, 15, 6, 6, 2, 1, 0},
+        {1419, 726, 644, 304, -52, 313, -292, -2, -2, 131, 214, -85, 86, 113,
+         -57, -36, 168, 78, 67, 51, 50, 36, 37, 25, 26, 16, 15, 7, 6, 2, 1, 0},
+        {1310, 733, 658, 313, 11, 285, -288, 28, -20, 161, 181, -62, 87, 103,
+         -57, -15, 155, 75, 69, 53, 50, 37, 37, 27, 26, 17, 15, 8, 6, 2, 1, 0},
+        {1335, 716, 668, 274, 45, 254, -328, 70, -37, 215, 148, -55, 94, 97,
+         -72, 11, 156, 71, 68, 53, 49, 38, 35, 27, 25, 17, 14, 8, 6, 2, 1, 0},
+        {1491, 710, 643, 259, -47, 304, -361, 48, -21, 186, 191, -92, 98, 109,
+         -77, -15, 178, 71, 67, 50, 49, 35, 36, 25, 26, 15, 15, 7, 6, 2, 1, 0},
+        {1838, 674, 606, 186, -199, 365, -453, 26, 6, 174, 254, -158, 110, 129,
+         -100, -46, 224, 72, 62, 44, 47, 30, 35, 21, 25, 13, 15, 6, 6, 2, 1, 0},
+        {2415, 609, 549, 52, -435, 449, -610, -12, 51, 172, 352, -260, 129, 163,
+         -146, -89, 299, 76, 52, 37, 43, 23, 33, 15, 24, 9, 14, 4, 6, 1, 1, 0},
+        {3220, 515, 471, -142, -759, 559, -827, -71, 116, 175, 489, -398, 151,
+         213, -211, -147, 405, 86, 36, 27, 37, 14, 29, 8, 22, 4, 14, 1, 6, 0, 1,
+         0},
+        {4209, 399, 376, -384, -1154, 689, -1099, -143, 196, 187, 656, -565,
+         179, 275, -294, -215, 535, 98, 17, 14, 28, 3, 25, -1, 20, -3, 13, -2,
+         6, -1, 1, 0},
+        {5304, 270, 271, -659, -1584, 833, -1424, -198, 273, 219, 830, -752,
+         215, 340, -391, -283, 681, 107, -3, 0, 19, -10, 20, -11, 17, -10, 11,
+         -6, 5, -2, 1, 0},
+        {6414, 141, 164, -951, -2004, 983, -1804, -198, 329, 288, 981, -948,
+         267, 395, -498, -335, 833, 104, -19, -16, 11, -24, 15, -22, 15, -17,
+         11, -10, 5, -4, 1, 0},
+        {7436, 23, 65, -1242, -2362, 1122, -2236, -99, 339, 413, 1074, -1137,
+         337, 428, -611, -352, 977, 82, -29, -34, 6, -38, 12, -33, 13, -25, 10,
+         -14, 5, -5, 1, -1},
+        {8277, -75, -12, -1518, -2604, 1220, -2698, 126, 282, 614, 1068, -1292,
+         422, 430, -725, -317, 1095, 38, -30, -52, 3, -50, 10, -42, 12, -31, 10,
+         -17, 5, -6, 1, -1},
+        {8863, -157, -49, -1773, -2673, 1233, -3138, 478, 147, 898, 928, -1378,
+         507, 399, -834, -216, 1163, -23, -22, -68, 2, -59, 8, -48, 11, -35, 9,
+         -19, 5, -7, 1, -1},
+        {9147, -236, -19, -2009, -2519, 1095, -3469, 914, -56, 1253, 636, -1357,
+         569, 342, -929, -42, 1156, -84, -12, -75, -1, -59, 4, -47, 6, -33, 6,
+         -18, 4, -6, 1, -1},
+        {9119, -342, 111, -2245, -2097, 732, -3565, 1335, -275, 1629, 205,
+         -1203, 581, 268, -998, 195, 1054, -124, -8, -67, -11, -47, -7, -35, -4,
+         -24, -1, -12, 0, -4, 0, 0},
+        {8701, -181, 20, -1877, -2375, 1049, -3288, 864, -54, 1191, 610, -1283,
+         541, 329, -879, -41, 1099, -75, -8, -67, 2, -54, 6, -43, 7, -30, 7,
+         -16, 4, -6, 1, -1},
+        {8013, -56, 30, -1536, -2374, 1128, -2813, 423, 130, 810, 847, -1230,
+         460, 367, -745, -195, 1050, -11, -12, -54, 7, -48, 12, -40, 12, -29,
+         10, -16, 5, -6, 1, -1},
+        {7102, 62, 100, -1203, -2169, 1066, -2279, 98, 236, 525, 924, -1085,
+         363, 376, -609, -271, 936, 46, -14, -35, 11, -35, 15, -31, 15, -23, 11,
+         -13, 6, -5, 1, 0},
+        {6043, 186, 199, -878, -1833, 936, -1771, -90, 266, 335, 881, -893, 276,
+         357, -479, -284, 788, 83, -8, -14, 16, -21, 18, -20, 16, -15, 11, -9,
+         6, -3, 1, 0},
+        {4932, 314, 307, -570, -1432, 785, -1330, -161, 239, 220, 763, -691,
+         208, 314, -361, -255, 633, 100, 5, 4, 23, -6, 22, -8, 18, -7, 12, -5,
+         6, -2, 1, 0}
+    },
+    /* Elevation 60 */
+    {
+        {4136, 99, 687, -1066, 158, -682, -988, 657, -55, 1033, -409, -166, 242,
+         -1, -405, 419, 260, 4, 25, 30, 8, 27, 2, 23, -1, 16, -2, 9, -2, 3, 0,
+         0},
+        {3442, 234, 694, -768, 191, -526, -804, 520, -39, 861, -304, -122, 207,
+         11, -326, 344, 225, 21, 35, 37, 17, 31, 9, 25, 4, 17, 1, 9, 0, 3, 0,
+         0},
+        {2868, 345, 700, -524, 224, -410, -645, 404, -22, 719, -221, -82, 178,
+         19, -259, 284, 195, 35, 42, 42, 24, 34, 15, 27, 9, 18, 4, 9, 1, 3, 0,
+         0},
+        {2442, 426, 705, -344, 254, -332, -521, 317, -6, 615, -162, -51, 156,
+         24, -209, 242, 171, 46, 48, 47, 29, 37, 19, 28, 12, 19, 6, 10, 2, 3, 0,
+         0},
+        {2170, 477, 708, -230, 278, -295, -436, 259, 10, 549, -128, -30, 142,
+         24, -176, 217, 154, 53, 51, 49, 32, 38, 22, 29, 14, 19, 7, 10, 2, 3, 0,
+         0},
+        {2047, 498, 709, -182, 300, -300, -384, 229, 26, 520, -118, -15, 135,
+         20, -159, 211, 144, 56, 52, 51, 34, 39, 23, 29, 15, 20, 8, 10, 3, 3, 0,
+         0},
+        {2068, 491, 708, -195, 321, -354, -358, 222, 47, 524, -134, -7, 134, 11,
+         -155, 223, 138, 57, 51, 51, 33, 39, 22, 30, 14, 20, 7, 10, 3, 3, 0, 0},
+        {2240, 459, 708, -267, 298, -359, -424, 264, 27, 567, -152, -24, 144,
+         15, -179, 234, 151, 52, 50, 49, 31, 38, 21, 29, 13, 19, 7, 10, 2, 3, 0,
+         0},
+        {2565, 398, 706, -403, 271, -405, -525, 333, 7, 646, -195, -50, 160, 14,
+         -219, 264, 170, 44, 46, 46, 27, 36, 17, 28, 11, 19, 5, 10, 2, 3, 0, 0},
+        {3043, 307, 701, -605, 237, -488, -665, 432, -13, 763, -260, -85, 185,
+         10, -275, 311, 197, 31, 39, 41, 21, 34, 13, 26, 7, 18, 3, 9, 1, 3, 0,
+         0},
+        {3661, 189, 694, -867, 197, -605, -842, 558, -35, 916, -347, -129, 217,
+         3, -348, 374, 231, 16, 31, 35, 14, 30, 6, 24, 2, 17, 0, 9, -1, 3, 0,
+         0},
+        {4387, 49, 686, -1176, 154, -751, -1045, 705, -57, 1096, -452, -179,
+         254, -8, -432, 449, 270, -2, 22, 27, 4, 26, -1, 22, -3, 16, -3, 9, -2,
+         3, -1, 0},
+        {5172, -103, 678, -1513, 116, -926, -1255, 860, -75, 1291, -570, -230,
+         294, -21, -522, 534, 310, -21, 11, 20, -6, 22, -9, 19, -9, 15, -7, 8,
+         -4, 3, -1, 0},
+        {5956, -257, 672, -1854, 92, -1125, -1446, 1012, -86, 1485, -696, -276,
+         332, -39, -609, 624, 345, -40, 0, 12, -16, 18, -17, 17, -16, 14, -11,
+         8, -5, 3, -1, 0},
+        {6673, -402, 670, -2173, 91, -1346, -1594, 1143, -84, 1662, -825, -308,
+         366, -61, -684, 714, 370, -56, -10, 6, -26, 14, -25, 15, -22, 13, -14,
+         8, -7, 3, -2, 0},
+        {7261, -526, 673, -2442, 118, -1582, -1676, 1240, -63, 1805, -948, -323,
+         390, -89, -739, 798, 380, -68, -20, 1, -34, 12, -32, 14, -27, 13, -18,
+         8, -8, 3, -2, 0},
+        {7667, -616, 679, -2637, 174, -1821, -1676, 1290, -22, 1899, -1057,
+         -316, 403, -120, -767, 869, 373, -75, -27, -1, -41, 11, -37, 14, -31,
+         13, -20, 8, -9, 3, -2, 0},
+        {7853, -663, 685, -2736, 251, -2045, -1587, 1286, 41, 1930, -1141, -289,
+         403, -153, -763, 921, 348, -75, -33, -1, -45, 11, -40, 14, -33, 13,
+         -22, 8, -10, 3, -2, 0},
+        {7801, -660, 689, -2726, 338, -2233, -1418, 1225, 125, 1894, -1190,
+         -243, 389, -187, -727, 947, 308, -68, -35, 1, -46, 12, -41, 15, -33,
+         14, -22, 9, -10, 4, -2, 0},
+        {7545, -601, 687, -2600, 254, -1952, -1523, 1230, 40, 1855, -1087, -274,
+         389, -144, -731, 883, 337, -68, -28, 2, -40, 12, -37, 15, -30, 13, -20,
+         9, -9, 3, -2, 0},
+        {7077, -499, 682, -2379, 185, -1657, -1543, 1180, -19, 1754, -958, -286,
+         375, -104, -704, 799, 349, -61, -19, 4, -33, 14, -31, 15, -26, 13, -17,
+         8, -8, 3, -2, 0},
+        {6443, -364, 679, -2086, 142, -1370, -1480, 1083, -54, 1603, -815, -277,
+         350, -69, -649, 704, 344, -49, -8, 9, -23, 16, -23, 16, -20, 14, -14,
+         8, -7, 3, -2, 0},
+        {5698, -211, 678, -1750, 125, -1106, -1351, 954, -68, 1421, -670, -250,
+         317, -41, -575, 604, 325, -33, 3, 15, -13, 19, -15, 18, -14, 14, -10,
+         8, -5, 3, -1, 0},
+        {4907, -53, 681, -1401, 133, -875, -1178, 806, -67, 1225, -533, -211,
+         280, -18, -491, 507, 295, -15, 15, 22, -2, 23, -6, 20, -7, 15, -6, 9,
+         -3, 3, -1, 0}
+    },
+    /* Elevation 75 */
+    {
+        {4015, 273, 335, -465, 75, -2216, 522, 12, 1140, 347, -602, 117, 73,
+         -341, 115, 535, -30, 59, -2, 37, 1, 26, 0, 19, 0, 13, -1, 7, -1, 2, 0,
+         0},
+        {3673, 320, 367, -371, 102, -1999, 462, 8, 1041, 335, -530, 113, 73,
+         -305, 105, 491, -17, 62, 6, 40, 6, 28, 4, 21, 2, 14, 1, 7, 0, 2, 0, 0},
+        {3379, 362, 394, -288, 124, -1812, 411, 3, 957, 323, -468, 109, 73,
+         -275, 97, 453, -6, 64, 12, 42, 10, 30, 7, 22, 4, 14, 2, 7, 1, 2, 0, 0},
+        {3149, 395, 414, -223, 140, -1667, 373, 0, 893, 313, -420, 106, 73,
+         -252, 91, 423, 2, 66, 17, 43, 14, 31, 10, 23, 6, 15, 3, 7, 1, 2, 0, 0},
+        {2995, 417, 426, -177, 149, -1571, 348, -4, 852, 305, -386, 104, 72,
+         -237, 88, 402, 8, 67, 20, 45, 16, 32, 11, 23, 8, 15, 4, 8, 1, 2, 0, 0},
+        {2922, 428, 431, -152, 150, -1526, 338, -6, 836, 299, -370, 103, 72,
+         -230, 88, 392, 10, 68, 22, 45, 17, 32, 12, 23, 8, 15, 4, 8, 1, 2, 0,
+         0},
+        {2934, 428, 427, -149, 142, -1536, 345, -8, 845, 294, -371, 103, 70,
+         -232, 92, 393, 9, 68, 21, 45, 17, 32, 12, 23, 8, 15, 4, 8, 1, 2, 0, 0},
+        {3035, 413, 420, -182, 140, -1598, 359, -5, 869, 302, -394, 105, 71,
+         -242, 92, 407, 6, 67, 19, 44, 15, 31, 11, 23, 7, 15, 4, 8, 1, 2, 0, 0},
+        {3216, 386, 405, -236, 130, -1711, 388, -1, 917, 312, -432, 107, 72,
+         -260, 95, 431, -1, 66, 15, 43, 13, 31, 9, 22, 6, 15, 3, 7, 1, 2, 0, 0},
+        {3469, 350, 384, -310, 113, -1871, 430, 3, 987, 323, -486, 110, 73,
+         -285, 101, 464, -10, 64, 10, 41, 9, 29, 6, 21, 4, 14, 2, 7, 0, 2, 0,
+         0},
+        {3781, 306, 356, -398, 91, -2069, 483, 8, 1075, 336, -552, 114, 73,
+         -317, 109, 505, -21, 61, 3, 39, 4, 28, 3, 20, 1, 14, 0, 7, 0, 2, 0, 0},
+        {4135, 256, 324, -498, 64, -2293, 544, 14, 1176, 350, -627, 119, 73,
+         -353, 119, 551, -35, 58, -4, 36, -1, 26, -1, 19, -1, 13, -1, 7, -1, 2,
+         0, 0},
+        {4506, 204, 289, -600, 34, -2529, 610, 19, 1283, 363, -705, 123, 73,
+         -392, 131, 599, -49, 55, -12, 33, -7, 24, -5, 18, -4, 12, -3, 6, -2, 2,
+         0, 0},
+        {4869, 154, 255, -699, 3, -2760, 675, 23, 1390, 374, -780, 128, 72,
+         -430, 142, 645, -63, 52, -20, 31, -12, 22, -9, 16, -7, 11, -5, 6, -2,
+         2, -1, 0},
+        {5196, 109, 223, -785, -28, -2969, 735, 26, 1488, 382, -848, 132, 71,
+         -464, 154, 687, -76, 50, -27, 28, -17, 20, -13, 15, -10, 10, -6, 6, -3,
+         2, -1, 0},
+        {5460, 74, 196, -852, -56, -3140, 786, 27, 1571, 386, -902, 136, 70,
+         -492, 166, 720, -86, 48, -33, 26, -21, 18, -15, 14, -12, 10, -7, 5, -3,
+         2, -1, 0},
+        {5641, 52, 175, -893, -81, -3258, 825, 27, 1632, 385, -938, 138, 69,
+         -513, 176, 742, -94, 47, -37, 25, -24, 17, -17, 13, -13, 9, -8, 5, -4,
+         2, -1, 0},
+        {5724, 43, 163, -905, -100, -3314, 847, 24, 1667, 378, -953, 139, 67,
+         -523, 184, 751, -98, 46, -39, 24, -25, 16, -18, 13, -13, 9, -8, 5, -4,
+         2, -1, 0},
+        {5701, 50, 159, -886, -112, -3303, 852, 19, 1672, 367, -945, 138, 64,
+         -522, 190, 746, -99, 46, -38, 24, -24, 16, -18, 12, -13, 9, -8, 5, -4,
+         2, -1, 0},
+        {5586, 62, 176, -868, -87, -3226, 822, 22, 1626, 374, -924, 137, 67,
+         -508, 179, 734, -93, 47, -36, 25, -23, 17, -17, 13, -12, 9, -8, 5, -3,
+         2, -1, 0},
+        {5376, 88, 200, -821, -58, -3089, 777, 24, 1554, 377, -883, 135, 69,
+         -485, 167, 708, -84, 49, -31, 27, -20, 19, -14, 14, -11, 10, -7, 5, -3,
+         2, -1, 0},
+        {5090, 126, 231, -751, -25, -2904, 720, 23, 1463, 374, -825, 131, 71,
+         -454, 154, 673, -72, 51, -25, 29, -15, 20, -11, 15, -9, 11, -6, 6, -3,
+         2, -1, 0},
+        {4750, 171, 265, -663, 10, -2685, 656, 20, 1358, 368, -755, 127, 72,
+         -418, 140, 629, -58, 53, -18, 32, -10, 22, -8, 17, -6, 11, -4, 6, -2,
+         2, -1, 0},
+        {4382, 222, 301, -565, 43, -2450, 588, 17, 1248, 358, -678, 122, 73,
+         -379, 127, 582, -44, 56, -10, 34, -5, 24, -4, 18, -3, 12, -2, 6, -1, 2,
+         0, 0}
+    },
+    /* Elevation 90 */
+    {
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0},
+        {3851, 657, -286, 652, -2035, -880, 418, 344, 1650, -615, -131, -132,
+         -106, -211, 677, 85, 25, 8, 35, -3, 31, -7, 26, -8, 21, -7, 14, -5, 6,
+         -2, 2, 0}
+    }
+};
+
+const uint16_t ae_hrtf_default_delays[AE_HRTF_DEFAULT_EL]
+                                     [AE_HRTF_DEFAULT_AZ] = {
+    {3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135,
+     3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135},
+    {3276, 3478, 3659, 3804, 3905, 3952, 3943, 3877, 3760, 3602, 3413, 3205,
+     2994, 2792, 2613, 2470, 2372, 2326, 2336, 2399, 2513, 2669, 2857, 3064},
+    {3407, 3802, 4160, 4458, 4668, 4769, 4749, 4609, 4367, 4046, 3673, 3271,
+     2863, 2472, 2127, 1851, 1662, 1573, 1591, 1714, 1934, 2236, 2599, 2998},
+    {3521, 4086, 4614, 5071, 5413, 5585, 5549, 5315, 4929, 4444, 3900, 3328,
+     2750, 2198, 1710, 1319, 1052, 927, 952, 1126, 1437, 1863, 2377, 2942},
+    {3608, 4309, 4985, 5607, 6115, 6397, 6337, 5964, 5409, 4764, 4077, 3372,
+     2663, 1987, 1390, 911, 584, 430, 461, 674, 1055, 1578, 2206, 2898},
+    {3663, 4453, 5235, 5996, 6701, 7195, 7076, 6477, 5746, 4975, 4190, 3399,
+     2609, 1855, 1188, 654, 289, 118, 153, 391, 815, 1398, 2099, 2871},
+    {3682, 4502, 5323, 6144, 6964, 7785, 7512, 6691, 5870, 5050, 4229, 3408,
+     2590, 1810, 1120, 567, 189, 12, 48, 294, 733, 1337, 2063, 2861},
+    {3663, 4453, 5235, 5996, 6701, 7195, 7076, 6477, 5746, 4975, 4190, 3399,
+     2609, 1855, 1188, 654, 289, 118, 153, 391, 815, 1398, 2099, 2871},
+    {3608, 4309, 4985, 5607, 6115, 6397, 6337, 5964, 5409, 4764, 4077, 3372,
+     2663, 1987, 1390, 911, 584, 430, 461, 674, 1055, 1578, 2206, 2898},
+    {3521, 4086, 4614, 5071, 5413, 5585, 5549, 5315, 4929, 4444, 3900, 3328,
+     2750, 2198, 1710, 1319, 1052, 927, 952, 1126, 1437, 1863, 2377, 2942},
+    {3407, 3802, 4160, 4458, 4668, 4769, 4749, 4609, 4367, 4046, 3673, 3271,
+     2863, 2472, 2127, 1851, 1662, 1573, 1591, 1714, 1934, 2236, 2599, 2998},
+    {3276, 3478, 3659, 3804, 3905, 3952, 3943, 3877, 3760, 3602, 3413, 3205,
+     2994, 2792, 2613, 2470, 2372, 2326, 2336, 2399, 2513, 2669, 2857, 3064},
+    {3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135,
+     3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135, 3135}
+};
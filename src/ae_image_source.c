@@ -0,0 +1,362 @@
+/**
+ * @file ae_image_source.c
+ * @brief Image-source early reflections for convex (shoebox/polyhedral) rooms
+ */
+
+#include "ae_internal.h"
+
+#define AE_IMAGE_EPS 1e-4f
+
+typedef struct {
+  const ae_room_geometry_t *room;
+  const float *listener;
+  float right[3]; /* Listener's right-hand axis */
+  float reflectance[AE_ROOM_MAX_PLANES]; /* Pressure reflection per wall */
+  float direct_m;
+  float speed;
+  uint32_t max_order;
+  size_t plane_path[AE_IMAGE_SOURCE_MAX_ORDER];
+  float images[AE_IMAGE_SOURCE_MAX_ORDER][3];
+  ae_reflection_t *list; /* Valid reflections found so far */
+  size_t count;
+  size_t capacity;
+  bool failed;
+} ae_image_search_t;
+
+typedef struct {
+  ae_engine_t *engine;
+  ae_room_geometry_t room;
+  ae_image_source_params_t params;
+} ae_image_job_t;
+
+static float ae_dot3(const float *a, const float *b) {
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static float ae_plane_side(const ae_room_plane_t *plane, const float *p) {
+  return ae_dot3(plane->normal, p) - plane->distance;
+}
+
+static bool ae_room_contains(const ae_room_geometry_t *room, const float *p) {
+  for (size_t i = 0; i < room->plane_count; ++i) {
+    if (ae_plane_side(&room->planes[i], p) < -AE_IMAGE_EPS)
+      return false;
+  }
+  return true;
+}
+
+static float ae_plane_absorption(const ae_room_plane_t *plane) {
+  float alpha = plane->absorption < 0.0f ? ae_rock_wall_absorption(1000.0f)
+                                         : plane->absorption;
+  return ae_clamp(alpha, 0.0f, 0.999f);
+}
+
+/**
+ * Check that the path listener -> image really bounces off each wall of the
+ * chain inside the room, walking back from the last reflection.
+ */
+static bool ae_image_path_valid(const ae_image_search_t *search,
+                                size_t order) {
+  const ae_room_geometry_t *room = search->room;
+  float point[3] = {search->listener[0], search->listener[1],
+                    search->listener[2]};
+  for (size_t k = order; k-- > 0;) {
+    const ae_room_plane_t *plane = &room->planes[search->plane_path[k]];
+    const float *image = search->images[k];
+    float dir[3] = {image[0] - point[0], image[1] - point[1],
+                    image[2] - point[2]};
+    float denom = ae_dot3(plane->normal, dir);
+    if (denom >= -AE_IMAGE_EPS)
+      return false;
+    float t = -ae_plane_side(plane, point) / denom;
+    if (t <= 0.0f || t >= 1.0f)
+      return false;
+    for (size_t j = 0; j < 3; ++j)
+      point[j] += t * dir[j];
+    if (!ae_room_contains(room, point))
+      return false;
+  }
+  return true;
+}
+
+static void ae_image_emit(ae_image_search_t *search, size_t order,
+                          float reflectance) {
+  if (search->count == search->capacity) {
+    size_t capacity = search->capacity ? search->capacity * 2 : 256;
+    ae_reflection_t *list = (ae_reflection_t *)realloc(
+        search->list, capacity * sizeof(ae_reflection_t));
+    if (!list) {
+      search->failed = true;
+      return;
+    }
+    search->list = list;
+    search->capacity = capacity;
+  }
+
+  const float *image = search->images[order - 1];
+  float dir[3] = {image[0] - search->listener[0],
+                  image[1] - search->listener[1],
+                  image[2] - search->listener[2]};
+  float dist = sqrtf(ae_dot3(dir, dir));
+  if (dist < search->direct_m)
+    dist = search->direct_m;
+
+  ae_reflection_t *out = &search->list[search->count++];
+  out->delay_ms = 1000.0f * (dist - search->direct_m) / search->speed;
+  out->gain = reflectance * search->direct_m / dist;
+  out->pan = ae_clamp(ae_dot3(dir, search->right) / dist, -1.0f, 1.0f);
+  out->order = (uint32_t)order;
+}
+
+/* Depth-first over wall sequences; no wall is hit twice in a row */
+static void ae_image_search(ae_image_search_t *search, const float *source,
+                            size_t depth, size_t last_plane,
+                            float reflectance) {
+  const ae_room_geometry_t *room = search->room;
+  for (size_t p = 0; p < room->plane_count && !search->failed; ++p) {
+    if (p == last_plane)
+      continue;
+    const ae_room_plane_t *plane = &room->planes[p];
+    /* Only mirror across walls the (image) source is in front of */
+    float side = ae_plane_side(plane, source);
+    if (side <= AE_IMAGE_EPS)
+      continue;
+    float *image = search->images[depth];
+    for (size_t j = 0; j < 3; ++j)
+      image[j] = source[j] - 2.0f * side * plane->normal[j];
+    search->plane_path[depth] = p;
+
+    float gain = reflectance * search->reflectance[p];
+    if (ae_image_path_valid(search, depth + 1))
+      ae_image_emit(search, depth + 1, gain);
+    if (depth + 1 < search->max_order)
+      ae_image_search(search, image, depth + 1, p, gain);
+  }
+}
+
+static int ae_reflection_compare(const void *a, const void *b) {
+  float da = ((const ae_reflection_t *)a)->delay_ms;
+  float db = ((const ae_reflection_t *)b)->delay_ms;
+  return (da > db) - (da < db);
+}
+
+static ae_result_t ae_image_validate(const ae_room_geometry_t *room,
+                                     const ae_image_source_params_t *params) {
+  if (!room || !params)
+    return AE_ERROR_INVALID_PARAM;
+  if (room->plane_count < 4 || room->plane_count > AE_ROOM_MAX_PLANES)
+    return AE_ERROR_INVALID_PARAM;
+  for (size_t i = 0; i < room->plane_count; ++i) {
+    float len = sqrtf(ae_dot3(room->planes[i].normal, room->planes[i].normal));
+    if (fabsf(len - 1.0f) > 1e-3f)
+      return AE_ERROR_INVALID_PARAM;
+  }
+  if (!ae_room_contains(room, params->source) ||
+      !ae_room_contains(room, params->listener))
+    return AE_ERROR_INVALID_PARAM;
+  return AE_OK;
+}
+
+/**
+ * Find all valid image sources up to max_order, sorted by arrival time.
+ * The caller frees *list_out.
+ */
+static ae_result_t ae_image_sources_find(const ae_room_geometry_t *room,
+                                         const ae_image_source_params_t *params,
+                                         ae_reflection_t **list_out,
+                                         size_t *count_out) {
+  ae_result_t result = ae_image_validate(room, params);
+  if (result != AE_OK)
+    return result;
+
+  ae_image_search_t search;
+  memset(&search, 0, sizeof(search));
+  search.room = room;
+  search.listener = params->listener;
+  float yaw = params->listener_yaw_deg * (float)M_PI / 180.0f;
+  search.right[0] = cosf(yaw);
+  search.right[1] = -sinf(yaw);
+  search.right[2] = 0.0f;
+  for (size_t i = 0; i < room->plane_count; ++i)
+    search.reflectance[i] = sqrtf(1.0f - ae_plane_absorption(&room->planes[i]));
+  float dir[3] = {params->source[0] - params->listener[0],
+                  params->source[1] - params->listener[1],
+                  params->source[2] - params->listener[2]};
+  search.direct_m = fmaxf(sqrtf(ae_dot3(dir, dir)), 0.1f);
+  search.speed = 331.3f + 0.606f * params->temperature_c;
+  if (search.speed < 1.0f)
+    search.speed = 1.0f;
+  search.max_order = params->max_order;
+  if (search.max_order < 1)
+    search.max_order = 1;
+  if (search.max_order > AE_IMAGE_SOURCE_MAX_ORDER)
+    search.max_order = AE_IMAGE_SOURCE_MAX_ORDER;
+
+  ae_image_search(&search, params->source, 0, AE_ROOM_MAX_PLANES, 1.0f);
+  if (search.failed) {
+    free(search.list);
+    return AE_ERROR_OUT_OF_MEMORY;
+  }
+  if (search.count > 1)
+    qsort(search.list, search.count, sizeof(ae_reflection_t),
+          ae_reflection_compare);
+  *list_out = search.list;
+  *count_out = search.count;
+  return AE_OK;
+}
+
+/* Earliest reflections that fit the ER buffer, as an engine tap table */
+static void ae_image_build_table(const ae_reflection_t *list, size_t count,
+                                 float sample_rate, size_t max_delay,
+                                 ae_er_table_t *table) {
+  memset(table, 0, sizeof(*table));
+  table->geometric = true;
+  for (size_t i = 0; i < count && table->tap_count < AE_ER_MAX_TAPS; ++i) {
+    size_t delay = (size_t)(list[i].delay_ms * 0.001f * sample_rate + 0.5f);
+    if (delay > max_delay)
+      break;
+    size_t t = table->tap_count++;
+    table->delay_samples[t] = delay;
+    table->gain_l[t] = list[i].gain * 0.5f * (1.0f - list[i].pan);
+    table->gain_r[t] = list[i].gain * 0.5f * (1.0f + list[i].pan);
+  }
+}
+
+static void ae_image_job_run(void *arg) {
+  ae_image_job_t *job = (ae_image_job_t *)arg;
+  ae_engine_t *engine = job->engine;
+  ae_reflection_t *list = NULL;
+  size_t count = 0;
+  if (ae_image_sources_find(&job->room, &job->params, &list, &count) ==
+      AE_OK) {
+    ae_er_table_t table;
+    ae_image_build_table(list, count, engine->reverb.sample_rate,
+                         engine->reverb.early.max_delay, &table);
+    ae_reverb_publish_early(engine, &table);
+  }
+  free(list);
+  free(job);
+}
+
+static void ae_image_job_discard(void *arg) { free(arg); }
+
+/*============================================================================
+ * Public API
+ *============================================================================*/
+
+AE_API ae_result_t ae_room_make_shoebox(float width_m, float depth_m,
+                                        float height_m,
+                                        const float absorption[6],
+                                        ae_room_geometry_t *out) {
+  if (!out || width_m <= 0.0f || depth_m <= 0.0f || height_m <= 0.0f)
+    return AE_ERROR_INVALID_PARAM;
+  static const float normals[6][3] = {{1.0f, 0.0f, 0.0f},  {-1.0f, 0.0f, 0.0f},
+                                      {0.0f, 1.0f, 0.0f},  {0.0f, -1.0f, 0.0f},
+                                      {0.0f, 0.0f, 1.0f},  {0.0f, 0.0f, -1.0f}};
+  float distances[6] = {0.0f, -width_m, 0.0f, -depth_m, 0.0f, -height_m};
+  float areas[6] = {depth_m * height_m, depth_m * height_m,
+                    width_m * height_m, width_m * height_m,
+                    width_m * depth_m,  width_m * depth_m};
+
+  memset(out, 0, sizeof(*out));
+  out->plane_count = 6;
+  out->volume_m3 = width_m * depth_m * height_m;
+  for (size_t i = 0; i < 6; ++i) {
+    ae_room_plane_t *plane = &out->planes[i];
+    memcpy(plane->normal, normals[i], sizeof(plane->normal));
+    plane->distance = distances[i];
+    plane->absorption = absorption ? absorption[i] : -1.0f;
+    plane->area_m2 = areas[i];
+  }
+  return AE_OK;
+}
+
+AE_API float ae_room_eyring_rt60(const ae_room_geometry_t *room) {
+  if (!room || room->plane_count == 0 ||
+      room->plane_count > AE_ROOM_MAX_PLANES)
+    return 0.0f;
+  float surface = 0.0f;
+  float weighted = 0.0f;
+  for (size_t i = 0; i < room->plane_count; ++i) {
+    surface += room->planes[i].area_m2;
+    weighted += room->planes[i].area_m2 *
+                ae_plane_absorption(&room->planes[i]);
+  }
+  if (surface <= 0.0f)
+    return 0.0f;
+  return ae_eyring_rt60(room->volume_m3, surface, weighted / surface);
+}
+
+AE_API ae_result_t ae_compute_image_sources(
+    const ae_room_geometry_t *room, const ae_image_source_params_t *params,
+    ae_reflection_t *out, size_t max_count, size_t *count_out) {
+  if (!count_out || (!out && max_count > 0))
+    return AE_ERROR_INVALID_PARAM;
+  ae_reflection_t *list = NULL;
+  size_t count = 0;
+  ae_result_t result = ae_image_sources_find(room, params, &list, &count);
+  if (result != AE_OK)
+    return result;
+  if (count > max_count)
+    count = max_count;
+  if (count > 0)
+    memcpy(out, list, count * sizeof(ae_reflection_t));
+  free(list);
+  *count_out = count;
+  return AE_OK;
+}
+
+AE_API ae_result_t
+ae_set_room_geometry(ae_engine_t *engine, const ae_room_geometry_t *room,
+                     const ae_image_source_params_t *params) {
+  if (!engine)
+    return AE_ERROR_INVALID_PARAM;
+  ae_result_t result = ae_image_validate(room, params);
+  if (result != AE_OK) {
+    ae_set_error(engine, "Invalid room geometry or source/listener outside");
+    return result;
+  }
+  if (!engine->worker) {
+    engine->worker = ae_worker_create();
+    if (!engine->worker) {
+      ae_set_error(engine, "Failed to start geometry worker thread");
+      return AE_ERROR_OUT_OF_MEMORY;
+    }
+  }
+
+  ae_image_job_t *job = (ae_image_job_t *)calloc(1, sizeof(ae_image_job_t));
+  if (!job) {
+    ae_set_error(engine, "Failed to allocate geometry job");
+    return AE_ERROR_OUT_OF_MEMORY;
+  }
+  job->engine = engine;
+  job->room = *room;
+  job->params = *params;
+
+  if (params->apply_rt60) {
+    float rt60 = ae_room_eyring_rt60(room);
+    if (rt60 > 0.0f)
+      AE_ATOMIC_STORE(&engine->decay_time, ae_clamp(rt60, 0.1f, 30.0f));
+  }
+  ae_worker_post(engine->worker, ae_image_job_run, ae_image_job_discard, job);
+  return AE_OK;
+}
+
+AE_API ae_result_t ae_clear_room_geometry(ae_engine_t *engine) {
+  if (!engine)
+    return AE_ERROR_INVALID_PARAM;
+  /* Let a queued geometry job land first so it cannot override the reset */
+  ae_worker_wait_idle(engine->worker);
+  ae_er_table_t table;
+  memset(&table, 0, sizeof(table));
+  table.geometric = false;
+  ae_reverb_publish_early(engine, &table);
+  return AE_OK;
+}
+
+AE_API ae_result_t ae_wait_room_geometry(ae_engine_t *engine) {
+  if (!engine)
+    return AE_ERROR_INVALID_PARAM;
+  ae_worker_wait_idle(engine->worker);
+  return AE_OK;
+}
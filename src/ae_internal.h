@@ -3,6 +3,7 @@
 
 #include "../include/acoustic_engine.h"
 
+#include <float.h>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -15,23 +16,127 @@
 typedef volatile float ae_atomic_float;
 #define AE_ATOMIC_STORE(ptr, val) (*(ptr) = (val))
 #define AE_ATOMIC_LOAD(ptr) (*(ptr))
+typedef volatile long ae_atomic_int;
+#define AE_ATOMIC_STORE_INT(ptr, val) (*(ptr) = (val))
+#define AE_ATOMIC_LOAD_INT(ptr) (*(ptr))
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define AE_ATOMIC_CAS_INT(ptr, expected, desired)                              \
+  (_InterlockedCompareExchange((ptr), (desired), (expected)) == (expected))
+#else
+#define AE_ATOMIC_CAS_INT(ptr, expected, desired)                              \
+  __sync_bool_compare_and_swap((ptr), (expected), (desired))
+#endif
 #else
 #include <stdatomic.h>
 typedef _Atomic float ae_atomic_float;
 #define AE_ATOMIC_STORE(ptr, val)                                              \
   atomic_store_explicit((ptr), (val), memory_order_relaxed)
 #define AE_ATOMIC_LOAD(ptr) atomic_load_explicit((ptr), memory_order_relaxed)
+/* Handoff flags between threads: release/acquire ordering */
+typedef _Atomic long ae_atomic_int;
+#define AE_ATOMIC_STORE_INT(ptr, val)                                          \
+  atomic_store_explicit((ptr), (val), memory_order_release)
+#define AE_ATOMIC_LOAD_INT(ptr)                                                \
+  atomic_load_explicit((ptr), memory_order_acquire)
+static inline bool ae_atomic_cas_int(ae_atomic_int *ptr, long expected,
+                                     long desired) {
+  return atomic_compare_exchange_strong_explicit(
+      ptr, &expected, desired, memory_order_acq_rel, memory_order_acquire);
+}
+#define AE_ATOMIC_CAS_INT(ptr, expected, desired)                              \
+  ae_atomic_cas_int((ptr), (expected), (desired))
 #endif
 
 #define AE_FDN_CHANNELS 8
 #define AE_ER_TAPS 12
+#define AE_ER_MAX_TAPS 128
+#define AE_ER_TILE 256
+/* Crossfade time when a new ER tap table is installed */
+#define AE_ER_FADE_S 0.015f
+#define AE_HALFBAND_PAIRS 6
+#define AE_HALFBAND_HISTORY 32
+#define AE_VELVET_MIN_TAPS 24
+#define AE_VELVET_MAX_TAPS 96
+/* Doppler line: longest propagation delay (~171 m) and the smoothing time
+ * of the delay it follows */
+#define AE_DOPPLER_MAX_DELAY_S 0.5f
+#define AE_DOPPLER_SMOOTH_S 0.02f
 
 #ifdef AE_USE_LIBMYSOFA
 #include "mysofa.h"
 #endif
 
+/* HRIR filters get this much room for folded-in onset delays */
+#define AE_HRIR_MAX_ONSET_S 0.0025f
+/* Default HRIR length after SOFA preprocessing */
+#define AE_HRIR_MAX_TAPS 256
+
+/* Built-in HRIR set (ae_hrtf_default.c, from tools/gen_default_hrtf.py):
+ * left ear only, the right ear is the mirrored azimuth */
+#define AE_HRTF_DEFAULT_RATE 48000.0f
+#define AE_HRTF_DEFAULT_TAPS 32
+#define AE_HRTF_DEFAULT_STEP_DEG 15.0f
+#define AE_HRTF_DEFAULT_AZ 24 /* Columns over [0, 360) */
+#define AE_HRTF_DEFAULT_EL 13 /* Rows over [-90, 90] */
+#define AE_HRTF_DEFAULT_TAP_SCALE 4096.0f
+#define AE_HRTF_DEFAULT_DELAY_SCALE 256.0f /* Per sample at the table rate */
+extern const int16_t ae_hrtf_default_taps[AE_HRTF_DEFAULT_EL]
+                                         [AE_HRTF_DEFAULT_AZ]
+                                         [AE_HRTF_DEFAULT_TAPS];
+extern const uint16_t ae_hrtf_default_delays[AE_HRTF_DEFAULT_EL]
+                                            [AE_HRTF_DEFAULT_AZ];
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#endif
+
+typedef struct ae_worker ae_worker_t;
+typedef struct ae_mutex ae_mutex_t;
+typedef void (*ae_job_fn)(void *arg);
+
+/* int16 delay storage: +/-8.0 maps onto the full 16-bit range */
+#define AE_DELAY_INT16_SCALE 4096.0f
+
+/* Delay line contents in the engine's configured storage format */
+typedef struct {
+  void *data;
+  ae_delay_storage_t format;
+} ae_delay_buffer_t;
+
+/* Fills one grid point: taps per ear and onset delays in samples */
+typedef bool (*ae_hrir_sample_fn)(void *user, float az_deg, float el_deg,
+                                  float *ir_l, float *ir_r, float *delay_l,
+                                  float *delay_r);
+
+/* HRIR set resampled on a regular az/el grid (ae_hrir_grid.c) */
+typedef struct {
+  size_t taps;     /* Taps per ear */
+  size_t stride;   /* Floats per ear, taps rounded up to 4 */
+  size_t az_count; /* Columns over [0, 360) */
+  size_t el_count; /* Rows over [-90, 90] */
+  float az_step;   /* Degrees */
+  float el_step;
+  float *table;    /* [el][az][ear][stride], 16-byte aligned */
+  float *delays;   /* [el][az][ear], samples */
+  void *storage;   /* Allocation behind table */
+} ae_hrir_grid_t;
+
+/* Real FFT plan with its own work buffer (one user at a time) */
 typedef struct {
-  float *buffer;
+  size_t size;      /* Real transform length (power of two) */
+  size_t half;      /* Complex FFT length */
+  float *twiddle;   /* Complex stage roots, interleaved re/im */
+  float *split;     /* Real split-pass roots, interleaved re/im */
+  uint32_t *bitrev; /* Bit-reversal permutation of the complex FFT */
+  float *work;      /* half complex values, interleaved */
+} ae_fft_t;
+
+typedef struct {
+  ae_delay_buffer_t buffer;
   size_t size;
   size_t delay;
   size_t index;
@@ -41,28 +146,83 @@ typedef struct {
 } ae_fdn_delay_t;
 
 typedef struct {
-  float *buffer;
+  ae_delay_buffer_t buffer;
   size_t size;
   size_t delay;
   size_t index;
   float feedback;
 } ae_allpass_t;
 
+/* Tap table handed from the geometry worker to the audio thread */
 typedef struct {
-  float *buffer;
-  size_t size;
+  size_t tap_count;
+  size_t delay_samples[AE_ER_MAX_TAPS];
+  float gain_l[AE_ER_MAX_TAPS];
+  float gain_r[AE_ER_MAX_TAPS];
+  bool geometric; /* false = return to the room_size tap table */
+} ae_er_table_t;
+
+typedef struct {
+  ae_delay_buffer_t buffer;     /* Diffused input, read by room_size taps */
+  ae_delay_buffer_t dry_buffer; /* Dry input, read by geometric taps */
+  size_t size;      /* max_delay + one processing block */
+  size_t max_delay; /* Longest tap delay in samples */
   size_t index;
   size_t tap_count;
-  size_t delay_samples[AE_ER_TAPS];
-  float gains[AE_ER_TAPS];
-  float pans[AE_ER_TAPS];
+  float room_size; /* Room size the tap table was built for */
+  size_t delay_samples[AE_ER_MAX_TAPS];
+  float gain_l[AE_ER_MAX_TAPS]; /* Tap gain with the pan law applied */
+  float gain_r[AE_ER_MAX_TAPS];
+  bool geometric; /* Taps from room geometry, fed from the dry input */
+  ae_er_table_t fade; /* Replaced taps, faded out over AE_ER_FADE_S */
+  bool fading;
+  float fade_gain; /* Weight of the new taps, 0 -> 1 while fading */
+  float fade_step; /* Per-sample fade increment */
 } ae_early_reflections_t;
 
+/* ae_er_table_t handoff slot states */
+enum {
+  AE_ER_SLOT_FREE = 0, /* Worker may write */
+  AE_ER_SLOT_WRITING,  /* Worker is filling the table */
+  AE_ER_SLOT_READY,    /* Published, not yet picked up */
+  AE_ER_SLOT_READING   /* Audio thread is installing the table */
+};
+
+/* Velvet-noise diffuser: sparse +/-1 FIR read as spans of the raw input */
+typedef struct {
+  ae_delay_buffer_t buffer; /* Pre-delay + 50 ms pulse span + one block */
+  size_t size;
+  size_t index;
+  size_t tap_count;
+  size_t positive_count;             /* Taps below this add, others subtract */
+  size_t offset[AE_VELVET_MAX_TAPS]; /* Pre-delay + pulse position */
+  float norm;                        /* Output gain, one multiply/sample */
+  size_t pre_delay;                  /* Settings the table was built for */
+  float room_size;
+  float diffusion;
+} ae_velvet_t;
+
+/* 2x halfband resampler pair around the decimated late reverb */
+typedef struct {
+  float coeffs[AE_HALFBAND_PAIRS]; /* Odd-offset taps, center tap is 0.5 */
+  float dec_history[AE_HALFBAND_HISTORY];
+  size_t dec_index;
+  float int_history_l[AE_HALFBAND_HISTORY];
+  float int_history_r[AE_HALFBAND_HISTORY];
+  size_t int_index;
+  float pending_l; /* Second output of the last interpolated pair */
+  float pending_r;
+  unsigned phase; /* Input samples consumed mod 2 */
+} ae_halfband_t;
+
 struct ae_reverb {
   ae_fdn_delay_t lines[AE_FDN_CHANNELS];
   ae_allpass_t diffusion[2];
+  ae_velvet_t velvet;
+  ae_diffuser_t diffuser;
   ae_early_reflections_t early;
-  float *pre_delay;
+  ae_halfband_t halfband;
+  ae_delay_buffer_t pre_delay;
   size_t pre_delay_size;
   size_t pre_delay_delay;
   size_t pre_delay_index;
@@ -72,35 +232,74 @@ struct ae_reverb {
   float damping;
   float lfo_phase;
   float sample_rate;
+  ae_reverb_rate_t rate_mode;
+  size_t decimation; /* 1 = full rate, 2 = late reverb at sample_rate / 2 */
+  size_t pending_decimation; /* AUTO: rate to switch to at the next block */
+  float *rate_scratch; /* Two line lengths: a line resampled on a switch */
+  float *diffused;   /* Block scratch: diffused input at full rate */
+  float *late_in;    /* Block scratch: decimated late input */
+  float *late_l;
+  float *late_r;
+  size_t block_size;
+  ae_er_table_t er_pending; /* Geometric tap table awaiting the audio thread */
+  ae_atomic_int er_pending_state;
 };
 
+/**
+ * Recursive filters for up to four channels at once, one per SIMD lane
+ * (ae_iir.c). The channels share one dependency chain, so stereo costs
+ * about what mono does. Lanes past the channel count run on silence.
+ */
+#define AE_IIR_LANES 4
+
+typedef enum {
+  AE_ONEPOLE_LOWPASS,
+  AE_ONEPOLE_HIGHPASS, /* Input minus the lowpass */
+  AE_ONEPOLE_BYPASS    /* Passes the input; the state keeps tracking it */
+} ae_onepole_mode_t;
+
+/* One-pole lowpass per lane; out = wet * lowpass + dry * input */
+typedef struct {
+  float alpha[AE_IIR_LANES];
+  float wet[AE_IIR_LANES];
+  float dry[AE_IIR_LANES];
+  float state[AE_IIR_LANES];
+} ae_onepole4_t;
+
+/* Direct form I biquad per lane, normalized so a0 = 1 */
+typedef struct {
+  float b0[AE_IIR_LANES], b1[AE_IIR_LANES], b2[AE_IIR_LANES];
+  float a1[AE_IIR_LANES], a2[AE_IIR_LANES];
+  float x1[AE_IIR_LANES], x2[AE_IIR_LANES];
+  float y1[AE_IIR_LANES], y2[AE_IIR_LANES];
+} ae_biquad4_t;
+
 struct ae_hrtf {
   bool enabled;
   ae_binaural_params_t params;
   int itd_samples;
   float ild_gain_l;
   float ild_gain_r;
-  float shadow_alpha;
-  float shadow_state_l;
-  float shadow_state_r;
+  ae_onepole4_t shadow; /* Head shadow on the far ear; lanes L, R */
   float *delay_l;
   float *delay_r;
   size_t delay_size;
   size_t delay_index;
-#ifdef AE_USE_LIBMYSOFA
-  struct MYSOFA_EASY *sofa;
-  float *hrir_l;
+  ae_hrtf_db_t *db; /* Installed HRIR set, one reference */
+  float *hrir_l;    /* Current filters, onset delay folded in */
   float *hrir_r;
-  size_t hrir_len;
+  size_t hrir_len;     /* Taps per HRIR in db */
+  size_t filter_len;   /* hrir_len plus onset headroom */
+  size_t max_hrir_len; /* Longest hrir_len the buffers take */
   float delay_l_samples;
   float delay_r_samples;
   float last_azimuth;
   float last_elevation;
-  float *history;
-  size_t history_size;
-  size_t history_index;
-  bool loaded;
-#endif
+  ae_convolver_t *convolver; /* HRIR pair, partitioned */
+  ae_atomic_int loaded;      /* An HRIR set is installed (audio reads) */
+  ae_mutex_t *lock;          /* Control thread vs. loader, never audio */
+  ae_worker_t *loader;       /* Background HRTF loads, created on first use */
+  bool load_posted;          /* Control thread: a load was ever queued */
 };
 
 struct ae_dynamics {
@@ -128,6 +327,59 @@ typedef struct {
   ae_extended_params_t extended_params;
 } ae_preset_entry_t;
 
+/* Four xoshiro128+ streams side by side, one per SIMD lane (ae_rng.c) */
+typedef struct {
+  uint32_t s[4][4]; /* [state word][lane] */
+  float spare[4];   /* Output of the last step not handed out yet */
+  uint32_t spare_count;
+} ae_rng_t;
+
+/**
+ * Doppler propagation delay. The read delay follows distance / c, eased
+ * once per block and read along a straight ramp inside it, so the pitch
+ * is continuous across blocks. Each ring carries a copy of its first three
+ * samples past the end, so four interpolation taps are always contiguous.
+ */
+typedef struct {
+  float *l;
+  float *r;
+  size_t size;      /* Power of two */
+  size_t max_delay; /* Longest read delay, samples */
+  size_t write;     /* Next write position */
+  float delay;    /* Read delay at the next block start, samples */
+  float distance; /* Propagation distance the delay follows, m */
+  float distance_set; /* Engine distance seen last block */
+  bool primed;        /* False until the first block after enabling */
+} ae_doppler_line_t;
+
+/* Tape wow/flutter delay lines and LFO phases, embedded in its owner.
+ * Rings keep a copy of their first three samples past the end. */
+#define AE_WOW_FLUTTER_SIZE 2048
+typedef struct {
+  float l[AE_WOW_FLUTTER_SIZE + 3];
+  float r[AE_WOW_FLUTTER_SIZE + 3];
+  size_t write;
+  float wow_phase;     /* Cycles, [0, 1) */
+  float flutter_phase; /* Cycles, [0, 1) */
+  bool primed;         /* False until the first block after enabling */
+} ae_wow_flutter_t;
+
+/* Precedence delay lines and write position, one per listener */
+typedef struct {
+  ae_delay_buffer_t l;
+  ae_delay_buffer_t r;
+  size_t index;
+} ae_precedence_line_t;
+
+/* A listener past the first: its own binaural stage and output history.
+ * hrtf uses only the per-listener fields; the set is engine->hrtf's. */
+typedef struct {
+  struct ae_hrtf hrtf;
+  ae_precedence_line_t precedence_line;
+  float *scratch_l;
+  float *scratch_r;
+} ae_listener_t;
+
 struct ae_engine {
   ae_config_t config;
   char last_error[256];
@@ -143,33 +395,34 @@ struct ae_engine {
   ae_atomic_float diffusion;
   ae_atomic_float lofi_amount;
   ae_atomic_float modulation;
+  ae_rng_t noise_rng; /* Lofi hiss, config.noise_seed or per engine */
+  ae_atomic_float tape_amount;
+  ae_wow_flutter_t wow_flutter;
 
   ae_doppler_params_t doppler;
-  float doppler_phase;
+  ae_doppler_line_t doppler_line;
   ae_adsr_t envelope;
   ae_env_state_t env_state;
   float env_level;
 
   ae_precedence_t precedence;
-  float *precedence_l;
-  float *precedence_r;
+  ae_precedence_line_t precedence_line;
   size_t precedence_size;
-  size_t precedence_index;
 
   struct ae_reverb reverb;
-  struct ae_hrtf hrtf;
+  struct ae_hrtf hrtf; /* Listener 0 */
+  ae_listener_t *listeners; /* Listeners 1 .. listener_count - 1 */
   struct ae_dynamics dynamics;
 
-  float lp_state_l;
-  float lp_state_r;
-  float hp_state_l;
-  float hp_state_r;
+  ae_onepole4_t brightness_lp; /* Lanes L, R */
+  ae_onepole4_t brightness_hp;
 
   float *scratch_l;
   float *scratch_r;
   float *scratch_mono;
   float *scratch_wet_l;
   float *scratch_wet_r;
+  float *scratch_env; /* Envelope gains: left, then right */
   size_t scratch_size;
 
   float *prev_mag;
@@ -177,6 +430,8 @@ struct ae_engine {
 
   float last_lufs;
   float output_gain;
+
+  ae_worker_t *worker; /* Background jobs, created on first use */
 };
 
 static inline float ae_clamp(float value, float min_val, float max_val) {
@@ -187,6 +442,13 @@ static inline float ae_clamp(float value, float min_val, float max_val) {
   return value;
 }
 
+/* Smoothing factor of an RC one-pole lowpass at cutoff_hz */
+static inline float ae_onepole_alpha(float cutoff_hz, float sample_rate) {
+  float rc = 1.0f / (2.0f * (float)M_PI * cutoff_hz);
+  float dt = 1.0f / sample_rate;
+  return dt / (rc + dt);
+}
+
 static inline float ae_db_to_linear(float db) {
   return powf(10.0f, db / 20.0f);
 }
@@ -203,6 +465,323 @@ static inline void ae_clear_buffer(float *buffer, size_t n) {
     memset(buffer, 0, n * sizeof(float));
 }
 
+/**
+ * The delay lines sit inside feedback loops, where round-to-nearest can hold
+ * a decaying tail at a small constant level forever (a limit cycle): once a
+ * pass through the loop shrinks a sample by less than half a quantization
+ * step, rounding puts the step back. Stores below this many steps truncate
+ * toward zero, which never increases a magnitude, and round to nearest above
+ * it, where truncation's bias would only add error. With the FDN damping in
+ * the loop a 30 s decay already dies at 16 steps; 64 leaves margin.
+ */
+#define AE_DELAY_INT16_TRUNCATE 64.0f
+/* Halves quantize in absolute steps only in the subnormal range; above it
+ * the step is relative and rounding cannot sustain a cycle at g < 0.9995 */
+#define AE_DELAY_HALF_TRUNCATE 6.103515625e-05f /* 2^-14 */
+
+/* IEEE 754 half <-> float, round to nearest even except for subnormals,
+ * which truncate (see AE_DELAY_HALF_TRUNCATE). Out-of-range values
+ * saturate at the largest finite half so a hot feedback loop cannot turn
+ * into infinities. */
+static inline uint16_t ae_float_to_half(float value) {
+#if defined(__F16C__)
+  value = ae_clamp(value, -65504.0f, 65504.0f);
+  if (fabsf(value) < AE_DELAY_HALF_TRUNCATE)
+    return (uint16_t)_cvtss_sh(value, _MM_FROUND_TO_ZERO);
+  return (uint16_t)_cvtss_sh(value, 0);
+#else
+  union {
+    uint32_t u;
+    float f;
+  } v;
+  v.f = value;
+  uint32_t sign = v.u & 0x80000000u;
+  v.u ^= sign;
+  uint16_t half;
+  if (v.u > 0x477fe000u) { /* Beyond 65504 */
+    half = v.u > (255u << 23) ? 0x7e00u : 0x7bffu; /* NaN, or saturate */
+  } else if (v.u < (113u << 23)) {
+    half = (uint16_t)(v.f * 16777216.0f); /* Subnormal: units of 2^-24 */
+  } else {
+    uint32_t mant_odd = (v.u >> 13) & 1u;
+    v.u += ((uint32_t)(15 - 127) << 23) + 0xfffu + mant_odd;
+    half = (uint16_t)(v.u >> 13);
+  }
+  return (uint16_t)(half | (sign >> 16));
+#endif
+}
+
+static inline float ae_half_to_float(uint16_t half) {
+#if defined(__F16C__)
+  return _cvtsh_ss(half);
+#else
+  union {
+    uint32_t u;
+    float f;
+  } v, magic;
+  magic.u = 113u << 23;
+  v.u = (uint32_t)(half & 0x7fffu) << 13;
+  uint32_t exp = v.u & (0x7c00u << 13);
+  v.u += (127u - 15u) << 23;
+  if (exp == (0x7c00u << 13)) {
+    v.u += (128u - 16u) << 23; /* Inf/NaN */
+  } else if (exp == 0) {
+    v.u += 1u << 23; /* Subnormal: renormalize */
+    v.f -= magic.f;
+  }
+  v.u |= (uint32_t)(half & 0x8000u) << 16;
+  return v.f;
+#endif
+}
+
+/* Rounds to nearest, truncating below AE_DELAY_INT16_TRUNCATE steps */
+static inline int16_t ae_float_to_int16(float value) {
+  float scaled = value * AE_DELAY_INT16_SCALE;
+  if (scaled >= 32767.0f)
+    return 32767;
+  if (scaled <= -32768.0f)
+    return -32768;
+  if (fabsf(scaled) < AE_DELAY_INT16_TRUNCATE)
+    return (int16_t)scaled;
+  return (int16_t)lrintf(scaled);
+}
+
+/* Worst-case error of the ae_fast_* kernels. exp, pow: relative; log10,
+ * sin, cos, tanh: absolute. Bounds hold for exp |x| <= 80, pow x in
+ * [1e-6, 1e3] with |y| <= 4, log10 over positive normal floats,
+ * sin/cos |x| <= 8192 and any tanh input. */
+typedef enum {
+  AE_MATH_EXACT = 0, /* libm */
+  AE_MATH_1E4,       /* <= 1e-4 */
+  AE_MATH_1E2        /* <= 1e-2 */
+} ae_math_tier_t;
+
+/* Fast math polynomials (ae_fastmath.c mirrors these in SIMD). exp2 on
+ * [-0.5, 0.5]; log2 of m in [sqrt(1/2), sqrt(2)) as s * P(s^2) with
+ * s = (m - 1) / (m + 1); sin on [-pi/2, pi/2]. Fitted minimax, errors
+ * measured in float by test_math. */
+#define AE_FM_EXP2_1E4_C0 9.999992610e-01f
+#define AE_FM_EXP2_1E4_C1 6.931218156e-01f
+#define AE_FM_EXP2_1E4_C2 2.402474636e-01f
+#define AE_FM_EXP2_1E4_C3 5.591785550e-02f
+#define AE_FM_EXP2_1E4_C4 9.570039987e-03f
+#define AE_FM_EXP2_1E2_C0 1.000443605e+00f
+#define AE_FM_EXP2_1E2_C1 7.034477217e-01f
+#define AE_FM_EXP2_1E2_C2 2.384250734e-01f
+#define AE_FM_LOG2_1E4_C1 2.885391289e+00f
+#define AE_FM_LOG2_1E4_C3 9.614708132e-01f
+#define AE_FM_LOG2_1E4_C5 5.989737693e-01f
+#define AE_FM_LOG2_1E2_C1 2.906975243e+00f
+#define AE_FM_SIN_1E4_C1 9.999966158e-01f
+#define AE_FM_SIN_1E4_C3 -1.666482835e-01f
+#define AE_FM_SIN_1E4_C5 8.306324973e-03f
+#define AE_FM_SIN_1E4_C7 -1.836364809e-04f
+#define AE_FM_SIN_1E2_C1 9.855287151e-01f
+#define AE_FM_SIN_1E2_C3 -1.425662757e-01f
+/* pi in three parts for argument reduction (Cody-Waite) */
+#define AE_FM_PI_A 3.140625f
+#define AE_FM_PI_B 9.67502593994140625e-4f
+#define AE_FM_PI_C 1.509957990978376432e-7f
+#define AE_FM_LOG2E 1.44269504088896341f
+#define AE_FM_LOG10_2 0.301029995663981195f
+/* ln(10) / 20: 10^(dB/20) == exp(dB * AE_DB_TO_NEPER) */
+#define AE_DB_TO_NEPER 0.115129254649702284f
+
+static inline float ae_fast_exp2f(float x, ae_math_tier_t tier) {
+  if (tier == AE_MATH_EXACT)
+    return exp2f(x);
+  x = ae_clamp(x, -126.0f, 126.0f);
+  float n = floorf(x + 0.5f);
+  float f = x - n;
+  float p;
+  if (tier == AE_MATH_1E2)
+    p = AE_FM_EXP2_1E2_C0 +
+        f * (AE_FM_EXP2_1E2_C1 + f * AE_FM_EXP2_1E2_C2);
+  else
+    p = AE_FM_EXP2_1E4_C0 +
+        f * (AE_FM_EXP2_1E4_C1 +
+             f * (AE_FM_EXP2_1E4_C2 +
+                  f * (AE_FM_EXP2_1E4_C3 + f * AE_FM_EXP2_1E4_C4)));
+  int32_t bits;
+  memcpy(&bits, &p, sizeof(bits));
+  bits += (int32_t)n * (1 << 23);
+  memcpy(&p, &bits, sizeof(p));
+  return p;
+}
+
+static inline float ae_fast_expf(float x, ae_math_tier_t tier) {
+  if (tier == AE_MATH_EXACT)
+    return expf(x);
+  return ae_fast_exp2f(x * AE_FM_LOG2E, tier);
+}
+
+/* Inputs below FLT_MIN, zero and negatives read as FLT_MIN */
+static inline float ae_fast_log2f(float x, ae_math_tier_t tier) {
+  if (tier == AE_MATH_EXACT)
+    return log2f(fmaxf(x, FLT_MIN));
+  x = fmaxf(x, FLT_MIN);
+  int32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  float e = (float)((bits >> 23) - 127);
+  bits = (bits & 0x007fffff) | 0x3f800000;
+  float m;
+  memcpy(&m, &bits, sizeof(m));
+  if (m > 1.41421356f) {
+    m *= 0.5f;
+    e += 1.0f;
+  }
+  float s = (m - 1.0f) / (m + 1.0f);
+  if (tier == AE_MATH_1E2)
+    return e + s * AE_FM_LOG2_1E2_C1;
+  float s2 = s * s;
+  return e + s * (AE_FM_LOG2_1E4_C1 +
+                  s2 * (AE_FM_LOG2_1E4_C3 + s2 * AE_FM_LOG2_1E4_C5));
+}
+
+static inline float ae_fast_log10f(float x, ae_math_tier_t tier) {
+  if (tier == AE_MATH_EXACT)
+    return log10f(fmaxf(x, FLT_MIN));
+  return ae_fast_log2f(x, tier) * AE_FM_LOG10_2;
+}
+
+static inline float ae_fast_powf(float x, float y, ae_math_tier_t tier) {
+  if (x <= 0.0f)
+    return 0.0f;
+  if (tier == AE_MATH_EXACT)
+    return powf(x, y);
+  return ae_fast_exp2f(y * ae_fast_log2f(x, tier), tier);
+}
+
+/* sin of r in [-pi/2, pi/2], negated when k is odd */
+static inline float ae_fast_sin_reduced(float r, float k,
+                                        ae_math_tier_t tier) {
+  float r2 = r * r;
+  float p;
+  if (tier == AE_MATH_1E2)
+    p = r * (AE_FM_SIN_1E2_C1 + r2 * AE_FM_SIN_1E2_C3);
+  else
+    p = r * (AE_FM_SIN_1E4_C1 +
+             r2 * (AE_FM_SIN_1E4_C3 +
+                   r2 * (AE_FM_SIN_1E4_C5 + r2 * AE_FM_SIN_1E4_C7)));
+  return ((int32_t)k & 1) ? -p : p;
+}
+
+static inline float ae_fast_sinf(float x, ae_math_tier_t tier) {
+  if (tier == AE_MATH_EXACT)
+    return sinf(x);
+  float k = floorf(x * (float)(1.0 / M_PI) + 0.5f);
+  float r = ((x - k * AE_FM_PI_A) - k * AE_FM_PI_B) - k * AE_FM_PI_C;
+  return ae_fast_sin_reduced(r, k, tier);
+}
+
+/* cos(x) = -(-1)^k sin(x - (k + 1/2) pi) */
+static inline float ae_fast_cosf(float x, ae_math_tier_t tier) {
+  if (tier == AE_MATH_EXACT)
+    return cosf(x);
+  float k = floorf(x * (float)(1.0 / M_PI));
+  float h = k + 0.5f;
+  float r = ((x - h * AE_FM_PI_A) - h * AE_FM_PI_B) - h * AE_FM_PI_C;
+  return -ae_fast_sin_reduced(r, k, tier);
+}
+
+/* tanh |x| = 1 - 2 / (e^2|x| + 1), saturated past 9 */
+static inline float ae_fast_tanhf(float x, ae_math_tier_t tier) {
+  if (tier == AE_MATH_EXACT)
+    return tanhf(x);
+  float a = fminf(fabsf(x), 9.0f);
+  float t = 1.0f - 2.0f / (ae_fast_exp2f(2.0f * AE_FM_LOG2E * a, tier) + 1.0f);
+  return x < 0.0f ? -t : t;
+}
+
+/* Fast math over arrays (dst may alias src). log10 of zero or a negative
+ * value gives log10(FLT_MIN); pow of x <= 0 gives 0 */
+void ae_fast_exp(float *dst, const float *src, size_t n, ae_math_tier_t tier);
+void ae_fast_log10(float *dst, const float *src, size_t n,
+                   ae_math_tier_t tier);
+void ae_fast_pow(float *dst, const float *src, float y, size_t n,
+                 ae_math_tier_t tier);
+void ae_fast_sin(float *dst, const float *src, size_t n, ae_math_tier_t tier);
+void ae_fast_cos(float *dst, const float *src, size_t n, ae_math_tier_t tier);
+void ae_fast_tanh(float *dst, const float *src, size_t n, ae_math_tier_t tier);
+
+/* Dynamics gain computer (compressor, de-esser): 0 at and below the knee,
+ * slope * over above it, and the quadratic that joins the two inside it.
+ * slope = 1 / ratio - 1, knee_scale = slope / (2 * knee); a zero half_knee
+ * gives the hard-knee curve. */
+static inline float ae_gain_curve_knee(float over, float slope,
+                                       float half_knee, float knee_scale) {
+  if (over <= -half_knee)
+    return 0.0f;
+  if (over < half_knee) {
+    float t = over + half_knee;
+    return knee_scale * t * t;
+  }
+  return slope * over;
+}
+
+/**
+ * Static gain change (dB) for n linear detector levels, in place. Levels go
+ * to dB through the fast log; the curve runs four levels at a time.
+ */
+static inline void ae_gain_curve_db(float *level, size_t n,
+                                    float threshold_db, float slope,
+                                    float half_knee, float knee_scale) {
+  ae_fast_log10(level, level, n, AE_MATH_1E4);
+  size_t i = 0;
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+  const __m128 twenty = _mm_set1_ps(20.0f);
+  const __m128 threshold = _mm_set1_ps(threshold_db);
+  const __m128 slope_v = _mm_set1_ps(slope);
+  const __m128 half_knee_v = _mm_set1_ps(half_knee);
+  const __m128 knee_scale_v = _mm_set1_ps(knee_scale);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+  for (; i + 4 <= n; i += 4) {
+    __m128 over =
+        _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(level + i), twenty), threshold);
+    /* slope <= 0, so the hard curve is min(slope * over, 0) */
+    __m128 gain = _mm_min_ps(_mm_mul_ps(slope_v, over), zero);
+    __m128 t = _mm_add_ps(over, half_knee_v);
+    __m128 knee = _mm_mul_ps(knee_scale_v, _mm_mul_ps(t, t));
+    __m128 in_knee = _mm_cmplt_ps(_mm_and_ps(over, abs_mask), half_knee_v);
+    gain = _mm_or_ps(_mm_and_ps(in_knee, knee), _mm_andnot_ps(in_knee, gain));
+    _mm_storeu_ps(level + i, gain);
+  }
+#endif
+  for (; i < n; ++i)
+    level[i] = ae_gain_curve_knee(20.0f * level[i] - threshold_db, slope,
+                                  half_knee, knee_scale);
+}
+
+/**
+ * Attack/release smoothing of a gain change (dB), in place; returns the
+ * last value. Attack while the reduction deepens (g < y), release while it
+ * recovers. With d = y - g, attack * d and release * d straddle zero the
+ * same way d does, so the branch is a min (attack faster than release) or
+ * a max: the recursion stays branch-free on noisy input.
+ */
+static inline float ae_gain_smooth(float *gain, size_t n, float y,
+                                   float attack, float release) {
+  if (attack <= release) {
+    for (size_t i = 0; i < n; ++i) {
+      float g = gain[i];
+      float a = attack * (y - g);
+      float r = release * (y - g);
+      y = g + (a < r ? a : r);
+      gain[i] = y;
+    }
+  } else {
+    for (size_t i = 0; i < n; ++i) {
+      float g = gain[i];
+      float a = attack * (y - g);
+      float r = release * (y - g);
+      y = g + (a > r ? a : r);
+      gain[i] = y;
+    }
+  }
+  return y;
+}
+
 void ae_set_error(ae_engine_t *engine, const char *message);
 void ae_clear_error(ae_engine_t *engine);
 
@@ -215,24 +794,113 @@ void ae_reverb_update_params(ae_engine_t *engine, float room_size, float rt60,
 void ae_reverb_process_block(ae_engine_t *engine, const float *input,
                              float *out_l, float *out_r, size_t frames);
 void ae_reverb_cleanup(ae_engine_t *engine);
+void ae_reverb_publish_early(ae_engine_t *engine, const ae_er_table_t *table);
+
+/* Delay line storage */
+bool ae_delay_buffer_alloc(ae_delay_buffer_t *buf, size_t size,
+                           ae_delay_storage_t format);
+void ae_delay_buffer_free(ae_delay_buffer_t *buf);
+void ae_delay_buffer_clear(ae_delay_buffer_t *buf, size_t size);
+void ae_delay_write_span(ae_delay_buffer_t *buf, size_t size, size_t start,
+                         const float *src, size_t n);
+float *ae_delay_span_load(const ae_delay_buffer_t *buf, size_t start,
+                          size_t n, float *scratch);
+void ae_delay_span_store(ae_delay_buffer_t *buf, size_t start,
+                         const float *src, size_t n);
+
+/* Real FFT (ae_fft.c) */
+bool ae_fft_init(ae_fft_t *fft, size_t size);
+void ae_fft_free(ae_fft_t *fft);
+void ae_fft_forward(ae_fft_t *fft, const float *in, float *re, float *im);
+void ae_fft_inverse(ae_fft_t *fft, const float *re, const float *im,
+                    float *out);
+
+/* Multichannel IIR core (ae_iir.c); ch[0 .. channels-1] filtered in place */
+void ae_onepole4_set(ae_onepole4_t *filter, size_t lane, float alpha,
+                     ae_onepole_mode_t mode);
+void ae_onepole4_process(ae_onepole4_t *filter, float *const *ch,
+                         size_t channels, size_t n);
+void ae_biquad4_set(ae_biquad4_t *filter, size_t lane, float b0, float b1,
+                    float b2, float a1, float a2);
+void ae_biquad4_process(ae_biquad4_t *filter, float *const *ch,
+                        size_t channels, size_t n);
+
+/* Noise generator (ae_rng.c) */
+void ae_rng_seed(ae_rng_t *rng, uint64_t seed);
+void ae_rng_seed_unique(ae_rng_t *rng);
+void ae_rng_uniform(ae_rng_t *rng, float *dst, size_t n);
+void ae_rng_tpdf(ae_rng_t *rng, float *dst, size_t n);
+
+/* HRIR grid */
+bool ae_hrir_grid_build(ae_hrir_grid_t *grid, size_t taps, float step_deg,
+                        ae_hrir_sample_fn sample, void *user);
+void ae_hrir_grid_free(ae_hrir_grid_t *grid);
+void ae_hrir_grid_lookup(const ae_hrir_grid_t *grid, float az_deg,
+                         float el_deg, float *ir_l, float *ir_r,
+                         float *delay_l, float *delay_r);
+void ae_hrir_apply_onset(float *ir, size_t hrir_len, size_t filter_len,
+                         float delay);
+bool ae_hrir_grid_preprocess(ae_hrir_grid_t *grid, size_t max_taps);
+
+/* Preprocessed HRIR grid cache (ae_hrir_cache.c) */
+bool ae_hrir_cache_key(const char *source_path, uint32_t sample_rate,
+                       uint32_t max_taps, uint64_t *key);
+bool ae_hrir_cache_path(const char *dir, uint64_t key, char *path,
+                        size_t size);
+bool ae_hrir_cache_load(ae_hrir_grid_t *grid, const char *path,
+                        uint64_t key);
+bool ae_hrir_cache_save(const ae_hrir_grid_t *grid, const char *path,
+                        uint64_t key);
+
+#ifdef AE_USE_LIBMYSOFA
+/* ae_hrir_sample_fn over an open SOFA file (ae_spatial.c) */
+typedef struct {
+  struct MYSOFA_EASY *sofa;
+  float sample_rate;
+} ae_sofa_source_t;
+bool ae_spatial_sample_sofa(void *user, float az_deg, float el_deg,
+                            float *ir_l, float *ir_r, float *delay_l,
+                            float *delay_r);
+#endif
+
+/* Background worker */
+ae_worker_t *ae_worker_create(void);
+void ae_worker_destroy(ae_worker_t *worker);
+void ae_worker_post(ae_worker_t *worker, ae_job_fn run, ae_job_fn discard,
+                    void *arg);
+void ae_worker_wait_idle(ae_worker_t *worker);
+ae_mutex_t *ae_mutex_create(void);
+void ae_mutex_destroy(ae_mutex_t *mutex);
+void ae_mutex_lock(ae_mutex_t *mutex);
+void ae_mutex_unlock(ae_mutex_t *mutex);
+void ae_thread_yield(void);
 
 void ae_spatial_init(ae_engine_t *engine);
 void ae_spatial_cleanup(ae_engine_t *engine);
-void ae_spatial_set_params(ae_engine_t *engine,
+void ae_spatial_set_params(ae_engine_t *engine, uint32_t listener,
                            const ae_binaural_params_t *params);
-void ae_spatial_process(ae_engine_t *engine, float *left, float *right,
-                        size_t frames);
-
-void ae_dsp_apply_brightness(float *samples, size_t n, float brightness,
-                             float sample_rate, float *lp_state,
-                             float *hp_state);
-void ae_dsp_apply_lofi(float *left, float *right, size_t n, float amount);
+void ae_spatial_process(ae_engine_t *engine, uint32_t listener, float *left,
+                        float *right, size_t frames);
+void ae_spatial_process_group(ae_engine_t *const *engines,
+                              float *const *left, float *const *right,
+                              size_t count, size_t frames);
+
+void ae_dsp_apply_brightness(ae_onepole4_t *lp, ae_onepole4_t *hp,
+                             float *left, float *right, size_t n,
+                             float brightness, float sample_rate);
+void ae_dsp_apply_lofi(ae_rng_t *rng, float *left, float *right, size_t n,
+                       float amount);
 void ae_dsp_apply_width(float *left, float *right, size_t n, float width);
-void ae_dsp_apply_precedence(ae_engine_t *engine, float *left, float *right,
-                             size_t frames);
-void ae_dsp_apply_doppler(const ae_doppler_params_t *doppler, const float *in_l,
-                          const float *in_r, float *out_l, float *out_r,
-                          size_t frames, float *phase);
+void ae_dsp_apply_precedence(ae_engine_t *engine, ae_precedence_line_t *line,
+                             float *left, float *right, size_t frames);
+bool ae_doppler_line_alloc(ae_doppler_line_t *line, float sample_rate,
+                           size_t max_frames);
+void ae_doppler_line_free(ae_doppler_line_t *line);
+void ae_doppler_line_reset(ae_doppler_line_t *line);
+void ae_dsp_apply_doppler(ae_doppler_line_t *line,
+                          const ae_doppler_params_t *doppler, float distance,
+                          float sample_rate, float *left, float *right,
+                          size_t frames);
 float ae_dsp_apply_envelope(ae_engine_t *engine, float sample);
 
 /* Propagation models */
@@ -251,30 +919,27 @@ void ae_apply_distance_absorption(float *samples, size_t frames,
 
 /* Dynamics processing */
 void ae_dynamics_init(ae_dynamics_t *dyn);
-float ae_compressor_process_sample(ae_dynamics_t *dyn, float sample,
-                                   float sample_rate);
-void ae_compressor_process(ae_dynamics_t *dyn, float *samples, size_t frames,
-                           float sample_rate);
-void ae_compressor_process_stereo(ae_dynamics_t *dyn, float *left, float *right,
-                                  size_t frames, float sample_rate);
-void ae_limiter_process(float *samples, size_t frames, float ceiling_db,
-                        size_t lookahead_samples, float release_ms,
-                        float sample_rate, float *delay_buffer,
-                        size_t *delay_index, float *envelope);
 float ae_soft_clip(float sample, float threshold);
 
 /* Extended LoFi effects */
-void ae_dsp_apply_wow_flutter(float *samples, size_t n, float depth,
-                              float rate_hz, float sample_rate, float *phase);
+void ae_dsp_apply_wow_flutter(ae_wow_flutter_t *wf, float *left, float *right,
+                              size_t n, float depth, float rate_hz,
+                              float sample_rate);
 void ae_dsp_apply_tape_saturation(float *samples, size_t n, float drive);
 
 /* SIMD helpers */
+void ae_simd_sub(float *dst, const float *a, const float *b, size_t n);
 void ae_simd_copy_gain(float *dst, const float *src, float gain, size_t n);
 void ae_simd_mix_gain(float *dst, const float *src, float gain, size_t n);
+void ae_simd_mix_gain_stereo(float *dst_l, float *dst_r, const float *src,
+                             float gain_l, float gain_r, size_t n);
 void ae_simd_interleave_stereo(float *dst, const float *left,
                                const float *right, size_t frames);
 void ae_simd_deinterleave_stereo(float *left, float *right, const float *src,
                                  size_t frames);
 float ae_simd_max_abs(const float *src, size_t n);
+void ae_simd_abs(float *dst, const float *src, size_t n);
+void ae_simd_max(float *dst, const float *a, const float *b, size_t n);
+void ae_simd_offset(float *dst, const float *src, float offset, size_t n);
 
 #endif /* AE_INTERNAL_H */
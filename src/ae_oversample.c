@@ -0,0 +1,525 @@
+/**
+ * @file ae_oversample.c
+ * @brief 2x/4x/8x oversampling around a nonlinear stage
+ *
+ * A waveshaper run at the base rate folds the harmonics it creates above
+ * Nyquist back into the audible band. The oversampler raises a block
+ * through a cascade of 2x halfband stages, hands it to a callback at the
+ * high rate, and brings the result back down through the same stages, so
+ * what the callback adds above the base band is filtered out instead.
+ *
+ * Linear phase uses symmetric Kaiser-windowed FIR halfbands. Every other
+ * tap of a halfband is zero, so one polyphase branch is a plain delay and
+ * a 2x stage costs one P-tap sum per output pair; four outputs come from
+ * unaligned loads on a linear history buffer. Low latency uses polyphase
+ * IIR halfbands: two chains of first-order allpasses in z^-2, one per
+ * branch, with lanes {left even, left odd, right even, right odd} so both
+ * branches of both channels advance in one step.
+ *
+ * The first stage holds the sharp transition at the base band edge; later
+ * stages only have to clear images an octave or more away and are short.
+ */
+
+#include "ae_internal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
+
+#define AE_OS_MAX_STAGES 3
+#define AE_OS_MAX_TAPS 20 /* One-sided FIR taps */
+#define AE_OS_MAX_PAIRS 4 /* IIR allpasses per branch */
+#define AE_OS_FIRST_TBW 0.04
+#define AE_OS_LATER_TBW 0.25
+
+typedef struct {
+  uint32_t taps;  /* FIR one-sided taps */
+  double beta;    /* FIR Kaiser window */
+  uint32_t coefs; /* IIR allpasses over both branches, even */
+} ae_os_design_t;
+
+/* Per quality: first stage, later stages. Image rejection of the first
+ * stage is about 43/61/91 dB (FIR) and 50/75/99 dB (IIR); later stages
+ * reject more than that. */
+static const ae_os_design_t ae_os_designs[3][2] = {
+    {{8, 4.0, 4}, {4, 5.0, 2}},
+    {{12, 6.0, 6}, {5, 7.0, 4}},
+    {{20, 9.0, 8}, {6, 8.0, 4}},
+};
+
+typedef struct {
+  uint32_t taps;
+  float up[AE_OS_MAX_TAPS][4];   /* 2 h_j, splatted */
+  float down[AE_OS_MAX_TAPS][4]; /* h_j, splatted */
+  float *hist[2];                /* Upsampler input, 2P-1 history first */
+  float *odd[2];                 /* Decimator odd phase, 2P-1 history */
+  float *even[2];                /* Decimator even phase, P-1 history */
+
+  uint32_t pairs;
+  float coef[AE_OS_MAX_PAIRS][4]; /* {c even, c odd, c even, c odd} */
+  float up_x[AE_OS_MAX_PAIRS][4], up_y[AE_OS_MAX_PAIRS][4];
+  float dn_x[AE_OS_MAX_PAIRS][4], dn_y[AE_OS_MAX_PAIRS][4];
+} ae_os_stage_t;
+
+struct ae_oversampler {
+  ae_oversampler_config_t config;
+  uint32_t stages;
+  float latency;
+  ae_os_stage_t stage[AE_OS_MAX_STAGES];
+  float *level[AE_OS_MAX_STAGES + 1][2]; /* level[s]: block at 2^s, s >= 1 */
+};
+
+static double ae_os_bessel_i0(double x) {
+  double y = 0.25 * x * x, term = 1.0, sum = 1.0;
+  for (int k = 1; k < 32; ++k) {
+    term *= y / ((double)k * (double)k);
+    sum += term;
+  }
+  return sum;
+}
+
+/* Halfband h_j at odd offsets 2j+1, scaled so the taps sum to 1/4 a side */
+static void ae_os_design_fir(ae_os_stage_t *st, const ae_os_design_t *d) {
+  double taps[AE_OS_MAX_TAPS], sum = 0.0;
+  double norm = ae_os_bessel_i0(d->beta);
+  for (uint32_t j = 0; j < d->taps; ++j) {
+    double off = (double)(2 * j + 1);
+    double r = off / (double)(2 * d->taps);
+    double sinc = ((j & 1) ? -1.0 : 1.0) / (M_PI * off);
+    taps[j] = sinc * ae_os_bessel_i0(d->beta * sqrt(1.0 - r * r)) / norm;
+    sum += taps[j];
+  }
+  st->taps = d->taps;
+  for (uint32_t j = 0; j < d->taps; ++j) {
+    float h = (float)(taps[j] * 0.25 / sum);
+    for (int lane = 0; lane < 4; ++lane) {
+      st->up[j][lane] = 2.0f * h;
+      st->down[j][lane] = h;
+    }
+  }
+}
+
+/* Elliptic polyphase halfband (Valenzuela and Constantinides): transition
+ * width tbw as a fraction of the high rate, count allpass coefficients,
+ * even indices on the even branch. Returns the DC group delay of both
+ * branches together, in high-rate samples. */
+static double ae_os_design_iir(ae_os_stage_t *st, uint32_t count,
+                               double tbw) {
+  double k = tan((1.0 - 2.0 * tbw) * M_PI * 0.25);
+  k *= k;
+  double kk = pow(1.0 - k * k, 0.25);
+  double e = 0.5 * (1.0 - kk) / (1.0 + kk);
+  double e4 = e * e * e * e;
+  double q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+  double order = (double)(2 * count + 1);
+  double delay = 0.0;
+
+  st->pairs = count / 2;
+  for (uint32_t i = 0; i < count; ++i) {
+    double c = (double)(i + 1);
+    double num = 0.0, den = 0.5;
+    for (int m = 0; m < 16; ++m) {
+      double sign = (m & 1) ? -1.0 : 1.0;
+      num += sign * pow(q, (double)(m * (m + 1))) *
+             sin((double)(2 * m + 1) * c * M_PI / order);
+      if (m > 0)
+        den += sign * pow(q, (double)(m * m)) *
+               cos((double)(2 * m) * c * M_PI / order);
+    }
+    num *= pow(q, 0.25);
+    double ww = num / den;
+    double wwsq = ww * ww;
+    double x = sqrt((1.0 - wwsq * k) * (1.0 - wwsq / k)) / (1.0 + wwsq);
+    double coef = (1.0 - x) / (1.0 + x);
+    st->coef[i / 2][i & 1] = (float)coef;
+    st->coef[i / 2][(i & 1) + 2] = (float)coef;
+    delay += 2.0 * (1.0 - coef) / (1.0 + coef);
+  }
+  return delay;
+}
+
+#ifdef AE_HAS_SSE2
+/* Four outputs of sum_j h_j (c[j] + c[-1-j]) on top of acc, even and odd
+ * taps in separate accumulators so the adds overlap */
+static inline __m128 ae_os_fir_sum(const float (*h)[4], const float *c,
+                                   size_t p, __m128 acc) {
+  __m128 acc1 = _mm_setzero_ps();
+  size_t j = 0;
+  for (; j + 2 <= p; j += 2) {
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(h[j]),
+                                     _mm_add_ps(_mm_loadu_ps(c + j),
+                                                _mm_loadu_ps(c - 1 - j))));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(h[j + 1]),
+                                       _mm_add_ps(_mm_loadu_ps(c + j + 1),
+                                                  _mm_loadu_ps(c - 2 - j))));
+  }
+  if (j < p)
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(h[j]),
+                                     _mm_add_ps(_mm_loadu_ps(c + j),
+                                                _mm_loadu_ps(c - 1 - j))));
+  return _mm_add_ps(acc, acc1);
+}
+#endif
+
+/* FIR 2x up: n inputs to 2n outputs. Output 2i is input i - P, output
+ * 2i + 1 the halfband value half a sample later. */
+static void ae_os_fir_up(const ae_os_stage_t *st, float *hist,
+                         const float *in, float *out, size_t n) {
+  size_t p = st->taps, h = 2 * p - 1;
+  memcpy(hist + h, in, n * sizeof(float));
+  size_t i = 0;
+#ifdef AE_HAS_SSE2
+  for (; i + 4 <= n; i += 4) {
+    const float *c = hist + i + p;
+    __m128 sum = ae_os_fir_sum(st->up, c, p, _mm_setzero_ps());
+    __m128 direct = _mm_loadu_ps(c - 1);
+    _mm_storeu_ps(out + 2 * i, _mm_unpacklo_ps(direct, sum));
+    _mm_storeu_ps(out + 2 * i + 4, _mm_unpackhi_ps(direct, sum));
+  }
+#endif
+  for (; i < n; ++i) {
+    const float *c = hist + i + p;
+    float acc[2] = {0.0f, 0.0f};
+    for (size_t j = 0; j < p; ++j)
+      acc[j & 1] += st->up[j][0] * (c[j] + *(c - 1 - j));
+    out[2 * i] = c[-1];
+    out[2 * i + 1] = acc[0] + acc[1];
+  }
+  memmove(hist, hist + n, h * sizeof(float));
+}
+
+/* FIR 2x down: 2n inputs to n outputs, centred on the even phase */
+static void ae_os_fir_down(const ae_os_stage_t *st, float *odd, float *even,
+                           const float *in, float *out, size_t n) {
+  size_t p = st->taps, ho = 2 * p - 1, he = p - 1;
+  float *o = odd + ho, *e = even + he;
+  size_t k = 0;
+#ifdef AE_HAS_SSE2
+  for (; k + 4 <= n; k += 4) {
+    __m128 a = _mm_loadu_ps(in + 2 * k);
+    __m128 b = _mm_loadu_ps(in + 2 * k + 4);
+    _mm_storeu_ps(e + k, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(o + k, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+  }
+#endif
+  for (; k < n; ++k) {
+    e[k] = in[2 * k];
+    o[k] = in[2 * k + 1];
+  }
+
+  k = 0;
+#ifdef AE_HAS_SSE2
+  const __m128 half = _mm_set1_ps(0.5f);
+  for (; k + 4 <= n; k += 4) {
+    const float *c = odd + k + p;
+    __m128 centre = _mm_mul_ps(half, _mm_loadu_ps(even + k));
+    _mm_storeu_ps(out + k, ae_os_fir_sum(st->down, c, p, centre));
+  }
+#endif
+  for (; k < n; ++k) {
+    const float *c = odd + k + p;
+    float acc[2] = {0.5f * even[k], 0.0f};
+    for (size_t j = 0; j < p; ++j)
+      acc[j & 1] += st->down[j][0] * (c[j] + *(c - 1 - j));
+    out[k] = acc[0] + acc[1];
+  }
+  memmove(odd, odd + n, ho * sizeof(float));
+  memmove(even, even + n, he * sizeof(float));
+}
+
+#ifdef AE_HAS_SSE2
+/* One allpass of every lane: y = (v - y1) c + x1. The state lives in
+ * named locals so each chain stays in registers; pairs is a constant at
+ * every call, which drops the unused steps. */
+#define AE_OS_AP(k)                                                            \
+  do {                                                                         \
+    __m128 y_ = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(v, y##k), c##k), x##k);       \
+    x##k = v;                                                                  \
+    y##k = y_;                                                                 \
+    v = y_;                                                                    \
+  } while (0)
+
+#define AE_OS_CHAIN(pairs)                                                     \
+  do {                                                                         \
+    AE_OS_AP(0);                                                               \
+    if ((pairs) > 1)                                                           \
+      AE_OS_AP(1);                                                             \
+    if ((pairs) > 2)                                                           \
+      AE_OS_AP(2);                                                             \
+    if ((pairs) > 3)                                                           \
+      AE_OS_AP(3);                                                             \
+  } while (0)
+
+#define AE_OS_LOAD(x, y, sx, sy)                                               \
+  __m128 x##0 = _mm_loadu_ps(sx[0]), y##0 = _mm_loadu_ps(sy[0]);               \
+  __m128 x##1 = _mm_loadu_ps(sx[1]), y##1 = _mm_loadu_ps(sy[1]);               \
+  __m128 x##2 = _mm_loadu_ps(sx[2]), y##2 = _mm_loadu_ps(sy[2]);               \
+  __m128 x##3 = _mm_loadu_ps(sx[3]), y##3 = _mm_loadu_ps(sy[3])
+
+#define AE_OS_STORE(x, y, sx, sy)                                              \
+  do {                                                                         \
+    _mm_storeu_ps(sx[0], x##0);                                                \
+    _mm_storeu_ps(sy[0], y##0);                                                \
+    _mm_storeu_ps(sx[1], x##1);                                                \
+    _mm_storeu_ps(sy[1], y##1);                                                \
+    _mm_storeu_ps(sx[2], x##2);                                                \
+    _mm_storeu_ps(sy[2], y##2);                                                \
+    _mm_storeu_ps(sx[3], x##3);                                                \
+    _mm_storeu_ps(sy[3], y##3);                                                \
+  } while (0)
+
+static inline void ae_os_iir_up_run(ae_os_stage_t *st, const float *l,
+                                    const float *r, float *out_l,
+                                    float *out_r, size_t n, uint32_t pairs) {
+  const __m128 c0 = _mm_loadu_ps(st->coef[0]), c1 = _mm_loadu_ps(st->coef[1]);
+  const __m128 c2 = _mm_loadu_ps(st->coef[2]), c3 = _mm_loadu_ps(st->coef[3]);
+  AE_OS_LOAD(x, y, st->up_x, st->up_y);
+  for (size_t i = 0; i < n; ++i) {
+    __m128 v = _mm_unpacklo_ps(_mm_load_ss(l + i), _mm_load_ss(r + i));
+    v = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 0, 0));
+    AE_OS_CHAIN(pairs);
+    _mm_storel_pi((__m64 *)(out_l + 2 * i), v);
+    if (out_r)
+      _mm_storeh_pi((__m64 *)(out_r + 2 * i), v);
+  }
+  AE_OS_STORE(x, y, st->up_x, st->up_y);
+}
+
+static inline void ae_os_iir_down_run(ae_os_stage_t *st, const float *l,
+                                      const float *r, float *out_l,
+                                      float *out_r, size_t n,
+                                      uint32_t pairs) {
+  const __m128 c0 = _mm_loadu_ps(st->coef[0]), c1 = _mm_loadu_ps(st->coef[1]);
+  const __m128 c2 = _mm_loadu_ps(st->coef[2]), c3 = _mm_loadu_ps(st->coef[3]);
+  const __m128 half = _mm_set1_ps(0.5f);
+  AE_OS_LOAD(x, y, st->dn_x, st->dn_y);
+  for (size_t k = 0; k < n; ++k) {
+    __m128 v = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(l + 2 * k));
+    v = _mm_loadh_pi(v, (const __m64 *)(r + 2 * k));
+    v = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+    AE_OS_CHAIN(pairs);
+    __m128 s = _mm_mul_ps(
+        half, _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1))));
+    out_l[k] = _mm_cvtss_f32(s);
+    if (out_r)
+      out_r[k] = _mm_cvtss_f32(_mm_movehl_ps(s, s));
+  }
+  AE_OS_STORE(x, y, st->dn_x, st->dn_y);
+}
+#else
+static void ae_os_iir_lanes(ae_os_stage_t *st, float x[][4], float y[][4],
+                            float v[4]) {
+  for (uint32_t p = 0; p < st->pairs; ++p) {
+    for (int lane = 0; lane < 4; ++lane) {
+      float out = (v[lane] - y[p][lane]) * st->coef[p][lane] + x[p][lane];
+      x[p][lane] = v[lane];
+      y[p][lane] = out;
+      v[lane] = out;
+    }
+  }
+}
+#endif
+
+/* IIR 2x up of both channels; r is read but not written back when out_r
+ * is NULL */
+static void ae_os_iir_up(ae_os_stage_t *st, const float *l, const float *r,
+                         float *out_l, float *out_r, size_t n) {
+#ifdef AE_HAS_SSE2
+  switch (st->pairs) {
+  case 1:
+    ae_os_iir_up_run(st, l, r, out_l, out_r, n, 1);
+    break;
+  case 2:
+    ae_os_iir_up_run(st, l, r, out_l, out_r, n, 2);
+    break;
+  case 3:
+    ae_os_iir_up_run(st, l, r, out_l, out_r, n, 3);
+    break;
+  default:
+    ae_os_iir_up_run(st, l, r, out_l, out_r, n, 4);
+    break;
+  }
+#else
+  for (size_t i = 0; i < n; ++i) {
+    float v[4] = {l[i], l[i], r[i], r[i]};
+    ae_os_iir_lanes(st, st->up_x, st->up_y, v);
+    out_l[2 * i] = v[0];
+    out_l[2 * i + 1] = v[1];
+    if (out_r) {
+      out_r[2 * i] = v[2];
+      out_r[2 * i + 1] = v[3];
+    }
+  }
+#endif
+}
+
+static void ae_os_iir_down(ae_os_stage_t *st, const float *l, const float *r,
+                           float *out_l, float *out_r, size_t n) {
+#ifdef AE_HAS_SSE2
+  switch (st->pairs) {
+  case 1:
+    ae_os_iir_down_run(st, l, r, out_l, out_r, n, 1);
+    break;
+  case 2:
+    ae_os_iir_down_run(st, l, r, out_l, out_r, n, 2);
+    break;
+  case 3:
+    ae_os_iir_down_run(st, l, r, out_l, out_r, n, 3);
+    break;
+  default:
+    ae_os_iir_down_run(st, l, r, out_l, out_r, n, 4);
+    break;
+  }
+#else
+  for (size_t k = 0; k < n; ++k) {
+    float v[4] = {l[2 * k + 1], l[2 * k], r[2 * k + 1], r[2 * k]};
+    ae_os_iir_lanes(st, st->dn_x, st->dn_y, v);
+    out_l[k] = 0.5f * (v[0] + v[1]);
+    if (out_r)
+      out_r[k] = 0.5f * (v[2] + v[3]);
+  }
+#endif
+}
+
+/* Stage s: n samples at 2^s times the base rate up to 2n, or back */
+static void ae_os_up(ae_oversampler_t *os, uint32_t s, float *const in[2],
+                     float *const out[2], size_t n) {
+  ae_os_stage_t *st = &os->stage[s];
+  if (os->config.phase == AE_OVERSAMPLE_LOW_LATENCY) {
+    ae_os_iir_up(st, in[0], in[1] ? in[1] : in[0], out[0],
+                 in[1] ? out[1] : NULL, n);
+    return;
+  }
+  for (int ch = 0; ch < 2 && in[ch]; ++ch)
+    ae_os_fir_up(st, st->hist[ch], in[ch], out[ch], n);
+}
+
+static void ae_os_down(ae_oversampler_t *os, uint32_t s, float *const in[2],
+                       float *const out[2], size_t n) {
+  ae_os_stage_t *st = &os->stage[s];
+  if (os->config.phase == AE_OVERSAMPLE_LOW_LATENCY) {
+    ae_os_iir_down(st, in[0], in[1] ? in[1] : in[0], out[0], out[1], n);
+    return;
+  }
+  for (int ch = 0; ch < 2 && out[ch]; ++ch)
+    ae_os_fir_down(st, st->odd[ch], st->even[ch], in[ch], out[ch], n);
+}
+
+AE_API ae_oversampler_t *
+ae_oversampler_create(const ae_oversampler_config_t *config) {
+  if (!config || config->max_frames == 0 ||
+      (config->factor != 2 && config->factor != 4 && config->factor != 8) ||
+      (config->phase != AE_OVERSAMPLE_LINEAR_PHASE &&
+       config->phase != AE_OVERSAMPLE_LOW_LATENCY) ||
+      (config->quality != AE_OVERSAMPLE_DRAFT &&
+       config->quality != AE_OVERSAMPLE_NORMAL &&
+       config->quality != AE_OVERSAMPLE_HIGH))
+    return NULL;
+  ae_oversampler_t *os = (ae_oversampler_t *)calloc(1, sizeof(*os));
+  if (!os)
+    return NULL;
+  os->config = *config;
+  os->stages = config->factor == 2 ? 1 : config->factor == 4 ? 2 : 3;
+
+  bool fir = config->phase == AE_OVERSAMPLE_LINEAR_PHASE;
+  bool ok = true;
+  double latency = 0.0;
+  for (uint32_t s = 0; s < os->stages; ++s) {
+    ae_os_stage_t *st = &os->stage[s];
+    const ae_os_design_t *d = &ae_os_designs[config->quality][s > 0];
+    size_t block = (size_t)config->max_frames << s;
+    double rate = (double)(2u << s);
+    if (fir) {
+      ae_os_design_fir(st, d);
+      size_t h = 2 * (size_t)d->taps - 1;
+      for (int ch = 0; ch < 2; ++ch) {
+        st->hist[ch] = (float *)calloc(h + block, sizeof(float));
+        st->odd[ch] = (float *)calloc(h + block, sizeof(float));
+        st->even[ch] = (float *)calloc(d->taps - 1 + block, sizeof(float));
+        ok = ok && st->hist[ch] && st->odd[ch] && st->even[ch];
+      }
+      /* Up delays 2P samples, down 2P - 2, at this stage's high rate */
+      latency += (double)(4 * d->taps - 2) / rate;
+    } else {
+      double tbw = s == 0 ? AE_OS_FIRST_TBW : AE_OS_LATER_TBW;
+      latency += ae_os_design_iir(st, d->coefs, tbw) / rate;
+    }
+    for (int ch = 0; ch < 2; ++ch) {
+      os->level[s + 1][ch] = (float *)calloc(block * 2, sizeof(float));
+      ok = ok && os->level[s + 1][ch];
+    }
+  }
+  if (!ok) {
+    ae_oversampler_destroy(os);
+    return NULL;
+  }
+  os->latency = (float)latency;
+  return os;
+}
+
+AE_API void ae_oversampler_destroy(ae_oversampler_t *os) {
+  if (!os)
+    return;
+  for (uint32_t s = 0; s < AE_OS_MAX_STAGES; ++s) {
+    for (int ch = 0; ch < 2; ++ch) {
+      free(os->stage[s].hist[ch]);
+      free(os->stage[s].odd[ch]);
+      free(os->stage[s].even[ch]);
+      free(os->level[s + 1][ch]);
+    }
+  }
+  free(os);
+}
+
+AE_API void ae_oversampler_reset(ae_oversampler_t *os) {
+  if (!os)
+    return;
+  for (uint32_t s = 0; s < os->stages; ++s) {
+    ae_os_stage_t *st = &os->stage[s];
+    memset(st->up_x, 0, sizeof(st->up_x));
+    memset(st->up_y, 0, sizeof(st->up_y));
+    memset(st->dn_x, 0, sizeof(st->dn_x));
+    memset(st->dn_y, 0, sizeof(st->dn_y));
+    if (!st->hist[0])
+      continue;
+    size_t h = 2 * (size_t)st->taps - 1;
+    for (int ch = 0; ch < 2; ++ch) {
+      memset(st->hist[ch], 0, h * sizeof(float));
+      memset(st->odd[ch], 0, h * sizeof(float));
+      memset(st->even[ch], 0, (st->taps - 1) * sizeof(float));
+    }
+  }
+}
+
+AE_API ae_result_t ae_oversampler_process(ae_oversampler_t *os, float *left,
+                                          float *right, size_t frames,
+                                          ae_oversample_fn fn,
+                                          void *user_data) {
+  if (!os || !left || !fn)
+    return AE_ERROR_INVALID_PARAM;
+  uint32_t top = os->stages;
+  size_t step = os->config.max_frames;
+  for (size_t start = 0; start < frames; start += step) {
+    size_t n = frames - start < step ? frames - start : step;
+    float *base[2] = {left + start, right ? right + start : NULL};
+    float *levels[AE_OS_MAX_STAGES + 1][2] = {{NULL, NULL}};
+    for (uint32_t s = 1; s <= top; ++s) {
+      levels[s][0] = os->level[s][0];
+      levels[s][1] = right ? os->level[s][1] : NULL;
+    }
+
+    ae_os_up(os, 0, base, levels[1], n);
+    for (uint32_t s = 1; s < top; ++s)
+      ae_os_up(os, s, levels[s], levels[s + 1], n << s);
+    fn(levels[top][0], levels[top][1], n << top, user_data);
+    for (uint32_t s = top - 1; s > 0; --s)
+      ae_os_down(os, s, levels[s + 1], levels[s], n << s);
+    ae_os_down(os, 0, levels[1], base, n);
+  }
+  return AE_OK;
+}
+
+AE_API float ae_oversampler_latency(const ae_oversampler_t *os) {
+  return os ? os->latency : 0.0f;
+}
@@ -1,31 +1,117 @@
 #include "ae_internal.h"
 
-static float ae_allpass_process(ae_allpass_t *ap, float input) {
-  float buf = ap->buffer[ap->index];
-  float output = -input + buf;
-  ap->buffer[ap->index] = input + buf * ap->feedback;
-  ap->index = (ap->index + 1) % ap->delay;
-  return output;
+/* In place over a block, in spans that end at the delay wrap */
+static void ae_allpass_process(ae_allpass_t *ap, float *samples,
+                               size_t frames) {
+  float scratch[AE_ER_TILE];
+  size_t i = 0;
+  while (i < frames) {
+    size_t n = frames - i;
+    if (n > AE_ER_TILE)
+      n = AE_ER_TILE;
+    if (n > ap->delay - ap->index)
+      n = ap->delay - ap->index;
+    float *buf = ae_delay_span_load(&ap->buffer, ap->index, n, scratch);
+    for (size_t k = 0; k < n; ++k) {
+      float input = samples[i + k];
+      float delayed = buf[k];
+      samples[i + k] = -input + delayed;
+      buf[k] = input + delayed * ap->feedback;
+    }
+    ae_delay_span_store(&ap->buffer, ap->index, buf, n);
+    ap->index += n;
+    if (ap->index >= ap->delay)
+      ap->index = 0;
+    i += n;
+  }
 }
 
+/**
+ * Build the ER tap table for a room size. The 12 legacy taps are anchors;
+ * denser tables place extra taps between them, interpolating delay, decay and
+ * pan, with the gains scaled so the total ER energy does not depend on the
+ * tap count. Pan law gains are folded into per-tap L/R gains here so the
+ * block engine only multiply-adds.
+ */
 static void ae_early_reflections_update(ae_early_reflections_t *early,
                                         float room_size, float sample_rate) {
   static const float base_ms[AE_ER_TAPS] = {7.0f, 11.0f, 17.0f, 23.0f,
                                             29.0f, 37.0f, 45.0f, 53.0f,
                                             61.0f, 73.0f, 89.0f, 101.0f};
-  size_t count = AE_ER_TAPS;
+  if (early->geometric || room_size == early->room_size)
+    return;
+  size_t count = early->tap_count;
   float scale = 0.6f + 0.8f * room_size;
+  float last = (float)(AE_ER_TAPS - 1);
+  float density = sqrtf((float)AE_ER_TAPS / (float)count);
   for (size_t i = 0; i < count; ++i) {
-    float ms = base_ms[i] * scale;
-    size_t delay = (size_t)(ms * 0.001f * sample_rate);
-    if (delay >= early->size)
-      delay = early->size - 1;
+    float pos = count > 1 ? last * (float)i / (float)(count - 1) : 0.0f;
+    size_t anchor = (size_t)pos;
+    if (anchor >= AE_ER_TAPS - 1)
+      anchor = AE_ER_TAPS - 2;
+    float frac = pos - (float)anchor;
+    float ms = base_ms[anchor] + (base_ms[anchor + 1] - base_ms[anchor]) * frac;
+    size_t delay = (size_t)(ms * scale * 0.001f * sample_rate);
+    if (delay > early->max_delay)
+      delay = early->max_delay;
     early->delay_samples[i] = delay;
-    early->gains[i] = 0.6f * powf(0.75f, (float)i);
-    float pan = -0.8f + (1.6f * (float)i / (float)(count - 1));
-    early->pans[i] = pan;
+    float gain = 0.6f * powf(0.75f, pos) * density;
+    float pan = -0.8f + 1.6f * pos / last;
+    early->gain_l[i] = gain * 0.5f * (1.0f - pan);
+    early->gain_r[i] = gain * 0.5f * (1.0f + pan);
   }
-  early->tap_count = count;
+  early->room_size = room_size;
+}
+
+/**
+ * Build the velvet-noise pulse table: one pulse at a random position in each
+ * of tap_count equal segments of a 20-50 ms span (longer for bigger rooms),
+ * with a random sign. Diffusion sets the pulse count. The sequence is seeded
+ * identically every time so a given setting always sounds the same.
+ */
+static void ae_velvet_update(ae_velvet_t *velvet, size_t pre_delay,
+                             float room_size, float diffusion,
+                             float sample_rate) {
+  if (pre_delay == velvet->pre_delay && room_size == velvet->room_size &&
+      diffusion == velvet->diffusion)
+    return;
+  size_t count =
+      AE_VELVET_MIN_TAPS +
+      (size_t)((AE_VELVET_MAX_TAPS - AE_VELVET_MIN_TAPS) * diffusion + 0.5f);
+  if (count > AE_VELVET_MAX_TAPS)
+    count = AE_VELVET_MAX_TAPS;
+  float span = (0.02f + 0.03f * room_size) * sample_rate;
+  float segment = span / (float)count;
+
+  size_t positive[AE_VELVET_MAX_TAPS];
+  size_t negative[AE_VELVET_MAX_TAPS];
+  size_t n_pos = 0;
+  size_t n_neg = 0;
+  uint32_t seed = 0x9E3779B9u;
+  for (size_t i = 0; i < count; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    float r1 = (float)(seed >> 8) / 16777216.0f;
+    seed = seed * 1664525u + 1013904223u;
+    size_t offset = pre_delay + (size_t)((float)i * segment +
+                                         r1 * (segment - 1.0f));
+    if (seed & 0x80000000u)
+      positive[n_pos++] = offset;
+    else
+      negative[n_neg++] = offset;
+  }
+  memcpy(velvet->offset, positive, n_pos * sizeof(size_t));
+  memcpy(velvet->offset + n_pos, negative, n_neg * sizeof(size_t));
+  velvet->tap_count = count;
+  velvet->positive_count = n_pos;
+
+  /* Match the energy gain of the allpass pair it replaces: each stage's
+   * impulse response is -1 followed by a feedback^k tail */
+  float fb = 0.5f + 0.4f * diffusion;
+  float stage_energy = 1.0f + 1.0f / (1.0f - fb * fb);
+  velvet->norm = stage_energy / sqrtf((float)count);
+  velvet->pre_delay = pre_delay;
+  velvet->room_size = room_size;
+  velvet->diffusion = diffusion;
 }
 
 static void ae_hadamard_8(float *v) {
@@ -57,18 +143,172 @@ static void ae_hadamard_8(float *v) {
   v[7] = b3 - b7;
 }
 
+/* Damping at or above this runs the late reverb at half rate (AUTO mode). The
+ * matching brightness of -1/3 already low-passes the reverb send to ~6 kHz and
+ * the per-pass damping pole sits near 2.5 kHz, so nothing audible remains
+ * above the 12 kHz Nyquist of the decimated FDN. */
+#define AE_REVERB_HALF_RATE_ENTER 0.7f
+#define AE_REVERB_HALF_RATE_EXIT 0.66f
+#define AE_HALFBAND_CENTER (2 * AE_HALFBAND_PAIRS - 1)
+#define AE_HALFBAND_MASK (AE_HALFBAND_HISTORY - 1)
+
+/**
+ * Design a Blackman-windowed halfband lowpass. Only the odd offsets from the
+ * center are non-zero; they are normalized for unity DC gain.
+ */
+static void ae_halfband_init(ae_halfband_t *hb) {
+  float span = (float)(4 * AE_HALFBAND_PAIRS);
+  float sum = 0.0f;
+  for (size_t j = 0; j < AE_HALFBAND_PAIRS; ++j) {
+    float d = (float)(2 * j + 1);
+    float sinc = sinf(0.5f * (float)M_PI * d) / ((float)M_PI * d);
+    float n = (float)AE_HALFBAND_CENTER + d + 1.0f;
+    float w = 0.42f - 0.5f * cosf(2.0f * (float)M_PI * n / span) +
+              0.08f * cosf(4.0f * (float)M_PI * n / span);
+    hb->coeffs[j] = sinc * w;
+    sum += hb->coeffs[j];
+  }
+  for (size_t j = 0; j < AE_HALFBAND_PAIRS; ++j)
+    hb->coeffs[j] *= 0.25f / sum;
+}
+
+static void ae_halfband_reset(ae_halfband_t *hb) {
+  memset(hb->dec_history, 0, sizeof(hb->dec_history));
+  memset(hb->int_history_l, 0, sizeof(hb->int_history_l));
+  memset(hb->int_history_r, 0, sizeof(hb->int_history_r));
+  hb->dec_index = 0;
+  hb->int_index = 0;
+  hb->pending_l = 0.0f;
+  hb->pending_r = 0.0f;
+  hb->phase = 0;
+}
+
+/**
+ * Decimate by 2. Emits one sample for every second input sample (carrying the
+ * phase across blocks) and returns the number of samples written to out.
+ */
+static size_t ae_halfband_decimate(ae_halfband_t *hb, const float *in,
+                                   float *out, size_t frames) {
+  const float *h = hb->coeffs;
+  const float *x = hb->dec_history;
+  size_t count = 0;
+  for (size_t i = 0; i < frames; ++i) {
+    size_t n = hb->dec_index;
+    hb->dec_history[n] = in[i];
+    hb->dec_index = (n + 1) & AE_HALFBAND_MASK;
+    hb->phase ^= 1u;
+    if (hb->phase)
+      continue;
+
+    size_t c = n - AE_HALFBAND_CENTER;
+    float acc = 0.5f * x[c & AE_HALFBAND_MASK];
+    for (size_t j = 0; j < AE_HALFBAND_PAIRS; ++j) {
+      size_t d = 2 * j + 1;
+      acc += h[j] * (x[(c + d) & AE_HALFBAND_MASK] +
+                     x[(c - d) & AE_HALFBAND_MASK]);
+    }
+    out[count++] = acc;
+  }
+  return count;
+}
+
+static void ae_halfband_push(float *history, size_t m, const float *h,
+                             float value, float *first, float *second) {
+  history[m] = value;
+  size_t mid = m - (AE_HALFBAND_PAIRS - 1);
+  float acc = 0.0f;
+  for (size_t j = 0; j < AE_HALFBAND_PAIRS; ++j) {
+    acc += h[j] * (history[(mid + j) & AE_HALFBAND_MASK] +
+                   history[(mid - 1 - j) & AE_HALFBAND_MASK]);
+  }
+  *first = 2.0f * acc;
+  *second = history[mid & AE_HALFBAND_MASK];
+}
+
+/**
+ * Interpolate by 2 back onto the full-rate timeline. `phase` is the decimator
+ * phase at the start of the block, so each decimated sample lands on the input
+ * sample that produced it and the second half of the pair on the next one.
+ */
+static void ae_halfband_interpolate(ae_halfband_t *hb, unsigned phase,
+                                    const float *in_l, const float *in_r,
+                                    float *out_l, float *out_r,
+                                    size_t frames) {
+  size_t j = 0;
+  for (size_t i = 0; i < frames; ++i) {
+    phase ^= 1u;
+    if (phase) {
+      out_l[i] = hb->pending_l;
+      out_r[i] = hb->pending_r;
+      continue;
+    }
+    size_t m = hb->int_index;
+    hb->int_index = (m + 1) & AE_HALFBAND_MASK;
+    ae_halfband_push(hb->int_history_l, m, hb->coeffs, in_l[j], &out_l[i],
+                     &hb->pending_l);
+    ae_halfband_push(hb->int_history_r, m, hb->coeffs, in_r[j], &out_r[i],
+                     &hb->pending_r);
+    ++j;
+  }
+}
+
+static size_t ae_reverb_select_decimation(const struct ae_reverb *reverb,
+                                          float damping) {
+  switch (reverb->rate_mode) {
+  case AE_REVERB_RATE_FULL:
+    return 1;
+  case AE_REVERB_RATE_HALF:
+    return 2;
+  case AE_REVERB_RATE_AUTO:
+  default:
+    if (reverb->decimation == 2)
+      return damping >= AE_REVERB_HALF_RATE_EXIT ? 2 : 1;
+    return damping >= AE_REVERB_HALF_RATE_ENTER ? 2 : 1;
+  }
+}
+
+static void ae_reverb_reset_late(struct ae_reverb *reverb) {
+  for (size_t i = 0; i < AE_FDN_CHANNELS; ++i) {
+    ae_delay_buffer_clear(&reverb->lines[i].buffer, reverb->lines[i].size);
+    reverb->lines[i].index = 0;
+    reverb->lines[i].filter_state = 0.0f;
+  }
+  ae_halfband_reset(&reverb->halfband);
+}
+
+/* Configured ER tap count: 0 selects the default, larger values clamp */
+static size_t ae_reverb_tap_count(uint32_t taps) {
+  if (taps == 0)
+    return AE_ER_TAPS;
+  return taps > AE_ER_MAX_TAPS ? AE_ER_MAX_TAPS : taps;
+}
+
 void ae_reverb_init(ae_engine_t *engine) {
   if (!engine)
     return;
   struct ae_reverb *reverb = &engine->reverb;
   reverb->sample_rate = (float)engine->config.sample_rate;
   reverb->lfo_phase = 0.0f;
+  reverb->rate_mode = engine->config.reverb_rate;
+  reverb->decimation = ae_reverb_select_decimation(reverb, 0.5f);
+  reverb->pending_decimation = reverb->decimation;
+  ae_halfband_init(&reverb->halfband);
+  ae_halfband_reset(&reverb->halfband);
+
+  size_t block = engine->config.max_buffer_size;
+  reverb->block_size = block;
+  reverb->diffused = (float *)calloc(block, sizeof(float));
+  reverb->late_in = (float *)calloc(block / 2 + 1, sizeof(float));
+  reverb->late_l = (float *)calloc(block / 2 + 1, sizeof(float));
+  reverb->late_r = (float *)calloc(block / 2 + 1, sizeof(float));
 
   size_t max_delay = (size_t)(reverb->sample_rate * 0.1f) + 1;
+  reverb->rate_scratch = (float *)calloc(2 * max_delay, sizeof(float));
   size_t max_er = (size_t)(reverb->sample_rate * 0.2f) + 1;
+  ae_delay_storage_t storage = engine->config.delay_storage;
 
   for (size_t i = 0; i < AE_FDN_CHANNELS; ++i) {
-    reverb->lines[i].buffer = (float *)calloc(max_delay, sizeof(float));
+    ae_delay_buffer_alloc(&reverb->lines[i].buffer, max_delay, storage);
     reverb->lines[i].size = max_delay;
     reverb->lines[i].delay = max_delay;
     reverb->lines[i].index = 0;
@@ -77,8 +317,19 @@ void ae_reverb_init(ae_engine_t *engine) {
     reverb->lines[i].filter_state = 0.0f;
   }
 
+  reverb->diffuser = engine->config.diffuser;
+  if (reverb->diffuser == AE_DIFFUSER_VELVET) {
+    size_t size = max_delay + (size_t)(reverb->sample_rate * 0.05f) + block;
+    if (ae_delay_buffer_alloc(&reverb->velvet.buffer, size, storage))
+      reverb->velvet.size = size;
+  }
+  /* The velvet filter folds the pre-delay into its pulse offsets, so the
+   * allpass rings are only needed without it (or as its fallback) */
+  bool allpass = !reverb->velvet.buffer.data;
+
   for (size_t i = 0; i < 2; ++i) {
-    reverb->diffusion[i].buffer = (float *)calloc(max_delay, sizeof(float));
+    if (allpass)
+      ae_delay_buffer_alloc(&reverb->diffusion[i].buffer, max_delay, storage);
     reverb->diffusion[i].size = max_delay;
     reverb->diffusion[i].delay = max_delay;
     reverb->diffusion[i].index = 0;
@@ -87,14 +338,26 @@ void ae_reverb_init(ae_engine_t *engine) {
 
   reverb->pre_delay_size = max_delay;
   reverb->pre_delay_delay = 1;
-  reverb->pre_delay = (float *)calloc(reverb->pre_delay_size, sizeof(float));
+  if (allpass)
+    ae_delay_buffer_alloc(&reverb->pre_delay, reverb->pre_delay_size,
+                          storage);
   reverb->pre_delay_index = 0;
+  reverb->velvet.index = 0;
+  reverb->velvet.room_size = -1.0f;
 
-  reverb->early.buffer = (float *)calloc(max_er, sizeof(float));
-  reverb->early.size = max_er;
+  size_t taps = ae_reverb_tap_count(engine->config.early_reflection_taps);
+  ae_delay_buffer_alloc(&reverb->early.buffer, max_er + block, storage);
+  ae_delay_buffer_alloc(&reverb->early.dry_buffer, max_er + block, storage);
+  reverb->early.size = max_er + block;
+  reverb->early.max_delay = max_er - 1;
   reverb->early.index = 0;
-  reverb->early.tap_count = AE_ER_TAPS;
+  reverb->early.tap_count = taps;
+  reverb->early.room_size = -1.0f;
+  reverb->early.geometric = false;
+  reverb->early.fading = false;
+  reverb->early.fade_step = 1.0f / (AE_ER_FADE_S * reverb->sample_rate);
   ae_early_reflections_update(&reverb->early, 0.5f, reverb->sample_rate);
+  AE_ATOMIC_STORE_INT(&reverb->er_pending_state, AE_ER_SLOT_FREE);
 
   ae_reverb_update_params(engine, 0.5f, 3.0f, 0.5f, 0.5f);
   ae_reverb_reset(engine);
@@ -104,18 +367,18 @@ void ae_reverb_reset(ae_engine_t *engine) {
   if (!engine)
     return;
   struct ae_reverb *reverb = &engine->reverb;
-  for (size_t i = 0; i < AE_FDN_CHANNELS; ++i) {
-    ae_clear_buffer(reverb->lines[i].buffer, reverb->lines[i].size);
-    reverb->lines[i].index = 0;
-    reverb->lines[i].filter_state = 0.0f;
-  }
+  ae_reverb_reset_late(reverb);
   for (size_t i = 0; i < 2; ++i) {
-    ae_clear_buffer(reverb->diffusion[i].buffer, reverb->diffusion[i].size);
+    ae_delay_buffer_clear(&reverb->diffusion[i].buffer,
+                          reverb->diffusion[i].size);
     reverb->diffusion[i].index = 0;
   }
-  ae_clear_buffer(reverb->pre_delay, reverb->pre_delay_size);
+  ae_delay_buffer_clear(&reverb->pre_delay, reverb->pre_delay_size);
   reverb->pre_delay_index = 0;
-  ae_clear_buffer(reverb->early.buffer, reverb->early.size);
+  ae_delay_buffer_clear(&reverb->velvet.buffer, reverb->velvet.size);
+  reverb->velvet.index = 0;
+  ae_delay_buffer_clear(&reverb->early.buffer, reverb->early.size);
+  ae_delay_buffer_clear(&reverb->early.dry_buffer, reverb->early.size);
   reverb->early.index = 0;
 }
 
@@ -131,6 +394,14 @@ void ae_reverb_update_params(ae_engine_t *engine, float room_size, float rt60,
   float scale = 0.7f + 0.8f * room_size;
   float sr_scale = reverb->sample_rate / 44100.0f;
 
+  /* Only ae_reverb_settle_rate switches, at a block boundary */
+  reverb->pending_decimation = ae_reverb_select_decimation(reverb, damping);
+  size_t decimation = reverb->decimation;
+  float late_rate = reverb->sample_rate / (float)decimation;
+  float late_scale = late_rate / 44100.0f;
+  float late_damping = decimation > 1 ? powf(damping, (float)decimation)
+                                      : damping;
+
   reverb->room_size = room_size;
   reverb->rt60 = rt60;
   reverb->diffusion_amount = diffusion;
@@ -143,9 +414,12 @@ void ae_reverb_update_params(ae_engine_t *engine, float room_size, float rt60,
   if (pre_delay >= reverb->pre_delay_size)
     pre_delay = reverb->pre_delay_size - 1;
   reverb->pre_delay_delay = pre_delay;
+  if (reverb->diffuser == AE_DIFFUSER_VELVET)
+    ae_velvet_update(&reverb->velvet, pre_delay, room_size, diffusion,
+                     reverb->sample_rate);
 
   for (size_t i = 0; i < AE_FDN_CHANNELS; ++i) {
-    size_t delay = (size_t)(base_delays[i] * sr_scale * scale);
+    size_t delay = (size_t)(base_delays[i] * late_scale * scale);
     if (delay < 1)
       delay = 1;
     if (delay >= reverb->lines[i].size)
@@ -153,9 +427,9 @@ void ae_reverb_update_params(ae_engine_t *engine, float room_size, float rt60,
     reverb->lines[i].delay = delay;
     if (reverb->lines[i].index >= reverb->lines[i].delay)
       reverb->lines[i].index %= reverb->lines[i].delay;
-    reverb->lines[i].damping = damping;
+    reverb->lines[i].damping = late_damping;
     reverb->lines[i].feedback =
-        powf(10.0f, (-3.0f * (float)delay) / (rt60 * reverb->sample_rate));
+        powf(10.0f, (-3.0f * (float)delay) / (rt60 * late_rate));
   }
 
   for (size_t i = 0; i < 2; ++i) {
@@ -173,78 +447,406 @@ void ae_reverb_update_params(ae_engine_t *engine, float room_size, float rt60,
   ae_early_reflections_update(&reverb->early, room_size, reverb->sample_rate);
 }
 
-void ae_reverb_process_block(ae_engine_t *engine, const float *input,
-                             float *out_l, float *out_r, size_t frames) {
-  if (!engine || !input || !out_l || !out_r || frames == 0)
+static void ae_reverb_diffuse(struct ae_reverb *reverb, const float *input,
+                              float *out, size_t frames) {
+  /* Pre-delay in spans short enough that the read never overtakes the
+   * write and neither crosses the end of the ring */
+  size_t size = reverb->pre_delay_size;
+  size_t delay = reverb->pre_delay_delay;
+  size_t i = 0;
+  while (i < frames) {
+    size_t write = reverb->pre_delay_index;
+    size_t read = write >= delay ? write - delay : write + size - delay;
+    size_t n = frames - i;
+    if (n > delay)
+      n = delay;
+    if (n > size - read)
+      n = size - read;
+    if (n > size - write)
+      n = size - write;
+    const float *pre = ae_delay_span_load(&reverb->pre_delay, read, n, out + i);
+    if (pre != out + i)
+      memcpy(out + i, pre, n * sizeof(float));
+    ae_delay_span_store(&reverb->pre_delay, write, input + i, n);
+    reverb->pre_delay_index = write + n == size ? 0 : write + n;
+    i += n;
+  }
+
+  ae_allpass_process(&reverb->diffusion[0], out, frames);
+  ae_allpass_process(&reverb->diffusion[1], out, frames);
+}
+
+/**
+ * Velvet-noise diffusion with the pre-delay folded into the pulse offsets.
+ * Each pulse is a span of the input buffer added or subtracted into the
+ * output, so the FIR costs no multiplies until the single unit-energy scale.
+ */
+static void ae_reverb_diffuse_velvet(struct ae_reverb *reverb,
+                                     const float *input, float *out,
+                                     size_t frames) {
+  ae_velvet_t *velvet = &reverb->velvet;
+  size_t size = velvet->size;
+
+  size_t start = velvet->index;
+  ae_delay_write_span(&velvet->buffer, size, start, input, frames);
+  velvet->index = (start + frames) % size;
+  ae_clear_buffer(out, frames);
+  float scratch[AE_ER_TILE];
+
+  for (size_t tile = 0; tile < frames; tile += AE_ER_TILE) {
+    size_t n = frames - tile < AE_ER_TILE ? frames - tile : AE_ER_TILE;
+    size_t pos = (start + tile) % size;
+    float *dst = out + tile;
+    for (size_t t = 0; t < velvet->tap_count; ++t) {
+      size_t read = pos >= velvet->offset[t] ? pos - velvet->offset[t]
+                                             : pos + size - velvet->offset[t];
+      size_t span = size - read < n ? size - read : n;
+      const float *a =
+          ae_delay_span_load(&velvet->buffer, read, span, scratch);
+      if (t < velvet->positive_count)
+        ae_simd_add(dst, dst, a, span);
+      else
+        ae_simd_sub(dst, dst, a, span);
+      if (span < n) {
+        const float *b =
+            ae_delay_span_load(&velvet->buffer, 0, n - span, scratch);
+        if (t < velvet->positive_count)
+          ae_simd_add(dst + span, dst + span, b, n - span);
+        else
+          ae_simd_sub(dst + span, dst + span, b, n - span);
+      }
+    }
+  }
+  ae_simd_scale(out, out, velvet->norm, frames);
+}
+
+/**
+ * Early reflections, accumulated onto the late reverb output. The block is
+ * written to the ER buffers first; every tap is then a contiguous span (split
+ * at most once at the wrap point) mixed into L/R with a SIMD multiply-add.
+ * Frames are tiled so the output stays in L1 across all taps.
+ */
+/* Mix one tap set over a tile starting at ring position pos */
+static void ae_early_mix_taps(const ae_early_reflections_t *early,
+                              bool geometric, size_t count,
+                              const size_t *delays, const float *gain_l,
+                              const float *gain_r, size_t pos, float *out_l,
+                              float *out_r, size_t n) {
+  const ae_delay_buffer_t *ring =
+      geometric ? &early->dry_buffer : &early->buffer;
+  size_t size = early->size;
+  float scratch[AE_ER_TILE];
+  for (size_t t = 0; t < count; ++t) {
+    size_t read = pos >= delays[t] ? pos - delays[t] : pos + size - delays[t];
+    size_t span = size - read < n ? size - read : n;
+    ae_simd_mix_gain_stereo(
+        out_l, out_r, ae_delay_span_load(ring, read, span, scratch),
+        gain_l[t], gain_r[t], span);
+    if (span < n)
+      ae_simd_mix_gain_stereo(
+          out_l + span, out_r + span,
+          ae_delay_span_load(ring, 0, n - span, scratch),
+          gain_l[t], gain_r[t], n - span);
+  }
+}
+
+/*
+ * Both rings are written every block, so a swap between room_size and
+ * geometric taps finds each set's own history in place and the crossfade
+ * never reads diffused samples through dry taps or the other way round.
+ */
+static void ae_reverb_early(struct ae_reverb *reverb, const float *dry,
+                            const float *diffused, float *out_l,
+                            float *out_r, size_t frames) {
+  ae_early_reflections_t *early = &reverb->early;
+  size_t size = early->size;
+
+  size_t start = early->index;
+  ae_delay_write_span(&early->buffer, size, start, diffused, frames);
+  ae_delay_write_span(&early->dry_buffer, size, start, dry, frames);
+  early->index = (start + frames) % size;
+
+  for (size_t tile = 0; tile < frames; tile += AE_ER_TILE) {
+    size_t n = frames - tile < AE_ER_TILE ? frames - tile : AE_ER_TILE;
+    size_t pos = (start + tile) % size;
+    if (!early->fading) {
+      ae_early_mix_taps(early, early->geometric, early->tap_count,
+                        early->delay_samples, early->gain_l, early->gain_r,
+                        pos, out_l + tile, out_r + tile, n);
+      continue;
+    }
+    /* A new table was installed: fade from the old taps over AE_ER_FADE_S,
+     * carrying the fade position across blocks */
+    float new_l[AE_ER_TILE] = {0}, new_r[AE_ER_TILE] = {0};
+    float old_l[AE_ER_TILE] = {0}, old_r[AE_ER_TILE] = {0};
+    const ae_er_table_t *fade = &early->fade;
+    ae_early_mix_taps(early, early->geometric, early->tap_count,
+                      early->delay_samples, early->gain_l, early->gain_r,
+                      pos, new_l, new_r, n);
+    ae_early_mix_taps(early, fade->geometric, fade->tap_count,
+                      fade->delay_samples, fade->gain_l, fade->gain_r, pos,
+                      old_l, old_r, n);
+    float w = early->fade_gain;
+    for (size_t k = 0; k < n; ++k) {
+      w = fminf(w + early->fade_step, 1.0f);
+      out_l[tile + k] += old_l[k] + (new_l[k] - old_l[k]) * w;
+      out_r[tile + k] += old_r[k] + (new_r[k] - old_r[k]) * w;
+    }
+    early->fade_gain = w;
+    early->fading = w < 1.0f;
+  }
+}
+
+/**
+ * Hand a tap table to the audio thread (called from the geometry worker).
+ * The slot is claimed with a CAS, so a table the audio thread has not picked
+ * up yet is simply overwritten; only an install in progress makes the writer
+ * wait, and that is a copy of a few kilobytes.
+ */
+void ae_reverb_publish_early(ae_engine_t *engine, const ae_er_table_t *table) {
+  if (!engine || !table)
     return;
   struct ae_reverb *reverb = &engine->reverb;
-  float modulation = AE_ATOMIC_LOAD(&engine->modulation);
+  while (!AE_ATOMIC_CAS_INT(&reverb->er_pending_state, AE_ER_SLOT_FREE,
+                            AE_ER_SLOT_WRITING) &&
+         !AE_ATOMIC_CAS_INT(&reverb->er_pending_state, AE_ER_SLOT_READY,
+                            AE_ER_SLOT_WRITING))
+    ae_thread_yield();
+  memcpy(&reverb->er_pending, table, sizeof(*table));
+  AE_ATOMIC_STORE_INT(&reverb->er_pending_state, AE_ER_SLOT_READY);
+}
 
-  for (size_t i = 0; i < frames; ++i) {
-    size_t read_pos =
-        (reverb->pre_delay_index + reverb->pre_delay_size -
-         reverb->pre_delay_delay) %
-        reverb->pre_delay_size;
-    float pre = reverb->pre_delay[read_pos];
-    reverb->pre_delay[reverb->pre_delay_index] = input[i];
-    reverb->pre_delay_index =
-        (reverb->pre_delay_index + 1) % reverb->pre_delay_size;
-
-    float diffused = pre;
-    diffused = ae_allpass_process(&reverb->diffusion[0], diffused);
-    diffused = ae_allpass_process(&reverb->diffusion[1], diffused);
-
-    float er_l = 0.0f;
-    float er_r = 0.0f;
-    reverb->early.buffer[reverb->early.index] = diffused;
-    for (size_t t = 0; t < reverb->early.tap_count; ++t) {
-      size_t tap =
-          (reverb->early.index + reverb->early.size -
-           reverb->early.delay_samples[t]) %
-          reverb->early.size;
-      float tap_val = reverb->early.buffer[tap] * reverb->early.gains[t];
-      float pan = reverb->early.pans[t];
-      float gain_l = 0.5f * (1.0f - pan);
-      float gain_r = 0.5f * (1.0f + pan);
-      er_l += tap_val * gain_l;
-      er_r += tap_val * gain_r;
+/* Install a published tap table at a block boundary (audio thread) */
+static void ae_reverb_install_early(ae_engine_t *engine) {
+  struct ae_reverb *reverb = &engine->reverb;
+  /* A table published mid-fade waits in the slot (newer ones overwrite it)
+   * until the running fade completes, so the audible mix never jumps */
+  if (reverb->early.fading ||
+      !AE_ATOMIC_CAS_INT(&reverb->er_pending_state, AE_ER_SLOT_READY,
+                         AE_ER_SLOT_READING))
+    return;
+  ae_early_reflections_t *early = &reverb->early;
+  const ae_er_table_t *table = &reverb->er_pending;
+  /* Keep the outgoing taps so the next blocks can fade them out */
+  ae_er_table_t *fade = &early->fade;
+  fade->geometric = early->geometric;
+  fade->tap_count = early->tap_count;
+  memcpy(fade->delay_samples, early->delay_samples,
+         early->tap_count * sizeof(size_t));
+  memcpy(fade->gain_l, early->gain_l, early->tap_count * sizeof(float));
+  memcpy(fade->gain_r, early->gain_r, early->tap_count * sizeof(float));
+  if (table->geometric) {
+    size_t count = table->tap_count;
+    if (count > AE_ER_MAX_TAPS)
+      count = AE_ER_MAX_TAPS;
+    for (size_t i = 0; i < count; ++i) {
+      size_t delay = table->delay_samples[i];
+      early->delay_samples[i] =
+          delay > early->max_delay ? early->max_delay : delay;
+      early->gain_l[i] = table->gain_l[i];
+      early->gain_r[i] = table->gain_r[i];
     }
-    reverb->early.index = (reverb->early.index + 1) % reverb->early.size;
+    early->tap_count = count;
+    early->geometric = true;
+    early->fading = true;
+    early->fade_gain = 0.0f;
+  } else if (early->geometric) {
+    early->tap_count =
+        ae_reverb_tap_count(engine->config.early_reflection_taps);
+    early->geometric = false;
+    early->room_size = -1.0f;
+    ae_early_reflections_update(early, AE_ATOMIC_LOAD(&engine->room_size),
+                                reverb->sample_rate);
+    early->fading = true;
+    early->fade_gain = 0.0f;
+  }
+  AE_ATOMIC_STORE_INT(&reverb->er_pending_state, AE_ER_SLOT_FREE);
+}
+
+/* FDN late reverb at sample_rate / decimation */
+static void ae_reverb_late(struct ae_reverb *reverb, const float *input,
+                           float *out_l, float *out_r, size_t frames,
+                           float modulation) {
+  float late_rate = reverb->sample_rate / (float)reverb->decimation;
+  float norm = 1.0f / sqrtf((float)AE_FDN_CHANNELS);
 
-    float fdn_out[AE_FDN_CHANNELS];
+  /* Work in spans that end before any line wraps, so each line is loaded
+   * and stored once per span rather than converted per sample */
+  float scratch[AE_FDN_CHANNELS][AE_ER_TILE];
+  float *taps[AE_FDN_CHANNELS];
+  size_t i = 0;
+  while (i < frames) {
+    size_t n = frames - i;
+    if (n > AE_ER_TILE)
+      n = AE_ER_TILE;
+    for (size_t c = 0; c < AE_FDN_CHANNELS; ++c) {
+      size_t room = reverb->lines[c].delay - reverb->lines[c].index;
+      if (n > room)
+        n = room;
+    }
     for (size_t c = 0; c < AE_FDN_CHANNELS; ++c) {
       ae_fdn_delay_t *line = &reverb->lines[c];
-      float sample = line->buffer[line->index];
-      line->filter_state =
-          sample + (line->filter_state - sample) * line->damping;
-      fdn_out[c] = line->filter_state;
+      taps[c] = ae_delay_span_load(&line->buffer, line->index, n, scratch[c]);
     }
 
-    float feedback_vec[AE_FDN_CHANNELS];
-    memcpy(feedback_vec, fdn_out, sizeof(feedback_vec));
-    ae_hadamard_8(feedback_vec);
-    float norm = 1.0f / sqrtf((float)AE_FDN_CHANNELS);
+    for (size_t k = 0; k < n; ++k) {
+      float fdn_out[AE_FDN_CHANNELS];
+      for (size_t c = 0; c < AE_FDN_CHANNELS; ++c) {
+        ae_fdn_delay_t *line = &reverb->lines[c];
+        float sample = taps[c][k];
+        line->filter_state =
+            sample + (line->filter_state - sample) * line->damping;
+        fdn_out[c] = line->filter_state;
+      }
+
+      float feedback_vec[AE_FDN_CHANNELS];
+      memcpy(feedback_vec, fdn_out, sizeof(feedback_vec));
+      ae_hadamard_8(feedback_vec);
+
+      /* 1% depth: the 1e-2 tier is far below audibility here */
+      float lfo = ae_fast_sinf(2.0f * (float)M_PI * reverb->lfo_phase,
+                               AE_MATH_1E2);
+      float mod = 1.0f + modulation * 0.01f * lfo;
+      reverb->lfo_phase += 0.25f / late_rate;
+      if (reverb->lfo_phase >= 1.0f)
+        reverb->lfo_phase -= 1.0f;
+
+      float input_sample = input[i + k] * mod;
+      for (size_t c = 0; c < AE_FDN_CHANNELS; ++c)
+        taps[c][k] = input_sample +
+                     feedback_vec[c] * norm * reverb->lines[c].feedback;
 
-    float mod = 1.0f +
-                modulation * 0.01f *
-                    sinf(2.0f * (float)M_PI * reverb->lfo_phase);
-    reverb->lfo_phase += 0.25f / reverb->sample_rate;
-    if (reverb->lfo_phase >= 1.0f)
-      reverb->lfo_phase -= 1.0f;
+      out_l[i + k] =
+          0.25f * (fdn_out[0] + fdn_out[1] + fdn_out[2] + fdn_out[3]);
+      out_r[i + k] =
+          0.25f * (fdn_out[4] + fdn_out[5] + fdn_out[6] + fdn_out[7]);
+    }
 
     for (size_t c = 0; c < AE_FDN_CHANNELS; ++c) {
       ae_fdn_delay_t *line = &reverb->lines[c];
-      float input_sample = diffused * mod;
-      line->buffer[line->index] =
-          input_sample + feedback_vec[c] * norm * line->feedback;
-      line->index = (line->index + 1) % line->delay;
+      ae_delay_span_store(&line->buffer, line->index, taps[c], n);
+      line->index += n;
+      if (line->index >= line->delay)
+        line->index = 0;
+    }
+    i += n;
+  }
+}
+
+/* Copy n samples of a line from ring position start into out */
+static void ae_reverb_line_copy(const ae_fdn_delay_t *line, size_t start,
+                                size_t n, float *out) {
+  const float *span = ae_delay_span_load(&line->buffer, start, n, out);
+  if (span != out)
+    memcpy(out, span, n * sizeof(float));
+}
+
+/* Linearly interpolated history sample at fractional position p */
+static float ae_reverb_line_sample(const float *history, size_t length,
+                                   float p) {
+  if (p <= 0.0f)
+    return history[0];
+  size_t k = (size_t)p;
+  if (k + 1 >= length)
+    return history[length - 1];
+  float frac = p - (float)k;
+  return history[k] + (history[k + 1] - history[k]) * frac;
+}
+
+/**
+ * Apply a pending AUTO rate change at a block boundary. Each line keeps its
+ * contents: the ring is unrolled oldest first and resampled onto the new
+ * line length, newest samples aligned, so the tail carries on through the
+ * switch. Going down a rate, a [1/4, 1/2, 1/4] smoother stands in for the
+ * halfband (the damping that selects half rate already removed the highs).
+ * Only the short halfband history restarts from zero.
+ */
+static void ae_reverb_settle_rate(ae_engine_t *engine) {
+  struct ae_reverb *reverb = &engine->reverb;
+  if (reverb->pending_decimation == reverb->decimation)
+    return;
+  size_t old_delay[AE_FDN_CHANNELS];
+  size_t old_index[AE_FDN_CHANNELS];
+  for (size_t c = 0; c < AE_FDN_CHANNELS; ++c) {
+    old_delay[c] = reverb->lines[c].delay;
+    old_index[c] = reverb->lines[c].index;
+  }
+  /* Old samples per new sample */
+  float step = (float)reverb->pending_decimation / (float)reverb->decimation;
+  reverb->decimation = reverb->pending_decimation;
+  ae_halfband_reset(&reverb->halfband);
+  ae_reverb_update_params(engine, reverb->room_size, reverb->rt60,
+                          reverb->diffusion_amount, reverb->damping);
+  if (!reverb->rate_scratch) {
+    ae_reverb_reset_late(reverb);
+    return;
+  }
+
+  float *history = reverb->rate_scratch;
+  float *resampled = history + reverb->lines[0].size;
+  for (size_t c = 0; c < AE_FDN_CHANNELS; ++c) {
+    ae_fdn_delay_t *line = &reverb->lines[c];
+    size_t length = old_delay[c];
+    size_t head = length - old_index[c];
+    ae_reverb_line_copy(line, old_index[c], head, history);
+    ae_reverb_line_copy(line, 0, old_index[c], history + head);
+    size_t delay = line->delay;
+    for (size_t j = 0; j < delay; ++j) {
+      float p = (float)(length - 1) - (float)(delay - 1 - j) * step;
+      float x = ae_reverb_line_sample(history, length, p);
+      if (step > 1.0f)
+        x = 0.5f * x +
+            0.25f * (ae_reverb_line_sample(history, length, p - 1.0f) +
+                     ae_reverb_line_sample(history, length, p + 1.0f));
+      resampled[j] = x;
     }
+    ae_delay_span_store(&line->buffer, 0, resampled, delay);
+    line->index = 0;
+  }
+}
+
+void ae_reverb_process_block(ae_engine_t *engine, const float *input,
+                             float *out_l, float *out_r, size_t frames) {
+  if (!engine || !input || !out_l || !out_r || frames == 0)
+    return;
+  struct ae_reverb *reverb = &engine->reverb;
+  if (!reverb->diffused || !reverb->late_in || !reverb->late_l ||
+      !reverb->late_r)
+    return;
+  float modulation = AE_ATOMIC_LOAD(&engine->modulation);
+  ae_reverb_install_early(engine);
 
-    float wet_l = 0.25f * (fdn_out[0] + fdn_out[1] + fdn_out[2] + fdn_out[3]);
-    float wet_r = 0.25f * (fdn_out[4] + fdn_out[5] + fdn_out[6] + fdn_out[7]);
+  for (size_t offset = 0; offset < frames; offset += reverb->block_size) {
+    size_t n = frames - offset;
+    if (n > reverb->block_size)
+      n = reverb->block_size;
+    float *block_l = out_l + offset;
+    float *block_r = out_r + offset;
+    ae_reverb_settle_rate(engine);
+
+    if (reverb->diffuser == AE_DIFFUSER_VELVET && reverb->velvet.buffer.data)
+      ae_reverb_diffuse_velvet(reverb, input + offset, reverb->diffused, n);
+    else
+      ae_reverb_diffuse(reverb, input + offset, reverb->diffused, n);
+
+    if (reverb->decimation > 1) {
+      ae_halfband_t *hb = &reverb->halfband;
+      unsigned phase = hb->phase;
+      size_t late_frames =
+          ae_halfband_decimate(hb, reverb->diffused, reverb->late_in, n);
+      ae_reverb_late(reverb, reverb->late_in, reverb->late_l, reverb->late_r,
+                     late_frames, modulation);
+      ae_halfband_interpolate(hb, phase, reverb->late_l, reverb->late_r,
+                              block_l, block_r, n);
+    } else {
+      ae_reverb_late(reverb, reverb->diffused, block_l, block_r, n,
+                     modulation);
+    }
 
-    out_l[i] = er_l + wet_l;
-    out_r[i] = er_r + wet_r;
+    /* Geometric reflections are discrete specular paths: their taps read
+     * the dry input, skipping the pre-delay and diffusers of the late field */
+    ae_reverb_early(reverb, input + offset, reverb->diffused, block_l,
+                    block_r, n);
   }
 }
 
@@ -253,19 +855,29 @@ void ae_reverb_cleanup(ae_engine_t *engine) {
     return;
   struct ae_reverb *reverb = &engine->reverb;
   for (size_t i = 0; i < AE_FDN_CHANNELS; ++i) {
-    free(reverb->lines[i].buffer);
-    reverb->lines[i].buffer = NULL;
+    ae_delay_buffer_free(&reverb->lines[i].buffer);
     reverb->lines[i].size = 0;
   }
   for (size_t i = 0; i < 2; ++i) {
-    free(reverb->diffusion[i].buffer);
-    reverb->diffusion[i].buffer = NULL;
+    ae_delay_buffer_free(&reverb->diffusion[i].buffer);
     reverb->diffusion[i].size = 0;
   }
-  free(reverb->pre_delay);
-  reverb->pre_delay = NULL;
+  ae_delay_buffer_free(&reverb->pre_delay);
   reverb->pre_delay_size = 0;
-  free(reverb->early.buffer);
-  reverb->early.buffer = NULL;
+  ae_delay_buffer_free(&reverb->velvet.buffer);
+  reverb->velvet.size = 0;
+  ae_delay_buffer_free(&reverb->early.buffer);
+  ae_delay_buffer_free(&reverb->early.dry_buffer);
   reverb->early.size = 0;
+  free(reverb->diffused);
+  free(reverb->late_in);
+  free(reverb->late_l);
+  free(reverb->late_r);
+  free(reverb->rate_scratch);
+  reverb->diffused = NULL;
+  reverb->late_in = NULL;
+  reverb->late_l = NULL;
+  reverb->late_r = NULL;
+  reverb->rate_scratch = NULL;
+  reverb->block_size = 0;
 }
@@ -0,0 +1,172 @@
+/**
+ * @file ae_rng.c
+ * @brief Per-engine noise generator (xoshiro128+, four SIMD lanes)
+ *
+ * Four independent xoshiro128+ streams run side by side, one per SSE lane,
+ * so a whole noise block comes out four samples per step with no shared
+ * state and no locks. The output sequence depends only on the seed: values
+ * left over from a step are kept for the next call, so splitting a block
+ * differently does not change the noise.
+ */
+
+#include "ae_internal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define AE_HAS_SSE2 1
+#endif
+
+/* 2^-23: a signed 24-bit integer to [-1, 1) */
+#define AE_RNG_SCALE (1.0f / 8388608.0f)
+
+static uint64_t ae_rng_splitmix(uint64_t *x) {
+  uint64_t z = (*x += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+/**
+ * Seed all four streams from one value through SplitMix64, as the
+ * xoshiro authors recommend; equal seeds give equal noise.
+ */
+void ae_rng_seed(ae_rng_t *rng, uint64_t seed) {
+  if (!rng)
+    return;
+  uint64_t x = seed;
+  for (int lane = 0; lane < 4; ++lane) {
+    uint64_t a = ae_rng_splitmix(&x);
+    uint64_t b = ae_rng_splitmix(&x);
+    rng->s[0][lane] = (uint32_t)a;
+    rng->s[1][lane] = (uint32_t)(a >> 32);
+    rng->s[2][lane] = (uint32_t)b;
+    rng->s[3][lane] = (uint32_t)(b >> 32);
+    /* An all-zero state never leaves zero */
+    if ((rng->s[0][lane] | rng->s[1][lane] | rng->s[2][lane] |
+         rng->s[3][lane]) == 0)
+      rng->s[0][lane] = 1u;
+  }
+  rng->spare_count = 0;
+}
+
+/* Keeps counter-derived seeds away from small explicit ones */
+#define AE_RNG_UNIQUE_SALT 0x6A09E667F3BCC909ull
+
+/**
+ * Seed from a process-wide creation counter, run through SplitMix64 so
+ * consecutive engines get unrelated streams: each caller hisses
+ * independently of every other, where one shared seed would put all of
+ * them in unison.
+ */
+void ae_rng_seed_unique(ae_rng_t *rng) {
+  static ae_atomic_int created;
+  long n = AE_ATOMIC_LOAD_INT(&created);
+  while (!AE_ATOMIC_CAS_INT(&created, n, n + 1))
+    n = AE_ATOMIC_LOAD_INT(&created);
+  uint64_t x = (uint64_t)n ^ AE_RNG_UNIQUE_SALT;
+  ae_rng_seed(rng, ae_rng_splitmix(&x));
+}
+
+#ifdef AE_HAS_SSE2
+static inline __m128i ae_rng_step4(__m128i s[4]) {
+  __m128i result = _mm_add_epi32(s[0], s[3]);
+  __m128i t = _mm_slli_epi32(s[1], 9);
+  s[2] = _mm_xor_si128(s[2], s[0]);
+  s[3] = _mm_xor_si128(s[3], s[1]);
+  s[1] = _mm_xor_si128(s[1], s[2]);
+  s[0] = _mm_xor_si128(s[0], s[3]);
+  s[2] = _mm_xor_si128(s[2], t);
+  s[3] = _mm_or_si128(_mm_slli_epi32(s[3], 11), _mm_srli_epi32(s[3], 21));
+  return result;
+}
+
+/* Top 24 bits as a signed integer, scaled to [-1, 1) */
+static inline __m128 ae_rng_to_float4(__m128i bits) {
+  return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(bits, 8)),
+                    _mm_set1_ps(AE_RNG_SCALE));
+}
+#endif
+
+/* One step of all four streams: four values in [-1, 1) */
+static void ae_rng_next4(ae_rng_t *rng, float out[4]) {
+#ifdef AE_HAS_SSE2
+  __m128i s[4];
+  for (int k = 0; k < 4; ++k)
+    s[k] = _mm_loadu_si128((const __m128i *)rng->s[k]);
+  _mm_storeu_ps(out, ae_rng_to_float4(ae_rng_step4(s)));
+  for (int k = 0; k < 4; ++k)
+    _mm_storeu_si128((__m128i *)rng->s[k], s[k]);
+#else
+  for (int lane = 0; lane < 4; ++lane) {
+    uint32_t s0 = rng->s[0][lane];
+    uint32_t s1 = rng->s[1][lane];
+    uint32_t s2 = rng->s[2][lane];
+    uint32_t s3 = rng->s[3][lane];
+    uint32_t result = s0 + s3;
+    uint32_t t = s1 << 9;
+    s2 ^= s0;
+    s3 ^= s1;
+    s1 ^= s2;
+    s0 ^= s3;
+    s2 ^= t;
+    s3 = (s3 << 11) | (s3 >> 21);
+    rng->s[0][lane] = s0;
+    rng->s[1][lane] = s1;
+    rng->s[2][lane] = s2;
+    rng->s[3][lane] = s3;
+    out[lane] = (float)((int32_t)result >> 8) * AE_RNG_SCALE;
+  }
+#endif
+}
+
+/**
+ * Fill dst with uniform noise in [-1, 1). Spare values from the last call
+ * come first, then whole steps, then a final step whose unused values are
+ * kept for the next call.
+ */
+void ae_rng_uniform(ae_rng_t *rng, float *dst, size_t n) {
+  if (!rng || !dst)
+    return;
+  size_t i = 0;
+  while (i < n && rng->spare_count > 0)
+    dst[i++] = rng->spare[4 - rng->spare_count--];
+
+#ifdef AE_HAS_SSE2
+  if (i + 4 <= n) {
+    __m128i s[4];
+    for (int k = 0; k < 4; ++k)
+      s[k] = _mm_loadu_si128((const __m128i *)rng->s[k]);
+    for (; i + 4 <= n; i += 4)
+      _mm_storeu_ps(dst + i, ae_rng_to_float4(ae_rng_step4(s)));
+    for (int k = 0; k < 4; ++k)
+      _mm_storeu_si128((__m128i *)rng->s[k], s[k]);
+  }
+#else
+  for (; i + 4 <= n; i += 4)
+    ae_rng_next4(rng, dst + i);
+#endif
+
+  if (i < n) {
+    ae_rng_next4(rng, rng->spare);
+    rng->spare_count = 4;
+    while (i < n)
+      dst[i++] = rng->spare[4 - rng->spare_count--];
+  }
+}
+
+/**
+ * Fill dst with triangular (TPDF) noise on (-1, 1): the mean of two
+ * uniform values, for dither ahead of a quantizer.
+ */
+void ae_rng_tpdf(ae_rng_t *rng, float *dst, size_t n) {
+  if (!rng || !dst)
+    return;
+  float second[64];
+  for (size_t i = 0; i < n; i += 64) {
+    size_t count = n - i < 64 ? n - i : 64;
+    ae_rng_uniform(rng, dst + i, count);
+    ae_rng_uniform(rng, second, count);
+    ae_simd_add(dst + i, dst + i, second, count);
+    ae_simd_scale(dst + i, dst + i, 0.5f, count);
+  }
+}
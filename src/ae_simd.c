@@ -42,6 +42,30 @@ AE_API void ae_simd_add(float *dst, const float *a, const float *b, size_t n) {
 #endif
 }
 
+/**
+ * Vector subtraction: dst = a - b
+ */
+void ae_simd_sub(float *dst, const float *a, const float *b, size_t n) {
+  if (!dst || !a || !b)
+    return;
+
+#ifdef AE_HAS_SSE2
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 va = _mm_loadu_ps(a + i);
+    __m128 vb = _mm_loadu_ps(b + i);
+    _mm_storeu_ps(dst + i, _mm_sub_ps(va, vb));
+  }
+  for (; i < n; ++i) {
+    dst[i] = a[i] - b[i];
+  }
+#else
+  for (size_t i = 0; i < n; ++i) {
+    dst[i] = a[i] - b[i];
+  }
+#endif
+}
+
 /**
  * Vector multiplication: dst = a * b
  */
@@ -154,6 +178,37 @@ void ae_simd_mix_gain(float *dst, const float *src, float gain, size_t n) {
 #endif
 }
 
+/**
+ * Stereo mix with gain: dst_l += src * gain_l, dst_r += src * gain_r
+ */
+void ae_simd_mix_gain_stereo(float *dst_l, float *dst_r, const float *src,
+                             float gain_l, float gain_r, size_t n) {
+  if (!dst_l || !dst_r || !src)
+    return;
+
+#ifdef AE_HAS_SSE2
+  size_t i = 0;
+  __m128 vgain_l = _mm_set1_ps(gain_l);
+  __m128 vgain_r = _mm_set1_ps(gain_r);
+  for (; i + 4 <= n; i += 4) {
+    __m128 vs = _mm_loadu_ps(src + i);
+    __m128 vl = _mm_loadu_ps(dst_l + i);
+    __m128 vr = _mm_loadu_ps(dst_r + i);
+    _mm_storeu_ps(dst_l + i, _mm_add_ps(vl, _mm_mul_ps(vs, vgain_l)));
+    _mm_storeu_ps(dst_r + i, _mm_add_ps(vr, _mm_mul_ps(vs, vgain_r)));
+  }
+  for (; i < n; ++i) {
+    dst_l[i] += src[i] * gain_l;
+    dst_r[i] += src[i] * gain_r;
+  }
+#else
+  for (size_t i = 0; i < n; ++i) {
+    dst_l[i] += src[i] * gain_l;
+    dst_r[i] += src[i] * gain_r;
+  }
+#endif
+}
+
 /**
  * Interleave stereo: dst[LRLRLR...] = left[LLL...], right[RRR...]
  */
@@ -223,3 +278,66 @@ float ae_simd_max_abs(const float *src, size_t n) {
   return max_val;
 #endif
 }
+
+void ae_simd_abs(float *dst, const float *src, size_t n) {
+  if (!dst || !src)
+    return;
+
+#ifdef AE_HAS_SSE2
+  size_t i = 0;
+  __m128 sign_mask = _mm_set1_ps(-0.0f);
+  for (; i + 4 <= n; i += 4) {
+    __m128 v = _mm_loadu_ps(src + i);
+    _mm_storeu_ps(dst + i, _mm_andnot_ps(sign_mask, v));
+  }
+  for (; i < n; ++i) {
+    dst[i] = fabsf(src[i]);
+  }
+#else
+  for (size_t i = 0; i < n; ++i) {
+    dst[i] = fabsf(src[i]);
+  }
+#endif
+}
+
+void ae_simd_max(float *dst, const float *a, const float *b, size_t n) {
+  if (!dst || !a || !b)
+    return;
+
+#ifdef AE_HAS_SSE2
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 va = _mm_loadu_ps(a + i);
+    __m128 vb = _mm_loadu_ps(b + i);
+    _mm_storeu_ps(dst + i, _mm_max_ps(va, vb));
+  }
+  for (; i < n; ++i) {
+    dst[i] = fmaxf(a[i], b[i]);
+  }
+#else
+  for (size_t i = 0; i < n; ++i) {
+    dst[i] = fmaxf(a[i], b[i]);
+  }
+#endif
+}
+
+void ae_simd_offset(float *dst, const float *src, float offset, size_t n) {
+  if (!dst || !src)
+    return;
+
+#ifdef AE_HAS_SSE2
+  size_t i = 0;
+  __m128 voffset = _mm_set1_ps(offset);
+  for (; i + 4 <= n; i += 4) {
+    __m128 v = _mm_loadu_ps(src + i);
+    _mm_storeu_ps(dst + i, _mm_add_ps(v, voffset));
+  }
+  for (; i < n; ++i) {
+    dst[i] = src[i] + offset;
+  }
+#else
+  for (size_t i = 0; i < n; ++i) {
+    dst[i] = src[i] + offset;
+  }
+#endif
+}
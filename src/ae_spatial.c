@@ -1,6 +1,149 @@
 #include "ae_internal.h"
 
+/*
+ * HRIR sets live in ae_hrtf_db_t: an immutable, refcounted grid that any
+ * number of engines can render from. An engine holds one reference plus
+ * its own filters, convolver and history, one of each per listener.
+ * engine->hrtf is listener 0 and also carries the engine-wide state (the
+ * set, lock, loader); the other listeners use only their per-listener
+ * fields.
+ *
+ * Threads: the control thread calls set_params; a loader worker may build
+ * and install a new set; the audio thread only reads hrtf.loaded and runs
+ * the convolver. hrtf.lock serializes the first two. The convolver and
+ * filter buffers are sized once for the longest allowed set and live until
+ * cleanup, so installing a set never frees anything the audio thread can
+ * see; the convolver's crossfade covers the switch.
+ */
+
+/* Engines gathered per ae_convolver_process_group call */
+#define AE_SPATIAL_GROUP 32
+
+struct ae_hrtf_db {
+  ae_hrir_grid_t grid; /* Read-only once created */
+  uint32_t sample_rate;
+  ae_atomic_int refs;
+};
+
+/* max_taps, 0 meaning the default */
+static size_t ae_spatial_max_taps(uint32_t max_taps) {
+  return max_taps > 0 ? max_taps : AE_HRIR_MAX_TAPS;
+}
+
+/* Built-in set taps at a sample rate */
+static size_t ae_spatial_default_taps(uint32_t sample_rate) {
+  return (size_t)ceilf(AE_HRTF_DEFAULT_TAPS * (float)sample_rate /
+                       AE_HRTF_DEFAULT_RATE);
+}
+
+/* Longest HRIR an engine's own loads produce */
+static size_t ae_spatial_max_hrir_len(const ae_engine_t *engine) {
+  size_t taps = ae_spatial_max_taps(engine->config.hrir_max_taps);
+  size_t builtin = ae_spatial_default_taps(engine->config.sample_rate);
+  return taps > builtin ? taps : builtin;
+}
+
+static size_t ae_spatial_onset_len(const ae_engine_t *engine) {
+  return (size_t)(AE_HRIR_MAX_ONSET_S * engine->config.sample_rate);
+}
+
+static struct ae_hrtf *ae_spatial_listener(ae_engine_t *engine,
+                                           uint32_t listener) {
+  return listener == 0 ? &engine->hrtf
+                       : &engine->listeners[listener - 1].hrtf;
+}
+
+/*============================================================================
+ * Shared HRIR database
+ *============================================================================*/
+
+AE_API ae_hrtf_db_t *ae_hrtf_db_retain(ae_hrtf_db_t *db) {
+  if (!db)
+    return NULL;
+  long refs = AE_ATOMIC_LOAD_INT(&db->refs);
+  while (!AE_ATOMIC_CAS_INT(&db->refs, refs, refs + 1))
+    refs = AE_ATOMIC_LOAD_INT(&db->refs);
+  return db;
+}
+
+AE_API void ae_hrtf_db_release(ae_hrtf_db_t *db) {
+  if (!db)
+    return;
+  long refs = AE_ATOMIC_LOAD_INT(&db->refs);
+  while (!AE_ATOMIC_CAS_INT(&db->refs, refs, refs - 1))
+    refs = AE_ATOMIC_LOAD_INT(&db->refs);
+  if (refs == 1) {
+    ae_hrir_grid_free(&db->grid);
+    free(db);
+  }
+}
+
+/* Wrap a built grid (taken over) in a db with one reference */
+static ae_hrtf_db_t *ae_spatial_db_wrap(ae_hrir_grid_t *grid,
+                                        uint32_t sample_rate) {
+  ae_hrtf_db_t *db = (ae_hrtf_db_t *)calloc(1, sizeof(ae_hrtf_db_t));
+  if (!db) {
+    ae_hrir_grid_free(grid);
+    return NULL;
+  }
+  db->grid = *grid;
+  db->sample_rate = sample_rate;
+  AE_ATOMIC_STORE_INT(&db->refs, 1);
+  memset(grid, 0, sizeof(*grid));
+  return db;
+}
+
+/* One ear of the built-in set, linearly resampled to the engine rate */
+static void ae_spatial_default_ear(const int16_t *taps, float ratio,
+                                   size_t count, float *ir) {
+  float scale = ratio / AE_HRTF_DEFAULT_TAP_SCALE; /* Keeps the DC gain */
+  for (size_t n = 0; n < count; ++n) {
+    float t = (float)n * ratio;
+    size_t i = (size_t)t;
+    float frac = t - (float)i;
+    float a = i < AE_HRTF_DEFAULT_TAPS ? (float)taps[i] : 0.0f;
+    float b = i + 1 < AE_HRTF_DEFAULT_TAPS ? (float)taps[i + 1] : 0.0f;
+    ir[n] = (a + frac * (b - a)) * scale;
+  }
+}
+
+typedef struct {
+  size_t taps;
+  float ratio; /* Table rate / engine rate */
+} ae_default_source_t;
+
+static bool ae_spatial_sample_default(void *user, float az_deg, float el_deg,
+                                      float *ir_l, float *ir_r,
+                                      float *delay_l, float *delay_r) {
+  const ae_default_source_t *source = (const ae_default_source_t *)user;
+  size_t a = (size_t)lrintf(az_deg / AE_HRTF_DEFAULT_STEP_DEG) %
+             AE_HRTF_DEFAULT_AZ;
+  size_t e = (size_t)lrintf((el_deg + 90.0f) / AE_HRTF_DEFAULT_STEP_DEG);
+  size_t mirror = (AE_HRTF_DEFAULT_AZ - a) % AE_HRTF_DEFAULT_AZ;
+  if (e >= AE_HRTF_DEFAULT_EL)
+    return false;
+  ae_spatial_default_ear(ae_hrtf_default_taps[e][a], source->ratio,
+                         source->taps, ir_l);
+  ae_spatial_default_ear(ae_hrtf_default_taps[e][mirror], source->ratio,
+                         source->taps, ir_r);
+  float per_sample = AE_HRTF_DEFAULT_DELAY_SCALE * source->ratio;
+  *delay_l = (float)ae_hrtf_default_delays[e][a] / per_sample;
+  *delay_r = (float)ae_hrtf_default_delays[e][mirror] / per_sample;
+  return true;
+}
+
+/* Built-in set: no file access, a few microseconds of table expansion */
+static bool ae_spatial_build_default(uint32_t sample_rate,
+                                     ae_hrir_grid_t *grid) {
+  ae_default_source_t source = {ae_spatial_default_taps(sample_rate),
+                                AE_HRTF_DEFAULT_RATE / (float)sample_rate};
+  return ae_hrir_grid_build(grid, source.taps, AE_HRTF_DEFAULT_STEP_DEG,
+                            ae_spatial_sample_default, &source);
+}
+
 #ifdef AE_USE_LIBMYSOFA
+#define AE_HRIR_GRID_STEP_DEG 5.0f
+
 static void ae_spatial_az_el_to_xyz(float az_deg, float el_deg, float *x,
                                     float *y, float *z) {
   float az = az_deg * (float)M_PI / 180.0f;
@@ -11,337 +154,662 @@ static void ae_spatial_az_el_to_xyz(float az_deg, float el_deg, float *x,
   *z = sinf(el);
 }
 
-static void ae_spatial_unload_sofa(ae_engine_t *engine) {
+bool ae_spatial_sample_sofa(void *user, float az_deg, float el_deg,
+                            float *ir_l, float *ir_r, float *delay_l,
+                            float *delay_r) {
+  const ae_sofa_source_t *source = (const ae_sofa_source_t *)user;
+  float x = 0.0f;
+  float y = 0.0f;
+  float z = 0.0f;
+  ae_spatial_az_el_to_xyz(az_deg, el_deg, &x, &y, &z);
+  /* Returns MYSOFA_OK and always fills N taps; delays are seconds */
+  if (mysofa_getfilter_float(source->sofa, x, y, z, ir_l, ir_r, delay_l,
+                             delay_r) != MYSOFA_OK)
+    return false;
+  *delay_l *= source->sample_rate;
+  *delay_r *= source->sample_rate;
+  return true;
+}
+
+static bool ae_spatial_build_sofa(const char *path, uint32_t sample_rate,
+                                  uint32_t max_taps, ae_hrir_grid_t *grid) {
+  int err = 0;
+  struct MYSOFA_EASY *sofa = mysofa_open(path, (float)sample_rate, &err);
+  if (!sofa || err != MYSOFA_OK) {
+    if (sofa)
+      mysofa_close(sofa);
+    return false;
+  }
+
+  size_t hrir_len = (size_t)sofa->hrtf->N;
+  if (hrir_len == 0) {
+    mysofa_close(sofa);
+    return false;
+  }
+
+  /* Resample the whole set now (libmysofa already converted it to the
+   * engine rate); libmysofa is not needed after this */
+  ae_sofa_source_t source = {sofa, (float)sample_rate};
+  bool ok = ae_hrir_grid_build(grid, hrir_len, AE_HRIR_GRID_STEP_DEG,
+                               ae_spatial_sample_sofa, &source);
+  mysofa_close(sofa);
+  if (!ok)
+    return false;
+  if (!ae_hrir_grid_preprocess(grid, max_taps)) {
+    ae_hrir_grid_free(grid);
+    return false;
+  }
+  return true;
+}
+#endif
+
+/**
+ * Grid for an HRTF file. With a cache directory, a SOFA file is
+ * preprocessed once and later loads read the cached grid instead (no HDF5
+ * parsing, and no libmysofa needed). Touches no engine, so it runs on any
+ * thread. On failure the grid is empty.
+ */
+static bool ae_spatial_build_file(const ae_hrtf_db_config_t *config,
+                                  ae_hrir_grid_t *grid, bool *cache_failed) {
+  memset(grid, 0, sizeof(*grid));
+  *cache_failed = false;
+  uint32_t max_taps = (uint32_t)ae_spatial_max_taps(config->max_taps);
+  char cache_path[1024];
+  uint64_t key = 0;
+  bool cached = config->cache_dir &&
+                ae_hrir_cache_key(config->path, config->sample_rate,
+                                  max_taps, &key) &&
+                ae_hrir_cache_path(config->cache_dir, key, cache_path,
+                                   sizeof(cache_path));
+  if (cached && ae_hrir_cache_load(grid, cache_path, key))
+    return true;
+#ifdef AE_USE_LIBMYSOFA
+  if (ae_spatial_build_sofa(config->path, config->sample_rate, max_taps,
+                            grid)) {
+    if (cached && !ae_hrir_cache_save(grid, cache_path, key))
+      *cache_failed = true;
+    return true;
+  }
+#endif
+  return false;
+}
+
+/* The built-in set at the engine rate, expanded by the first engine that
+ * asks and shared by all after it. The table keeps one reference for the
+ * life of the process. State: 0 none, 1 expanding, 2 ready */
+static ae_hrtf_db_t *ae_spatial_builtin;
+static ae_atomic_int ae_spatial_builtin_state;
+
+/* A new reference to the built-in set at sample_rate */
+static ae_hrtf_db_t *ae_spatial_builtin_db(uint32_t sample_rate) {
+  ae_hrir_grid_t grid;
+  if (sample_rate != AE_SAMPLE_RATE)
+    return ae_spatial_build_default(sample_rate, &grid)
+               ? ae_spatial_db_wrap(&grid, sample_rate)
+               : NULL;
+  while (AE_ATOMIC_LOAD_INT(&ae_spatial_builtin_state) != 2) {
+    if (!AE_ATOMIC_CAS_INT(&ae_spatial_builtin_state, 0, 1)) {
+      ae_thread_yield();
+      continue;
+    }
+    ae_hrtf_db_t *db = ae_spatial_build_default(sample_rate, &grid)
+                           ? ae_spatial_db_wrap(&grid, sample_rate)
+                           : NULL;
+    if (!db) {
+      /* Out of memory: the next caller tries again */
+      AE_ATOMIC_STORE_INT(&ae_spatial_builtin_state, 0);
+      return NULL;
+    }
+    ae_spatial_builtin = db;
+    AE_ATOMIC_STORE_INT(&ae_spatial_builtin_state, 2);
+  }
+  return ae_hrtf_db_retain(ae_spatial_builtin);
+}
+
+/* config->path, or the built-in set for NULL; no fallback */
+static ae_hrtf_db_t *ae_spatial_db_build(const ae_hrtf_db_config_t *config,
+                                         bool *cache_failed) {
+  *cache_failed = false;
+  if (!config->path || config->path[0] == '\0')
+    return ae_spatial_builtin_db(config->sample_rate);
+  ae_hrir_grid_t grid;
+  return ae_spatial_build_file(config, &grid, cache_failed)
+             ? ae_spatial_db_wrap(&grid, config->sample_rate)
+             : NULL;
+}
+
+AE_API ae_hrtf_db_t *ae_hrtf_db_create(const ae_hrtf_db_config_t *config) {
+  ae_hrtf_db_config_t cfg = {NULL, AE_SAMPLE_RATE, 0, NULL};
+  if (config)
+    cfg = *config;
+  if (cfg.sample_rate == 0)
+    cfg.sample_rate = AE_SAMPLE_RATE;
+  bool cache_failed = false;
+  return ae_spatial_db_build(&cfg, &cache_failed);
+}
+
+/* The db settings an engine's own loads use */
+static ae_hrtf_db_config_t ae_spatial_db_config(const ae_engine_t *engine,
+                                                const char *path) {
+  ae_hrtf_db_config_t config = {path, engine->config.sample_rate,
+                                engine->config.hrir_max_taps,
+                                engine->config.hrtf_cache_dir};
+  return config;
+}
+
+/**
+ * Set for path, falling back to the built-in set. *error gets a note for
+ * ae_set_error (NULL if none).
+ */
+static ae_hrtf_db_t *ae_spatial_db_build_fallback(const ae_engine_t *engine,
+                                                  const char *path,
+                                                  const char **error) {
+  *error = NULL;
+  bool cache_failed = false;
+  if (path && path[0] != '\0') {
+    ae_hrtf_db_config_t config = ae_spatial_db_config(engine, path);
+    ae_hrtf_db_t *db = ae_spatial_db_build(&config, &cache_failed);
+    if (db) {
+      if (cache_failed)
+        *error = "HRTF cache write failed";
+      return db;
+    }
+    *error = "HRTF load failed, using the built-in set";
+  }
+  ae_hrtf_db_config_t config = ae_spatial_db_config(engine, NULL);
+  ae_hrtf_db_t *db = ae_spatial_db_build(&config, &cache_failed);
+  if (!db)
+    *error = "HRTF load failed";
+  return db;
+}
+
+/*============================================================================
+ * Per-engine filters
+ *============================================================================*/
+
+static void ae_spatial_free_filters(struct ae_hrtf *hrtf) {
+  free(hrtf->hrir_l);
+  free(hrtf->hrir_r);
+  ae_convolver_destroy(hrtf->convolver);
+  hrtf->hrir_l = NULL;
+  hrtf->hrir_r = NULL;
+  hrtf->convolver = NULL;
+}
+
+static void ae_spatial_unload_hrir(ae_engine_t *engine) {
   if (!engine)
     return;
-  if (engine->hrtf.sofa) {
-    mysofa_close(engine->hrtf.sofa);
-    engine->hrtf.sofa = NULL;
-  }
-  free(engine->hrtf.hrir_l);
-  free(engine->hrtf.hrir_r);
-  free(engine->hrtf.history);
-  engine->hrtf.hrir_l = NULL;
-  engine->hrtf.hrir_r = NULL;
-  engine->hrtf.history = NULL;
+  ae_hrtf_db_release(engine->hrtf.db);
+  for (uint32_t l = 0; l < engine->config.listener_count; ++l)
+    ae_spatial_free_filters(ae_spatial_listener(engine, l));
+  engine->hrtf.db = NULL;
   engine->hrtf.hrir_len = 0;
-  engine->hrtf.history_size = 0;
-  engine->hrtf.history_index = 0;
-  engine->hrtf.loaded = false;
+  engine->hrtf.filter_len = 0;
+  AE_ATOMIC_STORE_INT(&engine->hrtf.loaded, 0);
 }
 
-static bool ae_spatial_alloc_hrtf_buffers(ae_engine_t *engine, size_t hrir_len) {
-  if (!engine || hrir_len == 0)
-    return false;
-  engine->hrtf.hrir_l = (float *)calloc(hrir_len, sizeof(float));
-  engine->hrtf.hrir_r = (float *)calloc(hrir_len, sizeof(float));
-  engine->hrtf.history = (float *)calloc(hrir_len, sizeof(float));
-  if (!engine->hrtf.hrir_l || !engine->hrtf.hrir_r ||
-      !engine->hrtf.history) {
-    free(engine->hrtf.hrir_l);
-    free(engine->hrtf.hrir_r);
-    free(engine->hrtf.history);
-    engine->hrtf.hrir_l = NULL;
-    engine->hrtf.hrir_r = NULL;
-    engine->hrtf.history = NULL;
-    return false;
+/**
+ * Filters and convolver per listener, once per engine, for the longest set
+ * it may install: its own loads, or a shared set given at creation.
+ */
+static bool ae_spatial_alloc_hrtf_buffers(ae_engine_t *engine,
+                                          size_t hrir_len) {
+  if (engine->hrtf.convolver)
+    return true;
+  size_t max_len = ae_spatial_max_hrir_len(engine);
+  if (hrir_len > max_len)
+    max_len = hrir_len;
+  size_t capacity = max_len + ae_spatial_onset_len(engine);
+  ae_convolver_config_t conv_config = {.max_taps = (uint32_t)capacity,
+                                       .partition_size = 0,
+                                       .crossfade_samples = 0};
+  /* Listener 0 last: its convolver marks the whole allocation done */
+  for (uint32_t l = engine->config.listener_count; l-- > 0;) {
+    struct ae_hrtf *hrtf = ae_spatial_listener(engine, l);
+    hrtf->hrir_l = (float *)calloc(capacity, sizeof(float));
+    hrtf->hrir_r = (float *)calloc(capacity, sizeof(float));
+    hrtf->convolver = ae_convolver_create(&conv_config);
+    if (!hrtf->hrir_l || !hrtf->hrir_r || !hrtf->convolver) {
+      for (uint32_t f = l; f < engine->config.listener_count; ++f)
+        ae_spatial_free_filters(ae_spatial_listener(engine, f));
+      return false;
+    }
   }
-  engine->hrtf.hrir_len = hrir_len;
-  engine->hrtf.history_size = hrir_len;
-  engine->hrtf.history_index = 0;
+  engine->hrtf.max_hrir_len = max_len;
   return true;
 }
 
-static bool ae_spatial_update_hrir(ae_engine_t *engine, float az_deg,
-                                   float el_deg) {
-  if (!engine || !engine->hrtf.sofa || !engine->hrtf.hrir_l ||
-      !engine->hrtf.hrir_r)
+static bool ae_spatial_update_hrir(ae_engine_t *engine, struct ae_hrtf *hrtf,
+                                   float az_deg, float el_deg) {
+  if (!engine || !engine->hrtf.db || !hrtf->hrir_l || !hrtf->hrir_r)
     return false;
-  if (fabsf(az_deg - engine->hrtf.last_azimuth) < 0.01f &&
-      fabsf(el_deg - engine->hrtf.last_elevation) < 0.01f)
+  if (fabsf(az_deg - hrtf->last_azimuth) < 0.01f &&
+      fabsf(el_deg - hrtf->last_elevation) < 0.01f)
     return true;
 
-  float x = 0.0f;
-  float y = 0.0f;
-  float z = 0.0f;
-  ae_spatial_az_el_to_xyz(az_deg, el_deg, &x, &y, &z);
-
-  float delay_l = 0.0f;
-  float delay_r = 0.0f;
-  int filter_len =
-      mysofa_getfilter_float(engine->hrtf.sofa, x, y, z, engine->hrtf.hrir_l,
-                             engine->hrtf.hrir_r, &delay_l, &delay_r);
-  if (filter_len <= 0)
+  /* Runs on the control thread; the audio thread crossfades to the new
+   * pair, onset delays included, at its next partition boundary */
+  size_t hrir_len = engine->hrtf.hrir_len;
+  size_t filter_len = engine->hrtf.filter_len;
+  ae_hrir_grid_lookup(&engine->hrtf.db->grid, az_deg, el_deg, hrtf->hrir_l,
+                      hrtf->hrir_r, &hrtf->delay_l_samples,
+                      &hrtf->delay_r_samples);
+  ae_hrir_apply_onset(hrtf->hrir_l, hrir_len, filter_len,
+                      hrtf->delay_l_samples);
+  ae_hrir_apply_onset(hrtf->hrir_r, hrir_len, filter_len,
+                      hrtf->delay_r_samples);
+  if (ae_convolver_set_filters(hrtf->convolver, hrtf->hrir_l, hrtf->hrir_r,
+                               filter_len) != AE_OK)
     return false;
 
-  engine->hrtf.delay_l_samples = delay_l;
-  engine->hrtf.delay_r_samples = delay_r;
-  engine->hrtf.last_azimuth = az_deg;
-  engine->hrtf.last_elevation = el_deg;
+  hrtf->last_azimuth = az_deg;
+  hrtf->last_elevation = el_deg;
   return true;
 }
 
-static bool ae_spatial_load_sofa(ae_engine_t *engine, const char *path) {
-  if (!engine || !path || path[0] == '\0')
-    return false;
+/* Every listener's filters from the installed set, after a change of set */
+static bool ae_spatial_update_all(ae_engine_t *engine) {
+  bool ok = true;
+  for (uint32_t l = 0; l < engine->config.listener_count; ++l) {
+    struct ae_hrtf *hrtf = ae_spatial_listener(engine, l);
+    hrtf->last_azimuth = 9999.0f;
+    hrtf->last_elevation = 9999.0f;
+    ok = ae_spatial_update_hrir(engine, hrtf, hrtf->params.azimuth_deg,
+                                hrtf->params.elevation_deg) &&
+         ok;
+  }
+  return ok;
+}
 
-  ae_spatial_unload_sofa(engine);
+/**
+ * Take a reference to db and publish filters for the current direction.
+ * On success *previous is the set it replaced (maybe NULL), for the caller
+ * to release outside the lock. Caller holds hrtf.lock.
+ */
+static ae_result_t ae_spatial_install_db(ae_engine_t *engine,
+                                         ae_hrtf_db_t *db,
+                                         ae_hrtf_db_t **previous) {
+  *previous = NULL;
+  if (db->sample_rate != engine->config.sample_rate)
+    return AE_ERROR_INVALID_PARAM;
+  if (!ae_spatial_alloc_hrtf_buffers(engine, db->grid.taps))
+    return AE_ERROR_OUT_OF_MEMORY;
+  /* The lookup writes every tap, so the buffers must hold them all */
+  if (db->grid.taps > engine->hrtf.max_hrir_len)
+    return AE_ERROR_INVALID_PARAM;
+
+  ae_hrtf_db_t *old = engine->hrtf.db;
+  size_t old_len = engine->hrtf.hrir_len;
+  engine->hrtf.db = db;
+  engine->hrtf.hrir_len = db->grid.taps;
+  engine->hrtf.filter_len = db->grid.taps + ae_spatial_onset_len(engine);
+  if (!ae_spatial_update_all(engine)) {
+    engine->hrtf.db = old;
+    engine->hrtf.hrir_len = old_len;
+    engine->hrtf.filter_len = old_len + ae_spatial_onset_len(engine);
+    if (old)
+      ae_spatial_update_all(engine);
+    return AE_ERROR_HRTF_LOAD_FAILED;
+  }
+  ae_hrtf_db_retain(db);
+  *previous = old;
+  AE_ATOMIC_STORE_INT(&engine->hrtf.loaded, 1);
+  return AE_OK;
+}
 
-  int err = 0;
-  struct MYSOFA_EASY *sofa =
-      mysofa_open(path, (float)engine->config.sample_rate, &err);
-  if (!sofa || err != MYSOFA_OK) {
-    if (sofa)
-      mysofa_close(sofa);
+/* install_db under the lock, releasing the replaced set after it */
+static ae_result_t ae_spatial_install(ae_engine_t *engine, ae_hrtf_db_t *db) {
+  ae_hrtf_db_t *previous = NULL;
+  ae_mutex_lock(engine->hrtf.lock);
+  ae_result_t result = ae_spatial_install_db(engine, db, &previous);
+  ae_mutex_unlock(engine->hrtf.lock);
+  ae_hrtf_db_release(previous);
+  return result;
+}
+
+AE_API ae_result_t ae_hrtf_set_db(ae_engine_t *engine, ae_hrtf_db_t *db) {
+  if (!engine || !db)
+    return AE_ERROR_INVALID_PARAM;
+  ae_result_t result = ae_spatial_install(engine, db);
+  if (result != AE_OK)
+    ae_set_error(engine, "HRTF database does not fit this engine");
+  return result;
+}
+
+/**
+ * The set config.binaural has an engine load on its own: *path is the file,
+ * or NULL for the built-in set. False for the parametric model.
+ */
+static bool ae_spatial_own_set(const ae_engine_t *engine, const char **path) {
+  const char *file = engine->config.hrtf_path;
+  *path = NULL;
+  switch (engine->config.binaural) {
+  case AE_BINAURAL_PARAMETRIC:
     return false;
+  case AE_BINAURAL_BUILTIN_HRTF:
+    return true;
+  case AE_BINAURAL_HRTF_FILE:
+    *path = file;
+    return true;
+  default:
+    *path = file;
+    return file && file[0] != '\0';
   }
+}
 
-  size_t hrir_len = (size_t)sofa->hrtf->N;
-  if (hrir_len == 0) {
-    mysofa_close(sofa);
-    return false;
+/* Synchronous load of the engine's own set, from engine creation */
+static void ae_spatial_load(ae_engine_t *engine) {
+  const char *path = NULL;
+  if (!ae_spatial_own_set(engine, &path))
+    return;
+  const char *error = NULL;
+  ae_hrtf_db_t *db = ae_spatial_db_build_fallback(engine, path, &error);
+  if (db) {
+    if (ae_spatial_install(engine, db) != AE_OK)
+      error = "HRTF load failed";
+    ae_hrtf_db_release(db);
   }
+  if (error)
+    ae_set_error(engine, error);
+}
 
-  engine->hrtf.sofa = sofa;
-  if (!ae_spatial_alloc_hrtf_buffers(engine, hrir_len)) {
-    mysofa_close(sofa);
-    engine->hrtf.sofa = NULL;
-    return false;
+/*============================================================================
+ * Asynchronous loading
+ *============================================================================*/
+
+typedef struct {
+  ae_engine_t *engine;
+  char *path;    /* NULL = built-in set */
+  bool fallback; /* Use the built-in set if path fails */
+  ae_hrtf_loaded_fn callback;
+  void *user_data;
+} ae_hrtf_job_t;
+
+static void ae_hrtf_job_discard(void *arg) {
+  ae_hrtf_job_t *job = (ae_hrtf_job_t *)arg;
+  free(job->path);
+  free(job);
+}
+
+static void ae_hrtf_job_run(void *arg) {
+  ae_hrtf_job_t *job = (ae_hrtf_job_t *)arg;
+  ae_engine_t *engine = job->engine;
+  ae_hrtf_db_t *db;
+  if (job->fallback) {
+    const char *error = NULL;
+    db = ae_spatial_db_build_fallback(engine, job->path, &error);
+  } else {
+    bool cache_failed = false;
+    ae_hrtf_db_config_t config = ae_spatial_db_config(engine, job->path);
+    db = ae_spatial_db_build(&config, &cache_failed);
   }
+  /* The parse above held no lock; installing is a swap and one lookup */
+  bool ok = db && ae_spatial_install(engine, db) == AE_OK;
+  ae_hrtf_db_release(db);
+  if (job->callback)
+    job->callback(engine, ok ? AE_OK : AE_ERROR_HRTF_LOAD_FAILED,
+                  job->user_data);
+  ae_hrtf_job_discard(job);
+}
 
-  engine->hrtf.delay_l_samples = 0.0f;
-  engine->hrtf.delay_r_samples = 0.0f;
-  engine->hrtf.last_azimuth = 9999.0f;
-  engine->hrtf.last_elevation = 9999.0f;
-  engine->hrtf.loaded = true;
-
-  ae_clear_buffer(engine->hrtf.delay_l, engine->hrtf.delay_size);
-  ae_clear_buffer(engine->hrtf.delay_r, engine->hrtf.delay_size);
-  ae_clear_buffer(engine->hrtf.history, engine->hrtf.history_size);
-  if (!ae_spatial_update_hrir(engine, 0.0f, 0.0f)) {
-    ae_spatial_unload_sofa(engine);
-    return false;
+static ae_result_t ae_spatial_post_load(ae_engine_t *engine, const char *path,
+                                        bool fallback,
+                                        ae_hrtf_loaded_fn callback,
+                                        void *user_data) {
+  if (!engine->hrtf.lock)
+    return AE_ERROR_OUT_OF_MEMORY;
+  if (!engine->hrtf.loader) {
+    engine->hrtf.loader = ae_worker_create();
+    if (!engine->hrtf.loader) {
+      ae_set_error(engine, "Failed to start HRTF loader thread");
+      return AE_ERROR_OUT_OF_MEMORY;
+    }
   }
+  ae_hrtf_job_t *job = (ae_hrtf_job_t *)calloc(1, sizeof(ae_hrtf_job_t));
+  if (!job)
+    return AE_ERROR_OUT_OF_MEMORY;
+  if (path && path[0] != '\0') {
+    size_t len = strlen(path);
+    job->path = (char *)malloc(len + 1);
+    if (!job->path) {
+      free(job);
+      return AE_ERROR_OUT_OF_MEMORY;
+    }
+    memcpy(job->path, path, len + 1);
+  }
+  job->engine = engine;
+  job->fallback = fallback;
+  job->callback = callback;
+  job->user_data = user_data;
+  engine->hrtf.load_posted = true;
+  ae_worker_post(engine->hrtf.loader, ae_hrtf_job_run, ae_hrtf_job_discard,
+                 job);
+  return AE_OK;
+}
 
-  return true;
+AE_API ae_result_t ae_hrtf_load_async(ae_engine_t *engine, const char *path,
+                                      ae_hrtf_loaded_fn callback,
+                                      void *user_data) {
+  if (!engine)
+    return AE_ERROR_INVALID_PARAM;
+  return ae_spatial_post_load(engine, path, false, callback, user_data);
+}
+
+AE_API ae_result_t ae_hrtf_wait(ae_engine_t *engine) {
+  if (!engine)
+    return AE_ERROR_INVALID_PARAM;
+  ae_worker_wait_idle(engine->hrtf.loader);
+  return AE_OK;
+}
+
+/* Per-listener state: parametric fallback and no filters yet */
+static void ae_spatial_init_listener(ae_engine_t *engine,
+                                     struct ae_hrtf *hrtf) {
+  hrtf->enabled = false;
+  hrtf->params.azimuth_deg = 0.0f;
+  hrtf->params.elevation_deg = 0.0f;
+  hrtf->params.itd_us = 0.0f;
+  hrtf->params.ild_db = 0.0f;
+  hrtf->itd_samples = 0;
+  hrtf->ild_gain_l = 1.0f;
+  hrtf->ild_gain_r = 1.0f;
+  memset(&hrtf->shadow, 0, sizeof(hrtf->shadow));
+  ae_onepole4_set(&hrtf->shadow, 0, 0.0f, AE_ONEPOLE_BYPASS);
+  ae_onepole4_set(&hrtf->shadow, 1, 0.0f, AE_ONEPOLE_BYPASS);
+
+  hrtf->delay_size = (size_t)(engine->config.sample_rate * 0.01f) + 1;
+  hrtf->delay_l = (float *)calloc(hrtf->delay_size, sizeof(float));
+  hrtf->delay_r = (float *)calloc(hrtf->delay_size, sizeof(float));
+  hrtf->delay_index = 0;
+
+  hrtf->hrir_l = NULL;
+  hrtf->hrir_r = NULL;
+  hrtf->delay_l_samples = 0.0f;
+  hrtf->delay_r_samples = 0.0f;
+  hrtf->last_azimuth = 9999.0f;
+  hrtf->last_elevation = 9999.0f;
+  hrtf->convolver = NULL;
 }
-#endif
 
 void ae_spatial_init(ae_engine_t *engine) {
   if (!engine)
     return;
-  engine->hrtf.enabled = false;
-  engine->hrtf.params.azimuth_deg = 0.0f;
-  engine->hrtf.params.elevation_deg = 0.0f;
-  engine->hrtf.params.itd_us = 0.0f;
-  engine->hrtf.params.ild_db = 0.0f;
-  engine->hrtf.itd_samples = 0;
-  engine->hrtf.ild_gain_l = 1.0f;
-  engine->hrtf.ild_gain_r = 1.0f;
-  engine->hrtf.shadow_alpha = 0.0f;
-  engine->hrtf.shadow_state_l = 0.0f;
-  engine->hrtf.shadow_state_r = 0.0f;
-
-  engine->hrtf.delay_size =
-      (size_t)(engine->config.sample_rate * 0.01f) + 1;
-  engine->hrtf.delay_l =
-      (float *)calloc(engine->hrtf.delay_size, sizeof(float));
-  engine->hrtf.delay_r =
-      (float *)calloc(engine->hrtf.delay_size, sizeof(float));
-  engine->hrtf.delay_index = 0;
+  for (uint32_t l = 0; l < engine->config.listener_count; ++l)
+    ae_spatial_init_listener(engine, ae_spatial_listener(engine, l));
 
-#ifdef AE_USE_LIBMYSOFA
-  engine->hrtf.sofa = NULL;
-  engine->hrtf.hrir_l = NULL;
-  engine->hrtf.hrir_r = NULL;
+  engine->hrtf.db = NULL;
+  engine->hrtf.max_hrir_len = 0;
   engine->hrtf.hrir_len = 0;
-  engine->hrtf.delay_l_samples = 0.0f;
-  engine->hrtf.delay_r_samples = 0.0f;
-  engine->hrtf.last_azimuth = 9999.0f;
-  engine->hrtf.last_elevation = 9999.0f;
-  engine->hrtf.history = NULL;
-  engine->hrtf.history_size = 0;
-  engine->hrtf.history_index = 0;
-  engine->hrtf.loaded = false;
-
-  if (engine->config.preload_hrtf && engine->config.hrtf_path) {
-    if (!ae_spatial_load_sofa(engine, engine->config.hrtf_path)) {
-      ae_set_error(engine, "HRTF load failed");
-    }
+  engine->hrtf.filter_len = 0;
+  engine->hrtf.lock = ae_mutex_create();
+  engine->hrtf.loader = NULL;
+  engine->hrtf.load_posted = false;
+  AE_ATOMIC_STORE_INT(&engine->hrtf.loaded, 0);
+
+  /* A shared set needs no loading, only a reference */
+  if (engine->config.hrtf_db) {
+    if (ae_spatial_install(engine, engine->config.hrtf_db) == AE_OK)
+      return;
+    ae_set_error(engine, "HRTF database does not fit this engine");
   }
-#endif
+  if (engine->config.preload_hrtf)
+    ae_spatial_load(engine);
 }
 
 void ae_spatial_cleanup(ae_engine_t *engine) {
   if (!engine)
     return;
-#ifdef AE_USE_LIBMYSOFA
-  ae_spatial_unload_sofa(engine);
-#endif
-  free(engine->hrtf.delay_l);
-  free(engine->hrtf.delay_r);
-  engine->hrtf.delay_l = NULL;
-  engine->hrtf.delay_r = NULL;
-  engine->hrtf.delay_size = 0;
-  engine->hrtf.delay_index = 0;
+  /* A load in progress finishes (and calls back) before this returns */
+  ae_worker_destroy(engine->hrtf.loader);
+  engine->hrtf.loader = NULL;
+  ae_spatial_unload_hrir(engine);
+  ae_mutex_destroy(engine->hrtf.lock);
+  engine->hrtf.lock = NULL;
+  for (uint32_t l = 0; l < engine->config.listener_count; ++l) {
+    struct ae_hrtf *hrtf = ae_spatial_listener(engine, l);
+    free(hrtf->delay_l);
+    free(hrtf->delay_r);
+    hrtf->delay_l = NULL;
+    hrtf->delay_r = NULL;
+    hrtf->delay_size = 0;
+    hrtf->delay_index = 0;
+  }
 }
 
-void ae_spatial_set_params(ae_engine_t *engine,
+void ae_spatial_set_params(ae_engine_t *engine, uint32_t listener,
                            const ae_binaural_params_t *params) {
-  if (!engine || !params)
+  if (!engine || !params || listener >= engine->config.listener_count)
     return;
-  engine->hrtf.params = *params;
-  engine->hrtf.enabled = true;
-
-#ifdef AE_USE_LIBMYSOFA
-  if (!engine->hrtf.loaded && engine->config.hrtf_path) {
-    if (!ae_spatial_load_sofa(engine, engine->config.hrtf_path)) {
-      ae_set_error(engine, "HRTF load failed");
-    }
-  }
-  if (engine->hrtf.loaded) {
-    if (!ae_spatial_update_hrir(engine, params->azimuth_deg,
-                                params->elevation_deg)) {
-      ae_set_error(engine, "HRTF update failed");
-    }
+  struct ae_hrtf *hrtf = ae_spatial_listener(engine, listener);
+  ae_mutex_lock(engine->hrtf.lock);
+  hrtf->params = *params;
+  hrtf->enabled = true;
+  bool loaded = AE_ATOMIC_LOAD_INT(&engine->hrtf.loaded) != 0;
+  if (loaded && !ae_spatial_update_hrir(engine, hrtf, params->azimuth_deg,
+                                        params->elevation_deg))
+    ae_set_error(engine, "HRTF update failed");
+  ae_mutex_unlock(engine->hrtf.lock);
+  if (loaded)
     return;
-  }
-#endif
+
+  /* Not preloaded: load in the background, parametric until it lands */
+  const char *path = NULL;
+  if (!engine->hrtf.load_posted && ae_spatial_own_set(engine, &path))
+    ae_spatial_post_load(engine, path, true, NULL, NULL);
+
+  /* Parametric ITD/ILD fallback until (or if never) an HRIR set loads */
 
   float itd_samples = params->itd_us * 1e-6f * engine->config.sample_rate;
   int itd = (int)lrintf(itd_samples);
-  int max_itd = (int)(engine->hrtf.delay_size - 1);
+  int max_itd = (int)(hrtf->delay_size - 1);
   if (itd > max_itd)
     itd = max_itd;
   if (itd < -max_itd)
     itd = -max_itd;
-  engine->hrtf.itd_samples = itd;
+  hrtf->itd_samples = itd;
 
   float ild = ae_clamp(params->ild_db, -20.0f, 20.0f);
-  engine->hrtf.ild_gain_l = ae_db_to_linear(-0.5f * ild);
-  engine->hrtf.ild_gain_r = ae_db_to_linear(0.5f * ild);
+  hrtf->ild_gain_l = ae_db_to_linear(-0.5f * ild);
+  hrtf->ild_gain_r = ae_db_to_linear(0.5f * ild);
 
+  /* Lowpass the far ear only; the near ear's lane passes through */
   float az = fabsf(params->azimuth_deg);
   float shadow = ae_clamp(az / 90.0f, 0.0f, 1.0f);
   float cutoff = 2000.0f + (1.0f - shadow) * 8000.0f;
-  float rc = 1.0f / (2.0f * (float)M_PI * cutoff);
-  float dt = 1.0f / engine->config.sample_rate;
-  engine->hrtf.shadow_alpha = dt / (rc + dt);
+  float alpha = ae_onepole_alpha(cutoff, (float)engine->config.sample_rate);
+  ae_onepole4_set(&hrtf->shadow, 0, alpha,
+                  params->azimuth_deg > 0.0f ? AE_ONEPOLE_LOWPASS
+                                             : AE_ONEPOLE_BYPASS);
+  ae_onepole4_set(&hrtf->shadow, 1, alpha,
+                  params->azimuth_deg < 0.0f ? AE_ONEPOLE_LOWPASS
+                                             : AE_ONEPOLE_BYPASS);
 }
 
-void ae_spatial_process(ae_engine_t *engine, float *left, float *right,
-                        size_t frames) {
-  if (!engine || !left || !right || frames == 0)
+void ae_spatial_process(ae_engine_t *engine, uint32_t listener, float *left,
+                        float *right, size_t frames) {
+  if (!engine || !left || !right || frames == 0 ||
+      listener >= engine->config.listener_count)
     return;
-  if (!engine->hrtf.enabled)
+  struct ae_hrtf *hrtf = ae_spatial_listener(engine, listener);
+  if (!hrtf->enabled)
     return;
 
-#ifdef AE_USE_LIBMYSOFA
-  if (engine->hrtf.loaded && engine->hrtf.hrir_l && engine->hrtf.hrir_r &&
-      engine->hrtf.history && engine->hrtf.hrir_len > 0) {
-    if (!engine->hrtf.delay_l || !engine->hrtf.delay_r)
-      return;
-
-    size_t hrir_len = engine->hrtf.hrir_len;
-    size_t history_size = engine->hrtf.history_size;
-    size_t delay_size = engine->hrtf.delay_size;
-    size_t delay_index = engine->hrtf.delay_index;
-    size_t history_index = engine->hrtf.history_index;
-
-    size_t delay_l = 0;
-    size_t delay_r = 0;
-    if (delay_size > 1) {
-      int max_delay = (int)delay_size - 1;
-      delay_l = (size_t)ae_clamp(lrintf(engine->hrtf.delay_l_samples), 0,
-                                 max_delay);
-      delay_r = (size_t)ae_clamp(lrintf(engine->hrtf.delay_r_samples), 0,
-                                 max_delay);
-    }
-
-    for (size_t i = 0; i < frames; ++i) {
-      float input = 0.5f * (left[i] + right[i]);
-      engine->hrtf.history[history_index] = input;
-
-      float out_l = 0.0f;
-      float out_r = 0.0f;
-      size_t idx = history_index;
-      for (size_t k = 0; k < hrir_len; ++k) {
-        float sample = engine->hrtf.history[idx];
-        out_l += engine->hrtf.hrir_l[k] * sample;
-        out_r += engine->hrtf.hrir_r[k] * sample;
-        if (idx == 0)
-          idx = history_size - 1;
-        else
-          --idx;
-      }
-
-      engine->hrtf.delay_l[delay_index] = out_l;
-      engine->hrtf.delay_r[delay_index] = out_r;
-
-      size_t read_l = (delay_index + delay_size - delay_l) % delay_size;
-      size_t read_r = (delay_index + delay_size - delay_r) % delay_size;
-
-      left[i] = engine->hrtf.delay_l[read_l];
-      right[i] = engine->hrtf.delay_r[read_r];
-
-      delay_index = (delay_index + 1) % delay_size;
-      history_index = (history_index + 1) % history_size;
-    }
-
-    engine->hrtf.delay_index = delay_index;
-    engine->hrtf.history_index = history_index;
+  if (AE_ATOMIC_LOAD_INT(&engine->hrtf.loaded) && hrtf->convolver) {
+    /* Mono downmix in place, then both ears from the shared spectrum; the
+     * onset delays are part of the filters */
+    for (size_t i = 0; i < frames; ++i)
+      left[i] = 0.5f * (left[i] + right[i]);
+    ae_convolver_process(hrtf->convolver, left, left, right, frames);
     return;
   }
-#endif
 
-  if (!engine->hrtf.delay_l || !engine->hrtf.delay_r)
+  if (!hrtf->delay_l || !hrtf->delay_r)
     return;
 
-  int itd = engine->hrtf.itd_samples;
-  size_t delay_size = engine->hrtf.delay_size;
-  float gain_l = engine->hrtf.ild_gain_l;
-  float gain_r = engine->hrtf.ild_gain_r;
-
-  bool shadow_left = engine->hrtf.params.azimuth_deg > 0.0f;
-  float alpha = engine->hrtf.shadow_alpha;
-  float state_l = engine->hrtf.shadow_state_l;
-  float state_r = engine->hrtf.shadow_state_r;
+  int itd = hrtf->itd_samples;
+  size_t delay_size = hrtf->delay_size;
+  float gain_l = hrtf->ild_gain_l;
+  float gain_r = hrtf->ild_gain_r;
 
   for (size_t i = 0; i < frames; ++i) {
-    engine->hrtf.delay_l[engine->hrtf.delay_index] = left[i];
-    engine->hrtf.delay_r[engine->hrtf.delay_index] = right[i];
+    hrtf->delay_l[hrtf->delay_index] = left[i];
+    hrtf->delay_r[hrtf->delay_index] = right[i];
 
-    size_t read_l = engine->hrtf.delay_index;
-    size_t read_r = engine->hrtf.delay_index;
+    size_t read_l = hrtf->delay_index;
+    size_t read_r = hrtf->delay_index;
     if (itd > 0) {
-      read_l = (engine->hrtf.delay_index + delay_size - (size_t)itd) %
-               delay_size;
+      read_l = (hrtf->delay_index + delay_size - (size_t)itd) % delay_size;
     } else if (itd < 0) {
       read_r =
-          (engine->hrtf.delay_index + delay_size - (size_t)(-itd)) %
-          delay_size;
-    }
-
-    float out_l = engine->hrtf.delay_l[read_l] * gain_l;
-    float out_r = engine->hrtf.delay_r[read_r] * gain_r;
-
-    if (alpha > 0.0f) {
-      if (shadow_left) {
-        state_l = state_l + alpha * (out_l - state_l);
-        out_l = state_l;
-      } else if (engine->hrtf.params.azimuth_deg < 0.0f) {
-        state_r = state_r + alpha * (out_r - state_r);
-        out_r = state_r;
-      }
+          (hrtf->delay_index + delay_size - (size_t)(-itd)) % delay_size;
     }
 
-    left[i] = out_l;
-    right[i] = out_r;
+    left[i] = hrtf->delay_l[read_l] * gain_l;
+    right[i] = hrtf->delay_r[read_r] * gain_r;
 
-    engine->hrtf.delay_index =
-        (engine->hrtf.delay_index + 1) % delay_size;
+    hrtf->delay_index = (hrtf->delay_index + 1) % delay_size;
   }
 
-  engine->hrtf.shadow_state_l = state_l;
-  engine->hrtf.shadow_state_r = state_r;
+  /* Head shadow, both ears in one pass */
+  float *const ch[2] = {left, right};
+  ae_onepole4_process(&hrtf->shadow, ch, 2, frames);
+}
+
+/**
+ * ae_spatial_process for listener 0 of several engines over the same frame
+ * count. The HRIR-rendering engines go to the convolver as one group, so
+ * their direct-form heads share SIMD registers; the rest run one at a
+ * time.
+ */
+void ae_spatial_process_group(ae_engine_t *const *engines,
+                              float *const *left, float *const *right,
+                              size_t count, size_t frames) {
+  ae_convolver_t *convs[AE_SPATIAL_GROUP];
+  const float *inputs[AE_SPATIAL_GROUP];
+  float *outs_l[AE_SPATIAL_GROUP];
+  float *outs_r[AE_SPATIAL_GROUP];
+  size_t batched = 0;
+  for (size_t e = 0; e < count; ++e) {
+    ae_engine_t *engine = engines[e];
+    if (!engine->hrtf.enabled ||
+        !AE_ATOMIC_LOAD_INT(&engine->hrtf.loaded) ||
+        !engine->hrtf.convolver) {
+      ae_spatial_process(engine, 0, left[e], right[e], frames);
+      continue;
+    }
+    for (size_t i = 0; i < frames; ++i)
+      left[e][i] = 0.5f * (left[e][i] + right[e][i]);
+    convs[batched] = engine->hrtf.convolver;
+    inputs[batched] = left[e];
+    outs_l[batched] = left[e];
+    outs_r[batched] = right[e];
+    if (++batched == AE_SPATIAL_GROUP) {
+      ae_convolver_process_group(convs, inputs, outs_l, outs_r, batched,
+                                 frames);
+      batched = 0;
+    }
+  }
+  if (batched > 0)
+    ae_convolver_process_group(convs, inputs, outs_l, outs_r, batched,
+                               frames);
 }
@@ -0,0 +1,224 @@
+/**
+ * @file ae_thread.c
+ * @brief Background worker thread (POSIX threads / Win32)
+ *
+ * One thread per worker runs posted jobs off the audio thread. Only the
+ * latest job is kept: posting while a job is still queued discards the
+ * queued one, so a stream of updates (e.g. a moving listener) never backs up.
+ *
+ * ae_mutex_t guards state shared between a control thread and a worker;
+ * the audio thread never takes it.
+ */
+
+#include "ae_internal.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+struct ae_worker {
+#if defined(_WIN32)
+  HANDLE thread;
+  SRWLOCK lock;
+  CONDITION_VARIABLE cond;
+#else
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+#endif
+  ae_job_fn run;     /* Queued job, NULL when none */
+  ae_job_fn discard; /* Releases the job argument if it never runs */
+  void *arg;
+  bool busy; /* A job is running */
+  bool stop;
+};
+
+#if defined(_WIN32)
+#define AE_WORKER_LOCK(w) AcquireSRWLockExclusive(&(w)->lock)
+#define AE_WORKER_UNLOCK(w) ReleaseSRWLockExclusive(&(w)->lock)
+#define AE_WORKER_WAIT(w)                                                      \
+  SleepConditionVariableSRW(&(w)->cond, &(w)->lock, INFINITE, 0)
+#define AE_WORKER_BROADCAST(w) WakeAllConditionVariable(&(w)->cond)
+#else
+#define AE_WORKER_LOCK(w) pthread_mutex_lock(&(w)->lock)
+#define AE_WORKER_UNLOCK(w) pthread_mutex_unlock(&(w)->lock)
+#define AE_WORKER_WAIT(w) pthread_cond_wait(&(w)->cond, &(w)->lock)
+#define AE_WORKER_BROADCAST(w) pthread_cond_broadcast(&(w)->cond)
+#endif
+
+static void ae_worker_loop(ae_worker_t *worker) {
+  AE_WORKER_LOCK(worker);
+  while (!worker->stop) {
+    if (!worker->run) {
+      AE_WORKER_WAIT(worker);
+      continue;
+    }
+    ae_job_fn run = worker->run;
+    void *arg = worker->arg;
+    worker->run = NULL;
+    worker->discard = NULL;
+    worker->arg = NULL;
+    worker->busy = true;
+    AE_WORKER_UNLOCK(worker);
+
+    run(arg);
+
+    AE_WORKER_LOCK(worker);
+    worker->busy = false;
+    AE_WORKER_BROADCAST(worker);
+  }
+  AE_WORKER_UNLOCK(worker);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI ae_worker_main(LPVOID arg) {
+  ae_worker_loop((ae_worker_t *)arg);
+  return 0;
+}
+#else
+static void *ae_worker_main(void *arg) {
+  ae_worker_loop((ae_worker_t *)arg);
+  return NULL;
+}
+#endif
+
+ae_worker_t *ae_worker_create(void) {
+  ae_worker_t *worker = (ae_worker_t *)calloc(1, sizeof(ae_worker_t));
+  if (!worker)
+    return NULL;
+#if defined(_WIN32)
+  InitializeSRWLock(&worker->lock);
+  InitializeConditionVariable(&worker->cond);
+  worker->thread = CreateThread(NULL, 0, ae_worker_main, worker, 0, NULL);
+  if (!worker->thread) {
+    free(worker);
+    return NULL;
+  }
+#else
+  if (pthread_mutex_init(&worker->lock, NULL) != 0) {
+    free(worker);
+    return NULL;
+  }
+  if (pthread_cond_init(&worker->cond, NULL) != 0) {
+    pthread_mutex_destroy(&worker->lock);
+    free(worker);
+    return NULL;
+  }
+  if (pthread_create(&worker->thread, NULL, ae_worker_main, worker) != 0) {
+    pthread_cond_destroy(&worker->cond);
+    pthread_mutex_destroy(&worker->lock);
+    free(worker);
+    return NULL;
+  }
+#endif
+  return worker;
+}
+
+void ae_worker_destroy(ae_worker_t *worker) {
+  if (!worker)
+    return;
+  AE_WORKER_LOCK(worker);
+  worker->stop = true;
+  if (worker->run && worker->discard)
+    worker->discard(worker->arg);
+  worker->run = NULL;
+  AE_WORKER_BROADCAST(worker);
+  AE_WORKER_UNLOCK(worker);
+
+#if defined(_WIN32)
+  WaitForSingleObject(worker->thread, INFINITE);
+  CloseHandle(worker->thread);
+#else
+  pthread_join(worker->thread, NULL);
+  pthread_cond_destroy(&worker->cond);
+  pthread_mutex_destroy(&worker->lock);
+#endif
+  free(worker);
+}
+
+void ae_worker_post(ae_worker_t *worker, ae_job_fn run, ae_job_fn discard,
+                    void *arg) {
+  if (!worker || !run)
+    return;
+  AE_WORKER_LOCK(worker);
+  if (worker->run && worker->discard)
+    worker->discard(worker->arg);
+  worker->run = run;
+  worker->discard = discard;
+  worker->arg = arg;
+  AE_WORKER_BROADCAST(worker);
+  AE_WORKER_UNLOCK(worker);
+}
+
+void ae_worker_wait_idle(ae_worker_t *worker) {
+  if (!worker)
+    return;
+  AE_WORKER_LOCK(worker);
+  while (worker->run || worker->busy)
+    AE_WORKER_WAIT(worker);
+  AE_WORKER_UNLOCK(worker);
+}
+
+struct ae_mutex {
+#if defined(_WIN32)
+  SRWLOCK lock;
+#else
+  pthread_mutex_t lock;
+#endif
+};
+
+ae_mutex_t *ae_mutex_create(void) {
+  ae_mutex_t *mutex = (ae_mutex_t *)calloc(1, sizeof(ae_mutex_t));
+  if (!mutex)
+    return NULL;
+#if defined(_WIN32)
+  InitializeSRWLock(&mutex->lock);
+#else
+  if (pthread_mutex_init(&mutex->lock, NULL) != 0) {
+    free(mutex);
+    return NULL;
+  }
+#endif
+  return mutex;
+}
+
+void ae_mutex_destroy(ae_mutex_t *mutex) {
+  if (!mutex)
+    return;
+#if !defined(_WIN32)
+  pthread_mutex_destroy(&mutex->lock);
+#endif
+  free(mutex);
+}
+
+void ae_mutex_lock(ae_mutex_t *mutex) {
+  if (!mutex)
+    return;
+#if defined(_WIN32)
+  AcquireSRWLockExclusive(&mutex->lock);
+#else
+  pthread_mutex_lock(&mutex->lock);
+#endif
+}
+
+void ae_mutex_unlock(ae_mutex_t *mutex) {
+  if (!mutex)
+    return;
+#if defined(_WIN32)
+  ReleaseSRWLockExclusive(&mutex->lock);
+#else
+  pthread_mutex_unlock(&mutex->lock);
+#endif
+}
+
+void ae_thread_yield(void) {
+#if defined(_WIN32)
+  SwitchToThread();
+#else
+  sched_yield();
+#endif
+}
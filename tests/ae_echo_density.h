@@ -0,0 +1,28 @@
+/**
+ * @file ae_echo_density.h
+ * @brief Normalized echo density, shared by the reverb tests and benchmarks
+ */
+
+#ifndef AE_ECHO_DENSITY_H
+#define AE_ECHO_DENSITY_H
+
+#include <math.h>
+#include <stddef.h>
+
+/* Normalized echo density (Abel & Huang) of one window: the fraction of
+ * samples beyond one standard deviation over the Gaussian 0.3173, so
+ * 1.0 = Gaussian-like density and sparse echoes read near 0 */
+static inline float ae_echo_density(const float *x, size_t n) {
+  double energy = 0.0;
+  for (size_t i = 0; i < n; ++i)
+    energy += (double)x[i] * x[i];
+  double sd = sqrt(energy / (double)n);
+  if (sd <= 0.0)
+    return 0.0f;
+  size_t outside = 0;
+  for (size_t i = 0; i < n; ++i)
+    outside += fabs(x[i]) > sd;
+  return (float)((double)outside / (double)n / 0.3173);
+}
+
+#endif /* AE_ECHO_DENSITY_H */
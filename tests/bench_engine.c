@@ -0,0 +1,1034 @@
+/**
+ * @file bench_engine.c
+ * @brief Throughput benchmarks for the processing stages
+ *
+ * Not part of ctest. Run `bench_engine` from a Release build; results are
+ * reported as nanoseconds per sample frame (lower is better).
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* syscall() for perf_event_open */
+#endif
+
+#include "acoustic_engine.h"
+#include "../src/ae_internal.h"
+#include "ae_echo_density.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||          \
+    defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define BENCH_HAS_TSC 1
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define BENCH_HAS_PERF 1
+#endif
+
+#define BENCH_SR 48000
+#ifndef BENCH_SECONDS
+#define BENCH_SECONDS 4
+#endif
+
+/*============================================================================
+ * Timing helpers
+ *============================================================================*/
+
+static double bench_now(void) {
+  return (double)clock() / (double)CLOCKS_PER_SEC;
+}
+
+static void bench_report(const char *name, double seconds, size_t frames) {
+  printf("  %-44s %8.2f ns/frame\n", name, seconds * 1e9 / (double)frames);
+}
+
+/* Time-stamp counter ticks; on current x86 parts these run at the base
+ * clock, so they approximate core cycles */
+static unsigned long long bench_ticks(void) {
+#ifdef BENCH_HAS_TSC
+  return (unsigned long long)__rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static void bench_report_cycles(const char *name, double seconds,
+                                unsigned long long ticks, size_t frames) {
+  printf("  %-44s %8.2f ns/frame %8.2f cycles/sample\n", name,
+         seconds * 1e9 / (double)frames, (double)ticks / (double)frames);
+}
+
+/* Last-level cache misses of this thread through perf counters; -1 where
+ * they are unavailable (other systems, or perf_event_paranoid) */
+static int bench_misses_open(void) {
+#ifdef BENCH_HAS_PERF
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = PERF_COUNT_HW_CACHE_MISSES;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+  if (fd >= 0) {
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+  return fd;
+#else
+  return -1;
+#endif
+}
+
+/* Misses counted since bench_misses_open, or -1; closes the counter */
+static double bench_misses_close(int fd) {
+  double misses = -1.0;
+#ifdef BENCH_HAS_PERF
+  if (fd >= 0) {
+    unsigned long long count = 0;
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(fd, &count, sizeof(count)) == (ssize_t)sizeof(count))
+      misses = (double)count;
+    close(fd);
+  }
+#else
+  (void)fd;
+#endif
+  return misses;
+}
+
+static void bench_report_misses(const char *name, double seconds,
+                                double misses, size_t frames) {
+  if (misses < 0.0) {
+    printf("  %-44s %8.2f ns/frame   (cache misses n/a)\n", name,
+           seconds * 1e9 / (double)frames);
+    return;
+  }
+  printf("  %-44s %8.2f ns/frame %8.3f LLC misses/frame\n", name,
+         seconds * 1e9 / (double)frames, misses / (double)frames);
+}
+
+static void bench_fill_noise(float *buffer, size_t n, unsigned seed) {
+  srand(seed);
+  for (size_t i = 0; i < n; ++i)
+    buffer[i] = 0.25f * (2.0f * ((float)rand() / RAND_MAX) - 1.0f);
+}
+
+/*============================================================================
+ * Engine benchmarks
+ *============================================================================*/
+
+static void bench_engine_preset(const char *name, const ae_config_t *config,
+                                const char *preset, size_t block) {
+  ae_engine_t *engine = ae_create_engine(config);
+  if (!engine) {
+    printf("  %-44s (engine creation failed)\n", name);
+    return;
+  }
+  ae_load_preset(engine, preset);
+
+  float *in = (float *)malloc(block * sizeof(float));
+  float *out = (float *)malloc(block * 2 * sizeof(float));
+  if (!in || !out) {
+    free(in);
+    free(out);
+    ae_destroy_engine(engine);
+    return;
+  }
+  bench_fill_noise(in, block, 1);
+  ae_audio_buffer_t in_buf = {
+      .samples = in, .frame_count = block, .channels = 1, .interleaved = true};
+  ae_audio_buffer_t out_buf = {
+      .samples = out, .frame_count = block, .channels = 2, .interleaved = true};
+
+  size_t total = (size_t)BENCH_SR * BENCH_SECONDS;
+  size_t blocks = total / block;
+  double start = bench_now();
+  for (size_t b = 0; b < blocks; ++b)
+    ae_process(engine, &in_buf, &out_buf);
+  bench_report(name, bench_now() - start, blocks * block);
+
+  free(in);
+  free(out);
+  ae_destroy_engine(engine);
+}
+
+static void bench_reverb_rate(void) {
+  static const char *presets[] = {"deep_sea", "space", "radio"};
+  ae_config_t full = ae_get_default_config();
+  full.reverb_rate = AE_REVERB_RATE_FULL;
+  ae_config_t autorate = ae_get_default_config();
+  autorate.reverb_rate = AE_REVERB_RATE_AUTO;
+
+  printf("\n=== Late reverb rate (engine total, block 256) ===\n");
+  for (size_t i = 0; i < sizeof(presets) / sizeof(presets[0]); ++i) {
+    char name[64];
+    snprintf(name, sizeof(name), "%s full rate", presets[i]);
+    bench_engine_preset(name, &full, presets[i], 256);
+    snprintf(name, sizeof(name), "%s auto rate", presets[i]);
+    bench_engine_preset(name, &autorate, presets[i], 256);
+  }
+}
+
+static void bench_early_reflections(void) {
+  static const uint32_t taps[] = {12, 32, 64, 128};
+  printf("\n=== Early reflection taps (engine total, block 256) ===\n");
+  for (size_t i = 0; i < sizeof(taps) / sizeof(taps[0]); ++i) {
+    ae_config_t config = ae_get_default_config();
+    config.early_reflection_taps = taps[i];
+    char name[64];
+    snprintf(name, sizeof(name), "cathedral, %u ER taps", (unsigned)taps[i]);
+    bench_engine_preset(name, &config, "cathedral", 256);
+  }
+}
+
+/* Wet impulse response, left channel */
+static int bench_impulse_response(const ae_config_t *config, float *out,
+                                  size_t length) {
+  ae_engine_t *engine = ae_create_engine(config);
+  if (!engine)
+    return 0;
+  ae_set_dry_wet(engine, 1.0f);
+  float in[256];
+  float stereo[512];
+  for (size_t pos = 0; pos < length; pos += 256) {
+    size_t n = length - pos < 256 ? length - pos : 256;
+    memset(in, 0, sizeof(in));
+    if (pos == 0)
+      in[0] = 1.0f;
+    ae_audio_buffer_t in_buf = {
+        .samples = in, .frame_count = n, .channels = 1, .interleaved = true};
+    ae_audio_buffer_t out_buf = {
+        .samples = stereo, .frame_count = n, .channels = 2,
+        .interleaved = true};
+    ae_process(engine, &in_buf, &out_buf);
+    for (size_t i = 0; i < n; ++i)
+      out[pos + i] = stereo[i * 2];
+  }
+  ae_destroy_engine(engine);
+  return 1;
+}
+
+static void bench_diffuser_density(void) {
+  static const ae_diffuser_t modes[] = {AE_DIFFUSER_ALLPASS,
+                                        AE_DIFFUSER_VELVET};
+  static const char *labels[] = {"allpass pair", "velvet noise"};
+  size_t length = BENCH_SR / 2;
+  size_t window = BENCH_SR / 100;
+  float *ir = (float *)malloc(length * sizeof(float));
+  if (!ir)
+    return;
+
+  printf("\n=== Input diffuser echo density (wet IR, 10 ms windows) ===\n");
+  printf("  %-16s", "after onset:");
+  for (size_t w = 0; w < 8; ++w)
+    printf(" %5zums", w * 10);
+  printf("\n");
+  for (size_t m = 0; m < 2; ++m) {
+    ae_config_t config = ae_get_default_config();
+    config.diffuser = modes[m];
+    if (!bench_impulse_response(&config, ir, length))
+      continue;
+    size_t onset = 0;
+    while (onset < length && fabsf(ir[onset]) < 1e-7f)
+      ++onset;
+    printf("  %-16s", labels[m]);
+    for (size_t w = 0; w < 8; ++w) {
+      size_t start = onset + w * window;
+      if (start + window > length)
+        break;
+      printf(" %7.2f", ae_echo_density(ir + start, window));
+    }
+    printf("\n");
+  }
+  free(ir);
+}
+
+static void bench_diffuser(void) {
+  static const char *presets[] = {"cathedral", "space"};
+  printf("\n=== Input diffuser (engine total, block 256) ===\n");
+  for (size_t i = 0; i < sizeof(presets) / sizeof(presets[0]); ++i) {
+    ae_config_t config = ae_get_default_config();
+    char name[64];
+    config.diffuser = AE_DIFFUSER_ALLPASS;
+    snprintf(name, sizeof(name), "%s, allpass pair", presets[i]);
+    bench_engine_preset(name, &config, presets[i], 256);
+    config.diffuser = AE_DIFFUSER_VELVET;
+    snprintf(name, sizeof(name), "%s, velvet noise", presets[i]);
+    bench_engine_preset(name, &config, presets[i], 256);
+  }
+}
+
+/* Many voices rendered round-robin, so each engine's delay lines have been
+ * evicted from cache by the others before its next block */
+static void bench_voices(const char *name, ae_delay_storage_t storage,
+                         size_t voices) {
+  ae_config_t config = ae_get_default_config();
+  config.delay_storage = storage;
+  config.max_buffer_size = 256;
+  ae_engine_t **engines = (ae_engine_t **)calloc(voices, sizeof(*engines));
+  float *in = (float *)malloc(256 * sizeof(float));
+  float *out = (float *)malloc(512 * sizeof(float));
+  size_t created = 0;
+  if (engines && in && out) {
+    for (; created < voices; ++created) {
+      engines[created] = ae_create_engine(&config);
+      if (!engines[created])
+        break;
+      ae_load_preset(engines[created], "cathedral");
+    }
+  }
+  if (created == voices) {
+    bench_fill_noise(in, 256, 1);
+    ae_audio_buffer_t in_buf = {
+        .samples = in, .frame_count = 256, .channels = 1, .interleaved = true};
+    ae_audio_buffer_t out_buf = {
+        .samples = out, .frame_count = 256, .channels = 2, .interleaved = true};
+    size_t rounds = (size_t)BENCH_SR * BENCH_SECONDS / 256 / voices + 1;
+    int misses = bench_misses_open();
+    double start = bench_now();
+    for (size_t r = 0; r < rounds; ++r) {
+      for (size_t v = 0; v < voices; ++v)
+        ae_process(engines[v], &in_buf, &out_buf);
+    }
+    double seconds = bench_now() - start;
+    bench_report_misses(name, seconds, bench_misses_close(misses),
+                        rounds * voices * 256);
+  } else {
+    printf("  %-44s (engine creation failed)\n", name);
+  }
+  for (size_t v = 0; v < created; ++v)
+    ae_destroy_engine(engines[v]);
+  free(engines);
+  free(in);
+  free(out);
+}
+
+static void bench_delay_storage(void) {
+  static const size_t voice_counts[] = {1, 64, 256};
+  static const ae_delay_storage_t formats[] = {
+      AE_DELAY_STORAGE_FLOAT32, AE_DELAY_STORAGE_FP16, AE_DELAY_STORAGE_INT16};
+  static const char *labels[] = {"float32", "fp16", "int16"};
+  printf("\n=== Delay storage (cathedral, block 256, per voice frame) ===\n");
+  for (size_t c = 0; c < sizeof(voice_counts) / sizeof(voice_counts[0]);
+       ++c) {
+    for (size_t f = 0; f < 3; ++f) {
+      char name[64];
+      snprintf(name, sizeof(name), "%3zu voices, %s", voice_counts[c],
+               labels[f]);
+      bench_voices(name, formats[f], voice_counts[c]);
+    }
+  }
+}
+
+/*============================================================================
+ * HRIR convolution
+ *============================================================================*/
+
+/* The per-sample ring-buffer FIR the SOFA path used before partitioning */
+static void bench_direct_fir(const float *ir_l, const float *ir_r, size_t taps,
+                             float *history, size_t *index, const float *in,
+                             float *out_l, float *out_r, size_t frames) {
+  size_t pos = *index;
+  for (size_t i = 0; i < frames; ++i) {
+    history[pos] = in[i];
+    float sum_l = 0.0f;
+    float sum_r = 0.0f;
+    size_t idx = pos;
+    for (size_t k = 0; k < taps; ++k) {
+      sum_l += ir_l[k] * history[idx];
+      sum_r += ir_r[k] * history[idx];
+      if (idx == 0)
+        idx = taps - 1;
+      else
+        --idx;
+    }
+    out_l[i] = sum_l;
+    out_r[i] = sum_r;
+    pos = (pos + 1) % taps;
+  }
+  *index = pos;
+}
+
+static void bench_hrir_case(size_t taps, size_t block, uint32_t partition) {
+  float *ir = (float *)malloc(2 * taps * sizeof(float));
+  float *history = (float *)calloc(taps, sizeof(float));
+  float *in = (float *)malloc(block * sizeof(float));
+  float *out = (float *)malloc(2 * block * sizeof(float));
+  ae_convolver_config_t config = {.max_taps = (uint32_t)taps,
+                                  .partition_size = partition};
+  ae_convolver_t *conv =
+      partition == UINT32_MAX ? NULL : ae_convolver_create(&config);
+  char name[64];
+  if (partition == UINT32_MAX)
+    snprintf(name, sizeof(name), "%4zu taps, block %4zu, direct", taps, block);
+  else
+    snprintf(name, sizeof(name), "%4zu taps, block %4zu, partition %u", taps,
+             block, (unsigned)partition);
+  if (!ir || !history || !in || !out ||
+      (partition != UINT32_MAX && !conv)) {
+    printf("  %-44s (setup failed)\n", name);
+  } else {
+    bench_fill_noise(ir, 2 * taps, 3);
+    bench_fill_noise(in, block, 1);
+    if (conv)
+      ae_convolver_set_filters(conv, ir, ir + taps, taps);
+    size_t index = 0;
+    size_t blocks = (size_t)BENCH_SR * BENCH_SECONDS / block;
+    double start = bench_now();
+    for (size_t b = 0; b < blocks; ++b) {
+      if (conv)
+        ae_convolver_process(conv, in, out, out + block, block);
+      else
+        bench_direct_fir(ir, ir + taps, taps, history, &index, in, out,
+                         out + block, block);
+    }
+    bench_report(name, bench_now() - start, blocks * block);
+  }
+  ae_convolver_destroy(conv);
+  free(ir);
+  free(history);
+  free(in);
+  free(out);
+}
+
+static void bench_hrir_convolution(void) {
+  static const size_t taps[] = {128, 256, 512};
+  static const size_t blocks[] = {64, 256};
+  static const uint32_t partitions[] = {UINT32_MAX, 32, 64, 128, 0};
+  printf("\n=== HRIR convolution (both ears; partition 0 = auto) ===\n");
+  for (size_t t = 0; t < sizeof(taps) / sizeof(taps[0]); ++t) {
+    for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); ++b) {
+      for (size_t p = 0; p < sizeof(partitions) / sizeof(partitions[0]); ++p)
+        bench_hrir_case(taps[t], blocks[b], partitions[p]);
+    }
+  }
+}
+
+/* Moving source: new filters every `interval` blocks (0 = never) */
+static void bench_hrir_update_case(size_t interval) {
+  size_t taps = 256;
+  size_t block = 256;
+  float *ir = (float *)malloc(4 * taps * sizeof(float));
+  float *in = (float *)malloc(block * sizeof(float));
+  float *out = (float *)malloc(2 * block * sizeof(float));
+  ae_convolver_config_t config = {.max_taps = (uint32_t)taps};
+  ae_convolver_t *conv = ae_convolver_create(&config);
+  char name[64];
+  if (interval == 0)
+    snprintf(name, sizeof(name), "%zu taps, static filters", taps);
+  else
+    snprintf(name, sizeof(name), "%zu taps, update every %zu blocks", taps,
+             interval);
+  if (!ir || !in || !out || !conv) {
+    printf("  %-44s (setup failed)\n", name);
+  } else {
+    bench_fill_noise(ir, 4 * taps, 3);
+    bench_fill_noise(in, block, 1);
+    ae_convolver_set_filters(conv, ir, ir + taps, taps);
+    size_t blocks = (size_t)BENCH_SR * BENCH_SECONDS / block;
+    double start = bench_now();
+    for (size_t b = 0; b < blocks; ++b) {
+      /* Counted in the total, as a control thread would share the core */
+      if (interval > 0 && b % interval == 0) {
+        const float *next = ir + ((b / interval) & 1) * 2 * taps;
+        ae_convolver_set_filters(conv, next, next + taps, taps);
+      }
+      ae_convolver_process(conv, in, out, out + block, block);
+    }
+    bench_report(name, bench_now() - start, blocks * block);
+  }
+  ae_convolver_destroy(conv);
+  free(ir);
+  free(in);
+  free(out);
+}
+
+static void bench_hrir_updates(void) {
+  static const size_t intervals[] = {0, 16, 4, 1};
+  printf("\n=== HRIR updates (block 256, crossfade 256) ===\n");
+  for (size_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); ++i)
+    bench_hrir_update_case(intervals[i]);
+}
+
+/* N sources with their own convolvers: one call each vs. one group call */
+static void bench_hrir_group_case(size_t sources, size_t taps) {
+  size_t block = 256;
+  float *ir = (float *)malloc(2 * taps * sizeof(float));
+  float *in = (float *)malloc(block * sizeof(float));
+  float *out = (float *)malloc(2 * sources * block * sizeof(float));
+  ae_convolver_t **convs =
+      (ae_convolver_t **)calloc(sources, sizeof(ae_convolver_t *));
+  const float **inputs = (const float **)calloc(sources, sizeof(float *));
+  float **out_l = (float **)calloc(sources, sizeof(float *));
+  float **out_r = (float **)calloc(sources, sizeof(float *));
+  size_t created = 0;
+  if (ir && in && out && convs && inputs && out_l && out_r) {
+    bench_fill_noise(ir, 2 * taps, 3);
+    bench_fill_noise(in, block, 1);
+    ae_convolver_config_t config = {.max_taps = (uint32_t)taps};
+    for (; created < sources; ++created) {
+      convs[created] = ae_convolver_create(&config);
+      if (!convs[created])
+        break;
+      ae_convolver_set_filters(convs[created], ir, ir + taps, taps);
+      inputs[created] = in;
+      out_l[created] = out + 2 * created * block;
+      out_r[created] = out + (2 * created + 1) * block;
+    }
+  }
+  if (created == sources) {
+    size_t blocks = (size_t)BENCH_SR * BENCH_SECONDS / block;
+    char name[64];
+    double start = bench_now();
+    for (size_t b = 0; b < blocks; ++b) {
+      for (size_t s = 0; s < sources; ++s)
+        ae_convolver_process(convs[s], in, out_l[s], out_r[s], block);
+    }
+    snprintf(name, sizeof(name), "%3zu sources, %zu taps, one by one",
+             sources, taps);
+    bench_report(name, bench_now() - start, blocks * block * sources);
+
+    start = bench_now();
+    for (size_t b = 0; b < blocks; ++b)
+      ae_convolver_process_group(convs, inputs, out_l, out_r, sources,
+                                 block);
+    snprintf(name, sizeof(name), "%3zu sources, %zu taps, grouped", sources,
+             taps);
+    bench_report(name, bench_now() - start, blocks * block * sources);
+  } else {
+    printf("  %zu sources (setup failed)\n", sources);
+  }
+  for (size_t s = 0; s < created; ++s)
+    ae_convolver_destroy(convs[s]);
+  free(convs);
+  free(inputs);
+  free(out_l);
+  free(out_r);
+  free(ir);
+  free(in);
+  free(out);
+}
+
+static void bench_hrir_group(void) {
+  static const size_t sources[] = {8, 32, 128};
+  static const size_t taps[] = {32, 155, 256};
+  printf("\n=== Grouped HRIR convolution (block 256, per source frame) ===\n");
+  for (size_t t = 0; t < sizeof(taps) / sizeof(taps[0]); ++t) {
+    for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); ++i)
+      bench_hrir_group_case(sources[i], taps[t]);
+  }
+}
+
+/* N sources: one HRIR convolver each vs. encode + one third-order decode */
+static void bench_ambisonic_case(size_t sources) {
+  size_t taps = 256;
+  size_t block = 256;
+  size_t speakers = 72;
+  float *ir = (float *)malloc(2 * speakers * taps * sizeof(float));
+  float *in = (float *)malloc(block * sizeof(float));
+  float *out = (float *)malloc(4 * block * sizeof(float));
+  float *az = (float *)malloc(speakers * sizeof(float));
+  float *el = (float *)malloc(speakers * sizeof(float));
+  ae_convolver_t **convs =
+      (ae_convolver_t **)calloc(sources, sizeof(ae_convolver_t *));
+  ae_ambisonic_config_t config = {.order = 3,
+                                  .max_frames = (uint32_t)block,
+                                  .max_taps = (uint32_t)taps};
+  ae_ambisonic_bus_t *bus = ae_ambisonic_bus_create(&config);
+  if (!ir || !in || !out || !az || !el || !convs || !bus) {
+    printf("  %zu sources (setup failed)\n", sources);
+  } else {
+    bench_fill_noise(ir, 2 * speakers * taps, 3);
+    bench_fill_noise(in, block, 1);
+    for (size_t s = 0; s < speakers; ++s) {
+      az[s] = (float)(s % 12) * 30.0f - 180.0f;
+      el[s] = (float)(s / 12) * 30.0f - 75.0f;
+    }
+    ae_ambisonic_set_decoder(bus, az, el, ir, ir + speakers * taps, speakers,
+                             taps);
+    ae_convolver_config_t conv_config = {.max_taps = (uint32_t)taps};
+    for (size_t s = 0; s < sources; ++s) {
+      convs[s] = ae_convolver_create(&conv_config);
+      if (convs[s])
+        ae_convolver_set_filters(convs[s], ir, ir + taps, taps);
+    }
+
+    size_t blocks = (size_t)BENCH_SR * BENCH_SECONDS / block;
+    char name[64];
+    double start = bench_now();
+    for (size_t b = 0; b < blocks; ++b) {
+      for (size_t s = 0; s < sources; ++s) {
+        if (convs[s])
+          ae_convolver_process(convs[s], in, out, out + block, block);
+      }
+    }
+    snprintf(name, sizeof(name), "%3zu sources, HRIR per source", sources);
+    bench_report(name, bench_now() - start, blocks * block);
+
+    float gains[16];
+    start = bench_now();
+    for (size_t b = 0; b < blocks; ++b) {
+      for (size_t s = 0; s < sources; ++s) {
+        ae_ambisonic_gains(3, (float)(s * 7 % 360), 0.0f, gains);
+        ae_ambisonic_encode(bus, in, block, gains, NULL);
+      }
+      ae_ambisonic_decode(bus, out, out + block, block);
+    }
+    snprintf(name, sizeof(name), "%3zu sources, third-order bus", sources);
+    bench_report(name, bench_now() - start, blocks * block);
+  }
+  for (size_t s = 0; convs && s < sources; ++s)
+    ae_convolver_destroy(convs[s]);
+  ae_ambisonic_bus_destroy(bus);
+  free(convs);
+  free(ir);
+  free(in);
+  free(out);
+  free(az);
+  free(el);
+}
+
+static void bench_ambisonics(void) {
+  static const size_t sources[] = {1, 8, 32, 128};
+  printf("\n=== Ambisonic bus (third order, 256 taps, block 256) ===\n");
+  for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); ++i)
+    bench_ambisonic_case(sources[i]);
+}
+
+/*============================================================================
+ * Fast math kernels
+ *============================================================================*/
+
+typedef void (*bench_fm_fn)(float *, const float *, size_t, ae_math_tier_t);
+
+static void bench_fast_pow_03(float *dst, const float *src, size_t n,
+                              ae_math_tier_t tier) {
+  ae_fast_pow(dst, src, 0.3f, n, tier);
+}
+
+/* One value per "frame"; inputs are |noise| + 0.01 so log and pow apply */
+static void bench_fastmath(void) {
+  static const struct {
+    const char *name;
+    bench_fm_fn fn;
+  } kernels[] = {{"exp", ae_fast_exp},     {"log10", ae_fast_log10},
+                 {"pow 0.3", bench_fast_pow_03},
+                 {"sin", ae_fast_sin},     {"cos", ae_fast_cos},
+                 {"tanh", ae_fast_tanh}};
+  static const char *tiers[] = {"exact", "1e-4", "1e-2"};
+  size_t block = 256;
+  float in[256];
+  float out[256];
+  bench_fill_noise(in, block, 5);
+  for (size_t i = 0; i < block; ++i)
+    in[i] = fabsf(in[i]) * 16.0f + 0.01f;
+
+  printf("\n=== Fast math (block 256, ns per value) ===\n");
+  size_t blocks = (size_t)BENCH_SR * BENCH_SECONDS * 4 / block;
+  for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); ++k) {
+    for (int tier = AE_MATH_EXACT; tier <= AE_MATH_1E2; ++tier) {
+      char name[64];
+      double start = bench_now();
+      for (size_t b = 0; b < blocks; ++b)
+        kernels[k].fn(out, in, block, (ae_math_tier_t)tier);
+      snprintf(name, sizeof(name), "%-8s %s", kernels[k].name, tiers[tier]);
+      bench_report(name, bench_now() - start, blocks * block);
+    }
+  }
+}
+
+/*============================================================================
+ * Compressor
+ *============================================================================*/
+
+/* The per-sample form the block compressor replaced: libm log10f/powf per
+ * sample, dB-domain envelope, coefficients hoisted */
+static void bench_compressor_reference(float *left, float *right, size_t n,
+                                       float *envelope) {
+  float attack = expf(-1.0f / (0.010f * BENCH_SR));
+  float release = expf(-1.0f / (0.100f * BENCH_SR));
+  for (size_t i = 0; i < n; ++i) {
+    float peak = fmaxf(fabsf(left[i]), fabsf(right[i]));
+    float level_db = peak > 1e-10f ? 20.0f * log10f(peak) : -100.0f;
+    float coeff = level_db > *envelope ? attack : release;
+    *envelope = coeff * *envelope + (1.0f - coeff) * level_db;
+    float over = *envelope + 20.0f;
+    float gain_db = over > 0.0f ? -0.75f * over : 0.0f;
+    float gain = powf(10.0f, gain_db / 20.0f);
+    left[i] *= gain;
+    right[i] *= gain;
+  }
+}
+
+static void bench_compressor_case(const char *name, ae_compressor_t *comp,
+                                  bool sidechain, float *left, float *right,
+                                  const float *key, size_t block) {
+  size_t blocks = (size_t)BENCH_SR * BENCH_SECONDS / block;
+  float envelope = -100.0f;
+  double start = bench_now();
+  unsigned long long ticks = bench_ticks();
+  for (size_t b = 0; b < blocks; ++b) {
+    if (comp)
+      ae_compressor_process(comp, left, right, sidechain ? key : NULL,
+                            sidechain ? key : NULL, block);
+    else
+      bench_compressor_reference(left, right, block, &envelope);
+  }
+  ticks = bench_ticks() - ticks;
+  bench_report_cycles(name, bench_now() - start, ticks, blocks * block);
+}
+
+static void bench_compressor(void) {
+  size_t block = 256;
+  float *left = (float *)malloc(block * sizeof(float));
+  float *right = (float *)malloc(block * sizeof(float));
+  float *key = (float *)malloc(block * sizeof(float));
+  ae_compressor_t *comp = ae_compressor_create(BENCH_SR);
+  printf("\n=== Compressor (stereo, block 256) ===\n");
+  if (!left || !right || !key || !comp) {
+    printf("  (setup failed)\n");
+  } else {
+    /* Loud enough to sit in the knee and above it; gains of 1/4 or so
+     * keep the buffers far from denormals */
+    bench_fill_noise(left, block, 1);
+    bench_fill_noise(right, block, 2);
+    bench_fill_noise(key, block, 3);
+    bench_compressor_case("per-sample libm (reference)", NULL, false, left,
+                          right, key, block);
+    bench_fill_noise(left, block, 1);
+    bench_fill_noise(right, block, 2);
+    ae_compressor_params_t params;
+    ae_compressor_get_params(comp, &params);
+    bench_compressor_case("block, linked", comp, false, left, right, key,
+                          block);
+    params.stereo_link = false;
+    ae_compressor_set_params(comp, &params);
+    bench_compressor_case("block, unlinked", comp, false, left, right, key,
+                          block);
+    params.stereo_link = true;
+    ae_compressor_set_params(comp, &params);
+    bench_compressor_case("block, linked, sidechain", comp, true, left, right,
+                          key, block);
+  }
+  ae_compressor_destroy(comp);
+  free(left);
+  free(right);
+  free(key);
+}
+
+/*============================================================================
+ * Limiter
+ *============================================================================*/
+
+static void bench_limiter_case(const char *name, bool true_peak, float *left,
+                               float *right, size_t block) {
+  ae_limiter_t *lim = ae_limiter_create(BENCH_SR);
+  ae_limiter_params_t params = {.ceiling_db = -1.0f,
+                                .lookahead_ms = 5.0f,
+                                .release_ms = 50.0f,
+                                .true_peak = true_peak};
+  if (!lim || ae_limiter_set_params(lim, &params) != AE_OK) {
+    printf("  %-44s (setup failed)\n", name);
+    ae_limiter_destroy(lim);
+    return;
+  }
+  size_t blocks = (size_t)BENCH_SR * BENCH_SECONDS / block;
+  double start = bench_now();
+  unsigned long long ticks = bench_ticks();
+  for (size_t b = 0; b < blocks; ++b)
+    ae_limiter_process(lim, left, right, block);
+  ticks = bench_ticks() - ticks;
+  bench_report_cycles(name, bench_now() - start, ticks, blocks * block);
+  ae_limiter_destroy(lim);
+}
+
+static void bench_limiter(void) {
+  size_t block = 256;
+  float *left = (float *)malloc(block * sizeof(float));
+  float *right = (float *)malloc(block * sizeof(float));
+  printf("\n=== Limiter (stereo, block 256, 5 ms lookahead) ===\n");
+  if (!left || !right) {
+    printf("  (setup failed)\n");
+  } else {
+    bench_fill_noise(left, block, 1);
+    bench_fill_noise(right, block, 2);
+    bench_limiter_case("sample peak", false, left, right, block);
+    bench_fill_noise(left, block, 1);
+    bench_fill_noise(right, block, 2);
+    bench_limiter_case("true peak (4x polyphase)", true, left, right, block);
+  }
+  free(left);
+  free(right);
+}
+
+/*============================================================================
+ * Parametric EQ
+ *============================================================================*/
+
+/* The per-sample form the EQ replaced: every band's enabled flag checked
+ * inside the loop, direct form I, one channel after the other */
+typedef struct {
+  float b0, b1, b2, a1, a2;
+  float x1[2], x2[2], y1[2], y2[2];
+  bool enabled;
+} bench_eq_band_t;
+
+static void bench_eq_reference(bench_eq_band_t *bands, size_t count,
+                               float *left, float *right, size_t n) {
+  float *ch[2] = {left, right};
+  for (size_t c = 0; c < 2; ++c) {
+    for (size_t i = 0; i < n; ++i) {
+      float x = ch[c][i];
+      for (size_t b = 0; b < count; ++b) {
+        bench_eq_band_t *f = &bands[b];
+        if (!f->enabled)
+          continue;
+        float y = f->b0 * x + f->b1 * f->x1[c] + f->b2 * f->x2[c] -
+                  f->a1 * f->y1[c] - f->a2 * f->y2[c];
+        f->x2[c] = f->x1[c];
+        f->x1[c] = x;
+        f->y2[c] = f->y1[c];
+        f->y1[c] = y;
+        x = y;
+      }
+      ch[c][i] = x;
+    }
+  }
+}
+
+static void bench_eq_case(const char *name, ae_eq_t *eq, float *left,
+                          float *right, size_t block) {
+  bench_eq_band_t bands[AE_MAX_EQ_BANDS];
+  for (size_t b = 0; b < AE_MAX_EQ_BANDS; ++b) {
+    /* A gentle resonance: stable, and far from denormals */
+    bench_eq_band_t f = {.b0 = 1.01f, .b1 = -1.8f, .b2 = 0.81f,
+                         .a1 = -1.8f, .a2 = 0.82f, .enabled = true};
+    bands[b] = f;
+  }
+  size_t blocks = (size_t)BENCH_SR * BENCH_SECONDS / block;
+  double start = bench_now();
+  unsigned long long ticks = bench_ticks();
+  for (size_t b = 0; b < blocks; ++b) {
+    if (eq)
+      ae_eq_process(eq, left, right, block);
+    else
+      bench_eq_reference(bands, AE_MAX_EQ_BANDS, left, right, block);
+  }
+  ticks = bench_ticks() - ticks;
+  bench_report_cycles(name, bench_now() - start, ticks, blocks * block);
+}
+
+static void bench_eq(void) {
+  size_t block = 256;
+  float *left = (float *)malloc(block * sizeof(float));
+  float *right = (float *)malloc(block * sizeof(float));
+  ae_eq_t *eq = ae_eq_create(BENCH_SR);
+  printf("\n=== Parametric EQ (8 bands, stereo, block 256) ===\n");
+  if (!left || !right || !eq) {
+    printf("  (setup failed)\n");
+  } else {
+    const float freqs[AE_MAX_EQ_BANDS] = {60.0f,   150.0f,  400.0f,
+                                          1000.0f, 2500.0f, 5000.0f,
+                                          9000.0f, 14000.0f};
+    for (uint32_t b = 0; b < AE_MAX_EQ_BANDS; ++b) {
+      ae_eq_band_t band = {.type = AE_EQ_PEAK,
+                           .frequency_hz = freqs[b],
+                           .gain_db = b & 1 ? -3.0f : 3.0f,
+                           .q = 1.0f,
+                           .enabled = true};
+      ae_eq_set_band(eq, b, &band);
+    }
+    bench_fill_noise(left, block, 1);
+    bench_fill_noise(right, block, 2);
+    bench_eq_case("per-sample DF-I, flag per band (reference)", NULL, left,
+                  right, block);
+    bench_fill_noise(left, block, 1);
+    bench_fill_noise(right, block, 2);
+    ae_eq_reset(eq);
+    bench_eq_case("skewed TDF-II cascade", eq, left, right, block);
+  }
+  ae_eq_destroy(eq);
+  free(left);
+  free(right);
+}
+
+/*============================================================================
+ * Main
+ *============================================================================*/
+
+/* The per-sample de-esser this replaced: one-pole highpass detector with
+ * its alpha, both envelope coefficients, log10 and pow all recomputed for
+ * every sample, fed the rectified louder channel */
+typedef struct {
+  float hp_state;
+  float envelope;
+} bench_ds_state_t;
+
+static float bench_ds_reference_sample(bench_ds_state_t *st, float x,
+                                       float sample_rate) {
+  float rc = 1.0f / (2.0f * 3.14159265f * 5000.0f);
+  float dt = 1.0f / sample_rate;
+  float alpha = rc / (rc + dt);
+  float hp = alpha * (st->hp_state + x);
+  st->hp_state = hp - x;
+  float level_db = 20.0f * log10f(fabsf(hp) + 1e-9f);
+  float attack = expf(-1.0f / (0.5f * 0.001f * sample_rate));
+  float release = expf(-1.0f / (20.0f * 0.001f * sample_rate));
+  float coeff = level_db > st->envelope ? attack : release;
+  st->envelope = coeff * st->envelope + (1.0f - coeff) * level_db;
+  float gain_db = 0.0f;
+  if (st->envelope > -30.0f)
+    gain_db = -(st->envelope + 30.0f) * 0.75f;
+  return (x - hp) + hp * powf(10.0f, gain_db / 20.0f);
+}
+static void bench_ds_case(const char *name, ae_deesser_t *ds, float *left,
+                          float *right, size_t block) {
+  bench_ds_state_t st = {0.0f, -120.0f};
+  size_t blocks = (size_t)BENCH_SR * BENCH_SECONDS / block;
+  double start = bench_now();
+  unsigned long long ticks = bench_ticks();
+  for (size_t b = 0; b < blocks; ++b) {
+    if (ds) {
+      ae_deesser_process(ds, left, right, block);
+      continue;
+    }
+    for (size_t i = 0; i < block; ++i) {
+      float mono = fmaxf(fabsf(left[i]), fabsf(right[i]));
+      float gain = bench_ds_reference_sample(&st, mono, (float)BENCH_SR) /
+                   (mono + 1e-9f);
+      left[i] *= gain;
+      right[i] *= gain;
+    }
+  }
+  ticks = bench_ticks() - ticks;
+  bench_report_cycles(name, bench_now() - start, ticks, blocks * block);
+}
+static void bench_deesser(void) {
+  size_t block = 256;
+  float *left = (float *)malloc(block * sizeof(float));
+  float *right = (float *)malloc(block * sizeof(float));
+  ae_deesser_t *ds = ae_deesser_create(BENCH_SR);
+  printf("\n=== De-esser (block 256) ===\n");
+  if (!left || !right || !ds) {
+    printf("  (setup failed)\n");
+  } else {
+    ae_deesser_params_t params;
+    ae_deesser_get_params(ds, &params);
+    params.threshold_db = -30.0f;
+    ae_deesser_set_params(ds, &params);
+    bench_fill_noise(left, block, 1);
+    bench_fill_noise(right, block, 2);
+    bench_ds_case("per-sample, stereo (reference)", NULL, left, right,
+                  block);
+    bench_fill_noise(left, block, 1);
+    bench_fill_noise(right, block, 2);
+    bench_ds_case("LR4 split band, stereo", ds, left, right, block);
+    ae_deesser_reset(ds);
+    bench_fill_noise(left, block, 1);
+    bench_ds_case("LR4 split band, mono", ds, left, NULL, block);
+  }
+  ae_deesser_destroy(ds);
+  free(left);
+  free(right);
+}
+
+/* Soft clipper for the oversampler bench: drive 2, vectorized tanh */
+static void bench_os_drive(float *left, float *right, size_t frames,
+                           void *user_data) {
+  (void)user_data;
+  float *ch[2] = {left, right};
+  for (size_t c = 0; c < 2; ++c) {
+    for (size_t i = 0; i < frames; ++i)
+      ch[c][i] *= 2.0f;
+    ae_fast_tanh(ch[c], ch[c], frames, AE_MATH_1E4);
+  }
+}
+static void bench_os_case(const char *name, ae_oversampler_t *os,
+                          float *left, float *right, size_t block) {
+  size_t blocks = (size_t)BENCH_SR * BENCH_SECONDS / block;
+  double start = bench_now();
+  unsigned long long ticks = bench_ticks();
+  for (size_t b = 0; b < blocks; ++b) {
+    if (os)
+      ae_oversampler_process(os, left, right, block, bench_os_drive, NULL);
+    else
+      bench_os_drive(left, right, block, NULL);
+  }
+  ticks = bench_ticks() - ticks;
+  bench_report_cycles(name, bench_now() - start, ticks, blocks * block);
+}
+static void bench_oversample(void) {
+  size_t block = 256;
+  float *left = (float *)malloc(block * sizeof(float));
+  float *right = (float *)malloc(block * sizeof(float));
+  printf("\n=== Oversampled tanh (stereo, block 256) ===\n");
+  if (!left || !right) {
+    printf("  (setup failed)\n");
+  } else {
+    bench_fill_noise(left, block, 1);
+    bench_fill_noise(right, block, 2);
+    bench_os_case("tanh at the base rate (reference)", NULL, left, right,
+                  block);
+    const char *phases[2] = {"linear phase", "low latency"};
+    const char *qualities[3] = {"draft", "normal", "high"};
+    for (int phase = 0; phase < 2; ++phase) {
+      for (int quality = 0; quality < 3; ++quality) {
+        for (uint32_t factor = 2; factor <= 8; factor *= 2) {
+          ae_oversampler_config_t config = {
+              .factor = factor,
+              .max_frames = (uint32_t)block,
+              .phase = (ae_oversample_phase_t)phase,
+              .quality = (ae_oversample_quality_t)quality};
+          ae_oversampler_t *os = ae_oversampler_create(&config);
+          if (!os)
+            continue;
+          char name[64];
+          snprintf(name, sizeof(name), "%ux %s %s, latency %.2f", factor,
+                   phases[phase], qualities[quality],
+                   ae_oversampler_latency(os));
+          bench_fill_noise(left, block, 1);
+          bench_fill_noise(right, block, 2);
+          bench_os_case(name, os, left, right, block);
+          ae_oversampler_destroy(os);
+        }
+      }
+    }
+  }
+  free(left);
+  free(right);
+}
+
+int main(void) {
+  printf("Acoustic Engine - Benchmarks (%d s of audio per case)\n",
+         BENCH_SECONDS);
+  bench_reverb_rate();
+  bench_early_reflections();
+  bench_diffuser();
+  bench_diffuser_density();
+  bench_delay_storage();
+  bench_hrir_convolution();
+  bench_hrir_updates();
+  bench_hrir_group();
+  bench_ambisonics();
+  bench_fastmath();
+  bench_compressor();
+  bench_limiter();
+  bench_deesser();
+  bench_eq();
+  bench_oversample();
+  return 0;
+}
@@ -361,6 +361,54 @@ void test_modfb_modulation_detection(void) {
   AE_TEST_PASS();
 }
 
+/* Channels run four to a register; odd block splits must not change the
+ * output of any lane, including the partial group of two */
+void test_modfb_split_blocks_match(void) {
+  ae_modfb_config_t config = {0};
+  config.n_channels = 10;
+  config.f_low = 0.5f;
+  config.f_high = 256.0f;
+  config.sample_rate = 1000;
+
+  ae_modfb_t *whole = ae_modfb_create(&config);
+  ae_modfb_t *split = ae_modfb_create(&config);
+  float *storage = (float *)calloc(2 * 10 * 2000, sizeof(float));
+  AE_ASSERT_NOT_NULL(whole);
+  AE_ASSERT_NOT_NULL(split);
+  AE_ASSERT_NOT_NULL(storage);
+
+  float input[2000];
+  ae_test_generate_noise(input, 2000, 0.5f);
+
+  float *out_whole[10];
+  float *out_split[10];
+  for (int ch = 0; ch < 10; ++ch) {
+    out_whole[ch] = storage + ch * 2000;
+    out_split[ch] = storage + (10 + ch) * 2000;
+  }
+  AE_ASSERT_EQ(ae_modfb_process(whole, input, 2000, out_whole), AE_OK);
+
+  const size_t sizes[] = {1, 6, 333, 1660};
+  size_t offset = 0;
+  for (size_t s = 0; s < 4; ++s) {
+    float *out[10];
+    for (int ch = 0; ch < 10; ++ch)
+      out[ch] = out_split[ch] + offset;
+    AE_ASSERT_EQ(ae_modfb_process(split, input + offset, sizes[s], out),
+                 AE_OK);
+    offset += sizes[s];
+  }
+
+  for (int ch = 0; ch < 10; ++ch)
+    AE_ASSERT(memcmp(out_whole[ch], out_split[ch], 2000 * sizeof(float)) ==
+              0);
+
+  free(storage);
+  ae_modfb_destroy(whole);
+  ae_modfb_destroy(split);
+  AE_TEST_PASS();
+}
+
 void test_bmld_spi_n0(void) {
   /* SπN0 configuration: signal anti-correlated, noise correlated */
   ae_bmld_params_t params = {
@@ -847,6 +895,7 @@ int main(void) {
   AE_TEST_SUITE_BEGIN("DRNL / Modulation Filterbank");
   AE_RUN_TEST(test_drnl_compression);
   AE_RUN_TEST(test_modfb_modulation_detection);
+  AE_RUN_TEST(test_modfb_split_blocks_match);
   AE_TEST_SUITE_END();
 
   AE_TEST_SUITE_BEGIN("Loudness / Timbral");
@@ -382,6 +382,910 @@ void test_buffer_mix(void) {
   AE_TEST_PASS();
 }
 
+/*============================================================================
+ * Block processor helpers
+ *============================================================================*/
+
+/* One of the block processors below run in place on left/right */
+typedef void (*block_process_fn)(void *ctx, float *left, float *right,
+                                 size_t frames);
+
+#define SPLIT_FRAMES 4096
+
+/* Call sizes adding up to SPLIT_FRAMES: single frames, then calls that
+ * start and end on both sides of 256-frame tile edges */
+static const size_t split_sizes[] = {1, 2, 5, 250, 258, 3, 3577};
+
+/**
+ * Runs left/right (SPLIT_FRAMES each, right may be NULL) through whole in
+ * one call, in place, and a copy through split in split_sizes calls. True
+ * if both give bit-identical output.
+ */
+static bool check_block_split_invariance(block_process_fn process,
+                                         void *whole, void *split,
+                                         float *left, float *right) {
+  static float sl[SPLIT_FRAMES], sr[SPLIT_FRAMES];
+  memcpy(sl, left, sizeof(sl));
+  if (right)
+    memcpy(sr, right, sizeof(sr));
+  process(whole, left, right, SPLIT_FRAMES);
+  size_t offset = 0;
+  for (size_t s = 0; s < sizeof(split_sizes) / sizeof(split_sizes[0]); ++s) {
+    process(split, sl + offset, right ? sr + offset : NULL, split_sizes[s]);
+    offset += split_sizes[s];
+  }
+  return memcmp(left, sl, sizeof(sl)) == 0 &&
+         (!right || memcmp(right, sr, sizeof(sr)) == 0);
+}
+
+/*============================================================================
+ * Tests: Compressor
+ *============================================================================*/
+
+#define COMP_SR 48000
+
+static ae_compressor_params_t comp_params(float knee_db) {
+  ae_compressor_params_t params = {.threshold_db = -20.0f,
+                                   .ratio = 4.0f,
+                                   .knee_db = knee_db,
+                                   .attack_ms = 10.0f,
+                                   .release_ms = 100.0f,
+                                   .makeup_db = 0.0f,
+                                   .stereo_link = true};
+  return params;
+}
+
+static void comp_fill(float *buf, size_t n, float value) {
+  for (size_t i = 0; i < n; ++i)
+    buf[i] = value;
+}
+
+/* Steady-state gain (dB) of a DC input after one second */
+static float comp_settled_gain_db(const ae_compressor_params_t *params,
+                                  float level) {
+  static float buf[COMP_SR];
+  ae_compressor_t *comp = ae_compressor_create(COMP_SR);
+  if (!comp || ae_compressor_set_params(comp, params) != AE_OK) {
+    ae_compressor_destroy(comp);
+    return NAN;
+  }
+  comp_fill(buf, COMP_SR, level);
+  ae_compressor_process(comp, buf, NULL, NULL, NULL, COMP_SR);
+  ae_compressor_destroy(comp);
+  return 20.0f * log10f(buf[COMP_SR - 1] / level);
+}
+
+void test_compressor_hard_knee_curve(void) {
+  ae_compressor_params_t params = comp_params(0.0f);
+  /* -6.02 dB in, 13.98 dB over: 3/4 of the excess is removed */
+  float over = 20.0f * log10f(0.5f) + 20.0f;
+  AE_ASSERT_FLOAT_EQ(comp_settled_gain_db(&params, 0.5f), -0.75f * over,
+                     0.01f);
+  AE_ASSERT_FLOAT_EQ(comp_settled_gain_db(&params, 0.05f), 0.0f, 0.001f);
+  params.makeup_db = 6.0f;
+  AE_ASSERT_FLOAT_EQ(comp_settled_gain_db(&params, 0.05f), 6.0f, 0.001f);
+  AE_TEST_PASS();
+}
+
+void test_compressor_soft_knee(void) {
+  ae_compressor_params_t params = comp_params(6.0f);
+  /* At threshold: (1/R - 1) * (W/2)^2 / (2W) = -0.5625 dB */
+  AE_ASSERT_FLOAT_EQ(comp_settled_gain_db(&params, 0.1f), -0.5625f, 0.01f);
+  /* Past the knee the hard curve takes over */
+  float level = powf(10.0f, -10.0f / 20.0f);
+  AE_ASSERT_FLOAT_EQ(comp_settled_gain_db(&params, level), -7.5f, 0.01f);
+  /* Below it, untouched */
+  AE_ASSERT_FLOAT_EQ(comp_settled_gain_db(&params, 0.05f), 0.0f, 0.001f);
+  AE_TEST_PASS();
+}
+
+void test_compressor_attack_time(void) {
+  ae_compressor_params_t params = comp_params(0.0f);
+  params.release_ms = 1000.0f;
+  ae_compressor_t *comp = ae_compressor_create(COMP_SR);
+  AE_ASSERT_NOT_NULL(comp);
+  AE_ASSERT_EQ(ae_compressor_set_params(comp, &params), AE_OK);
+
+  /* One attack time constant after a step: 1 - 1/e of the final gain */
+  float buf[480];
+  comp_fill(buf, 480, 0.5f);
+  ae_compressor_process(comp, buf, NULL, NULL, NULL, 480);
+  float final_db = -0.75f * (20.0f * log10f(0.5f) + 20.0f);
+  AE_ASSERT_FLOAT_EQ(ae_compressor_gain_reduction(comp),
+                     -final_db * (1.0f - expf(-1.0f)), 0.05f);
+  ae_compressor_destroy(comp);
+  AE_TEST_PASS();
+}
+
+void test_compressor_stereo_link(void) {
+  static float left[COMP_SR], right[COMP_SR];
+  ae_compressor_params_t params = comp_params(0.0f);
+  float expected = -0.75f * (20.0f * log10f(0.5f) + 20.0f);
+
+  for (int linked = 0; linked < 2; ++linked) {
+    params.stereo_link = linked != 0;
+    ae_compressor_t *comp = ae_compressor_create(COMP_SR);
+    AE_ASSERT_NOT_NULL(comp);
+    AE_ASSERT_EQ(ae_compressor_set_params(comp, &params), AE_OK);
+    comp_fill(left, COMP_SR, 0.5f);
+    comp_fill(right, COMP_SR, 0.01f);
+    ae_compressor_process(comp, left, right, NULL, NULL, COMP_SR);
+    float gain_l = 20.0f * log10f(left[COMP_SR - 1] / 0.5f);
+    float gain_r = 20.0f * log10f(right[COMP_SR - 1] / 0.01f);
+    AE_ASSERT_FLOAT_EQ(gain_l, expected, 0.01f);
+    /* Linked, the quiet side follows the loud one; unlinked it is left
+     * alone */
+    AE_ASSERT_FLOAT_EQ(gain_r, linked ? expected : 0.0f, 0.01f);
+    ae_compressor_destroy(comp);
+  }
+  AE_TEST_PASS();
+}
+
+void test_compressor_sidechain(void) {
+  static float main_l[COMP_SR], main_r[COMP_SR], key[COMP_SR];
+  ae_compressor_params_t params = comp_params(0.0f);
+  ae_compressor_t *comp = ae_compressor_create(COMP_SR);
+  AE_ASSERT_NOT_NULL(comp);
+  AE_ASSERT_EQ(ae_compressor_set_params(comp, &params), AE_OK);
+
+  /* A loud key ducks a quiet signal */
+  comp_fill(main_l, COMP_SR, 0.01f);
+  comp_fill(main_r, COMP_SR, 0.01f);
+  comp_fill(key, COMP_SR, 0.5f);
+  ae_compressor_process(comp, main_l, main_r, key, NULL, COMP_SR);
+  float expected = -0.75f * (20.0f * log10f(0.5f) + 20.0f);
+  AE_ASSERT_FLOAT_EQ(20.0f * log10f(main_l[COMP_SR - 1] / 0.01f), expected,
+                     0.01f);
+  AE_ASSERT_FLOAT_EQ(20.0f * log10f(main_r[COMP_SR - 1] / 0.01f), expected,
+                     0.01f);
+
+  /* A silent key leaves a loud signal alone */
+  ae_compressor_reset(comp);
+  comp_fill(main_l, COMP_SR, 0.5f);
+  comp_fill(key, COMP_SR, 0.0f);
+  ae_compressor_process(comp, main_l, NULL, key, NULL, COMP_SR);
+  AE_ASSERT_FLOAT_EQ(main_l[COMP_SR - 1], 0.5f, 0.0001f);
+  ae_compressor_destroy(comp);
+  AE_TEST_PASS();
+}
+
+static void comp_process(void *ctx, float *left, float *right,
+                         size_t frames) {
+  ae_compressor_process(ctx, left, right, NULL, NULL, frames);
+}
+
+/* Tile boundaries inside process must not show in the output */
+void test_compressor_block_split(void) {
+  static float buf[SPLIT_FRAMES];
+  ae_test_generate_sine(buf, SPLIT_FRAMES, 220.0f, (float)COMP_SR, 0.9f);
+  ae_compressor_params_t params = comp_params(6.0f);
+  ae_compressor_t *a = ae_compressor_create(COMP_SR);
+  ae_compressor_t *b = ae_compressor_create(COMP_SR);
+  AE_ASSERT_NOT_NULL(a);
+  AE_ASSERT_NOT_NULL(b);
+  ae_compressor_set_params(a, &params);
+  ae_compressor_set_params(b, &params);
+
+  AE_ASSERT(check_block_split_invariance(comp_process, a, b, buf, NULL));
+  ae_compressor_destroy(a);
+  ae_compressor_destroy(b);
+  AE_TEST_PASS();
+}
+
+void test_compressor_rejects_bad_params(void) {
+  ae_compressor_t *comp = ae_compressor_create(COMP_SR);
+  AE_ASSERT_NOT_NULL(comp);
+  AE_ASSERT_NULL(ae_compressor_create(0));
+  ae_compressor_params_t params = comp_params(6.0f);
+  params.ratio = 0.5f;
+  AE_ASSERT_EQ(ae_compressor_set_params(comp, &params),
+               AE_ERROR_INVALID_PARAM);
+  params = comp_params(6.0f);
+  params.attack_ms = 0.0f;
+  AE_ASSERT_EQ(ae_compressor_set_params(comp, &params),
+               AE_ERROR_INVALID_PARAM);
+  params = comp_params(-1.0f);
+  AE_ASSERT_EQ(ae_compressor_set_params(comp, &params),
+               AE_ERROR_INVALID_PARAM);
+
+  /* A rejected update keeps the previous parameters */
+  ae_compressor_get_params(comp, &params);
+  AE_ASSERT_FLOAT_EQ(params.ratio, 4.0f, 0.0f);
+  AE_ASSERT_EQ(ae_compressor_process(comp, NULL, NULL, NULL, NULL, 16),
+               AE_ERROR_INVALID_PARAM);
+  ae_compressor_destroy(comp);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Tests: Limiter
+ *============================================================================*/
+
+static ae_limiter_t *lim_create(float ceiling_db, float lookahead_ms,
+                                bool true_peak) {
+  ae_limiter_t *lim = ae_limiter_create(COMP_SR);
+  ae_limiter_params_t params = {.ceiling_db = ceiling_db,
+                                .lookahead_ms = lookahead_ms,
+                                .release_ms = 50.0f,
+                                .true_peak = true_peak};
+  if (lim && ae_limiter_set_params(lim, &params) != AE_OK) {
+    ae_limiter_destroy(lim);
+    return NULL;
+  }
+  return lim;
+}
+
+static float lim_peak(const float *buf, size_t n) {
+  float peak = 0.0f;
+  for (size_t i = 0; i < n; ++i)
+    peak = fmaxf(peak, fabsf(buf[i]));
+  return peak;
+}
+
+void test_limiter_latency(void) {
+  ae_limiter_t *lim = lim_create(-1.0f, 5.0f, false);
+  AE_ASSERT_NOT_NULL(lim);
+  AE_ASSERT_EQ(ae_limiter_latency(lim), 240u);
+
+  /* Below the ceiling the limiter is a pure delay */
+  float buf[1024] = {0};
+  buf[10] = 0.5f;
+  ae_limiter_process(lim, buf, NULL, 1024);
+  AE_ASSERT_FLOAT_EQ(buf[250], 0.5f, 0.0f);
+  AE_ASSERT_FLOAT_EQ(lim_peak(buf, 250), 0.0f, 0.0f);
+
+  ae_limiter_params_t params;
+  ae_limiter_get_params(lim, &params);
+  params.true_peak = true;
+  AE_ASSERT_EQ(ae_limiter_set_params(lim, &params), AE_OK);
+  AE_ASSERT_EQ(ae_limiter_latency(lim), 246u);
+  ae_limiter_destroy(lim);
+  AE_TEST_PASS();
+}
+
+/* A lone peak is reduced by the time it comes out, and the gain ramps
+ * down ahead of it instead of stepping */
+void test_limiter_lookahead_ramp(void) {
+  static float buf[4800];
+  ae_limiter_t *lim = lim_create(-6.0f, 5.0f, false);
+  AE_ASSERT_NOT_NULL(lim);
+  comp_fill(buf, 4800, 0.25f);
+  buf[2000] = 2.0f;
+  ae_limiter_process(lim, buf, NULL, 4800);
+
+  float ceiling = powf(10.0f, -6.0f / 20.0f);
+  size_t out = 2000 + ae_limiter_latency(lim);
+  AE_ASSERT(fabsf(buf[out]) <= ceiling * 1.0001f);
+  AE_ASSERT_FLOAT_EQ(buf[out], ceiling, 0.001f);
+  AE_ASSERT(lim_peak(buf, 4800) <= ceiling * 1.0001f);
+  /* Halfway up the ramp the background is already halfway down */
+  float target = ceiling / 2.0f;
+  float half = 0.25f * (1.0f - 0.5f * (1.0f - target));
+  AE_ASSERT_FLOAT_EQ(buf[out - 120], half, 0.005f);
+  /* Untouched before the ramp */
+  AE_ASSERT_FLOAT_EQ(buf[out - 241], 0.25f, 0.0f);
+  ae_limiter_destroy(lim);
+  AE_TEST_PASS();
+}
+
+void test_limiter_ceiling_on_noise(void) {
+  static float left[COMP_SR], right[COMP_SR];
+  ae_test_generate_noise(left, COMP_SR, 4.0f);
+  ae_test_generate_noise(right, COMP_SR, 2.0f);
+  ae_limiter_t *lim = lim_create(-1.0f, 1.5f, false);
+  AE_ASSERT_NOT_NULL(lim);
+  ae_limiter_process(lim, left, right, COMP_SR);
+  float ceiling = powf(10.0f, -1.0f / 20.0f);
+  AE_ASSERT(lim_peak(left, COMP_SR) <= ceiling * 1.0001f);
+  AE_ASSERT(lim_peak(right, COMP_SR) <= ceiling * 1.0001f);
+  AE_ASSERT(ae_limiter_gain_reduction(lim) > 0.0f);
+  ae_limiter_destroy(lim);
+  AE_TEST_PASS();
+}
+
+/* A quarter-rate sine sampled 45 degrees off its crests: the samples sit
+ * 3 dB below the true peak */
+void test_limiter_true_peak(void) {
+  static float buf[4800];
+  float ceiling = powf(10.0f, -2.0f / 20.0f);
+  for (int tp = 0; tp < 2; ++tp) {
+    for (size_t i = 0; i < 4800; ++i)
+      buf[i] = (i & 2) ? -0.70710678f : 0.70710678f;
+    ae_limiter_t *lim = lim_create(-2.0f, 2.0f, tp != 0);
+    AE_ASSERT_NOT_NULL(lim);
+    ae_limiter_process(lim, buf, NULL, 4800);
+    float peak = lim_peak(buf + 2400, 2400);
+    if (tp)
+      AE_ASSERT_FLOAT_EQ(peak, ceiling * 0.70710678f, 0.01f);
+    else
+      AE_ASSERT_FLOAT_EQ(peak, 0.70710678f, 0.0001f);
+    ae_limiter_destroy(lim);
+  }
+  AE_TEST_PASS();
+}
+
+static void lim_process(void *ctx, float *left, float *right,
+                        size_t frames) {
+  ae_limiter_process(ctx, left, right, frames);
+}
+
+void test_limiter_block_split(void) {
+  static float left[SPLIT_FRAMES], right[SPLIT_FRAMES];
+  ae_test_generate_noise(left, SPLIT_FRAMES, 3.0f);
+  ae_test_generate_sine(right, SPLIT_FRAMES, 220.0f, (float)COMP_SR, 1.5f);
+  ae_limiter_t *a = lim_create(-1.0f, 3.0f, true);
+  ae_limiter_t *b = lim_create(-1.0f, 3.0f, true);
+  AE_ASSERT_NOT_NULL(a);
+  AE_ASSERT_NOT_NULL(b);
+
+  AE_ASSERT(check_block_split_invariance(lim_process, a, b, left, right));
+  ae_limiter_destroy(a);
+  ae_limiter_destroy(b);
+  AE_TEST_PASS();
+}
+
+void test_limiter_rejects_bad_params(void) {
+  ae_limiter_t *lim = ae_limiter_create(COMP_SR);
+  AE_ASSERT_NOT_NULL(lim);
+  AE_ASSERT_NULL(ae_limiter_create(0));
+  ae_limiter_params_t params;
+  ae_limiter_get_params(lim, &params);
+  params.lookahead_ms = AE_LIMITER_MAX_LOOKAHEAD_MS + 1.0f;
+  AE_ASSERT_EQ(ae_limiter_set_params(lim, &params), AE_ERROR_INVALID_PARAM);
+  ae_limiter_get_params(lim, &params);
+  params.release_ms = 0.0f;
+  AE_ASSERT_EQ(ae_limiter_set_params(lim, &params), AE_ERROR_INVALID_PARAM);
+  ae_limiter_get_params(lim, &params);
+  params.ceiling_db = NAN;
+  AE_ASSERT_EQ(ae_limiter_set_params(lim, &params), AE_ERROR_INVALID_PARAM);
+  ae_limiter_get_params(lim, &params);
+  AE_ASSERT_FLOAT_EQ(params.ceiling_db, -1.0f, 0.0f);
+  AE_ASSERT_EQ(ae_limiter_process(lim, NULL, NULL, 16),
+               AE_ERROR_INVALID_PARAM);
+  ae_limiter_destroy(lim);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Tests: De-esser
+ *============================================================================*/
+
+static ae_deesser_t *ds_create(float threshold_db, bool wideband) {
+  ae_deesser_t *ds = ae_deesser_create(COMP_SR);
+  ae_deesser_params_t params = {.frequency_hz = 5000.0f,
+                                .threshold_db = threshold_db,
+                                .ratio = 4.0f,
+                                .attack_ms = 0.5f,
+                                .release_ms = 20.0f,
+                                .wideband = wideband};
+  if (ds && ae_deesser_set_params(ds, &params) != AE_OK) {
+    ae_deesser_destroy(ds);
+    return NULL;
+  }
+  return ds;
+}
+
+/* Adds amp * sin of cycles per period samples, exactly periodic */
+static void ds_add_tone(float *buf, size_t n, size_t period, double cycles,
+                        float amp) {
+  for (size_t i = 0; i < n; ++i)
+    buf[i] += amp * (float)sin(6.283185307179586 * cycles *
+                               (double)(i % period) / (double)period);
+}
+
+/* Amplitude of that tone in buf; n spans whole periods */
+static float ds_tone_amp(const float *buf, size_t n, size_t period,
+                         double cycles) {
+  double c = 0.0, s = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    double w = 6.283185307179586 * cycles * (double)(i % period) /
+               (double)period;
+    c += buf[i] * cos(w);
+    s += buf[i] * sin(w);
+  }
+  return (float)(2.0 / (double)n * sqrt(c * c + s * s));
+}
+
+/* Below threshold the two crossover bands sum back to the input level at
+ * every frequency, the crossover included */
+void test_deesser_crossover_flat(void) {
+  static float buf[COMP_SR];
+  const float freqs[4] = {300.0f, 4000.0f, 5000.0f, 15000.0f};
+  for (size_t f = 0; f < 4; ++f) {
+    ae_deesser_t *ds = ds_create(0.0f, false);
+    AE_ASSERT_NOT_NULL(ds);
+    comp_fill(buf, COMP_SR, 0.0f);
+    ds_add_tone(buf, COMP_SR, COMP_SR, freqs[f], 0.5f);
+    ae_deesser_process(ds, buf, NULL, COMP_SR);
+    float rms = ae_test_calculate_rms(buf + COMP_SR / 2, COMP_SR / 2);
+    AE_ASSERT_FLOAT_EQ(20.0f * log10f(rms / 0.35355339f), 0.0f, 0.01f);
+    AE_ASSERT_FLOAT_EQ(ae_deesser_gain_reduction(ds), 0.0f, 0.0f);
+    ae_deesser_destroy(ds);
+  }
+  AE_TEST_PASS();
+}
+
+/* 300 Hz plus 15 kHz, both at 0.5: the band peak sits 24 dB over the
+ * threshold, so ratio 4 takes about 18 dB off the 15 kHz tone. Split band
+ * leaves the 300 Hz tone alone, wideband takes it down with the rest. */
+void test_deesser_band_reduction(void) {
+  static float buf[COMP_SR];
+  const size_t tail = COMP_SR / 2;
+  for (int wideband = 0; wideband < 2; ++wideband) {
+    ae_deesser_t *ds = ds_create(-30.0f, wideband != 0);
+    AE_ASSERT_NOT_NULL(ds);
+    comp_fill(buf, COMP_SR, 0.0f);
+    ds_add_tone(buf, COMP_SR, 160, 1.0, 0.5f);
+    ds_add_tone(buf, COMP_SR, 16, 5.0, 0.5f);
+    ae_deesser_process(ds, buf, NULL, COMP_SR);
+    float reduction = ae_deesser_gain_reduction(ds);
+    /* Sampled peaks of a 15 kHz tone read a little under its amplitude */
+    AE_ASSERT(reduction > 16.5f && reduction < 18.5f);
+    float high = 20.0f * log10f(ds_tone_amp(buf + tail, tail, 16, 5.0) / 0.5f);
+    float low = 20.0f * log10f(ds_tone_amp(buf + tail, tail, 160, 1.0) / 0.5f);
+    AE_ASSERT_FLOAT_EQ(high, -reduction, 0.5f);
+    AE_ASSERT_FLOAT_EQ(low, wideband ? -reduction : 0.0f, 0.5f);
+    ae_deesser_destroy(ds);
+  }
+  AE_TEST_PASS();
+}
+
+/* One gain from the louder channel drives both, and mono matches a stereo
+ * pair of identical channels */
+void test_deesser_stereo_link(void) {
+  static float left[COMP_SR], right[COMP_SR], mono[COMP_SR];
+  ae_deesser_t *ds = ds_create(-30.0f, true);
+  AE_ASSERT_NOT_NULL(ds);
+  comp_fill(left, COMP_SR, 0.0f);
+  comp_fill(right, COMP_SR, 0.0f);
+  ds_add_tone(left, COMP_SR, 16, 5.0, 0.5f);
+  ds_add_tone(right, COMP_SR, 48, 1.0, 0.25f);
+  ae_deesser_process(ds, left, right, COMP_SR);
+  float gain = 20.0f * log10f(
+      ds_tone_amp(right + COMP_SR / 2, COMP_SR / 2, 48, 1.0) / 0.25f);
+  AE_ASSERT_FLOAT_EQ(gain, -ae_deesser_gain_reduction(ds), 0.5f);
+  ae_deesser_destroy(ds);
+
+  ae_deesser_t *a = ds_create(-30.0f, false);
+  ae_deesser_t *b = ds_create(-30.0f, false);
+  AE_ASSERT_NOT_NULL(a);
+  AE_ASSERT_NOT_NULL(b);
+  ae_test_generate_noise(left, COMP_SR, 0.5f);
+  memcpy(right, left, sizeof(left));
+  memcpy(mono, left, sizeof(left));
+  ae_deesser_process(a, left, right, COMP_SR);
+  ae_deesser_process(b, mono, NULL, COMP_SR);
+  AE_ASSERT(memcmp(left, right, sizeof(left)) == 0);
+  AE_ASSERT(memcmp(left, mono, sizeof(left)) == 0);
+  ae_deesser_destroy(a);
+  ae_deesser_destroy(b);
+  AE_TEST_PASS();
+}
+
+static void ds_process(void *ctx, float *left, float *right, size_t frames) {
+  ae_deesser_process(ctx, left, right, frames);
+}
+
+/* Call boundaries, inside and across tiles, must not show in the output */
+void test_deesser_block_split(void) {
+  static float left[SPLIT_FRAMES], right[SPLIT_FRAMES];
+  ae_test_generate_noise(left, SPLIT_FRAMES, 0.5f);
+  ae_test_generate_sine(right, SPLIT_FRAMES, 7000.0f, (float)COMP_SR, 0.5f);
+  ae_deesser_t *a = ds_create(-30.0f, false);
+  ae_deesser_t *b = ds_create(-30.0f, false);
+  AE_ASSERT_NOT_NULL(a);
+  AE_ASSERT_NOT_NULL(b);
+
+  AE_ASSERT(check_block_split_invariance(ds_process, a, b, left, right));
+  ae_deesser_destroy(a);
+  ae_deesser_destroy(b);
+  AE_TEST_PASS();
+}
+
+void test_deesser_rejects_bad_params(void) {
+  AE_ASSERT_NULL(ae_deesser_create(0));
+  ae_deesser_t *ds = ds_create(-30.0f, false);
+  AE_ASSERT_NOT_NULL(ds);
+  ae_deesser_params_t params;
+  ae_deesser_get_params(ds, &params);
+  params.frequency_hz = 24000.0f;
+  AE_ASSERT_EQ(ae_deesser_set_params(ds, &params), AE_ERROR_INVALID_PARAM);
+  params.frequency_hz = 0.0f;
+  AE_ASSERT_EQ(ae_deesser_set_params(ds, &params), AE_ERROR_INVALID_PARAM);
+  ae_deesser_get_params(ds, &params);
+  params.ratio = 0.5f;
+  AE_ASSERT_EQ(ae_deesser_set_params(ds, &params), AE_ERROR_INVALID_PARAM);
+  ae_deesser_get_params(ds, &params);
+  params.release_ms = 0.0f;
+  AE_ASSERT_EQ(ae_deesser_set_params(ds, &params), AE_ERROR_INVALID_PARAM);
+
+  /* A rejected update keeps the previous parameters */
+  ae_deesser_get_params(ds, &params);
+  AE_ASSERT_FLOAT_EQ(params.frequency_hz, 5000.0f, 0.0f);
+  AE_ASSERT_FLOAT_EQ(params.ratio, 4.0f, 0.0f);
+  AE_ASSERT_EQ(ae_deesser_process(ds, NULL, NULL, 16),
+               AE_ERROR_INVALID_PARAM);
+  ae_deesser_destroy(ds);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Tests: Parametric EQ
+ *============================================================================*/
+
+static ae_eq_band_t eq_band(ae_eq_band_type_t type, float freq, float gain) {
+  ae_eq_band_t band = {.type = type,
+                       .frequency_hz = freq,
+                       .gain_db = gain,
+                       .q = 0.707f,
+                       .enabled = true};
+  return band;
+}
+
+/* Settled gain (dB) of an EQ at one frequency: one second of sine, RMS
+ * of the last quarter against the input's */
+static float eq_gain_db(ae_eq_t *eq, float freq) {
+  static float buf[COMP_SR], ref[COMP_SR];
+  const size_t tail = 3 * COMP_SR / 4;
+  ae_eq_reset(eq);
+  ae_test_generate_sine(buf, COMP_SR, freq, (float)COMP_SR, 0.25f);
+  memcpy(ref, buf, sizeof(buf));
+  ae_eq_process(eq, buf, NULL, COMP_SR);
+  return 20.0f * log10f(ae_test_calculate_rms(buf + tail, COMP_SR - tail) /
+                        ae_test_calculate_rms(ref + tail, COMP_SR - tail));
+}
+
+void test_eq_band_gains(void) {
+  ae_eq_t *eq = ae_eq_create(COMP_SR);
+  AE_ASSERT_NOT_NULL(eq);
+  ae_eq_band_t band = eq_band(AE_EQ_PEAK, 1000.0f, 6.0f);
+  band.q = 2.0f;
+  AE_ASSERT_EQ(ae_eq_set_band(eq, 0, &band), AE_OK);
+  AE_ASSERT_FLOAT_EQ(eq_gain_db(eq, 1000.0f), 6.0f, 0.05f);
+  AE_ASSERT_FLOAT_EQ(eq_gain_db(eq, 100.0f), 0.0f, 0.1f);
+
+  band = eq_band(AE_EQ_LOW_SHELF, 200.0f, -9.0f);
+  AE_ASSERT_EQ(ae_eq_set_band(eq, 0, &band), AE_OK);
+  AE_ASSERT_FLOAT_EQ(eq_gain_db(eq, 30.0f), -9.0f, 0.2f);
+  AE_ASSERT_FLOAT_EQ(eq_gain_db(eq, 8000.0f), 0.0f, 0.05f);
+
+  band = eq_band(AE_EQ_LOWPASS, 1000.0f, 0.0f);
+  AE_ASSERT_EQ(ae_eq_set_band(eq, 0, &band), AE_OK);
+  AE_ASSERT_FLOAT_EQ(eq_gain_db(eq, 1000.0f), -3.01f, 0.05f);
+  AE_ASSERT(eq_gain_db(eq, 10000.0f) < -35.0f);
+  ae_eq_destroy(eq);
+  AE_TEST_PASS();
+}
+
+/* Gains in dB add across the cascade, for odd and even band counts, and
+ * each channel keeps its own state */
+void test_eq_cascade(void) {
+  static float left[COMP_SR], right[COMP_SR];
+  for (uint32_t count = 1; count <= AE_MAX_EQ_BANDS; ++count) {
+    ae_eq_t *eq = ae_eq_create(COMP_SR);
+    AE_ASSERT_NOT_NULL(eq);
+    /* Disabled bands in between are compacted out */
+    ae_eq_band_t off = eq_band(AE_EQ_HIGHPASS, 5000.0f, 0.0f);
+    off.enabled = false;
+    for (uint32_t b = 0; b < AE_MAX_EQ_BANDS; ++b) {
+      ae_eq_band_t band = eq_band(AE_EQ_PEAK, 1000.0f, 1.5f);
+      AE_ASSERT_EQ(ae_eq_set_band(eq, b, b < count ? &band : &off), AE_OK);
+    }
+    ae_test_generate_sine(left, COMP_SR, 1000.0f, (float)COMP_SR, 0.1f);
+    comp_fill(right, COMP_SR, 0.0f);
+    ae_eq_process(eq, left, right, COMP_SR);
+    float gain = 20.0f * log10f(lim_peak(left + COMP_SR / 2, COMP_SR / 2) /
+                                0.1f);
+    AE_ASSERT_FLOAT_EQ(gain, 1.5f * (float)count, 0.02f);
+    AE_ASSERT_FLOAT_EQ(lim_peak(right, COMP_SR), 0.0f, 0.0f);
+    ae_eq_destroy(eq);
+  }
+  AE_TEST_PASS();
+}
+
+/* A gain change glides rather than steps, and a band switched off glides
+ * out and then leaves the signal untouched */
+void test_eq_glide(void) {
+  static float buf[COMP_SR], ref[COMP_SR];
+  ae_eq_t *eq = ae_eq_create(COMP_SR);
+  AE_ASSERT_NOT_NULL(eq);
+  ae_eq_band_t band = eq_band(AE_EQ_LOW_SHELF, 2000.0f, 0.0f);
+  AE_ASSERT_EQ(ae_eq_set_band(eq, 0, &band), AE_OK);
+  comp_fill(buf, 4800, 0.5f);
+  ae_eq_process(eq, buf, NULL, 4800);
+  AE_ASSERT_FLOAT_EQ(buf[4799], 0.5f, 0.0001f);
+
+  band.gain_db = 12.0f;
+  AE_ASSERT_EQ(ae_eq_set_band(eq, 0, &band), AE_OK);
+  comp_fill(buf, 4800, 0.5f);
+  ae_eq_process(eq, buf, NULL, 4800);
+  float final = 0.5f * powf(10.0f, 12.0f / 20.0f);
+  AE_ASSERT(buf[0] < 0.51f);
+  AE_ASSERT(buf[60] > 0.51f && buf[60] < 0.5f * (final + 0.5f));
+  float max_step = 0.0f;
+  for (size_t i = 1; i < 4800; ++i)
+    max_step = fmaxf(max_step, fabsf(buf[i] - buf[i - 1]));
+  /* An instant switch would jump by 1.5 */
+  AE_ASSERT(max_step < 0.02f);
+  AE_ASSERT_FLOAT_EQ(buf[4799], final, 0.001f);
+
+  band.enabled = false;
+  AE_ASSERT_EQ(ae_eq_set_band(eq, 0, &band), AE_OK);
+  comp_fill(buf, 4800, 0.5f);
+  ae_eq_process(eq, buf, NULL, 4800);
+  AE_ASSERT(buf[0] > 0.5f * (final + 0.5f));
+  ae_test_generate_noise(buf, COMP_SR, 0.5f);
+  memcpy(ref, buf, sizeof(buf));
+  ae_eq_process(eq, buf, NULL, COMP_SR);
+  AE_ASSERT(memcmp(buf, ref, sizeof(buf)) == 0);
+  ae_eq_destroy(eq);
+  AE_TEST_PASS();
+}
+
+static void eq_process(void *ctx, float *left, float *right, size_t frames) {
+  ae_eq_process(ctx, left, right, frames);
+}
+
+/* Call boundaries, mid-glide included, must not show in the output */
+void test_eq_block_split(void) {
+  static float left[SPLIT_FRAMES], right[SPLIT_FRAMES];
+  ae_test_generate_noise(left, SPLIT_FRAMES, 0.5f);
+  ae_test_generate_sine(right, SPLIT_FRAMES, 440.0f, (float)COMP_SR, 0.5f);
+  ae_eq_t *a = ae_eq_create(COMP_SR);
+  ae_eq_t *b = ae_eq_create(COMP_SR);
+  AE_ASSERT_NOT_NULL(a);
+  AE_ASSERT_NOT_NULL(b);
+  const float freqs[5] = {80.0f, 250.0f, 1000.0f, 4000.0f, 12000.0f};
+  for (uint32_t i = 0; i < 5; ++i) {
+    ae_eq_band_t band = eq_band(i == 0 ? AE_EQ_HIGHPASS : AE_EQ_PEAK,
+                                freqs[i], 3.0f - 2.0f * (float)i);
+    ae_eq_set_band(a, i, &band);
+    ae_eq_set_band(b, i, &band);
+  }
+
+  AE_ASSERT(check_block_split_invariance(eq_process, a, b, left, right));
+  ae_eq_destroy(a);
+  ae_eq_destroy(b);
+  AE_TEST_PASS();
+}
+
+void test_eq_rejects_bad_params(void) {
+  ae_eq_t *eq = ae_eq_create(COMP_SR);
+  AE_ASSERT_NOT_NULL(eq);
+  AE_ASSERT_NULL(ae_eq_create(0));
+  ae_eq_band_t band = eq_band(AE_EQ_PEAK, 1000.0f, 6.0f);
+  AE_ASSERT_EQ(ae_eq_set_band(eq, AE_MAX_EQ_BANDS, &band),
+               AE_ERROR_INVALID_PARAM);
+  band.frequency_hz = 24000.0f;
+  AE_ASSERT_EQ(ae_eq_set_band(eq, 0, &band), AE_ERROR_INVALID_PARAM);
+  band = eq_band(AE_EQ_PEAK, 1000.0f, 30.0f);
+  AE_ASSERT_EQ(ae_eq_set_band(eq, 0, &band), AE_ERROR_INVALID_PARAM);
+  band = eq_band(AE_EQ_PEAK, 1000.0f, 6.0f);
+  band.q = 0.0f;
+  AE_ASSERT_EQ(ae_eq_set_band(eq, 0, &band), AE_ERROR_INVALID_PARAM);
+
+  /* A rejected band keeps the previous settings */
+  AE_ASSERT_EQ(ae_eq_get_band(eq, 0, &band), AE_OK);
+  AE_ASSERT(!band.enabled);
+  AE_ASSERT_EQ(ae_eq_process(eq, NULL, NULL, 16), AE_ERROR_INVALID_PARAM);
+  ae_eq_destroy(eq);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Tests: Oversampler
+ *============================================================================*/
+
+static ae_oversampler_t *os_create(uint32_t factor, uint32_t max_frames,
+                                   ae_oversample_phase_t phase,
+                                   ae_oversample_quality_t quality) {
+  ae_oversampler_config_t config = {.factor = factor,
+                                    .max_frames = max_frames,
+                                    .phase = phase,
+                                    .quality = quality};
+  return ae_oversampler_create(&config);
+}
+
+/* Counts the high-rate frames it is handed and leaves them alone */
+static void os_count(float *left, float *right, size_t frames,
+                     void *user_data) {
+  (void)left;
+  (void)right;
+  *(size_t *)user_data += frames;
+}
+
+/* 0.5 amplitude, exactly periodic: cycles per period samples */
+static void os_fill(float *buf, size_t n, size_t period, double cycles) {
+  for (size_t i = 0; i < n; ++i)
+    buf[i] = 0.5f * (float)sin(6.283185307179586 * cycles *
+                               (double)(i % period) / (double)period);
+}
+
+static void os_drive(float *left, float *right, size_t frames,
+                     void *user_data) {
+  (void)user_data;
+  for (size_t i = 0; i < frames; ++i) {
+    left[i] = tanhf(4.0f * left[i]);
+    if (right)
+      right[i] = tanhf(4.0f * right[i]);
+  }
+}
+
+static void os_drive_process(void *ctx, float *left, float *right,
+                             size_t frames) {
+  ae_oversampler_process(ctx, left, right, frames, os_drive, NULL);
+}
+
+/* Level of everything but the 15 kHz fundamental, in dB below it. The
+ * input repeats every 16 samples, so the fit over whole periods is exact
+ * and anything else in band is aliasing. */
+static float os_alias_db(const float *buf, size_t n) {
+  double c = 0.0, s = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    double w = 6.283185307179586 * 5.0 * (double)(i % 16) / 16.0;
+    c += buf[i] * cos(w);
+    s += buf[i] * sin(w);
+  }
+  c *= 2.0 / (double)n;
+  s *= 2.0 / (double)n;
+  double rest = 0.0, fund = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    double w = 6.283185307179586 * 5.0 * (double)(i % 16) / 16.0;
+    double fit = c * cos(w) + s * sin(w);
+    rest += (buf[i] - fit) * (buf[i] - fit);
+    fund += fit * fit;
+  }
+  return (float)(10.0 * log10(rest / fund));
+}
+
+/* With nothing in the callback the oversampler is a delay by its latency,
+ * for every factor and both phase modes */
+void test_oversampler_passband_latency(void) {
+  static float buf[COMP_SR];
+  for (int phase = 0; phase < 2; ++phase) {
+    for (uint32_t factor = 2; factor <= 8; factor *= 2) {
+      ae_oversampler_t *os = os_create(factor, 512,
+                                       (ae_oversample_phase_t)phase,
+                                       AE_OVERSAMPLE_NORMAL);
+      AE_ASSERT_NOT_NULL(os);
+      float latency = ae_oversampler_latency(os);
+      AE_ASSERT(latency > 0.0f && latency < 32.0f);
+      os_fill(buf, COMP_SR, 48, 1.0);
+      size_t seen = 0;
+      AE_ASSERT_EQ(ae_oversampler_process(os, buf, NULL, COMP_SR, os_count,
+                                          &seen),
+                   AE_OK);
+      AE_ASSERT_EQ(seen, (size_t)COMP_SR * factor);
+      float err = 0.0f;
+      for (size_t i = COMP_SR / 2; i < COMP_SR; ++i) {
+        double t = 6.283185307179586 * ((double)(i % 48) - latency) / 48.0;
+        err = fmaxf(err, fabsf(buf[i] - 0.5f * (float)sin(t)));
+      }
+      AE_ASSERT(err < 0.001f);
+      ae_oversampler_destroy(os);
+    }
+  }
+
+  /* Linear phase at 2x: an impulse comes out symmetric about the latency */
+  ae_oversampler_t *os = os_create(2, 64, AE_OVERSAMPLE_LINEAR_PHASE,
+                                   AE_OVERSAMPLE_NORMAL);
+  AE_ASSERT_NOT_NULL(os);
+  size_t at = (size_t)ae_oversampler_latency(os);
+  AE_ASSERT_FLOAT_EQ(ae_oversampler_latency(os), (float)at, 0.0f);
+  comp_fill(buf, 256, 0.0f);
+  buf[0] = 1.0f;
+  size_t seen = 0;
+  ae_oversampler_process(os, buf, NULL, 256, os_count, &seen);
+  AE_ASSERT_FLOAT_EQ(buf[at], lim_peak(buf, 256), 0.0f);
+  for (size_t d = 1; d < at; ++d)
+    AE_ASSERT_FLOAT_EQ(buf[at - d], buf[at + d], 1e-6f);
+  ae_oversampler_destroy(os);
+  AE_TEST_PASS();
+}
+
+/* A driven tanh on a 15 kHz sine: at the base rate its 3rd harmonic folds
+ * to 3 kHz, oversampled the harmonics are filtered out before decimation */
+void test_oversampler_alias_rejection(void) {
+  static float buf[COMP_SR];
+  const size_t tail = COMP_SR / 2;
+  os_fill(buf, COMP_SR, 16, 5.0);
+  os_drive(buf, NULL, COMP_SR, NULL);
+  float base = os_alias_db(buf + tail, COMP_SR - tail);
+  AE_ASSERT(base > -20.0f);
+
+  for (int phase = 0; phase < 2; ++phase) {
+    float prev = base;
+    for (uint32_t factor = 2; factor <= 8; factor *= 2) {
+      ae_oversampler_t *os = os_create(factor, 512,
+                                       (ae_oversample_phase_t)phase,
+                                       AE_OVERSAMPLE_NORMAL);
+      AE_ASSERT_NOT_NULL(os);
+      os_fill(buf, COMP_SR, 16, 5.0);
+      ae_oversampler_process(os, buf, NULL, COMP_SR, os_drive, NULL);
+      float alias = os_alias_db(buf + tail, COMP_SR - tail);
+      /* 2x still folds the 5th harmonic; from 4x up the aliases left come
+       * from harmonics above the 12th */
+      AE_ASSERT(alias < prev - 10.0f);
+      if (factor >= 4)
+        AE_ASSERT(alias < -70.0f);
+      prev = factor == 2 ? alias : prev;
+      ae_oversampler_destroy(os);
+    }
+  }
+  AE_TEST_PASS();
+}
+
+/* Call boundaries and the internal max_frames split must not show in the
+ * output, and mono matches the left channel of a stereo run */
+void test_oversampler_block_split(void) {
+  static float left[SPLIT_FRAMES], right[SPLIT_FRAMES], mono[SPLIT_FRAMES];
+  for (int phase = 0; phase < 2; ++phase) {
+    ae_test_generate_noise(left, SPLIT_FRAMES, 0.5f);
+    ae_test_generate_sine(right, SPLIT_FRAMES, 440.0f, (float)COMP_SR, 0.5f);
+    memcpy(mono, left, sizeof(left));
+    ae_oversampler_t *a = os_create(4, 512, (ae_oversample_phase_t)phase,
+                                    AE_OVERSAMPLE_HIGH);
+    ae_oversampler_t *b = os_create(4, 512, (ae_oversample_phase_t)phase,
+                                    AE_OVERSAMPLE_HIGH);
+    ae_oversampler_t *m = os_create(4, 300, (ae_oversample_phase_t)phase,
+                                    AE_OVERSAMPLE_HIGH);
+    AE_ASSERT_NOT_NULL(a);
+    AE_ASSERT_NOT_NULL(b);
+    AE_ASSERT_NOT_NULL(m);
+
+    AE_ASSERT(
+        check_block_split_invariance(os_drive_process, a, b, left, right));
+    ae_oversampler_process(m, mono, NULL, SPLIT_FRAMES, os_drive, NULL);
+    AE_ASSERT(memcmp(left, mono, sizeof(left)) == 0);
+
+    /* reset returns to the state of a fresh oversampler */
+    ae_oversampler_reset(b);
+    ae_test_generate_noise(left, SPLIT_FRAMES, 0.5f);
+    memcpy(mono, left, sizeof(left));
+    ae_oversampler_t *c = os_create(4, 512, (ae_oversample_phase_t)phase,
+                                    AE_OVERSAMPLE_HIGH);
+    AE_ASSERT_NOT_NULL(c);
+    ae_oversampler_process(b, left, NULL, SPLIT_FRAMES, os_drive, NULL);
+    ae_oversampler_process(c, mono, NULL, SPLIT_FRAMES, os_drive, NULL);
+    AE_ASSERT(memcmp(left, mono, sizeof(left)) == 0);
+    ae_oversampler_destroy(a);
+    ae_oversampler_destroy(b);
+    ae_oversampler_destroy(c);
+    ae_oversampler_destroy(m);
+  }
+  AE_TEST_PASS();
+}
+
+void test_oversampler_rejects_bad_config(void) {
+  AE_ASSERT_NULL(ae_oversampler_create(NULL));
+  AE_ASSERT_NULL(os_create(3, 512, AE_OVERSAMPLE_LINEAR_PHASE,
+                           AE_OVERSAMPLE_NORMAL));
+  AE_ASSERT_NULL(os_create(16, 512, AE_OVERSAMPLE_LINEAR_PHASE,
+                           AE_OVERSAMPLE_NORMAL));
+  AE_ASSERT_NULL(os_create(2, 0, AE_OVERSAMPLE_LINEAR_PHASE,
+                           AE_OVERSAMPLE_NORMAL));
+  AE_ASSERT_NULL(os_create(2, 512, (ae_oversample_phase_t)2,
+                           AE_OVERSAMPLE_NORMAL));
+  AE_ASSERT_NULL(os_create(2, 512, AE_OVERSAMPLE_LOW_LATENCY,
+                           (ae_oversample_quality_t)3));
+
+  ae_oversampler_t *os = os_create(2, 512, AE_OVERSAMPLE_LOW_LATENCY,
+                                   AE_OVERSAMPLE_DRAFT);
+  AE_ASSERT_NOT_NULL(os);
+  float buf[16] = {0};
+  size_t seen = 0;
+  AE_ASSERT_EQ(ae_oversampler_process(os, NULL, NULL, 16, os_count, &seen),
+               AE_ERROR_INVALID_PARAM);
+  AE_ASSERT_EQ(ae_oversampler_process(os, buf, NULL, 16, NULL, NULL),
+               AE_ERROR_INVALID_PARAM);
+  AE_ASSERT_EQ(ae_oversampler_process(os, buf, NULL, 0, os_count, &seen),
+               AE_OK);
+  AE_ASSERT_EQ(seen, (size_t)0);
+  AE_ASSERT_FLOAT_EQ(ae_oversampler_latency(NULL), 0.0f, 0.0f);
+  ae_oversampler_destroy(os);
+  AE_TEST_PASS();
+}
+
 /*============================================================================
  * Main
  *============================================================================*/
@@ -414,5 +1318,47 @@ int main(void) {
   AE_RUN_TEST(test_buffer_mix);
   AE_TEST_SUITE_END();
 
+  AE_TEST_SUITE_BEGIN("Compressor");
+  AE_RUN_TEST(test_compressor_hard_knee_curve);
+  AE_RUN_TEST(test_compressor_soft_knee);
+  AE_RUN_TEST(test_compressor_attack_time);
+  AE_RUN_TEST(test_compressor_stereo_link);
+  AE_RUN_TEST(test_compressor_sidechain);
+  AE_RUN_TEST(test_compressor_block_split);
+  AE_RUN_TEST(test_compressor_rejects_bad_params);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Limiter");
+  AE_RUN_TEST(test_limiter_latency);
+  AE_RUN_TEST(test_limiter_lookahead_ramp);
+  AE_RUN_TEST(test_limiter_ceiling_on_noise);
+  AE_RUN_TEST(test_limiter_true_peak);
+  AE_RUN_TEST(test_limiter_block_split);
+  AE_RUN_TEST(test_limiter_rejects_bad_params);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("De-esser");
+  AE_RUN_TEST(test_deesser_crossover_flat);
+  AE_RUN_TEST(test_deesser_band_reduction);
+  AE_RUN_TEST(test_deesser_stereo_link);
+  AE_RUN_TEST(test_deesser_block_split);
+  AE_RUN_TEST(test_deesser_rejects_bad_params);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Parametric EQ");
+  AE_RUN_TEST(test_eq_band_gains);
+  AE_RUN_TEST(test_eq_cascade);
+  AE_RUN_TEST(test_eq_glide);
+  AE_RUN_TEST(test_eq_block_split);
+  AE_RUN_TEST(test_eq_rejects_bad_params);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Oversampling");
+  AE_RUN_TEST(test_oversampler_passband_latency);
+  AE_RUN_TEST(test_oversampler_alias_rejection);
+  AE_RUN_TEST(test_oversampler_block_split);
+  AE_RUN_TEST(test_oversampler_rejects_bad_config);
+  AE_TEST_SUITE_END();
+
   return ae_test_report();
 }
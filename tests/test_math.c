@@ -4,8 +4,11 @@
  */
 
 #include "../include/acoustic_engine.h"
+#include "../src/ae_internal.h"
 #include "ae_test.h"
+#include <float.h>
 #include <math.h>
+#include <stdbool.h>
 
 
 /*============================================================================
@@ -217,6 +220,175 @@ void test_safe_log10_negative(void) {
   AE_TEST_PASS();
 }
 
+/*============================================================================
+ * Tests: Fast math
+ *============================================================================*/
+
+/* Odd length so the scalar tail after the SIMD body is covered too */
+#define FM_N 4099
+
+typedef enum { FM_EXP, FM_LOG10, FM_POW, FM_SIN, FM_COS, FM_TANH } fm_kernel_t;
+
+static void fm_run(fm_kernel_t kernel, float *dst, const float *src, float y,
+                   ae_math_tier_t tier) {
+  switch (kernel) {
+  case FM_EXP:
+    ae_fast_exp(dst, src, FM_N, tier);
+    break;
+  case FM_LOG10:
+    ae_fast_log10(dst, src, FM_N, tier);
+    break;
+  case FM_POW:
+    ae_fast_pow(dst, src, y, FM_N, tier);
+    break;
+  case FM_SIN:
+    ae_fast_sin(dst, src, FM_N, tier);
+    break;
+  case FM_COS:
+    ae_fast_cos(dst, src, FM_N, tier);
+    break;
+  case FM_TANH:
+    ae_fast_tanh(dst, src, FM_N, tier);
+    break;
+  }
+}
+
+static double fm_reference(fm_kernel_t kernel, double x, double y) {
+  switch (kernel) {
+  case FM_EXP:
+    return exp(x);
+  case FM_LOG10:
+    return log10(x);
+  case FM_POW:
+    return pow(x, y);
+  case FM_SIN:
+    return sin(x);
+  case FM_COS:
+    return cos(x);
+  case FM_TANH:
+    return tanh(x);
+  }
+  return 0.0;
+}
+
+/* Worst error over src; relative for exp and pow, absolute otherwise */
+static double fm_max_error(fm_kernel_t kernel, const float *src, float y,
+                           ae_math_tier_t tier) {
+  static float dst[FM_N];
+  fm_run(kernel, dst, src, y, tier);
+  bool relative = kernel == FM_EXP || kernel == FM_POW;
+  double worst = 0.0;
+  for (size_t i = 0; i < FM_N; ++i) {
+    double ref = fm_reference(kernel, src[i], y);
+    double err = fabs((double)dst[i] - ref);
+    if (relative)
+      err /= fabs(ref);
+    if (err > worst || isnan(err))
+      worst = isnan(err) ? INFINITY : err;
+  }
+  return worst;
+}
+
+/* Linear sweep of [lo, hi], or logarithmic when log_spaced */
+static void fm_sweep(float *src, float lo, float hi, bool log_spaced) {
+  for (size_t i = 0; i < FM_N; ++i) {
+    double t = (double)i / (FM_N - 1);
+    src[i] = log_spaced ? (float)(lo * pow((double)hi / lo, t))
+                        : (float)(lo + (hi - lo) * t);
+  }
+}
+
+static bool fm_tiers_hold(fm_kernel_t kernel, const float *src, float y) {
+  return fm_max_error(kernel, src, y, AE_MATH_1E4) <= 1e-4 &&
+         fm_max_error(kernel, src, y, AE_MATH_1E2) <= 1e-2;
+}
+
+void test_fast_exp_accuracy(void) {
+  static float src[FM_N];
+  fm_sweep(src, -80.0f, 80.0f, false);
+  AE_ASSERT(fm_tiers_hold(FM_EXP, src, 0.0f));
+  AE_TEST_PASS();
+}
+
+void test_fast_log10_accuracy(void) {
+  static float src[FM_N];
+  fm_sweep(src, FLT_MIN, 1e38f, true);
+  AE_ASSERT(fm_tiers_hold(FM_LOG10, src, 0.0f));
+  fm_sweep(src, 0.5f, 2.0f, false);
+  AE_ASSERT(fm_tiers_hold(FM_LOG10, src, 0.0f));
+  AE_TEST_PASS();
+}
+
+void test_fast_pow_accuracy(void) {
+  static float src[FM_N];
+  const float exponents[] = {-4.0f, -0.5f, 0.25f, 0.3f, 1.0f, 2.5f, 4.0f};
+  fm_sweep(src, 1e-6f, 1e3f, true);
+  for (size_t e = 0; e < sizeof(exponents) / sizeof(exponents[0]); ++e)
+    AE_ASSERT(fm_tiers_hold(FM_POW, src, exponents[e]));
+  AE_TEST_PASS();
+}
+
+void test_fast_sin_cos_accuracy(void) {
+  static float src[FM_N];
+  fm_sweep(src, -8.0f, 8.0f, false);
+  AE_ASSERT(fm_tiers_hold(FM_SIN, src, 0.0f));
+  AE_ASSERT(fm_tiers_hold(FM_COS, src, 0.0f));
+  fm_sweep(src, -8192.0f, 8192.0f, false);
+  AE_ASSERT(fm_tiers_hold(FM_SIN, src, 0.0f));
+  AE_ASSERT(fm_tiers_hold(FM_COS, src, 0.0f));
+  AE_TEST_PASS();
+}
+
+void test_fast_tanh_accuracy(void) {
+  static float src[FM_N];
+  fm_sweep(src, -20.0f, 20.0f, false);
+  AE_ASSERT(fm_tiers_hold(FM_TANH, src, 0.0f));
+  fm_sweep(src, -0.01f, 0.01f, false);
+  AE_ASSERT(fm_tiers_hold(FM_TANH, src, 0.0f));
+  AE_TEST_PASS();
+}
+
+/* The exact tier is libm itself, value for value */
+void test_fast_exact_tier_is_libm(void) {
+  static float src[FM_N];
+  static float dst[FM_N];
+  fm_sweep(src, 0.01f, 10.0f, false);
+  ae_fast_exp(dst, src, FM_N, AE_MATH_EXACT);
+  for (size_t i = 0; i < FM_N; ++i)
+    AE_ASSERT(dst[i] == expf(src[i]));
+  ae_fast_log10(dst, src, FM_N, AE_MATH_EXACT);
+  for (size_t i = 0; i < FM_N; ++i)
+    AE_ASSERT(dst[i] == log10f(src[i]));
+  ae_fast_pow(dst, src, 0.3f, FM_N, AE_MATH_EXACT);
+  for (size_t i = 0; i < FM_N; ++i)
+    AE_ASSERT(dst[i] == powf(src[i], 0.3f));
+  ae_fast_sin(dst, src, FM_N, AE_MATH_EXACT);
+  for (size_t i = 0; i < FM_N; ++i)
+    AE_ASSERT(dst[i] == sinf(src[i]));
+  ae_fast_cos(dst, src, FM_N, AE_MATH_EXACT);
+  for (size_t i = 0; i < FM_N; ++i)
+    AE_ASSERT(dst[i] == cosf(src[i]));
+  ae_fast_tanh(dst, src, FM_N, AE_MATH_EXACT);
+  for (size_t i = 0; i < FM_N; ++i)
+    AE_ASSERT(dst[i] == tanhf(src[i]));
+  AE_TEST_PASS();
+}
+
+/* Documented edge behaviour: log10 floors at FLT_MIN, pow of x <= 0 is 0 */
+void test_fast_edge_inputs(void) {
+  float src[5] = {0.0f, -1.0f, 0.0f, -1.0f, 0.0f};
+  float dst[5];
+  for (int tier = AE_MATH_EXACT; tier <= AE_MATH_1E2; ++tier) {
+    ae_fast_log10(dst, src, 5, (ae_math_tier_t)tier);
+    for (int i = 0; i < 5; ++i)
+      AE_ASSERT_FLOAT_EQ(dst[i], log10f(FLT_MIN), 0.01f);
+    ae_fast_pow(dst, src, 0.5f, 5, (ae_math_tier_t)tier);
+    for (int i = 0; i < 5; ++i)
+      AE_ASSERT(dst[i] == 0.0f);
+  }
+  AE_TEST_PASS();
+}
+
 /*============================================================================
  * Main
  *============================================================================*/
@@ -264,5 +436,15 @@ int main(void) {
   AE_RUN_TEST(test_safe_log10_negative);
   AE_TEST_SUITE_END();
 
+  AE_TEST_SUITE_BEGIN("Fast Math");
+  AE_RUN_TEST(test_fast_exp_accuracy);
+  AE_RUN_TEST(test_fast_log10_accuracy);
+  AE_RUN_TEST(test_fast_pow_accuracy);
+  AE_RUN_TEST(test_fast_sin_cos_accuracy);
+  AE_RUN_TEST(test_fast_tanh_accuracy);
+  AE_RUN_TEST(test_fast_exact_tier_is_libm);
+  AE_RUN_TEST(test_fast_edge_inputs);
+  AE_TEST_SUITE_END();
+
   return ae_test_report();
 }
@@ -7,6 +7,7 @@
 #include "ae_test.h"
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 /*============================================================================
  * Francois-Garrison Seawater Absorption Tests
@@ -167,6 +168,153 @@ void test_rock_wall_absorption(void) {
   AE_TEST_PASS();
 }
 
+/*============================================================================
+ * Doppler Tests
+ *============================================================================*/
+
+#define DOPPLER_SR 48000
+#define DOPPLER_LENGTH DOPPLER_SR
+
+/* Dry-only render of a 1 kHz tone with Doppler on. distance_rate (m/s)
+ * moves the source through ae_set_distance() every block. */
+static int render_doppler(const ae_doppler_params_t *doppler,
+                          float distance_rate, size_t block, float *out) {
+  ae_engine_t *engine = ae_create_engine(NULL);
+  float *tone = (float *)malloc(DOPPLER_LENGTH * sizeof(float));
+  if (!engine || !tone) {
+    ae_destroy_engine(engine);
+    free(tone);
+    return 0;
+  }
+  ae_test_generate_sine(tone, DOPPLER_LENGTH, 1000.0f, DOPPLER_SR, 0.5f);
+  ae_set_dry_wet(engine, 0.0f);
+  ae_set_distance(engine, 100.0f);
+  ae_set_doppler(engine, doppler);
+
+  float distance = 100.0f;
+  float stereo[2 * 512];
+  int ok = 1;
+  for (size_t pos = 0; pos < DOPPLER_LENGTH && ok; pos += block) {
+    size_t n = DOPPLER_LENGTH - pos < block ? DOPPLER_LENGTH - pos : block;
+    ae_audio_buffer_t in = {.samples = tone + pos, .frame_count = n,
+                            .channels = 1, .interleaved = true};
+    ae_audio_buffer_t o = {.samples = stereo, .frame_count = n,
+                           .channels = 2, .interleaved = true};
+    ok = ae_process(engine, &in, &o) == AE_OK;
+    for (size_t i = 0; i < n; ++i)
+      out[pos + i] = stereo[2 * i];
+    if (distance_rate != 0.0f) {
+      distance += distance_rate * (float)n / DOPPLER_SR;
+      ae_set_distance(engine, distance);
+    }
+  }
+  ae_destroy_engine(engine);
+  free(tone);
+  return ok;
+}
+
+/* Frequency from interpolated rising zero crossings over the second half;
+ * max_step gets the largest sample-to-sample jump relative to the peak */
+static float doppler_frequency(const float *x, float *max_step) {
+  size_t start = DOPPLER_LENGTH / 2;
+  float first = -1.0f;
+  float last = -1.0f;
+  size_t crossings = 0;
+  float peak = 0.0f;
+  float step = 0.0f;
+  for (size_t i = start; i < DOPPLER_LENGTH; ++i) {
+    peak = fmaxf(peak, fabsf(x[i]));
+    step = fmaxf(step, fabsf(x[i] - x[i - 1]));
+    if (x[i - 1] < 0.0f && x[i] >= 0.0f) {
+      float t = (float)(i - 1) + x[i - 1] / (x[i - 1] - x[i]);
+      if (first < 0.0f)
+        first = t;
+      last = t;
+      ++crossings;
+    }
+  }
+  *max_step = peak > 0.0f ? step / peak : 1.0f;
+  if (crossings < 2)
+    return 0.0f;
+  return (float)(crossings - 1) * DOPPLER_SR / (last - first);
+}
+
+void test_doppler_velocity_pitch(void) {
+  /* Approaching at c/10: f' = f * c / (c - v), held across odd blocks */
+  float *out = (float *)malloc(DOPPLER_LENGTH * sizeof(float));
+  AE_ASSERT(out != NULL);
+  ae_doppler_params_t doppler = {.source_velocity = 34.3f,
+                                 .listener_velocity = 0.0f,
+                                 .enabled = true};
+  AE_ASSERT(render_doppler(&doppler, 0.0f, 300, out));
+  float max_step = 0.0f;
+  float freq = doppler_frequency(out, &max_step);
+  free(out);
+
+  float expected = 1000.0f * 343.0f / (343.0f - 34.3f);
+  AE_ASSERT_FLOAT_EQ(freq, expected, expected * 0.005f);
+  /* A clean tone near 1.1 kHz moves at most 2 sin(pi f / fs) per sample */
+  AE_ASSERT(max_step < 0.2f);
+  AE_TEST_PASS();
+}
+
+void test_doppler_distance_pitch(void) {
+  /* Distance alone, updated every block: receding at 20 m/s lowers the
+   * pitch by the delay slope, 1 - 20 / c */
+  float *out = (float *)malloc(DOPPLER_LENGTH * sizeof(float));
+  AE_ASSERT(out != NULL);
+  ae_doppler_params_t doppler = {.source_velocity = 0.0f,
+                                 .listener_velocity = 0.0f,
+                                 .enabled = true};
+  AE_ASSERT(render_doppler(&doppler, 20.0f, 256, out));
+  float max_step = 0.0f;
+  float freq = doppler_frequency(out, &max_step);
+  free(out);
+
+  float expected = 1000.0f * (1.0f - 20.0f / 343.0f);
+  AE_ASSERT_FLOAT_EQ(freq, expected, expected * 0.005f);
+  AE_ASSERT(max_step < 0.2f);
+  AE_TEST_PASS();
+}
+
+void test_doppler_reenable_starts_silent(void) {
+  /* A tone through the line, Doppler off, then on again over silence:
+   * nothing from before may come back out */
+  ae_engine_t *engine = ae_create_engine(NULL);
+  AE_ASSERT_NOT_NULL(engine);
+  ae_set_dry_wet(engine, 0.0f);
+  ae_set_distance(engine, 50.0f);
+  ae_doppler_params_t doppler = {.source_velocity = 0.0f,
+                                 .listener_velocity = 0.0f,
+                                 .enabled = true};
+  float tone[512];
+  float silence[512] = {0};
+  float stereo[2 * 512];
+  ae_test_generate_sine(tone, 512, 1000.0f, DOPPLER_SR, 0.5f);
+  ae_audio_buffer_t in = {.samples = tone, .frame_count = 512,
+                          .channels = 1, .interleaved = true};
+  ae_audio_buffer_t out = {.samples = stereo, .frame_count = 512,
+                           .channels = 2, .interleaved = true};
+  AE_ASSERT_EQ(ae_set_doppler(engine, &doppler), AE_OK);
+  for (int b = 0; b < 8; ++b)
+    AE_ASSERT_EQ(ae_process(engine, &in, &out), AE_OK);
+
+  doppler.enabled = false;
+  AE_ASSERT_EQ(ae_set_doppler(engine, &doppler), AE_OK);
+  doppler.enabled = true;
+  AE_ASSERT_EQ(ae_set_doppler(engine, &doppler), AE_OK);
+  in.samples = silence;
+  float peak = 0.0f;
+  for (int b = 0; b < 8; ++b) {
+    AE_ASSERT_EQ(ae_process(engine, &in, &out), AE_OK);
+    for (size_t i = 0; i < 2 * 512; ++i)
+      peak = fmaxf(peak, fabsf(stereo[i]));
+  }
+  ae_destroy_engine(engine);
+  AE_ASSERT(peak == 0.0f);
+  AE_TEST_PASS();
+}
+
 /*============================================================================
  * Main
  *============================================================================*/
@@ -192,5 +340,11 @@ int main(void) {
   AE_RUN_TEST(test_rock_wall_absorption);
   AE_TEST_SUITE_END();
 
+  AE_TEST_SUITE_BEGIN("Doppler");
+  AE_RUN_TEST(test_doppler_velocity_pitch);
+  AE_RUN_TEST(test_doppler_distance_pitch);
+  AE_RUN_TEST(test_doppler_reenable_starts_silent);
+  AE_TEST_SUITE_END();
+
   return ae_test_report();
 }
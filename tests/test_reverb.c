@@ -0,0 +1,1073 @@
+/**
+ * @file test_reverb.c
+ * @brief Tests for the reverb (early reflections + FDN late reverb)
+ */
+
+#include "acoustic_engine.h"
+#include "ae_echo_density.h"
+#include "ae_test.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SR 48000
+#define TEST_BLOCK 256
+
+/*============================================================================
+ * Helpers
+ *============================================================================*/
+
+static ae_engine_t *create_engine_with_rate(ae_reverb_rate_t rate) {
+  ae_config_t config = ae_get_default_config();
+  config.reverb_rate = rate;
+  return ae_create_engine(&config);
+}
+
+static ae_engine_t *create_engine_with_taps(uint32_t taps) {
+  ae_config_t config = ae_get_default_config();
+  config.early_reflection_taps = taps;
+  return ae_create_engine(&config);
+}
+
+/* Run a mono signal through the engine in fixed blocks, stereo out */
+static int render(ae_engine_t *engine, const float *input, float *out_l,
+                  float *out_r, size_t length, size_t block) {
+  float in_buf[AE_MAX_BUFFER_SIZE];
+  float out_buf[AE_MAX_BUFFER_SIZE * 2];
+  for (size_t pos = 0; pos < length; pos += block) {
+    size_t n = length - pos < block ? length - pos : block;
+    memcpy(in_buf, input + pos, n * sizeof(float));
+    ae_audio_buffer_t in = {
+        .samples = in_buf, .frame_count = n, .channels = 1,
+        .interleaved = true};
+    ae_audio_buffer_t out = {
+        .samples = out_buf, .frame_count = n, .channels = 2,
+        .interleaved = true};
+    if (ae_process(engine, &in, &out) != AE_OK)
+      return 0;
+    for (size_t i = 0; i < n; ++i) {
+      out_l[pos + i] = out_buf[i * 2];
+      out_r[pos + i] = out_buf[i * 2 + 1];
+    }
+  }
+  return 1;
+}
+
+static float wet_energy(ae_reverb_rate_t rate, const char *preset,
+                        const float *input, size_t length, size_t block) {
+  ae_engine_t *engine = create_engine_with_rate(rate);
+  if (!engine)
+    return -1.0f;
+  ae_load_preset(engine, preset);
+  ae_set_dry_wet(engine, 1.0f);
+
+  float *out_l = (float *)calloc(length, sizeof(float));
+  float *out_r = (float *)calloc(length, sizeof(float));
+  float energy = -1.0f;
+  if (out_l && out_r && render(engine, input, out_l, out_r, length, block)) {
+    energy = 0.0f;
+    for (size_t i = 0; i < length; ++i) {
+      if (!isfinite(out_l[i]) || !isfinite(out_r[i])) {
+        energy = -1.0f;
+        break;
+      }
+      energy += out_l[i] * out_l[i] + out_r[i] * out_r[i];
+    }
+  }
+  free(out_l);
+  free(out_r);
+  ae_destroy_engine(engine);
+  return energy;
+}
+
+/*============================================================================
+ * Multi-rate late reverb
+ *============================================================================*/
+
+void test_reverb_half_rate_tail_energy(void) {
+  size_t length = TEST_SR;
+  float *impulse = (float *)calloc(length, sizeof(float));
+  AE_ASSERT_NOT_NULL(impulse);
+  impulse[0] = 1.0f;
+
+  float full = wet_energy(AE_REVERB_RATE_FULL, "deep_sea", impulse, length,
+                          TEST_BLOCK);
+  float half = wet_energy(AE_REVERB_RATE_HALF, "deep_sea", impulse, length,
+                          TEST_BLOCK);
+  free(impulse);
+
+  AE_ASSERT(full > 0.0f);
+  AE_ASSERT(half > 0.0f);
+  /* Same RT60 and damping: tail energy within 3 dB */
+  AE_ASSERT_RANGE(10.0f * log10f(half / full), -3.0f, 3.0f);
+  AE_TEST_PASS();
+}
+
+void test_reverb_half_rate_passband(void) {
+  /* Noise rather than a tone: a steady sine lands on different FDN comb
+   * resonances at each rate */
+  size_t length = TEST_SR / 2;
+  float *noise = (float *)malloc(length * sizeof(float));
+  AE_ASSERT_NOT_NULL(noise);
+  srand(3);
+  ae_test_generate_noise(noise, length, 0.3f);
+
+  float full =
+      wet_energy(AE_REVERB_RATE_FULL, "radio", noise, length, TEST_BLOCK);
+  float half =
+      wet_energy(AE_REVERB_RATE_HALF, "radio", noise, length, TEST_BLOCK);
+  free(noise);
+
+  AE_ASSERT(full > 0.0f);
+  AE_ASSERT(half > 0.0f);
+  AE_ASSERT_RANGE(10.0f * log10f(half / full), -3.0f, 3.0f);
+  AE_TEST_PASS();
+}
+
+void test_reverb_auto_rate_odd_blocks(void) {
+  /* Odd block sizes exercise the decimator phase carried across blocks: the
+   * output must match one long block sample for sample */
+  size_t length = AE_MAX_BUFFER_SIZE;
+  float *noise = (float *)malloc(length * sizeof(float));
+  float *a_l = (float *)calloc(length, sizeof(float));
+  float *a_r = (float *)calloc(length, sizeof(float));
+  float *b_l = (float *)calloc(length, sizeof(float));
+  float *b_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(noise && a_l && a_r && b_l && b_r);
+  srand(7);
+  ae_test_generate_noise(noise, length, 0.3f);
+
+  const size_t blocks[2] = {length, 127};
+  float *outs[2][2] = {{a_l, a_r}, {b_l, b_r}};
+  for (int k = 0; k < 2; ++k) {
+    ae_engine_t *engine = create_engine_with_rate(AE_REVERB_RATE_AUTO);
+    AE_ASSERT_NOT_NULL(engine);
+    ae_load_preset(engine, "space");
+    ae_set_dry_wet(engine, 1.0f);
+    AE_ASSERT(render(engine, noise, outs[k][0], outs[k][1], length,
+                     blocks[k]));
+    ae_destroy_engine(engine);
+  }
+
+  float energy = 0.0f, max_diff = 0.0f;
+  for (size_t i = 0; i < length; ++i) {
+    energy += a_l[i] * a_l[i] + a_r[i] * a_r[i];
+    max_diff = fmaxf(max_diff, fabsf(a_l[i] - b_l[i]));
+    max_diff = fmaxf(max_diff, fabsf(a_r[i] - b_r[i]));
+  }
+  free(noise);
+  free(a_l);
+  free(a_r);
+  free(b_l);
+  free(b_r);
+
+  AE_ASSERT(energy > 0.0f);
+  AE_ASSERT(max_diff < 1e-6f);
+  AE_TEST_PASS();
+}
+
+void test_reverb_auto_rate_keeps_tail(void) {
+  /* Brightness automation into the half-rate band must not cut the tail */
+  size_t length = TEST_SR;
+  size_t change = TEST_SR / 2;
+  size_t window = TEST_SR / 20;
+  float *input = (float *)calloc(length, sizeof(float));
+  float *out_l = (float *)calloc(length, sizeof(float));
+  float *out_r = (float *)calloc(length, sizeof(float));
+  ae_engine_t *engine = create_engine_with_rate(AE_REVERB_RATE_AUTO);
+  AE_ASSERT(input && out_l && out_r && engine);
+  input[0] = 1.0f;
+  ae_set_dry_wet(engine, 1.0f);
+  ae_set_brightness(engine, 0.0f);
+
+  AE_ASSERT(render(engine, input, out_l, out_r, change, TEST_BLOCK));
+  ae_set_brightness(engine, -1.0f);
+  AE_ASSERT(render(engine, input + change, out_l + change, out_r + change,
+                   length - change, TEST_BLOCK));
+
+  float before = 0.0f, after = 0.0f;
+  for (size_t i = 0; i < window; ++i) {
+    size_t a = change - window + i, b = change + i;
+    before += out_l[a] * out_l[a] + out_r[a] * out_r[a];
+    after += out_l[b] * out_l[b] + out_r[b] * out_r[b];
+  }
+  ae_destroy_engine(engine);
+  free(input);
+  free(out_l);
+  free(out_r);
+
+  AE_ASSERT(before > 0.0f);
+  /* The heavier damping dulls the tail but must not silence it */
+  AE_ASSERT(10.0f * log10f(after / before) > -20.0f);
+  AE_TEST_PASS();
+}
+
+/* AUTO under a continuous feed: brightness -1 from change onward */
+static int render_rate_switch(ae_reverb_rate_t rate, const float *input,
+                              float *out_l, float *out_r, size_t length,
+                              size_t change) {
+  ae_engine_t *engine = create_engine_with_rate(rate);
+  if (!engine)
+    return 0;
+  ae_extended_params_t ext = {0.5f, 0.5f, 0.0f, 0.0f};
+  ae_set_extended_params(engine, &ext);
+  ae_set_dry_wet(engine, 1.0f);
+  ae_set_brightness(engine, 0.0f);
+  int ok = render(engine, input, out_l, out_r, change, TEST_BLOCK);
+  ae_set_brightness(engine, -1.0f);
+  ok = ok && render(engine, input + change, out_l + change, out_r + change,
+                    length - change, TEST_BLOCK);
+  ae_destroy_engine(engine);
+  return ok;
+}
+
+void test_reverb_auto_rate_switches_under_signal(void) {
+  /* A reverb that never goes quiet still reaches half rate: once the state
+   * from before the switch has decayed, AUTO renders what HALF renders */
+  size_t length = 3 * TEST_SR;
+  size_t change = TEST_SR / 2;
+  size_t window = TEST_SR / 4;
+  float *noise = (float *)malloc(length * sizeof(float));
+  float *a_l = (float *)calloc(length, sizeof(float));
+  float *a_r = (float *)calloc(length, sizeof(float));
+  float *h_l = (float *)calloc(length, sizeof(float));
+  float *h_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(noise && a_l && a_r && h_l && h_r);
+  ae_test_generate_noise(noise, length, 0.3f);
+  AE_ASSERT(render_rate_switch(AE_REVERB_RATE_AUTO, noise, a_l, a_r, length,
+                               change));
+  AE_ASSERT(render_rate_switch(AE_REVERB_RATE_HALF, noise, h_l, h_r, length,
+                               change));
+
+  double signal = 0.0, error = 0.0;
+  for (size_t i = length - window; i < length; ++i) {
+    signal += (double)h_l[i] * h_l[i] + (double)h_r[i] * h_r[i];
+    double dl = (double)a_l[i] - h_l[i], dr = (double)a_r[i] - h_r[i];
+    error += dl * dl + dr * dr;
+  }
+  free(noise);
+  free(a_l);
+  free(a_r);
+  free(h_l);
+  free(h_r);
+
+  AE_ASSERT(signal > 0.0);
+  AE_ASSERT(10.0 * log10(error / signal + 1e-30) < -60.0);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Early reflection tap engine
+ *============================================================================*/
+
+static float early_energy(uint32_t taps, size_t block, float *out_l,
+                          float *out_r, size_t length) {
+  ae_engine_t *engine = create_engine_with_taps(taps);
+  if (!engine)
+    return -1.0f;
+  /* Short decay keeps the FDN well below the reflections */
+  ae_extended_params_t ext = {0.1f, 0.5f, 0.0f, 0.0f};
+  ae_set_extended_params(engine, &ext);
+  ae_set_dry_wet(engine, 1.0f);
+
+  float *impulse = (float *)calloc(length, sizeof(float));
+  float energy = -1.0f;
+  if (impulse) {
+    impulse[0] = 1.0f;
+    if (render(engine, impulse, out_l, out_r, length, block)) {
+      energy = 0.0f;
+      for (size_t i = 0; i < length; ++i)
+        energy += out_l[i] * out_l[i] + out_r[i] * out_r[i];
+    }
+  }
+  free(impulse);
+  ae_destroy_engine(engine);
+  return energy;
+}
+
+void test_er_block_size_invariance(void) {
+  /* Tap spans split at the ER buffer wrap point must match small blocks */
+  size_t length = TEST_SR / 2;
+  float *a_l = (float *)calloc(length, sizeof(float));
+  float *a_r = (float *)calloc(length, sizeof(float));
+  float *b_l = (float *)calloc(length, sizeof(float));
+  float *b_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(a_l && a_r && b_l && b_r);
+
+  float ea = early_energy(64, AE_MAX_BUFFER_SIZE, a_l, a_r, length);
+  float eb = early_energy(64, 61, b_l, b_r, length);
+  AE_ASSERT(ea > 0.0f);
+  AE_ASSERT(eb > 0.0f);
+
+  float max_diff = 0.0f;
+  for (size_t i = 0; i < length; ++i) {
+    max_diff = fmaxf(max_diff, fabsf(a_l[i] - b_l[i]));
+    max_diff = fmaxf(max_diff, fabsf(a_r[i] - b_r[i]));
+  }
+  free(a_l);
+  free(a_r);
+  free(b_l);
+  free(b_r);
+
+  AE_ASSERT(max_diff < 1e-5f);
+  AE_TEST_PASS();
+}
+
+void test_er_dense_taps_energy(void) {
+  size_t length = TEST_SR / 4;
+  float *out_l = (float *)calloc(length, sizeof(float));
+  float *out_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(out_l && out_r);
+
+  float sparse = early_energy(12, TEST_BLOCK, out_l, out_r, length);
+  float dense = early_energy(128, TEST_BLOCK, out_l, out_r, length);
+
+  /* Count distinct reflections in the first 150 ms of the dense response */
+  size_t nonzero = 0;
+  for (size_t i = 1; i < (size_t)(0.15f * TEST_SR); ++i) {
+    if (fabsf(out_l[i]) > 1e-6f && fabsf(out_l[i - 1]) <= 1e-6f)
+      ++nonzero;
+  }
+  free(out_l);
+  free(out_r);
+
+  AE_ASSERT(sparse > 0.0f);
+  AE_ASSERT(dense > 0.0f);
+  /* Gains are normalized by tap count: energy stays within 3 dB */
+  AE_ASSERT_RANGE(10.0f * log10f(dense / sparse), -3.0f, 3.0f);
+  AE_ASSERT(nonzero > 12);
+  AE_TEST_PASS();
+}
+
+void test_er_zero_taps_is_default(void) {
+  /* A zeroed config field selects the documented 12 taps, not one */
+  size_t length = TEST_SR / 4;
+  float *a_l = (float *)calloc(length, sizeof(float));
+  float *a_r = (float *)calloc(length, sizeof(float));
+  float *b_l = (float *)calloc(length, sizeof(float));
+  float *b_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(a_l && a_r && b_l && b_r);
+
+  float zero = early_energy(0, TEST_BLOCK, a_l, a_r, length);
+  float twelve = early_energy(12, TEST_BLOCK, b_l, b_r, length);
+  int same = memcmp(a_l, b_l, length * sizeof(float)) == 0 &&
+             memcmp(a_r, b_r, length * sizeof(float)) == 0;
+  free(a_l);
+  free(a_r);
+  free(b_l);
+  free(b_r);
+
+  AE_ASSERT(zero > 0.0f);
+  AE_ASSERT_FLOAT_EQ(zero, twelve, 0.0f);
+  AE_ASSERT(same);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Velvet-noise diffuser
+ *============================================================================*/
+
+static ae_engine_t *create_engine_with_diffuser(ae_diffuser_t diffuser) {
+  ae_config_t config = ae_get_default_config();
+  config.diffuser = diffuser;
+  return ae_create_engine(&config);
+}
+
+static int diffuser_response(ae_diffuser_t diffuser, const char *preset,
+                             const float *input, float *out_l, float *out_r,
+                             size_t length, size_t block) {
+  ae_engine_t *engine = create_engine_with_diffuser(diffuser);
+  if (!engine)
+    return 0;
+  if (preset)
+    ae_load_preset(engine, preset);
+  ae_set_dry_wet(engine, 1.0f);
+  int ok = render(engine, input, out_l, out_r, length, block);
+  ae_destroy_engine(engine);
+  return ok;
+}
+
+void test_velvet_level_matches_allpass(void) {
+  size_t length = TEST_SR / 2;
+  float *noise = (float *)malloc(length * sizeof(float));
+  float *out_l = (float *)calloc(length, sizeof(float));
+  float *out_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(noise && out_l && out_r);
+  srand(5);
+  ae_test_generate_noise(noise, length, 0.3f);
+
+  float energy[2] = {0.0f, 0.0f};
+  ae_diffuser_t modes[2] = {AE_DIFFUSER_ALLPASS, AE_DIFFUSER_VELVET};
+  for (size_t m = 0; m < 2; ++m) {
+    AE_ASSERT(diffuser_response(modes[m], "cathedral", noise, out_l, out_r,
+                                length, TEST_BLOCK));
+    for (size_t i = 0; i < length; ++i) {
+      AE_ASSERT(isfinite(out_l[i]) && isfinite(out_r[i]));
+      energy[m] += out_l[i] * out_l[i] + out_r[i] * out_r[i];
+    }
+  }
+  free(noise);
+  free(out_l);
+  free(out_r);
+
+  AE_ASSERT(energy[0] > 0.0f);
+  AE_ASSERT_RANGE(10.0f * log10f(energy[1] / energy[0]), -3.0f, 3.0f);
+  AE_TEST_PASS();
+}
+
+void test_velvet_block_size_invariance(void) {
+  /* Pulse spans split at the buffer wrap point must match small blocks */
+  size_t length = TEST_SR / 2;
+  float *impulse = (float *)calloc(length, sizeof(float));
+  float *a_l = (float *)calloc(length, sizeof(float));
+  float *a_r = (float *)calloc(length, sizeof(float));
+  float *b_l = (float *)calloc(length, sizeof(float));
+  float *b_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(impulse && a_l && a_r && b_l && b_r);
+  impulse[0] = 1.0f;
+
+  AE_ASSERT(diffuser_response(AE_DIFFUSER_VELVET, NULL, impulse, a_l, a_r,
+                              length, AE_MAX_BUFFER_SIZE));
+  AE_ASSERT(diffuser_response(AE_DIFFUSER_VELVET, NULL, impulse, b_l, b_r,
+                              length, 61));
+  float max_diff = 0.0f;
+  float peak = 0.0f;
+  for (size_t i = 0; i < length; ++i) {
+    max_diff = fmaxf(max_diff, fabsf(a_l[i] - b_l[i]));
+    max_diff = fmaxf(max_diff, fabsf(a_r[i] - b_r[i]));
+    peak = fmaxf(peak, fabsf(a_l[i]));
+  }
+  free(impulse);
+  free(a_l);
+  free(a_r);
+  free(b_l);
+  free(b_r);
+
+  AE_ASSERT(peak > 0.0f);
+  AE_ASSERT(max_diff < 1e-5f);
+  AE_TEST_PASS();
+}
+
+void test_velvet_early_echo_density(void) {
+  /* The allpass pair starts as a few sparse echoes; velvet pulses are spread
+   * evenly over the diffuser span from the first millisecond */
+  size_t length = TEST_SR / 4;
+  size_t window = TEST_SR / 100;
+  float *impulse = (float *)calloc(length, sizeof(float));
+  float *out_l = (float *)calloc(length, sizeof(float));
+  float *out_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(impulse && out_l && out_r);
+  impulse[0] = 1.0f;
+
+  float density[2] = {0.0f, 0.0f};
+  ae_diffuser_t modes[2] = {AE_DIFFUSER_ALLPASS, AE_DIFFUSER_VELVET};
+  for (size_t m = 0; m < 2; ++m) {
+    AE_ASSERT(diffuser_response(modes[m], NULL, impulse, out_l, out_r, length,
+                                TEST_BLOCK));
+    size_t onset = 0;
+    while (onset < length - window && fabsf(out_l[onset]) < 1e-7f)
+      ++onset;
+    density[m] = ae_echo_density(out_l + onset, window);
+  }
+  free(impulse);
+  free(out_l);
+  free(out_r);
+
+  AE_ASSERT(density[0] > 0.0f);
+  AE_ASSERT(density[1] > density[0]);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Compact delay storage
+ *============================================================================*/
+
+static int storage_response(ae_delay_storage_t storage, const float *input,
+                            float *out_l, float *out_r, size_t length) {
+  ae_config_t config = ae_get_default_config();
+  config.delay_storage = storage;
+  ae_engine_t *engine = ae_create_engine(&config);
+  if (!engine)
+    return 0;
+  ae_load_preset(engine, "cathedral");
+  ae_precedence_t prec = {12.0f, -6.0f, 0.3f};
+  ae_apply_precedence(engine, &prec);
+  int ok = render(engine, input, out_l, out_r, length, TEST_BLOCK);
+  ae_destroy_engine(engine);
+  return ok;
+}
+
+/* Error energy of a compact format against float32, in dB */
+static float storage_error_db(ae_delay_storage_t storage) {
+  size_t length = TEST_SR / 2;
+  float *noise = (float *)malloc(length * sizeof(float));
+  float *ref_l = (float *)calloc(length, sizeof(float));
+  float *ref_r = (float *)calloc(length, sizeof(float));
+  float *out_l = (float *)calloc(length, sizeof(float));
+  float *out_r = (float *)calloc(length, sizeof(float));
+  float result = INFINITY;
+  if (noise && ref_l && ref_r && out_l && out_r) {
+    srand(9);
+    ae_test_generate_noise(noise, length, 0.3f);
+    if (storage_response(AE_DELAY_STORAGE_FLOAT32, noise, ref_l, ref_r,
+                         length) &&
+        storage_response(storage, noise, out_l, out_r, length)) {
+      float signal = 0.0f;
+      float error = 0.0f;
+      for (size_t i = 0; i < length; ++i) {
+        signal += ref_l[i] * ref_l[i] + ref_r[i] * ref_r[i];
+        float dl = out_l[i] - ref_l[i];
+        float dr = out_r[i] - ref_r[i];
+        error += dl * dl + dr * dr;
+      }
+      if (isfinite(error) && signal > 0.0f)
+        result = 10.0f * log10f(error / signal + 1e-20f);
+    }
+  }
+  free(noise);
+  free(ref_l);
+  free(ref_r);
+  free(out_l);
+  free(out_r);
+  return result;
+}
+
+void test_delay_storage_fp16(void) {
+  /* 11-bit mantissa: the error tracks the signal, around -65 dB */
+  float err = storage_error_db(AE_DELAY_STORAGE_FP16);
+  AE_ASSERT(err < -55.0f);
+  AE_TEST_PASS();
+}
+
+void test_delay_storage_int16(void) {
+  /* Fixed quantization step: error around -50 dB at this level */
+  float err = storage_error_db(AE_DELAY_STORAGE_INT16);
+  AE_ASSERT(err < -40.0f);
+  AE_TEST_PASS();
+}
+
+/* Peak (dBFS) over the last second of a burst followed by silence */
+static float storage_tail_db(ae_delay_storage_t storage, size_t silence) {
+  ae_config_t config = ae_get_default_config();
+  config.delay_storage = storage;
+  ae_engine_t *engine = ae_create_engine(&config);
+  float *input = (float *)calloc(TEST_SR, sizeof(float));
+  float *out_l = (float *)calloc(TEST_SR, sizeof(float));
+  float *out_r = (float *)calloc(TEST_SR, sizeof(float));
+  float peak = INFINITY;
+  if (engine && input && out_l && out_r) {
+    srand(13);
+    ae_test_generate_noise(input, TEST_SR / 10, 0.5f);
+    int ok = render(engine, input, out_l, out_r, TEST_SR, TEST_BLOCK);
+    memset(input, 0, TEST_SR * sizeof(float));
+    for (size_t s = 0; s < silence && ok; ++s)
+      ok = render(engine, input, out_l, out_r, TEST_SR, TEST_BLOCK);
+    if (ok) {
+      peak = 0.0f;
+      for (size_t i = 0; i < TEST_SR; ++i)
+        peak = fmaxf(peak, fmaxf(fabsf(out_l[i]), fabsf(out_r[i])));
+      peak = 20.0f * log10f(peak + 1e-30f);
+    }
+  }
+  ae_destroy_engine(engine);
+  free(input);
+  free(out_l);
+  free(out_r);
+  return peak;
+}
+
+void test_delay_storage_tail_decays(void) {
+  /* Quantizing inside the FDN loop must not sustain a limit cycle: after
+   * 20 s of silence the compact formats are as quiet as float32 */
+  float fp16 = storage_tail_db(AE_DELAY_STORAGE_FP16, 20);
+  float int16 = storage_tail_db(AE_DELAY_STORAGE_INT16, 20);
+  AE_ASSERT(fp16 < -120.0f);
+  AE_ASSERT(int16 < -120.0f);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Geometric early reflections (image sources)
+ *============================================================================*/
+
+static ae_image_source_params_t shoebox_params(uint32_t order) {
+  ae_image_source_params_t params = {
+      /* Off-center so no path grazes an edge of the room */
+      .source = {3.0f, 3.0f, 1.2f},
+      .listener = {7.0f, 5.0f, 1.7f},
+      .listener_yaw_deg = 0.0f,
+      .max_order = order,
+      .temperature_c = 20.0f,
+      .apply_rt60 = false};
+  return params;
+}
+
+void test_image_source_shoebox_first_order(void) {
+  ae_room_geometry_t room;
+  AE_ASSERT_EQ(ae_room_make_shoebox(10.0f, 8.0f, 3.0f, NULL, &room), AE_OK);
+  ae_image_source_params_t params = shoebox_params(1);
+
+  ae_reflection_t refl[16];
+  size_t count = 0;
+  AE_ASSERT_EQ(ae_compute_image_sources(&room, &params, refl, 16, &count),
+               AE_OK);
+  AE_ASSERT_EQ(count, 6);
+
+  /* The floor comes first: image at z = -1.2, listener 4 m right, 2 m ahead */
+  float c = 331.3f + 0.606f * 20.0f;
+  float direct = sqrtf(16.0f + 4.0f + 0.25f);
+  float floor_path = sqrtf(16.0f + 4.0f + 2.9f * 2.9f);
+  AE_ASSERT_FLOAT_EQ(refl[0].delay_ms, 1000.0f * (floor_path - direct) / c,
+                     0.01f);
+  AE_ASSERT_FLOAT_EQ(refl[0].pan, -4.0f / floor_path, 1e-3f);
+  AE_ASSERT(refl[0].gain > 0.0f && refl[0].gain < 1.0f);
+
+  int hard_left = 0;
+  int hard_right = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (i > 0)
+      AE_ASSERT(refl[i].delay_ms >= refl[i - 1].delay_ms);
+    AE_ASSERT_EQ(refl[i].order, 1);
+    hard_left += refl[i].pan < -0.95f;
+    hard_right += refl[i].pan > 0.95f;
+  }
+  /* x = 0 wall behind the source is on the left, x = 10 wall on the right */
+  AE_ASSERT_EQ(hard_left, 1);
+  AE_ASSERT_EQ(hard_right, 1);
+  AE_TEST_PASS();
+}
+
+void test_image_source_shoebox_counts(void) {
+  /* A shoebox has 4n^2 + 2 distinct images of order n, all valid */
+  static const size_t expected[] = {6, 24, 62, 128};
+  ae_room_geometry_t room;
+  ae_room_make_shoebox(10.0f, 8.0f, 3.0f, NULL, &room);
+  ae_reflection_t refl[256];
+  for (uint32_t order = 1; order <= AE_IMAGE_SOURCE_MAX_ORDER; ++order) {
+    ae_image_source_params_t params = shoebox_params(order);
+    size_t count = 0;
+    AE_ASSERT_EQ(ae_compute_image_sources(&room, &params, refl, 256, &count),
+                 AE_OK);
+    AE_ASSERT_EQ(count, expected[order - 1]);
+  }
+  AE_TEST_PASS();
+}
+
+void test_image_source_polyhedral(void) {
+  /* Triangular prism: two side walls meeting at a ridge, floor, two ends */
+  float s = sqrtf(0.5f);
+  ae_room_geometry_t room;
+  memset(&room, 0, sizeof(room));
+  room.plane_count = 5;
+  room.planes[0] = (ae_room_plane_t){{s, 0.0f, -s}, -5.0f * s, 0.1f, 0.0f};
+  room.planes[1] = (ae_room_plane_t){{-s, 0.0f, -s}, -15.0f * s, 0.1f, 0.0f};
+  room.planes[2] = (ae_room_plane_t){{0.0f, 0.0f, 1.0f}, 0.0f, 0.1f, 0.0f};
+  room.planes[3] = (ae_room_plane_t){{0.0f, 1.0f, 0.0f}, 0.0f, 0.1f, 0.0f};
+  room.planes[4] = (ae_room_plane_t){{0.0f, -1.0f, 0.0f}, -8.0f, 0.1f, 0.0f};
+
+  ae_image_source_params_t params = shoebox_params(2);
+  params.source[2] = 1.0f;
+  params.listener[2] = 1.0f;
+  ae_reflection_t refl[64];
+  size_t count = 0;
+  AE_ASSERT_EQ(ae_compute_image_sources(&room, &params, refl, 64, &count),
+               AE_OK);
+  size_t first = 0;
+  for (size_t i = 0; i < count; ++i) {
+    AE_ASSERT(refl[i].delay_ms >= 0.0f);
+    AE_ASSERT(refl[i].gain > 0.0f && refl[i].gain <= 1.0f);
+    first += refl[i].order == 1;
+  }
+  AE_ASSERT_EQ(first, 5);
+  AE_ASSERT(count > first);
+
+  /* Listener above the roof line is rejected */
+  params.listener[2] = 9.0f;
+  AE_ASSERT_EQ(ae_compute_image_sources(&room, &params, refl, 64, &count),
+               AE_ERROR_INVALID_PARAM);
+  AE_TEST_PASS();
+}
+
+static ae_engine_t *create_geometry_engine(void) {
+  ae_engine_t *engine = ae_create_engine(NULL);
+  if (!engine)
+    return NULL;
+  ae_extended_params_t ext = {0.1f, 0.5f, 0.0f, 0.0f};
+  ae_set_extended_params(engine, &ext);
+  ae_set_dry_wet(engine, 1.0f);
+  return engine;
+}
+
+void test_room_geometry_async_swap(void) {
+  ae_engine_t *engine = create_geometry_engine();
+  AE_ASSERT_NOT_NULL(engine);
+  ae_room_geometry_t room;
+  ae_room_make_shoebox(10.0f, 8.0f, 3.0f, NULL, &room);
+  ae_image_source_params_t params = shoebox_params(3);
+  AE_ASSERT_EQ(ae_set_room_geometry(engine, &room, &params), AE_OK);
+  AE_ASSERT_EQ(ae_wait_room_geometry(engine), AE_OK);
+
+  size_t length = TEST_SR / 4;
+  float *impulse = (float *)calloc(length, sizeof(float));
+  float *out_l = (float *)calloc(length, sizeof(float));
+  float *out_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(impulse && out_l && out_r);
+  impulse[0] = 1.0f;
+  AE_ASSERT(render(engine, impulse, out_l, out_r, length, TEST_BLOCK));
+
+  /* The first sound is the floor/ceiling reflection, ahead of the late
+   * reverb's pre-delay and diffusers */
+  ae_reflection_t first;
+  size_t count = 0;
+  ae_compute_image_sources(&room, &params, &first, 1, &count);
+  size_t expected = (size_t)(first.delay_ms * 0.001f * TEST_SR + 0.5f);
+  size_t onset = length;
+  for (size_t i = 0; i < length && onset == length; ++i) {
+    if (fabsf(out_l[i]) > 1e-6f || fabsf(out_r[i]) > 1e-6f)
+      onset = i;
+  }
+  free(impulse);
+  free(out_l);
+  free(out_r);
+  ae_destroy_engine(engine);
+
+  AE_ASSERT_EQ(onset, expected);
+  AE_TEST_PASS();
+}
+
+void test_room_geometry_clear(void) {
+  /* After clearing, the engine renders the room_size taps again once the
+   * install and clear crossfades have run out over silence */
+  size_t length = TEST_SR / 4;
+  size_t lead = 4 * TEST_BLOCK;
+  float *impulse = (float *)calloc(length, sizeof(float));
+  float *silence = (float *)calloc(length, sizeof(float));
+  float *a_l = (float *)calloc(length, sizeof(float));
+  float *a_r = (float *)calloc(length, sizeof(float));
+  float *b_l = (float *)calloc(length, sizeof(float));
+  float *b_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(impulse && silence && a_l && a_r && b_l && b_r);
+  impulse[0] = 1.0f;
+
+  ae_engine_t *plain = create_geometry_engine();
+  ae_engine_t *cleared = create_geometry_engine();
+  AE_ASSERT(plain && cleared);
+  ae_room_geometry_t room;
+  ae_room_make_shoebox(10.0f, 8.0f, 3.0f, NULL, &room);
+  ae_image_source_params_t params = shoebox_params(2);
+  ae_set_room_geometry(cleared, &room, &params);
+  ae_wait_room_geometry(cleared);
+  render(cleared, silence, b_l, b_r, lead, TEST_BLOCK);
+  AE_ASSERT_EQ(ae_clear_room_geometry(cleared), AE_OK);
+  render(cleared, silence, b_l, b_r, lead, TEST_BLOCK);
+  render(plain, silence, a_l, a_r, 2 * lead, TEST_BLOCK);
+
+  render(plain, impulse, a_l, a_r, length, TEST_BLOCK);
+  render(cleared, impulse, b_l, b_r, length, TEST_BLOCK);
+  float max_diff = 0.0f;
+  for (size_t i = 0; i < length; ++i) {
+    max_diff = fmaxf(max_diff, fabsf(a_l[i] - b_l[i]));
+    max_diff = fmaxf(max_diff, fabsf(a_r[i] - b_r[i]));
+  }
+  ae_destroy_engine(plain);
+  ae_destroy_engine(cleared);
+  free(impulse);
+  free(silence);
+  free(a_l);
+  free(a_r);
+  free(b_l);
+  free(b_r);
+
+  AE_ASSERT(max_diff < 1e-6f);
+  AE_TEST_PASS();
+}
+
+void test_room_geometry_moving_listener(void) {
+  /* Updates posted every block while rendering: no stalls, no garbage */
+  ae_engine_t *engine = create_geometry_engine();
+  AE_ASSERT_NOT_NULL(engine);
+  ae_room_geometry_t room;
+  ae_room_make_shoebox(10.0f, 8.0f, 3.0f, NULL, &room);
+
+  size_t length = TEST_SR / 2;
+  float *noise = (float *)malloc(length * sizeof(float));
+  float *out_l = (float *)calloc(length, sizeof(float));
+  float *out_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(noise && out_l && out_r);
+  srand(11);
+  ae_test_generate_noise(noise, length, 0.3f);
+
+  int ok = 1;
+  for (size_t pos = 0; pos < length && ok; pos += TEST_BLOCK) {
+    ae_image_source_params_t params = shoebox_params(4);
+    params.listener[0] = 1.0f + 8.0f * (float)pos / (float)length;
+    params.listener_yaw_deg = 360.0f * (float)pos / (float)length;
+    ok = ae_set_room_geometry(engine, &room, &params) == AE_OK;
+    size_t n = length - pos < TEST_BLOCK ? length - pos : TEST_BLOCK;
+    ok = ok && render(engine, noise + pos, out_l + pos, out_r + pos, n, n);
+  }
+  float energy = 0.0f;
+  for (size_t i = 0; i < length && ok; ++i) {
+    if (!isfinite(out_l[i]) || !isfinite(out_r[i]))
+      ok = 0;
+    energy += out_l[i] * out_l[i] + out_r[i] * out_r[i];
+  }
+  ae_destroy_engine(engine);
+  free(noise);
+  free(out_l);
+  free(out_r);
+
+  AE_ASSERT(ok);
+  AE_ASSERT(energy > 0.0f);
+  AE_TEST_PASS();
+}
+
+/* ER table crossfade length (15 ms) at TEST_SR */
+#define ER_FADE_FRAMES 720
+
+void test_room_geometry_swap_crossfade(void) {
+  /* A new tap table fades in over 15 ms instead of stepping, carried across
+   * blocks: on a DC input every tap settles, so the swap is a level change
+   * spread evenly over the fade */
+  ae_engine_t *engine = create_geometry_engine();
+  AE_ASSERT_NOT_NULL(engine);
+  ae_room_geometry_t room;
+  ae_room_make_shoebox(10.0f, 8.0f, 3.0f, NULL, &room);
+  ae_image_source_params_t params = shoebox_params(2);
+  ae_set_room_geometry(engine, &room, &params);
+  ae_wait_room_geometry(engine);
+
+  size_t settle = TEST_SR;
+  float *dc = (float *)malloc(settle * sizeof(float));
+  float *out_l = (float *)calloc(settle, sizeof(float));
+  float *out_r = (float *)calloc(settle, sizeof(float));
+  AE_ASSERT(dc && out_l && out_r);
+  for (size_t i = 0; i < settle; ++i)
+    dc[i] = 0.25f;
+  AE_ASSERT(render(engine, dc, out_l, out_r, settle, TEST_BLOCK));
+  float before = out_l[settle - 1];
+
+  params.listener[0] = 9.5f;
+  params.listener[1] = 1.0f;
+  ae_set_room_geometry(engine, &room, &params);
+  ae_wait_room_geometry(engine);
+  size_t length = 4 * TEST_BLOCK;
+  AE_ASSERT(render(engine, dc, out_l, out_r, length, TEST_BLOCK));
+  float after = out_l[length - 1];
+  float first_block = out_l[TEST_BLOCK - 1];
+  float max_step = fabsf(out_l[0] - before);
+  for (size_t i = 1; i < length; ++i)
+    max_step = fmaxf(max_step, fabsf(out_l[i] - out_l[i - 1]));
+  ae_destroy_engine(engine);
+  free(dc);
+  free(out_l);
+  free(out_r);
+
+  AE_ASSERT(fabsf(after - before) > 1e-3f);
+  AE_ASSERT(fabsf(first_block - before) < 0.5f * fabsf(after - before));
+  AE_ASSERT(max_step < 2.0f * fabsf(after - before) / ER_FADE_FRAMES);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Lofi Noise
+ *============================================================================*/
+
+/* Wet-only "chaos" render with the given noise seed */
+static int render_lofi(uint32_t seed, const float *input, float *out_l,
+                       float *out_r, size_t length) {
+  ae_config_t config = ae_get_default_config();
+  config.noise_seed = seed;
+  ae_engine_t *engine = ae_create_engine(&config);
+  if (!engine)
+    return 0;
+  ae_load_preset(engine, "chaos");
+  ae_set_dry_wet(engine, 1.0f);
+  int ok = render(engine, input, out_l, out_r, length, TEST_BLOCK);
+  ae_destroy_engine(engine);
+  return ok;
+}
+
+void test_lofi_seed_determinism(void) {
+  /* Equal seeds render bit-identical lofi output; other seeds do not */
+  size_t length = TEST_SR / 4;
+  float *noise = (float *)malloc(length * sizeof(float));
+  float *a_l = (float *)calloc(length, sizeof(float));
+  float *a_r = (float *)calloc(length, sizeof(float));
+  float *b_l = (float *)calloc(length, sizeof(float));
+  float *b_r = (float *)calloc(length, sizeof(float));
+  float *c_l = (float *)calloc(length, sizeof(float));
+  float *c_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(noise && a_l && a_r && b_l && b_r && c_l && c_r);
+  ae_test_generate_noise(noise, length, 0.3f);
+
+  AE_ASSERT(render_lofi(7, noise, a_l, a_r, length));
+  AE_ASSERT(render_lofi(7, noise, b_l, b_r, length));
+  AE_ASSERT(render_lofi(8, noise, c_l, c_r, length));
+
+  int identical = memcmp(a_l, b_l, length * sizeof(float)) == 0 &&
+                  memcmp(a_r, b_r, length * sizeof(float)) == 0;
+  size_t differing = 0;
+  for (size_t i = 0; i < length; ++i) {
+    if (a_l[i] != c_l[i])
+      ++differing;
+  }
+  free(noise);
+  free(a_l);
+  free(a_r);
+  free(b_l);
+  free(b_r);
+  free(c_l);
+  free(c_r);
+
+  AE_ASSERT(identical);
+  AE_ASSERT(differing > 0);
+  AE_TEST_PASS();
+}
+
+void test_lofi_auto_seed_distinct(void) {
+  /* Seed 0 (the default): every engine hisses differently */
+  size_t length = TEST_SR / 4;
+  float *noise = (float *)malloc(length * sizeof(float));
+  float *a_l = (float *)calloc(length, sizeof(float));
+  float *a_r = (float *)calloc(length, sizeof(float));
+  float *b_l = (float *)calloc(length, sizeof(float));
+  float *b_r = (float *)calloc(length, sizeof(float));
+  AE_ASSERT(noise && a_l && a_r && b_l && b_r);
+  ae_test_generate_noise(noise, length, 0.3f);
+
+  AE_ASSERT(render_lofi(0, noise, a_l, a_r, length));
+  AE_ASSERT(render_lofi(0, noise, b_l, b_r, length));
+
+  size_t differing = 0;
+  for (size_t i = 0; i < length; ++i) {
+    if (a_l[i] != b_l[i])
+      ++differing;
+  }
+  free(noise);
+  free(a_l);
+  free(a_r);
+  free(b_l);
+  free(b_r);
+
+  AE_ASSERT(differing > 0);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Tape Wow/Flutter
+ *============================================================================*/
+
+void test_tape_engines_independent(void) {
+  /* Tape state belongs to each engine: two engines processed alternately
+   * match one processed alone, and the wobble changes the signal */
+  enum { BLOCKS = 64 };
+  float in[TEST_BLOCK];
+  float alone[BLOCKS][2 * TEST_BLOCK];
+  float out_b[2 * TEST_BLOCK];
+  float out_c[2 * TEST_BLOCK];
+  ae_engine_t *a = ae_create_engine(NULL);
+  ae_engine_t *b = ae_create_engine(NULL);
+  ae_engine_t *c = ae_create_engine(NULL);
+  ae_engine_t *plain = ae_create_engine(NULL);
+  AE_ASSERT(a && b && c && plain);
+  ae_apply_expression(a, "tape: 1.0");
+  ae_apply_expression(b, "tape: 1.0");
+  ae_apply_expression(c, "tape: 1.0");
+
+  ae_audio_buffer_t input = {.samples = in, .frame_count = TEST_BLOCK,
+                             .channels = 1, .interleaved = true};
+  int matched = 1;
+  float changed = 0.0f;
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int block = 0; block < BLOCKS; ++block) {
+      ae_test_generate_sine(in, TEST_BLOCK, 3000.0f + 17.0f * (float)block,
+                            TEST_SR, 0.5f);
+      if (pass == 0) {
+        ae_audio_buffer_t o = {.samples = alone[block],
+                               .frame_count = TEST_BLOCK, .channels = 2,
+                               .interleaved = true};
+        ae_process(a, &input, &o);
+        ae_audio_buffer_t p = {.samples = out_b, .frame_count = TEST_BLOCK,
+                               .channels = 2, .interleaved = true};
+        ae_process(plain, &input, &p);
+        for (size_t i = 0; i < 2 * TEST_BLOCK; ++i)
+          changed = fmaxf(changed, fabsf(alone[block][i] - out_b[i]));
+        continue;
+      }
+      ae_audio_buffer_t ob = {.samples = out_b, .frame_count = TEST_BLOCK,
+                              .channels = 2, .interleaved = true};
+      ae_audio_buffer_t oc = {.samples = out_c, .frame_count = TEST_BLOCK,
+                              .channels = 2, .interleaved = true};
+      ae_process(b, &input, &ob);
+      ae_process(c, &input, &oc);
+      matched = matched &&
+                memcmp(out_b, alone[block], sizeof(out_b)) == 0 &&
+                memcmp(out_c, alone[block], sizeof(out_c)) == 0;
+    }
+  }
+  ae_destroy_engine(a);
+  ae_destroy_engine(b);
+  ae_destroy_engine(c);
+  ae_destroy_engine(plain);
+
+  AE_ASSERT(matched);
+  AE_ASSERT(changed > 1e-3f);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Main
+ *============================================================================*/
+
+int main(void) {
+  printf("Acoustic Engine - Reverb Tests\n");
+
+  AE_TEST_SUITE_BEGIN("Multi-rate Late Reverb");
+  AE_RUN_TEST(test_reverb_half_rate_tail_energy);
+  AE_RUN_TEST(test_reverb_half_rate_passband);
+  AE_RUN_TEST(test_reverb_auto_rate_odd_blocks);
+  AE_RUN_TEST(test_reverb_auto_rate_keeps_tail);
+  AE_RUN_TEST(test_reverb_auto_rate_switches_under_signal);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Early Reflection Taps");
+  AE_RUN_TEST(test_er_block_size_invariance);
+  AE_RUN_TEST(test_er_dense_taps_energy);
+  AE_RUN_TEST(test_er_zero_taps_is_default);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Velvet-noise Diffuser");
+  AE_RUN_TEST(test_velvet_level_matches_allpass);
+  AE_RUN_TEST(test_velvet_block_size_invariance);
+  AE_RUN_TEST(test_velvet_early_echo_density);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Compact Delay Storage");
+  AE_RUN_TEST(test_delay_storage_fp16);
+  AE_RUN_TEST(test_delay_storage_int16);
+  AE_RUN_TEST(test_delay_storage_tail_decays);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Geometric Early Reflections");
+  AE_RUN_TEST(test_image_source_shoebox_first_order);
+  AE_RUN_TEST(test_image_source_shoebox_counts);
+  AE_RUN_TEST(test_image_source_polyhedral);
+  AE_RUN_TEST(test_room_geometry_async_swap);
+  AE_RUN_TEST(test_room_geometry_clear);
+  AE_RUN_TEST(test_room_geometry_moving_listener);
+  AE_RUN_TEST(test_room_geometry_swap_crossfade);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Lofi Noise");
+  AE_RUN_TEST(test_lofi_seed_determinism);
+  AE_RUN_TEST(test_lofi_auto_seed_distinct);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Tape Wow/Flutter");
+  AE_RUN_TEST(test_tape_engines_independent);
+  AE_TEST_SUITE_END();
+
+  return ae_test_report();
+}
@@ -0,0 +1,1060 @@
+/**
+ * @file test_spatial.c
+ * @brief Tests for binaural rendering and HRIR convolution
+ */
+
+#include "acoustic_engine.h"
+#include "ae_test.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SR 48000
+
+/*============================================================================
+ * Helpers
+ *============================================================================*/
+
+/* Decaying noise, shaped roughly like a measured HRIR */
+static void make_hrir(float *ir, size_t taps, unsigned seed) {
+  srand(seed);
+  for (size_t k = 0; k < taps; ++k) {
+    float decay = expf(-6.0f * (float)k / (float)taps);
+    ir[k] = decay * (2.0f * ((float)rand() / RAND_MAX) - 1.0f);
+  }
+}
+
+static void direct_convolve(const float *x, size_t length, const float *ir,
+                            size_t taps, float *out) {
+  for (size_t n = 0; n < length; ++n) {
+    double sum = 0.0;
+    for (size_t k = 0; k < taps && k <= n; ++k)
+      sum += (double)ir[k] * x[n - k];
+    out[n] = (float)sum;
+  }
+}
+
+/* Max error of the convolver against direct form, in varying block sizes */
+static float convolver_error(size_t taps, uint32_t partition,
+                             const size_t *blocks, size_t block_count) {
+  size_t length = 4096;
+  float *x = (float *)malloc(length * sizeof(float));
+  float *ir_l = (float *)malloc(taps * sizeof(float));
+  float *ir_r = (float *)malloc(taps * sizeof(float));
+  float *ref_l = (float *)malloc(length * sizeof(float));
+  float *ref_r = (float *)malloc(length * sizeof(float));
+  float *out_l = (float *)malloc(length * sizeof(float));
+  float *out_r = (float *)malloc(length * sizeof(float));
+  ae_convolver_config_t config = {.max_taps = (uint32_t)taps,
+                                  .partition_size = partition};
+  ae_convolver_t *conv = ae_convolver_create(&config);
+  float max_err = INFINITY;
+  if (x && ir_l && ir_r && ref_l && ref_r && out_l && out_r && conv) {
+    ae_test_generate_noise(x, length, 0.5f);
+    make_hrir(ir_l, taps, 11);
+    make_hrir(ir_r, taps, 23);
+    direct_convolve(x, length, ir_l, taps, ref_l);
+    direct_convolve(x, length, ir_r, taps, ref_r);
+    ae_convolver_set_filters(conv, ir_l, ir_r, taps);
+    size_t pos = 0;
+    for (size_t b = 0; pos < length; ++b) {
+      size_t n = blocks[b % block_count];
+      if (n > length - pos)
+        n = length - pos;
+      ae_convolver_process(conv, x + pos, out_l + pos, out_r + pos, n);
+      pos += n;
+    }
+    max_err = 0.0f;
+    for (size_t i = 0; i < length; ++i) {
+      max_err = fmaxf(max_err, fabsf(out_l[i] - ref_l[i]));
+      max_err = fmaxf(max_err, fabsf(out_r[i] - ref_r[i]));
+    }
+  }
+  ae_convolver_destroy(conv);
+  free(x);
+  free(ir_l);
+  free(ir_r);
+  free(ref_l);
+  free(ref_r);
+  free(out_l);
+  free(out_r);
+  return max_err;
+}
+
+/*============================================================================
+ * Partitioned convolution
+ *============================================================================*/
+
+void test_convolver_matches_direct(void) {
+  static const size_t taps[] = {1, 48, 64, 65, 200, 256, 512};
+  static const size_t blocks[] = {256};
+  for (size_t t = 0; t < sizeof(taps) / sizeof(taps[0]); ++t) {
+    float err = convolver_error(taps[t], 0, blocks, 1);
+    AE_ASSERT(err < 1e-4f);
+  }
+  AE_TEST_PASS();
+}
+
+void test_convolver_partition_sizes(void) {
+  static const uint32_t partitions[] = {16, 32, 128, 512};
+  static const size_t blocks[] = {256};
+  for (size_t p = 0; p < sizeof(partitions) / sizeof(partitions[0]); ++p) {
+    float err = convolver_error(384, partitions[p], blocks, 1);
+    AE_ASSERT(err < 1e-4f);
+  }
+  AE_TEST_PASS();
+}
+
+void test_convolver_odd_blocks(void) {
+  /* Host blocks that straddle partition boundaries in every way */
+  static const size_t blocks[] = {1, 7, 64, 63, 130, 3, 500};
+  float err = convolver_error(300, 64, blocks, 7);
+  AE_ASSERT(err < 1e-4f);
+  AE_TEST_PASS();
+}
+
+void test_convolver_zero_latency(void) {
+  ae_convolver_config_t config = {.max_taps = 512, .partition_size = 0};
+  ae_convolver_t *conv = ae_convolver_create(&config);
+  AE_ASSERT_NOT_NULL(conv);
+  float ir_l[512] = {0};
+  float ir_r[512] = {0};
+  ir_l[0] = 0.75f;
+  ir_r[0] = -0.5f;
+  ir_r[300] = 0.25f;
+  AE_ASSERT_EQ(ae_convolver_set_filters(conv, ir_l, ir_r, 512), AE_OK);
+
+  float x[512] = {0};
+  float out_l[512];
+  float out_r[512];
+  x[0] = 1.0f;
+  ae_convolver_process(conv, x, out_l, out_r, 512);
+  ae_convolver_destroy(conv);
+
+  AE_ASSERT_FLOAT_EQ(out_l[0], 0.75f, 1e-6f);
+  AE_ASSERT_FLOAT_EQ(out_r[0], -0.5f, 1e-6f);
+  AE_ASSERT_FLOAT_EQ(out_r[300], 0.25f, 1e-5f);
+  AE_ASSERT_FLOAT_EQ(out_r[299], 0.0f, 1e-5f);
+  AE_TEST_PASS();
+}
+
+void test_convolver_in_place(void) {
+  /* Mono input buffer reused as the left output */
+  ae_convolver_config_t config = {.max_taps = 128, .partition_size = 32};
+  ae_convolver_t *conv = ae_convolver_create(&config);
+  AE_ASSERT_NOT_NULL(conv);
+  float ir_l[128];
+  float ir_r[128];
+  make_hrir(ir_l, 128, 5);
+  make_hrir(ir_r, 128, 6);
+  ae_convolver_set_filters(conv, ir_l, ir_r, 128);
+
+  float x[1000];
+  float ref[1000];
+  float buf[1000];
+  float right[1000];
+  ae_test_generate_noise(x, 1000, 0.5f);
+  direct_convolve(x, 1000, ir_l, 128, ref);
+  memcpy(buf, x, sizeof(buf));
+  for (size_t pos = 0; pos < 1000; pos += 100)
+    ae_convolver_process(conv, buf + pos, buf + pos, right + pos, 100);
+  ae_convolver_destroy(conv);
+
+  float max_err = 0.0f;
+  for (size_t i = 0; i < 1000; ++i)
+    max_err = fmaxf(max_err, fabsf(buf[i] - ref[i]));
+  AE_ASSERT(max_err < 1e-4f);
+  AE_TEST_PASS();
+}
+
+void test_convolver_rejects_bad_config(void) {
+  ae_convolver_config_t config = {.max_taps = 256, .partition_size = 48};
+  AE_ASSERT_NULL(ae_convolver_create(&config));
+  config.max_taps = 0;
+  config.partition_size = 64;
+  AE_ASSERT_NULL(ae_convolver_create(&config));
+
+  config.max_taps = 64;
+  ae_convolver_t *conv = ae_convolver_create(&config);
+  AE_ASSERT_NOT_NULL(conv);
+  float ir[128] = {0};
+  AE_ASSERT_EQ(ae_convolver_set_filters(conv, ir, ir, 128),
+               AE_ERROR_INVALID_PARAM);
+  ae_convolver_destroy(conv);
+  AE_TEST_PASS();
+}
+
+void test_convolver_crossfade(void) {
+  /* Polarity flip on DC: an abrupt switch would jump by 1.0 */
+  ae_convolver_config_t config = {.max_taps = 64, .partition_size = 32};
+  ae_convolver_t *conv = ae_convolver_create(&config);
+  AE_ASSERT_NOT_NULL(conv);
+  float pos_ir[64] = {0};
+  float neg_ir[64] = {0};
+  pos_ir[0] = 1.0f;
+  neg_ir[0] = -1.0f;
+  float x[1024];
+  float out_l[1024];
+  float out_r[1024];
+  for (size_t i = 0; i < 1024; ++i)
+    x[i] = 0.5f;
+
+  ae_convolver_set_filters(conv, pos_ir, pos_ir, 64);
+  ae_convolver_process(conv, x, out_l, out_r, 100);
+  AE_ASSERT_FLOAT_EQ(out_l[0], 0.5f, 1e-6f); /* First filters: no fade */
+  ae_convolver_set_filters(conv, neg_ir, neg_ir, 64);
+  ae_convolver_process(conv, x + 100, out_l + 100, out_r + 100, 924);
+  ae_convolver_destroy(conv);
+
+  float max_step = 0.0f;
+  for (size_t i = 1; i < 1024; ++i)
+    max_step = fmaxf(max_step, fabsf(out_l[i] - out_l[i - 1]));
+  AE_ASSERT(max_step < 0.01f);
+  /* Fade starts at the next partition (128) and lasts 256 samples */
+  AE_ASSERT_FLOAT_EQ(out_l[127], 0.5f, 1e-6f);
+  AE_ASSERT_FLOAT_EQ(out_r[383], -0.5f, 1e-6f);
+  AE_ASSERT_FLOAT_EQ(out_l[1023], -0.5f, 1e-6f);
+  AE_TEST_PASS();
+}
+
+void test_convolver_switch_matches_direct(void) {
+  /* Long filters, so the FFT partitions are faded as well as the head */
+  size_t taps = 300;
+  size_t length = 2048;
+  ae_convolver_config_t config = {.max_taps = 300, .partition_size = 64};
+  ae_convolver_t *conv = ae_convolver_create(&config);
+  AE_ASSERT_NOT_NULL(conv);
+  float *x = (float *)malloc(length * sizeof(float));
+  float *ir_a = (float *)malloc(taps * sizeof(float));
+  float *ir_b = (float *)malloc(taps * sizeof(float));
+  float *ir_c = (float *)malloc(taps * sizeof(float));
+  float *ref_a = (float *)malloc(length * sizeof(float));
+  float *ref_c = (float *)malloc(length * sizeof(float));
+  float *out_l = (float *)malloc(length * sizeof(float));
+  float *out_r = (float *)malloc(length * sizeof(float));
+  AE_ASSERT(x && ir_a && ir_b && ir_c && ref_a && ref_c && out_l && out_r);
+  ae_test_generate_noise(x, length, 0.5f);
+  make_hrir(ir_a, taps, 31);
+  make_hrir(ir_b, taps, 32);
+  make_hrir(ir_c, taps, 33);
+  direct_convolve(x, length, ir_a, taps, ref_a);
+  direct_convolve(x, length, ir_c, taps, ref_c);
+
+  ae_convolver_set_filters(conv, ir_a, ir_a, taps);
+  ae_convolver_process(conv, x, out_l, out_r, 1000);
+  /* Published twice before the audio thread looks: only the last counts */
+  ae_convolver_set_filters(conv, ir_b, ir_b, taps);
+  ae_convolver_set_filters(conv, ir_c, ir_c, taps);
+  ae_convolver_process(conv, x + 1000, out_l + 1000, out_r + 1000,
+                       length - 1000);
+  ae_convolver_destroy(conv);
+
+  /* Fade runs from 1024 to 1280 */
+  float err_a = 0.0f;
+  float err_c = 0.0f;
+  for (size_t i = 0; i < 1024; ++i)
+    err_a = fmaxf(err_a, fabsf(out_l[i] - ref_a[i]));
+  for (size_t i = 1280; i < length; ++i)
+    err_c = fmaxf(err_c, fabsf(out_r[i] - ref_c[i]));
+  AE_ASSERT(err_a < 1e-4f);
+  AE_ASSERT(err_c < 1e-4f);
+
+  free(x);
+  free(ir_a);
+  free(ir_b);
+  free(ir_c);
+  free(ref_a);
+  free(ref_c);
+  free(out_l);
+  free(out_r);
+  AE_TEST_PASS();
+}
+
+void test_convolver_group_matches_single(void) {
+  /* A full batch of eight, a partition size that breaks the run, a batch
+   * of two, and filter switches part way through */
+  enum { COUNT = 12, TAPS = 200, LENGTH = 2048 };
+  static const size_t blocks[] = {100, 37, 256, 5};
+  ae_convolver_t *group[COUNT];
+  ae_convolver_t *single[COUNT];
+  float *x = (float *)malloc(COUNT * LENGTH * sizeof(float));
+  float *ir = (float *)malloc(2 * COUNT * TAPS * sizeof(float));
+  float *out = (float *)malloc(4 * COUNT * LENGTH * sizeof(float));
+  AE_ASSERT(x && ir && out);
+  ae_test_generate_noise(x, COUNT * LENGTH, 0.5f);
+  for (size_t c = 0; c < 2 * COUNT; ++c)
+    make_hrir(ir + c * TAPS, TAPS, 40 + (unsigned)c);
+
+  const float *inputs[COUNT];
+  float *group_l[COUNT], *group_r[COUNT], *single_l[COUNT], *single_r[COUNT];
+  for (size_t c = 0; c < COUNT; ++c) {
+    ae_convolver_config_t config = {.max_taps = TAPS,
+                                    .partition_size = c == 9 ? 64 : 32};
+    group[c] = ae_convolver_create(&config);
+    single[c] = ae_convolver_create(&config);
+    AE_ASSERT(group[c] && single[c]);
+    const float *ir_c = ir + 2 * c * TAPS;
+    ae_convolver_set_filters(group[c], ir_c, ir_c + TAPS, TAPS);
+    ae_convolver_set_filters(single[c], ir_c, ir_c + TAPS, TAPS);
+    group_l[c] = out + (4 * c) * LENGTH;
+    group_r[c] = out + (4 * c + 1) * LENGTH;
+    single_l[c] = out + (4 * c + 2) * LENGTH;
+    single_r[c] = out + (4 * c + 3) * LENGTH;
+  }
+
+  size_t pos = 0;
+  for (size_t b = 0; pos < LENGTH; ++b) {
+    size_t n = blocks[b % 4];
+    if (n > LENGTH - pos)
+      n = LENGTH - pos;
+    if (b == 6) {
+      for (size_t c = 0; c < COUNT; c += 2) {
+        const float *next = ir + 2 * ((c + 1) % COUNT) * TAPS;
+        ae_convolver_set_filters(group[c], next, next + TAPS, TAPS);
+        ae_convolver_set_filters(single[c], next, next + TAPS, TAPS);
+      }
+    }
+    float *gl[COUNT], *gr[COUNT];
+    for (size_t c = 0; c < COUNT; ++c) {
+      inputs[c] = x + c * LENGTH + pos;
+      gl[c] = group_l[c] + pos;
+      gr[c] = group_r[c] + pos;
+      ae_convolver_process(single[c], inputs[c], single_l[c] + pos,
+                           single_r[c] + pos, n);
+    }
+    AE_ASSERT_EQ(ae_convolver_process_group(group, inputs, gl, gr, COUNT, n),
+                 AE_OK);
+    pos += n;
+  }
+
+  float max_diff = 0.0f;
+  for (size_t c = 0; c < COUNT; ++c) {
+    for (size_t i = 0; i < LENGTH; ++i) {
+      max_diff = fmaxf(max_diff, fabsf(group_l[c][i] - single_l[c][i]));
+      max_diff = fmaxf(max_diff, fabsf(group_r[c][i] - single_r[c][i]));
+    }
+    ae_convolver_destroy(group[c]);
+    ae_convolver_destroy(single[c]);
+  }
+  AE_ASSERT(max_diff < 1e-5f);
+  free(x);
+  free(ir);
+  free(out);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Ambisonics
+ *============================================================================*/
+
+#define AMBI_SPEAKERS 62
+#define AMBI_TAPS 4
+#define AMBI_BLOCK 256
+
+/* Left component of a direction (positive azimuth to the right) */
+static float ambi_left(float az_deg, float el_deg) {
+  float az = az_deg * (float)M_PI / 180.0f;
+  return -cosf(el_deg * (float)M_PI / 180.0f) * sinf(az);
+}
+
+/*
+ * Virtual speakers whose "HRIRs" are bare gains: the left ear hears
+ * (1 + left) / 2 and the right ear (1 - left) / 2. Both are first-order
+ * patterns, so any decoder of order >= 1 must reproduce them exactly.
+ */
+static ae_ambisonic_bus_t *ambi_create(uint32_t order) {
+  float az[AMBI_SPEAKERS];
+  float el[AMBI_SPEAKERS];
+  float hrirs_l[AMBI_SPEAKERS * AMBI_TAPS] = {0};
+  float hrirs_r[AMBI_SPEAKERS * AMBI_TAPS] = {0};
+  size_t s = 0;
+  for (int ring = -2; ring <= 2; ++ring) {
+    for (int a = 0; a < 12; ++a) {
+      az[s] = (float)(a * 30 - 180);
+      el[s] = (float)(ring * 30);
+      ++s;
+    }
+  }
+  az[s] = 0.0f;
+  el[s++] = 90.0f;
+  az[s] = 0.0f;
+  el[s++] = -90.0f;
+  for (s = 0; s < AMBI_SPEAKERS; ++s) {
+    float left = ambi_left(az[s], el[s]);
+    hrirs_l[s * AMBI_TAPS] = 0.5f * (1.0f + left);
+    hrirs_r[s * AMBI_TAPS] = 0.5f * (1.0f - left);
+  }
+  ae_ambisonic_config_t config = {.order = order,
+                                  .max_frames = AMBI_BLOCK,
+                                  .max_taps = AMBI_TAPS,
+                                  .partition_size = 0};
+  ae_ambisonic_bus_t *bus = ae_ambisonic_bus_create(&config);
+  if (bus && ae_ambisonic_set_decoder(bus, az, el, hrirs_l, hrirs_r,
+                                      AMBI_SPEAKERS, AMBI_TAPS) != AE_OK) {
+    ae_ambisonic_bus_destroy(bus);
+    bus = NULL;
+  }
+  return bus;
+}
+
+/* Decode one block of DC from a single source; returns the last sample */
+static void ambi_render(ae_ambisonic_bus_t *bus, uint32_t order, float az,
+                        float el, float *left, float *right) {
+  float x[AMBI_BLOCK];
+  float out_l[AMBI_BLOCK];
+  float out_r[AMBI_BLOCK];
+  float gains[16];
+  for (size_t i = 0; i < AMBI_BLOCK; ++i)
+    x[i] = 1.0f;
+  ae_ambisonic_gains(order, az, el, gains);
+  ae_ambisonic_encode(bus, x, AMBI_BLOCK, gains, NULL);
+  ae_ambisonic_decode(bus, out_l, out_r, AMBI_BLOCK);
+  *left = out_l[AMBI_BLOCK - 1];
+  *right = out_r[AMBI_BLOCK - 1];
+}
+
+void test_ambisonic_gains(void) {
+  float g[16];
+  AE_ASSERT_EQ(ae_ambisonic_gains(3, 0.0f, 0.0f, g), AE_OK);
+  AE_ASSERT_FLOAT_EQ(g[0], 1.0f, 1e-6f); /* W */
+  AE_ASSERT_FLOAT_EQ(g[1], 0.0f, 1e-6f); /* Y */
+  AE_ASSERT_FLOAT_EQ(g[2], 0.0f, 1e-6f); /* Z */
+  AE_ASSERT_FLOAT_EQ(g[3], 1.0f, 1e-6f); /* X */
+  ae_ambisonic_gains(1, -90.0f, 0.0f, g);
+  AE_ASSERT_FLOAT_EQ(g[1], 1.0f, 1e-6f); /* Negative azimuth is left */
+  ae_ambisonic_gains(2, 0.0f, 90.0f, g);
+  AE_ASSERT_FLOAT_EQ(g[2], 1.0f, 1e-6f);
+  AE_ASSERT_FLOAT_EQ(g[6], 1.0f, 1e-6f);
+  AE_ASSERT_EQ(ae_ambisonic_gains(4, 0.0f, 0.0f, g), AE_ERROR_INVALID_PARAM);
+  AE_TEST_PASS();
+}
+
+void test_ambisonic_decode_direction(void) {
+  for (uint32_t order = 1; order <= 3; ++order) {
+    ae_ambisonic_bus_t *bus = ambi_create(order);
+    AE_ASSERT_NOT_NULL(bus);
+    static const float az[] = {-90.0f, 90.0f, 0.0f, -30.0f, 135.0f};
+    static const float el[] = {0.0f, 0.0f, 0.0f, 20.0f, -45.0f};
+    for (size_t k = 0; k < 5; ++k) {
+      float left, right;
+      ambi_render(bus, order, az[k], el[k], &left, &right);
+      float expect = ambi_left(az[k], el[k]);
+      AE_ASSERT_FLOAT_EQ(left, 0.5f * (1.0f + expect), 1e-2f);
+      AE_ASSERT_FLOAT_EQ(right, 0.5f * (1.0f - expect), 1e-2f);
+    }
+    ae_ambisonic_bus_destroy(bus);
+  }
+  AE_TEST_PASS();
+}
+
+void test_ambisonic_many_sources(void) {
+  /* One decode for 64 sources equals the sum of their single renders */
+  ae_ambisonic_bus_t *bus = ambi_create(3);
+  AE_ASSERT_NOT_NULL(bus);
+  float x[AMBI_BLOCK];
+  float out_l[AMBI_BLOCK];
+  float out_r[AMBI_BLOCK];
+  float gains[16];
+  for (size_t i = 0; i < AMBI_BLOCK; ++i)
+    x[i] = 1.0f;
+  float expect_l = 0.0f;
+  for (int k = 0; k < 64; ++k) {
+    float az = (float)(k * 37 % 360) - 180.0f;
+    float el = (float)(k * 23 % 120) - 60.0f;
+    ae_ambisonic_gains(3, az, el, gains);
+    for (size_t c = 0; c < 16; ++c)
+      gains[c] *= 1.0f / 64.0f;
+    ae_ambisonic_encode(bus, x, AMBI_BLOCK, gains, NULL);
+    expect_l += 0.5f * (1.0f + ambi_left(az, el)) / 64.0f;
+  }
+  ae_ambisonic_decode(bus, out_l, out_r, AMBI_BLOCK);
+  AE_ASSERT_FLOAT_EQ(out_l[AMBI_BLOCK - 1], expect_l, 1e-2f);
+  AE_ASSERT_FLOAT_EQ(out_l[AMBI_BLOCK - 1] + out_r[AMBI_BLOCK - 1], 1.0f,
+                     1e-2f);
+
+  /* The bus is cleared by decode */
+  ae_ambisonic_decode(bus, out_l, out_r, AMBI_BLOCK);
+  AE_ASSERT_FLOAT_EQ(out_l[AMBI_BLOCK - 1], 0.0f, 1e-6f);
+  ae_ambisonic_bus_destroy(bus);
+  AE_TEST_PASS();
+}
+
+void test_ambisonic_rotation(void) {
+  ae_ambisonic_bus_t *bus = ambi_create(3);
+  AE_ASSERT_NOT_NULL(bus);
+  float left, right;
+
+  /* Turning right puts a frontal source on the left */
+  ae_ambisonic_set_rotation(bus, 90.0f, 0.0f, 0.0f);
+  ambi_render(bus, 3, 0.0f, 0.0f, &left, &right); /* Ramps in */
+  ambi_render(bus, 3, 0.0f, 0.0f, &left, &right);
+  AE_ASSERT_FLOAT_EQ(left, 1.0f, 1e-2f);
+  AE_ASSERT_FLOAT_EQ(right, 0.0f, 1e-2f);
+
+  /* Right ear down: a source overhead is heard on the left */
+  ae_ambisonic_set_rotation(bus, 0.0f, 0.0f, 90.0f);
+  ambi_render(bus, 3, 0.0f, 90.0f, &left, &right);
+  ambi_render(bus, 3, 0.0f, 90.0f, &left, &right);
+  AE_ASSERT_FLOAT_EQ(left, 1.0f, 1e-2f);
+
+  /* Looking up moves a source on the left nowhere */
+  ae_ambisonic_set_rotation(bus, 0.0f, 60.0f, 0.0f);
+  ambi_render(bus, 3, -90.0f, 0.0f, &left, &right);
+  ambi_render(bus, 3, -90.0f, 0.0f, &left, &right);
+  AE_ASSERT_FLOAT_EQ(left, 1.0f, 1e-2f);
+  ae_ambisonic_bus_destroy(bus);
+  AE_TEST_PASS();
+}
+
+void test_ambisonic_gain_ramp(void) {
+  /* A source panned hard left to hard right within one block */
+  ae_ambisonic_bus_t *bus = ambi_create(1);
+  AE_ASSERT_NOT_NULL(bus);
+  float x[AMBI_BLOCK];
+  float out_l[AMBI_BLOCK];
+  float out_r[AMBI_BLOCK];
+  float from[4];
+  float to[4];
+  for (size_t i = 0; i < AMBI_BLOCK; ++i)
+    x[i] = 1.0f;
+  ae_ambisonic_gains(1, -90.0f, 0.0f, from);
+  ae_ambisonic_gains(1, 90.0f, 0.0f, to);
+  ae_ambisonic_encode(bus, x, AMBI_BLOCK, to, from);
+  ae_ambisonic_decode(bus, out_l, out_r, AMBI_BLOCK);
+  ae_ambisonic_bus_destroy(bus);
+
+  float max_step = 0.0f;
+  for (size_t i = 1; i < AMBI_BLOCK; ++i)
+    max_step = fmaxf(max_step, fabsf(out_l[i] - out_l[i - 1]));
+  AE_ASSERT(max_step < 0.01f);
+  AE_ASSERT_FLOAT_EQ(out_l[0], 1.0f, 1e-2f);
+  AE_ASSERT_FLOAT_EQ(out_r[AMBI_BLOCK - 1], 1.0f, 1e-2f);
+  AE_TEST_PASS();
+}
+
+void test_ambisonic_rejects_bad_config(void) {
+  ae_ambisonic_config_t config = {.order = 0, .max_frames = 256,
+                                  .max_taps = 64};
+  AE_ASSERT_NULL(ae_ambisonic_bus_create(&config));
+  config.order = 4;
+  AE_ASSERT_NULL(ae_ambisonic_bus_create(&config));
+  config.order = 2;
+  ae_ambisonic_bus_t *bus = ae_ambisonic_bus_create(&config);
+  AE_ASSERT_NOT_NULL(bus);
+
+  /* Second order needs at least nine speakers */
+  float angles[8] = {0};
+  float hrirs[8 * 64] = {0};
+  AE_ASSERT_EQ(
+      ae_ambisonic_set_decoder(bus, angles, angles, hrirs, hrirs, 8, 64),
+      AE_ERROR_INVALID_PARAM);
+  float x[512] = {0};
+  float gains[9] = {0};
+  AE_ASSERT_EQ(ae_ambisonic_encode(bus, x, 512, gains, NULL),
+               AE_ERROR_BUFFER_TOO_SMALL);
+  ae_ambisonic_bus_destroy(bus);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Built-in HRTF
+ *============================================================================*/
+
+/* Impulse response of an engine's dry path, 256-frame blocks */
+static void render_engine(ae_engine_t *engine, float *out_l, float *out_r,
+                          size_t length) {
+  float in_buf[256] = {0};
+  float out_buf[512];
+  in_buf[0] = 1.0f;
+  for (size_t pos = 0; pos < length; pos += 256) {
+    ae_audio_buffer_t in = {.samples = in_buf, .frame_count = 256,
+                            .channels = 1, .interleaved = true};
+    ae_audio_buffer_t out = {.samples = out_buf, .frame_count = 256,
+                             .channels = 2, .interleaved = true};
+    ae_process(engine, &in, &out);
+    in_buf[0] = 0.0f;
+    for (size_t i = 0; i < 256 && pos + i < length; ++i) {
+      out_l[pos + i] = out_buf[2 * i];
+      out_r[pos + i] = out_buf[2 * i + 1];
+    }
+  }
+}
+
+/* Impulse through a built-in HRTF engine, dry path only, source at az */
+static int render_impulse(float az, float *out_l, float *out_r,
+                          size_t length) {
+  ae_config_t config = ae_get_default_config();
+  config.binaural = AE_BINAURAL_BUILTIN_HRTF;
+  ae_engine_t *engine = ae_create_engine(&config);
+  if (!engine)
+    return 0;
+  ae_set_dry_wet(engine, 0.0f);
+  ae_set_source_position(engine, az, 0.0f);
+  render_engine(engine, out_l, out_r, length);
+  ae_destroy_engine(engine);
+  return 1;
+}
+
+static size_t first_arrival(const float *x, size_t length) {
+  float peak = 0.0f;
+  for (size_t i = 0; i < length; ++i)
+    peak = fmaxf(peak, fabsf(x[i]));
+  for (size_t i = 0; i < length; ++i) {
+    if (fabsf(x[i]) > 0.1f * peak)
+      return i;
+  }
+  return length;
+}
+
+static float energy(const float *x, size_t length) {
+  float sum = 0.0f;
+  for (size_t i = 0; i < length; ++i)
+    sum += x[i] * x[i];
+  return sum;
+}
+
+void test_default_hrtf_lateral(void) {
+  float out_l[512];
+  float out_r[512];
+  AE_ASSERT(render_impulse(90.0f, out_l, out_r, 512));
+  float ild_db = 10.0f * log10f(energy(out_r, 512) / energy(out_l, 512));
+  AE_ASSERT(ild_db > 6.0f);
+  /* Far ear late by roughly the head's ITD (~0.65 ms) */
+  float itd_ms =
+      (float)(first_arrival(out_l, 512) - first_arrival(out_r, 512)) *
+      1000.0f / 48000.0f;
+  AE_ASSERT(itd_ms > 0.4f && itd_ms < 0.9f);
+  AE_TEST_PASS();
+}
+
+void test_default_hrtf_symmetry(void) {
+  float front_l[512];
+  float front_r[512];
+  float left_l[512];
+  float left_r[512];
+  float right_l[512];
+  float right_r[512];
+  AE_ASSERT(render_impulse(0.0f, front_l, front_r, 512));
+  AE_ASSERT(render_impulse(-60.0f, left_l, left_r, 512));
+  AE_ASSERT(render_impulse(60.0f, right_l, right_r, 512));
+  float max_diff = 0.0f;
+  for (size_t i = 0; i < 512; ++i) {
+    max_diff = fmaxf(max_diff, fabsf(front_l[i] - front_r[i]));
+    max_diff = fmaxf(max_diff, fabsf(left_l[i] - right_r[i]));
+    max_diff = fmaxf(max_diff, fabsf(left_r[i] - right_l[i]));
+  }
+  AE_ASSERT(max_diff < 1e-5f);
+  AE_ASSERT(energy(front_l, 512) > 0.1f);
+  AE_TEST_PASS();
+}
+
+void test_hrtf_cache_missing_source(void) {
+  /* Nothing to hash or cache: the built-in set, with the failure noted */
+  ae_config_t config = ae_get_default_config();
+  config.hrtf_path = "missing_hrtf.sofa";
+  config.hrtf_cache_dir = ".";
+  config.hrir_max_taps = 64;
+  ae_engine_t *engine = ae_create_engine(&config);
+  AE_ASSERT_NOT_NULL(engine);
+  AE_ASSERT_NOT_NULL(ae_get_last_error_detail(engine));
+
+  float in_buf[256] = {1.0f};
+  float out_buf[512];
+  ae_set_dry_wet(engine, 0.0f);
+  ae_set_source_position(engine, 90.0f, 0.0f);
+  ae_audio_buffer_t in = {.samples = in_buf, .frame_count = 256,
+                          .channels = 1, .interleaved = true};
+  ae_audio_buffer_t out = {.samples = out_buf, .frame_count = 256,
+                           .channels = 2, .interleaved = true};
+  AE_ASSERT_EQ(ae_process(engine, &in, &out), AE_OK);
+  float energy_l = 0.0f;
+  float energy_r = 0.0f;
+  for (size_t i = 0; i < 256; ++i) {
+    energy_l += out_buf[2 * i] * out_buf[2 * i];
+    energy_r += out_buf[2 * i + 1] * out_buf[2 * i + 1];
+  }
+  AE_ASSERT(energy_r > 4.0f * energy_l);
+  ae_destroy_engine(engine);
+  AE_TEST_PASS();
+}
+
+typedef struct {
+  int calls;
+  ae_result_t result;
+} load_status_t;
+
+static void on_hrtf_loaded(ae_engine_t *engine, ae_result_t result,
+                           void *user_data) {
+  (void)engine;
+  load_status_t *status = (load_status_t *)user_data;
+  status->calls++;
+  status->result = result;
+}
+
+void test_hrtf_lazy_load_matches_preload(void) {
+  /* Not preloaded: the first update starts a background load, and once it
+   * lands the output is the preloaded engine's */
+  float pre_l[512];
+  float pre_r[512];
+  AE_ASSERT(render_impulse(0.0f, pre_l, pre_r, 512));
+
+  ae_config_t config = ae_get_default_config();
+  config.binaural = AE_BINAURAL_BUILTIN_HRTF;
+  config.preload_hrtf = false;
+  ae_engine_t *engine = ae_create_engine(&config);
+  AE_ASSERT_NOT_NULL(engine);
+  ae_set_dry_wet(engine, 0.0f);
+  AE_ASSERT_EQ(ae_set_source_position(engine, 0.0f, 0.0f), AE_OK);
+  AE_ASSERT_EQ(ae_hrtf_wait(engine), AE_OK);
+
+  float out_l[512];
+  float out_r[512];
+  render_engine(engine, out_l, out_r, 512);
+  float max_diff = 0.0f;
+  for (size_t i = 0; i < 512; ++i) {
+    max_diff = fmaxf(max_diff, fabsf(out_l[i] - pre_l[i]));
+    max_diff = fmaxf(max_diff, fabsf(out_r[i] - pre_r[i]));
+  }
+  AE_ASSERT(max_diff < 1e-6f);
+  ae_destroy_engine(engine);
+  AE_TEST_PASS();
+}
+
+void test_default_binaural_is_parametric(void) {
+  /* No hrtf_path and no model chosen: ITD/ILD as given, preloaded or not,
+   * and no background load */
+  const ae_binaural_params_t params = {500.0f, 6.0f, 0.0f, 0.0f};
+  for (int preload = 0; preload < 2; ++preload) {
+    ae_config_t config = ae_get_default_config();
+    config.preload_hrtf = preload != 0;
+    ae_engine_t *engine = ae_create_engine(&config);
+    AE_ASSERT_NOT_NULL(engine);
+    ae_set_dry_wet(engine, 0.0f);
+    AE_ASSERT_EQ(ae_set_binaural_params(engine, &params), AE_OK);
+    AE_ASSERT_EQ(ae_hrtf_wait(engine), AE_OK);
+
+    float out_l[512];
+    float out_r[512];
+    render_engine(engine, out_l, out_r, 512);
+    /* 500 us is 24 samples at 48 kHz, the left ear late */
+    AE_ASSERT_EQ(first_arrival(out_l, 512) - first_arrival(out_r, 512), 24);
+    float ild_db = 10.0f * log10f(energy(out_r, 512) / energy(out_l, 512));
+    AE_ASSERT(fabsf(ild_db - 6.0f) < 0.1f);
+    ae_destroy_engine(engine);
+  }
+  AE_TEST_PASS();
+}
+
+void test_hrtf_load_async_callback(void) {
+  ae_config_t config = ae_get_default_config();
+  config.preload_hrtf = false;
+  ae_engine_t *engine = ae_create_engine(&config);
+  AE_ASSERT_NOT_NULL(engine);
+  ae_set_dry_wet(engine, 0.0f);
+  ae_set_source_position(engine, 90.0f, 0.0f);
+
+  load_status_t status = {0, AE_OK};
+  AE_ASSERT_EQ(ae_hrtf_load_async(engine, NULL, on_hrtf_loaded, &status),
+               AE_OK);
+  AE_ASSERT_EQ(ae_hrtf_wait(engine), AE_OK);
+  AE_ASSERT_EQ(status.calls, 1);
+  AE_ASSERT_EQ(status.result, AE_OK);
+
+  /* A file that cannot load reports failure and keeps the current set */
+  load_status_t failed = {0, AE_OK};
+  AE_ASSERT_EQ(ae_hrtf_load_async(engine, "missing_hrtf.sofa",
+                                  on_hrtf_loaded, &failed),
+               AE_OK);
+  AE_ASSERT_EQ(ae_hrtf_wait(engine), AE_OK);
+  AE_ASSERT_EQ(failed.calls, 1);
+  AE_ASSERT_EQ(failed.result, AE_ERROR_HRTF_LOAD_FAILED);
+
+  float out_l[512];
+  float out_r[512];
+  render_engine(engine, out_l, out_r, 512);
+  float itd_ms =
+      (float)(first_arrival(out_l, 512) - first_arrival(out_r, 512)) *
+      1000.0f / 48000.0f;
+  AE_ASSERT(itd_ms > 0.4f && itd_ms < 0.9f);
+  AE_ASSERT(energy(out_r, 512) > 4.0f * energy(out_l, 512));
+
+  AE_ASSERT_EQ(ae_hrtf_load_async(NULL, NULL, NULL, NULL),
+               AE_ERROR_INVALID_PARAM);
+  ae_destroy_engine(engine);
+  AE_TEST_PASS();
+}
+
+void test_hrtf_db_shared(void) {
+  /* Engines on one shared set render exactly like an engine that loaded
+   * its own, and keep the set alive after the creator lets go */
+  float own_l[512];
+  float own_r[512];
+  AE_ASSERT(render_impulse(60.0f, own_l, own_r, 512));
+
+  ae_hrtf_db_t *db = ae_hrtf_db_create(NULL);
+  AE_ASSERT_NOT_NULL(db);
+  ae_config_t config = ae_get_default_config();
+  config.hrtf_db = db;
+  config.preload_hrtf = false;
+  ae_engine_t *engines[2];
+  for (int e = 0; e < 2; ++e) {
+    engines[e] = ae_create_engine(&config);
+    AE_ASSERT_NOT_NULL(engines[e]);
+  }
+  ae_hrtf_db_release(db);
+
+  for (int e = 0; e < 2; ++e) {
+    float out_l[512];
+    float out_r[512];
+    ae_set_dry_wet(engines[e], 0.0f);
+    ae_set_source_position(engines[e], 60.0f, 0.0f);
+    render_engine(engines[e], out_l, out_r, 512);
+    float max_diff = 0.0f;
+    for (size_t i = 0; i < 512; ++i) {
+      max_diff = fmaxf(max_diff, fabsf(out_l[i] - own_l[i]));
+      max_diff = fmaxf(max_diff, fabsf(out_r[i] - own_r[i]));
+    }
+    AE_ASSERT(max_diff < 1e-6f);
+    ae_destroy_engine(engines[e]);
+  }
+  AE_TEST_PASS();
+}
+
+void test_hrtf_builtin_db_expanded_once(void) {
+  /* Every request for the built-in set at the engine rate gets the same
+   * process-wide copy, which outlives all of its users */
+  ae_hrtf_db_t *first = ae_hrtf_db_create(NULL);
+  ae_hrtf_db_t *second = ae_hrtf_db_create(NULL);
+  AE_ASSERT_NOT_NULL(first);
+  AE_ASSERT(first == second);
+  ae_hrtf_db_release(first);
+  ae_hrtf_db_release(second);
+
+  float before_l[512];
+  float before_r[512];
+  float after_l[512];
+  float after_r[512];
+  AE_ASSERT(render_impulse(30.0f, before_l, before_r, 512));
+  ae_hrtf_db_t *again = ae_hrtf_db_create(NULL);
+  AE_ASSERT(again == first);
+  ae_hrtf_db_release(again);
+  AE_ASSERT(render_impulse(30.0f, after_l, after_r, 512));
+  AE_ASSERT(memcmp(before_l, after_l, sizeof(before_l)) == 0);
+  AE_ASSERT(memcmp(before_r, after_r, sizeof(before_r)) == 0);
+  AE_TEST_PASS();
+}
+
+void test_hrtf_db_rejects_mismatch(void) {
+  ae_hrtf_db_config_t db_config = {NULL, 44100, 0, NULL};
+  ae_hrtf_db_t *db = ae_hrtf_db_create(&db_config);
+  AE_ASSERT_NOT_NULL(db);
+  ae_config_t config = ae_get_default_config();
+  ae_engine_t *engine = ae_create_engine(&config);
+  AE_ASSERT_NOT_NULL(engine);
+  AE_ASSERT_EQ(ae_hrtf_set_db(engine, db), AE_ERROR_INVALID_PARAM);
+  AE_ASSERT_EQ(ae_hrtf_set_db(engine, NULL), AE_ERROR_INVALID_PARAM);
+
+  /* A shared set swapped into a running engine */
+  ae_hrtf_db_t *shared = ae_hrtf_db_create(NULL);
+  AE_ASSERT_NOT_NULL(shared);
+  AE_ASSERT_EQ(ae_hrtf_set_db(engine, shared), AE_OK);
+  ae_hrtf_db_release(shared);
+  ae_hrtf_db_release(db);
+  ae_destroy_engine(engine);
+
+  ae_hrtf_db_config_t missing = {"missing_hrtf.sofa", 0, 0, NULL};
+  AE_ASSERT_NULL(ae_hrtf_db_create(&missing));
+  AE_TEST_PASS();
+}
+
+void test_process_group_matches_process(void) {
+  /* Binaural engines batched, plus one that never placed its source */
+  enum { ENGINES = 6, FRAMES = 256 };
+  ae_engine_t *group[ENGINES];
+  ae_engine_t *solo[ENGINES];
+  ae_config_t config = ae_get_default_config();
+  for (size_t e = 0; e < ENGINES; ++e) {
+    group[e] = ae_create_engine(&config);
+    solo[e] = ae_create_engine(&config);
+    AE_ASSERT(group[e] && solo[e]);
+    ae_set_dry_wet(group[e], 0.0f);
+    ae_set_dry_wet(solo[e], 0.0f);
+    if (e + 1 < ENGINES) {
+      ae_set_source_position(group[e], (float)e * 50.0f - 120.0f, 10.0f);
+      ae_set_source_position(solo[e], (float)e * 50.0f - 120.0f, 10.0f);
+    }
+  }
+
+  static float in[ENGINES][FRAMES];
+  static float group_out[ENGINES][2 * FRAMES];
+  float solo_out[2 * FRAMES];
+  ae_audio_buffer_t inputs[ENGINES];
+  ae_audio_buffer_t outputs[ENGINES];
+  for (size_t e = 0; e < ENGINES; ++e) {
+    ae_test_generate_noise(in[e], FRAMES, 0.5f);
+    inputs[e] = (ae_audio_buffer_t){.samples = in[e], .frame_count = FRAMES,
+                                    .channels = 1, .interleaved = true};
+    outputs[e] =
+        (ae_audio_buffer_t){.samples = group_out[e], .frame_count = FRAMES,
+                            .channels = 2, .interleaved = true};
+  }
+
+  float max_diff = 0.0f;
+  for (int block = 0; block < 8; ++block) {
+    AE_ASSERT_EQ(ae_process_group(group, inputs, outputs, ENGINES), AE_OK);
+    for (size_t e = 0; e < ENGINES; ++e) {
+      ae_audio_buffer_t out = {.samples = solo_out, .frame_count = FRAMES,
+                               .channels = 2, .interleaved = true};
+      ae_process(solo[e], &inputs[e], &out);
+      for (size_t i = 0; i < 2 * FRAMES; ++i)
+        max_diff = fmaxf(max_diff, fabsf(group_out[e][i] - solo_out[i]));
+    }
+  }
+  AE_ASSERT(max_diff < 1e-5f);
+
+  outputs[3].frame_count = FRAMES / 2;
+  AE_ASSERT_EQ(ae_process_group(group, inputs, outputs, ENGINES),
+               AE_ERROR_INVALID_PARAM);
+  for (size_t e = 0; e < ENGINES; ++e) {
+    ae_destroy_engine(group[e]);
+    ae_destroy_engine(solo[e]);
+  }
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Multiple listeners
+ *============================================================================*/
+
+void test_listeners_match_separate_engines(void) {
+  /* One engine, three listeners, reverb on: each output equals a
+   * single-listener engine hearing the source from that direction */
+  enum { LISTENERS = 3, FRAMES = 256 };
+  static const float azimuths[LISTENERS] = {-60.0f, 0.0f, 90.0f};
+  ae_config_t config = ae_get_default_config();
+  config.listener_count = LISTENERS;
+  ae_engine_t *shared = ae_create_engine(&config);
+  AE_ASSERT_NOT_NULL(shared);
+  ae_load_preset(shared, "cathedral");
+  ae_engine_t *solo[LISTENERS];
+  ae_config_t solo_config = ae_get_default_config();
+  for (uint32_t l = 0; l < LISTENERS; ++l) {
+    AE_ASSERT_EQ(ae_set_listener_source_position(shared, l, azimuths[l],
+                                                 0.0f),
+                 AE_OK);
+    solo[l] = ae_create_engine(&solo_config);
+    AE_ASSERT_NOT_NULL(solo[l]);
+    ae_load_preset(solo[l], "cathedral");
+    ae_set_source_position(solo[l], azimuths[l], 0.0f);
+  }
+
+  static float in[FRAMES];
+  static float out[LISTENERS][2 * FRAMES];
+  float solo_out[2 * FRAMES];
+  ae_audio_buffer_t input = {.samples = in, .frame_count = FRAMES,
+                             .channels = 1, .interleaved = true};
+  ae_audio_buffer_t outputs[LISTENERS];
+  for (uint32_t l = 0; l < LISTENERS; ++l)
+    outputs[l] = (ae_audio_buffer_t){.samples = out[l], .frame_count = FRAMES,
+                                     .channels = 2, .interleaved = true};
+
+  float max_diff = 0.0f;
+  float level = 0.0f;
+  for (int block = 0; block < 8; ++block) {
+    ae_test_generate_noise(in, FRAMES, 0.5f);
+    AE_ASSERT_EQ(ae_process_listeners(shared, &input, outputs, LISTENERS),
+                 AE_OK);
+    for (uint32_t l = 0; l < LISTENERS; ++l) {
+      ae_audio_buffer_t solo_buf = {.samples = solo_out,
+                                    .frame_count = FRAMES, .channels = 2,
+                                    .interleaved = true};
+      ae_process(solo[l], &input, &solo_buf);
+      for (size_t i = 0; i < 2 * FRAMES; ++i) {
+        max_diff = fmaxf(max_diff, fabsf(out[l][i] - solo_out[i]));
+        level = fmaxf(level, fabsf(solo_out[i]));
+      }
+    }
+  }
+  AE_ASSERT(level > 0.01f);
+  AE_ASSERT(max_diff < 1e-5f);
+  for (uint32_t l = 0; l < LISTENERS; ++l)
+    ae_destroy_engine(solo[l]);
+  ae_destroy_engine(shared);
+  AE_TEST_PASS();
+}
+
+void test_listeners_reject_bad_args(void) {
+  ae_config_t config = ae_get_default_config();
+  config.listener_count = AE_MAX_LISTENERS + 1;
+  AE_ASSERT_NULL(ae_create_engine(&config));
+
+  config.listener_count = 2;
+  ae_engine_t *engine = ae_create_engine(&config);
+  AE_ASSERT_NOT_NULL(engine);
+  AE_ASSERT_EQ(ae_set_listener_source_position(engine, 2, 0.0f, 0.0f),
+               AE_ERROR_INVALID_PARAM);
+  float out_buf[3][128];
+  ae_audio_buffer_t outputs[3];
+  for (int l = 0; l < 3; ++l)
+    outputs[l] = (ae_audio_buffer_t){.samples = out_buf[l], .frame_count = 64,
+                                     .channels = 2, .interleaved = true};
+  AE_ASSERT_EQ(ae_process_listeners(engine, NULL, outputs, 3),
+               AE_ERROR_INVALID_PARAM);
+  outputs[1].frame_count = 32;
+  AE_ASSERT_EQ(ae_process_listeners(engine, NULL, outputs, 2),
+               AE_ERROR_INVALID_PARAM);
+  outputs[1].frame_count = 64;
+  AE_ASSERT_EQ(ae_process_listeners(engine, NULL, outputs, 2), AE_OK);
+  ae_destroy_engine(engine);
+  AE_TEST_PASS();
+}
+
+/*============================================================================
+ * Main
+ *============================================================================*/
+
+int main(void) {
+  printf("Acoustic Engine - Spatial Tests\n");
+
+  AE_TEST_SUITE_BEGIN("Partitioned HRIR Convolution");
+  AE_RUN_TEST(test_convolver_matches_direct);
+  AE_RUN_TEST(test_convolver_partition_sizes);
+  AE_RUN_TEST(test_convolver_odd_blocks);
+  AE_RUN_TEST(test_convolver_zero_latency);
+  AE_RUN_TEST(test_convolver_in_place);
+  AE_RUN_TEST(test_convolver_rejects_bad_config);
+  AE_RUN_TEST(test_convolver_crossfade);
+  AE_RUN_TEST(test_convolver_switch_matches_direct);
+  AE_RUN_TEST(test_convolver_group_matches_single);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Ambisonics");
+  AE_RUN_TEST(test_ambisonic_gains);
+  AE_RUN_TEST(test_ambisonic_decode_direction);
+  AE_RUN_TEST(test_ambisonic_many_sources);
+  AE_RUN_TEST(test_ambisonic_rotation);
+  AE_RUN_TEST(test_ambisonic_gain_ramp);
+  AE_RUN_TEST(test_ambisonic_rejects_bad_config);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Built-in HRTF");
+  AE_RUN_TEST(test_default_hrtf_lateral);
+  AE_RUN_TEST(test_default_hrtf_symmetry);
+  AE_RUN_TEST(test_hrtf_cache_missing_source);
+  AE_RUN_TEST(test_hrtf_lazy_load_matches_preload);
+  AE_RUN_TEST(test_default_binaural_is_parametric);
+  AE_RUN_TEST(test_hrtf_load_async_callback);
+  AE_RUN_TEST(test_hrtf_db_shared);
+  AE_RUN_TEST(test_hrtf_builtin_db_expanded_once);
+  AE_RUN_TEST(test_hrtf_db_rejects_mismatch);
+  AE_RUN_TEST(test_process_group_matches_process);
+  AE_TEST_SUITE_END();
+
+  AE_TEST_SUITE_BEGIN("Multiple Listeners");
+  AE_RUN_TEST(test_listeners_match_separate_engines);
+  AE_RUN_TEST(test_listeners_reject_bad_args);
+  AE_TEST_SUITE_END();
+
+  return ae_test_report();
+}
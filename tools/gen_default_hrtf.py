@@ -0,0 +1,203 @@
+"""
+Generate src/ae_hrtf_default.c, the built-in HRIR set.
+
+The set comes from the Brown-Duda structural model (IEEE Trans. Speech and
+Audio Processing 6(5), 1998): a rigid-sphere head shadow per ear, Woodworth
+interaural delays and five pinna echoes whose delays depend on direction.
+Each response is converted to minimum phase through the real cepstrum,
+truncated with a short fade-out and quantized to int16. The pure onset
+delay of each ear is stored separately, in 1/256 samples, so the engine
+can fold it back in. Only the left ear is stored; the model is
+left/right symmetric, so the right ear is the left ear at the mirrored
+azimuth.
+
+Usage:
+  python tools/gen_default_hrtf.py > src/ae_hrtf_default.c
+"""
+
+import cmath
+import math
+
+RATE = 48000
+TAPS = 32
+FADE = 8             # Half-Hann fade over the last taps
+STEP_DEG = 15
+AZ_COUNT = 360 // STEP_DEG
+EL_COUNT = 180 // STEP_DEG + 1
+FFT_SIZE = 512
+TAP_SCALE = 4096     # int16 = tap * TAP_SCALE
+DELAY_SCALE = 256    # uint16 = delay (samples) * DELAY_SCALE
+
+HEAD_RADIUS = 0.0875
+SPEED_OF_SOUND = 343.0
+EAR_AZ_DEG = -100.0  # Left ear, slightly behind the interaural axis
+ALPHA_MIN = 0.1
+THETA_MIN_DEG = 150.0
+
+# Pinna echoes: reflection, delay (samples at 44.1 kHz) = A cos(az/2)
+# sin(D (90 - el)) + B
+PINNA_RHO = [0.5, -1.0, 0.5, -0.25, 0.25]
+PINNA_A = [1.0, 5.0, 5.0, 5.0, 5.0]
+PINNA_B = [2.0, 4.0, 7.0, 11.0, 13.0]
+PINNA_D = [1.0, 0.5, 0.5, 0.5, 0.5]
+
+
+def fft(x, inverse=False):
+    n = len(x)
+    if n == 1:
+        return list(x)
+    even = fft(x[0::2], inverse)
+    odd = fft(x[1::2], inverse)
+    sign = 1.0 if inverse else -1.0
+    out = [0j] * n
+    for k in range(n // 2):
+        t = cmath.exp(sign * 2j * math.pi * k / n) * odd[k]
+        out[k] = even[k] + t
+        out[k + n // 2] = even[k] - t
+    return out
+
+
+def ifft(x):
+    return [v / len(x) for v in fft(x, inverse=True)]
+
+
+def direction(az_deg, el_deg):
+    """Engine angles (positive azimuth to the right) to x front, y left."""
+    az = math.radians(-az_deg)
+    el = math.radians(el_deg)
+    return (math.cos(el) * math.cos(az), math.cos(el) * math.sin(az),
+            math.sin(el))
+
+
+def left_ear_response(az_deg, el_deg):
+    """Magnitude at each FFT bin and the onset delay in samples."""
+    src = direction(az_deg, el_deg)
+    ear = direction(EAR_AZ_DEG, 0.0)
+    cos_theta = max(-1.0, min(1.0, sum(a * b for a, b in zip(src, ear))))
+    theta = math.acos(cos_theta)  # Angle of incidence at the ear
+
+    alpha = (1.0 + ALPHA_MIN / 2.0) + (1.0 - ALPHA_MIN / 2.0) * math.cos(
+        theta / math.radians(THETA_MIN_DEG) * math.pi)
+    w0 = SPEED_OF_SOUND / HEAD_RADIUS
+
+    # Woodworth path difference, offset so the earliest arrival is 0
+    a_c = HEAD_RADIUS / SPEED_OF_SOUND
+    if theta < math.pi / 2.0:
+        delay_s = a_c - a_c * math.cos(theta)
+    else:
+        delay_s = a_c + a_c * (theta - math.pi / 2.0)
+
+    # Pinna model is defined for the front hemisphere; fold the rear onto it
+    # and fade the azimuth term out toward the poles
+    az = (az_deg + 180.0) % 360.0 - 180.0
+    if abs(az) > 90.0:
+        az = math.copysign(180.0 - abs(az), az)
+    pinna_az = math.radians(az) * math.cos(math.radians(el_deg))
+    pinna_el = math.radians(90.0 - el_deg)
+    echoes = []
+    for rho, a, b, d in zip(PINNA_RHO, PINNA_A, PINNA_B, PINNA_D):
+        tau = a * math.cos(pinna_az / 2.0) * math.sin(d * pinna_el) + b
+        echoes.append((rho, tau / 44100.0))
+
+    mags = []
+    for k in range(FFT_SIZE):
+        f = k if k <= FFT_SIZE // 2 else k - FFT_SIZE
+        w = 2.0 * math.pi * f * RATE / FFT_SIZE
+        shadow = (1.0 + 1j * alpha * w / (2.0 * w0)) / (1.0 + 1j * w /
+                                                       (2.0 * w0))
+        pinna = 1.0 + sum(rho * cmath.exp(-1j * w * t) for rho, t in echoes)
+        mags.append(abs(shadow * pinna))  # Unity at DC
+    return mags, delay_s * RATE
+
+
+def minimum_phase(mags):
+    """Real-cepstrum minimum-phase impulse response for a magnitude."""
+    n = len(mags)
+    log_mag = [complex(math.log(max(m, 1e-6)), 0.0) for m in mags]
+    cep = ifft(log_mag)
+    folded = [0j] * n
+    folded[0] = cep[0]
+    folded[n // 2] = cep[n // 2]
+    for k in range(1, n // 2):
+        folded[k] = 2.0 * cep[k]
+    spectrum = [cmath.exp(v) for v in fft(folded)]
+    return [v.real for v in ifft(spectrum)]
+
+
+def main():
+    taps = []
+    delays = []
+    for e in range(EL_COUNT):
+        el = -90.0 + e * STEP_DEG
+        row_taps = []
+        row_delays = []
+        for a in range(AZ_COUNT):
+            az = a * STEP_DEG
+            mags, delay = left_ear_response(az, el)
+            ir = minimum_phase(mags)[:TAPS]
+            for i in range(FADE):
+                ir[TAPS - FADE + i] *= 0.5 * (1.0 + math.cos(
+                    math.pi * (i + 1) / (FADE + 1)))
+            row_taps.append([int(round(max(-32767, min(32767, v * TAP_SCALE))))
+                             for v in ir])
+            row_delays.append(int(round(delay * DELAY_SCALE)))
+        taps.append(row_taps)
+        delays.append(row_delays)
+
+    print("/**")
+    print(" * @file ae_hrtf_default.c")
+    print(" * @brief Built-in HRIR set (generated by tools/gen_default_hrtf.py)")
+    print(" *")
+    print(" * Brown-Duda structural model, minimum phase, %d taps at %d Hz on a"
+          % (TAPS, RATE))
+    print(" * %d-degree grid. Left ear only; do not edit by hand." % STEP_DEG)
+    print(" */")
+    print()
+    print('#include "ae_internal.h"')
+    print()
+    print("const int16_t ae_hrtf_default_taps[AE_HRTF_DEFAULT_EL]"
+          "[AE_HRTF_DEFAULT_AZ]")
+    print("                                   [AE_HRTF_DEFAULT_TAPS] = {")
+    for e in range(EL_COUNT):
+        print("    /* Elevation %d */" % (-90 + e * STEP_DEG))
+        print("    {")
+        for a in range(AZ_COUNT):
+            values = taps[e][a]
+            lines = []
+            line = "        {"
+            for i, v in enumerate(values):
+                item = "%d" % v + ("," if i + 1 < len(values) else "}")
+                if i + 1 == len(values) and a + 1 < AZ_COUNT:
+                    item += ","
+                if len(line) + 1 + len(item) > 80:
+                    lines.append(line)
+                    line = "         " + item
+                else:
+                    line += ("" if line.endswith("{") else " ") + item
+            lines.append(line)
+            print("\n".join(lines))
+        print("    }%s" % ("," if e + 1 < EL_COUNT else ""))
+    print("};")
+    print()
+    print("const uint16_t ae_hrtf_default_delays[AE_HRTF_DEFAULT_EL]")
+    print("                                     [AE_HRTF_DEFAULT_AZ] = {")
+    for e in range(EL_COUNT):
+        values = delays[e]
+        lines = []
+        line = "    {"
+        for i, v in enumerate(values):
+            item = "%d" % v + ("," if i + 1 < len(values) else "}")
+            if i + 1 == len(values) and e + 1 < EL_COUNT:
+                item += ","
+            if len(line) + 1 + len(item) > 80:
+                lines.append(line)
+                line = "     " + item
+            else:
+                line += ("" if line.endswith("{") else " ") + item
+        lines.append(line)
+        print("\n".join(lines))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()